@@ -38,8 +38,22 @@ extern "C"
         uint32_t totalCommandCRCErrors;//how many commands return a CRC error
         uint32_t totalBufferComparisons;//how many write-read buffer, then compare the two have been done in the test;
         uint32_t totalBufferMiscompares;//how many times did the buffer miscompare.
+        uint64_t totalBitsCompared;//total number of bits read back and compared against the pattern. Use with totalBitErrors to get a bit error rate
+        uint64_t totalBitErrors;//total number of bits that flipped between the write buffer and read buffer commands
+        uint32_t bitErrorsByBitPosition[8];//flipped bit count for each bit (0 - 7) of a byte. A single position with most of the errors points to a stuck data line
+        bool miscompareOffsetValid;//set when at least one miscompare was seen and firstMiscompareOffset is valid
+        uint32_t firstMiscompareOffset;//byte offset in the buffer of the first flipped bit seen during this test
     }patternTestResults, *ptrPatternTestResults;
 
+    typedef struct _bufferCompareResult
+    {
+        uint64_t bitErrors;//number of bits that differ between the two buffers
+        uint32_t bytesInError;//number of bytes with at least one flipped bit
+        uint32_t firstErrorOffset;//byte offset of the first miscompare. Only valid when bitErrors is non-zero
+        uint32_t lastErrorOffset;//byte offset of the last miscompare. Only valid when bitErrors is non-zero
+        uint32_t bitErrorsByBitPosition[8];//flipped bit count for each bit (0 - 7) of a byte
+    }bufferCompareResult, *ptrBufferCompareResult;
+
     typedef struct _cableTestResults
     {
         uint64_t totalTestTimeNS;
@@ -53,10 +67,102 @@ extern "C"
         patternTestResults randomTest[RANDOM_TEST_COUNT];
     }cableTestResults, *ptrCableTestResults;
 
+    #define LINK_STRESS_MAX_ERROR_INTERVALS 64
+
+    typedef struct _linkStressOptions
+    {
+        uint32_t timeLimitSeconds;//stop after this many seconds. 0 = no time limit
+        uint64_t byteLimit;//stop after commands for this many bytes have been sent in both directions, whether they completed or not. 0 = no byte limit. At least one limit must be set.
+        bool randomPatterns;//generate a new random pattern for every transfer instead of cycling through the fixed byte patterns
+    }linkStressOptions, *ptrLinkStressOptions;
+
+    typedef struct _linkStressResults
+    {
+        uint32_t bufferSize;//transfer size used for each write buffer and read buffer command
+        uint64_t bytesTransferred;//bytes moved in both directions by write/read pairs that both completed
+        patternTestResults totals;//command, CRC, timeout, and bit error counts for the whole run
+        uint32_t errorEvents;//transfers that had a CRC error, timeout, failure, or miscompare
+        bool firstErrorValid;
+        uint64_t timeToFirstErrorNS;//time from the start of the test to the first error event
+        uint32_t errorIntervalCount;//number of entries in errorIntervalNS
+        uint64_t errorIntervalNS[LINK_STRESS_MAX_ERROR_INTERVALS];//time between each error event and the previous one (or the start of the test for the first). Only the first LINK_STRESS_MAX_ERROR_INTERVALS are kept
+    }linkStressResults, *ptrLinkStressResults;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  fill_Buffer_Test_Pattern(uint8_t *buffer, uint32_t bufferSize, uint32_t pattern)
+    //
+    //! \brief   Description: Fills a buffer with a repeating 32bit pattern, a full vector register at a time when SSE2/AVX2 are available.
+    //!                        The pattern is stored in host byte order, matching what fill_Pattern_Buffer_Into_Another_Buffer would write.
+    //
+    //  Entry:
+    //!   \param[out] buffer = pointer to the buffer to fill
+    //!   \param[in] bufferSize = size of the buffer in bytes. Does not need to be a multiple of 4
+    //!   \param[in] pattern = 32bit pattern to repeat through the buffer
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API void fill_Buffer_Test_Pattern(uint8_t *buffer, uint32_t bufferSize, uint32_t pattern);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  compare_Buffer_Test_Data(const uint8_t *expected, const uint8_t *received, uint32_t bufferSize, ptrBufferCompareResult result)
+    //
+    //! \brief   Description: XOR's the two buffers and counts how many bits flipped and where. Matching data is skipped a vector at a time,
+    //!                        so the cost of a clean transfer is about the same as memcmp.
+    //
+    //  Entry:
+    //!   \param[in] expected = pointer to the pattern that was sent to the device
+    //!   \param[in] received = pointer to the data that was read back from the device
+    //!   \param[in] bufferSize = size of both buffers in bytes
+    //!   \param[out] result = pointer to a structure to hold the comparison results. This is cleared before comparing.
+    //!
+    //  Exit:
+    //!   \return true = buffers match, false = at least one bit is different
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API bool compare_Buffer_Test_Data(const uint8_t *expected, const uint8_t *received, uint32_t bufferSize, ptrBufferCompareResult result);
+
     int perform_Cable_Test(tDevice *device, ptrCableTestResults testResults);
 
     void print_Cable_Test_Results(cableTestResults testResults);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  perform_Link_Stress_Test(tDevice *device, ptrLinkStressOptions options, ptrLinkStressResults results)
+    //
+    //! \brief   Description: Keeps the link saturated with back to back write buffer/read buffer commands at the device's buffer size
+    //!                        until the time or byte limit is reached. Every transfer is compared and CRC errors are checked so that
+    //!                        marginal links that pass the short cable test can still be caught.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in] options = pointer to the limits and pattern selection for the test. At least one limit must be non-zero.
+    //!   \param[out] results = pointer to a structure to hold the results. This is cleared at the start of the test.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = test ran to its limit, NOT_SUPPORTED = buffer commands not supported, BAD_PARAMETER = no limit set, !SUCCESS means something went wrong
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int perform_Link_Stress_Test(tDevice *device, ptrLinkStressOptions options, ptrLinkStressResults results);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_Link_Stress_Test_Results(ptrLinkStressResults results)
+    //
+    //! \brief   Description: Prints throughput, CRC errors per GB, bit error rate, and the time to first error distribution from a link stress test
+    //
+    //  Entry:
+    //!   \param[in] results = pointer to the results from perform_Link_Stress_Test
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API void print_Link_Stress_Test_Results(ptrLinkStressResults results);
+
 #if defined (__cplusplus)
 }
 #endif
\ No newline at end of file
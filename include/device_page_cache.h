@@ -0,0 +1,241 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file device_page_cache.h
+// \brief This file defines the functions for sharing identify and inquiry/VPD data and learned transfer sizes between operations on the same device
+
+#pragma once
+
+#include "operations_Common.h"
+
+#if defined (__cplusplus)
+extern "C"
+{
+#endif
+
+    //The functions below work like the transport commands they are named after, except that the data read from each device is kept in memory.
+    //Later calls for the same page on the same device are answered from memory without sending a command.
+    //Anything that changes what a drive reports in this data (format, sanitize, set sector size, firmware activation, set max LBA, changing a
+    //setting that shows up in identify data) must call invalidate_Device_Page_Cache when it is done. The operations in this library already do.
+    //The cache is held for the whole process, keyed on the tDevice pointer and the serial number. Closing a device does not release it (that is done
+    //by opensea-transport, which knows nothing about this cache), so call release_Device_Page_Cache(device) before closing each device, or
+    //release_Device_Page_Cache(NULL) once all devices are closed. Otherwise the memory is held until the process exits.
+    //These are safe to call from more than one thread, but each device should only be used by one thread at a time (like any other command).
+
+    //-----------------------------------------------------------------------------
+    //
+    //  scsi_Inquiry_Cached(tDevice *device, uint8_t *pDataBuf, uint32_t dataLength, uint8_t pageCode, bool evpd)
+    //
+    //! \brief   Description: Same as scsi_Inquiry (without CmdDt). Standard inquiry data and VPD pages are kept after the first read.
+    //!                        If a longer read of a page is requested than what is kept, the page is read from the drive again.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[out] pDataBuf = buffer to fill with the inquiry data
+    //!   \param[in] dataLength = number of bytes to read
+    //!   \param[in] pageCode = VPD page to read. Must be 0 when evpd is false
+    //!   \param[in] evpd = set to true to read a VPD page, false for standard inquiry data
+    //!
+    //  Exit:
+    //!   \return SUCCESS = data returned, BAD_PARAMETER, anything else = the return value of scsi_Inquiry
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int scsi_Inquiry_Cached(tDevice *device, uint8_t *pDataBuf, uint32_t dataLength, uint8_t pageCode, bool evpd);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  ata_Identify_Cached(tDevice *device, uint8_t *ptrData, uint32_t dataSize)
+    //
+    //! \brief   Description: Same as ata_Identify. The identify data is kept after the first read.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[out] ptrData = buffer to fill with the identify data
+    //!   \param[in] dataSize = size of ptrData. Should be LEGACY_DRIVE_SEC_SIZE
+    //!
+    //  Exit:
+    //!   \return SUCCESS = data returned, BAD_PARAMETER, anything else = the return value of ata_Identify
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int ata_Identify_Cached(tDevice *device, uint8_t *ptrData, uint32_t dataSize);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  ata_Read_Log_Directory_Cached(tDevice *device, bool gpl, uint8_t *ptrData, uint32_t dataSize)
+    //
+    //! \brief   Description: Reads the GPL log directory (read log ext) or the SMART log directory (SMART read log). Each directory is kept after the first read.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in] gpl = set to true for the GPL directory, false for the SMART directory
+    //!   \param[out] ptrData = buffer to fill with the directory
+    //!   \param[in] dataSize = size of ptrData. Should be LEGACY_DRIVE_SEC_SIZE
+    //!
+    //  Exit:
+    //!   \return SUCCESS = data returned, BAD_PARAMETER, anything else = the return value of the read log command
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int ata_Read_Log_Directory_Cached(tDevice *device, bool gpl, uint8_t *ptrData, uint32_t dataSize);
+
+#if !defined (DISABLE_NVME_PASSTHROUGH)
+    //-----------------------------------------------------------------------------
+    //
+    //  nvme_Identify_Cached(tDevice *device, uint8_t *ptrData, uint32_t nvmeNamespace, uint32_t cns)
+    //
+    //! \brief   Description: Same as nvme_Identify. Each CNS and namespace combination is kept after the first read.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[out] ptrData = buffer to fill with the identify data. Must be NVME_IDENTIFY_DATA_LEN bytes
+    //!   \param[in] nvmeNamespace = namespace ID
+    //!   \param[in] cns = controller or namespace structure to read
+    //!
+    //  Exit:
+    //!   \return SUCCESS = data returned, BAD_PARAMETER, anything else = the return value of nvme_Identify
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int nvme_Identify_Cached(tDevice *device, uint8_t *ptrData, uint32_t nvmeNamespace, uint32_t cns);
+#endif
+
+    //The largest transfer each kind of command can use on a device is learned as logs are pulled and firmware is downloaded. Some drives, and many USB bridges, reject
+    //transfers over some size. A read that fails because of its size is retried halfway between the largest size that has worked and the size that failed, so
+    //the limit is found in a few commands. What was learned is kept when the pages are invalidated, and is only dropped by release_Device_Page_Cache,
+    //reset_Device_Transfer_Sizes, or when a different drive shows up on the same tDevice.
+    #define TRANSFER_SIZE_GRANULARITY LEGACY_DRIVE_SEC_SIZE //transfer sizes are always a multiple of this
+
+    typedef enum _eTransferSizeCommand
+    {
+        TRANSFER_SIZE_ATA_READ_LOG_EXT,
+        TRANSFER_SIZE_SCSI_READ_BUFFER,//read buffer 10 and 16 (error history and internal status log)
+        TRANSFER_SIZE_FIRMWARE_DOWNLOAD,//segments of a firmware download (download microcode, write buffer, NVMe firmware image download)
+        TRANSFER_SIZE_COMMAND_COUNT//must be last
+    }eTransferSizeCommand;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Device_Transfer_Size(tDevice *device, eTransferSizeCommand command, uint32_t maximumSize)
+    //
+    //! \brief   Description: Gets the transfer size to start a pull with. Until a command has failed on the device this is maximumSize.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in] command = the command the transfer size is for
+    //!   \param[in] maximumSize = largest transfer size the caller wants to use. Should be a multiple of TRANSFER_SIZE_GRANULARITY
+    //!
+    //  Exit:
+    //!   \return transfer size in bytes. Never less than TRANSFER_SIZE_GRANULARITY
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API uint32_t get_Device_Transfer_Size(tDevice *device, eTransferSizeCommand command, uint32_t maximumSize);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  is_Transfer_Size_Failure(tDevice *device, int commandResult)
+    //
+    //! \brief   Description: Checks if a failed command looks like it was turned down because of its transfer length. That is an OS or
+    //!                        driver failure, or ILLEGAL REQUEST with INVALID FIELD IN CDB. Aborts, busy, and medium errors are not.
+    //!                        Only call reduce_Device_Transfer_Size when this is true so other failures are not learned as size limits.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to the device the command was sent to. The last command's sense data is checked
+    //!   \param[in] commandResult = return value of the command that failed
+    //!
+    //  Exit:
+    //!   \return true = the failure may be caused by the transfer size, false = it isn't
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API bool is_Transfer_Size_Failure(tDevice *device, int commandResult);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  reduce_Device_Transfer_Size(tDevice *device, eTransferSizeCommand command, uint32_t failedSize)
+    //
+    //! \brief   Description: Call when a command fails because of its size (see is_Transfer_Size_Failure) to remember the size that failed and get a smaller size to retry with.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in] command = the command that failed
+    //!   \param[in] failedSize = transfer size of the command that failed
+    //!
+    //  Exit:
+    //!   \return transfer size to retry with. 0 means the failure was not caused by the transfer size (it was already as small as it
+    //!            can be, or the same size has already worked on this device) so there is no point retrying.
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API uint32_t reduce_Device_Transfer_Size(tDevice *device, eTransferSizeCommand command, uint32_t failedSize);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  confirm_Device_Transfer_Size(tDevice *device, eTransferSizeCommand command, uint32_t transferSize)
+    //
+    //! \brief   Description: Call when a command succeeds to remember that the device took a transfer of this size.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in] command = the command that succeeded
+    //!   \param[in] transferSize = transfer size of the command that succeeded
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API void confirm_Device_Transfer_Size(tDevice *device, eTransferSizeCommand command, uint32_t transferSize);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  reset_Device_Transfer_Sizes(tDevice *device)
+    //
+    //! \brief   Description: Forgets the transfer sizes learned for a device so the next pull starts from the largest size again.
+    //!                        Use this when the path to the drive has changed (different adapter or driver) or a limit was learned by mistake.
+    //
+    //  Entry:
+    //!   \param[in] device = device to forget the transfer sizes of. NULL forgets them for every device
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API void reset_Device_Transfer_Sizes(tDevice *device);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  invalidate_Device_Page_Cache(tDevice *device)
+    //
+    //! \brief   Description: Throws away the pages kept for a device so the next read of each page goes to the drive.
+    //!                        Learned transfer sizes are kept. Use release_Device_Page_Cache to free everything.
+    //
+    //  Entry:
+    //!   \param[in] device = device to forget. NULL forgets every device
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API void invalidate_Device_Page_Cache(tDevice *device);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  release_Device_Page_Cache(tDevice *device)
+    //
+    //! \brief   Description: Frees everything kept for a device. Call this before closing the device.
+    //
+    //  Entry:
+    //!   \param[in] device = device being closed. NULL releases every device
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API void release_Device_Page_Cache(tDevice *device);
+
+#if defined (__cplusplus)
+}
+#endif
@@ -295,8 +295,90 @@ extern "C"
 
     OPENSEA_OPERATIONS_API int get_DeviceStatistics(tDevice *device, ptrDeviceStatistics deviceStats);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  update_DeviceStatistics(tDevice *device, ptrDeviceStatistics deviceStats)
+    //
+    //! \brief   Description: Refreshes statistics from an earlier get_DeviceStatistics call. Use this when polling.
+    //!                        This is a refresh, not a change-only read: neither ATA nor SCSI reports which statistics changed, so every value is read again.
+    //!                        ATA: the whole device statistics log is read again, the same as get_DeviceStatistics.
+    //!                        SCSI: the supported log pages list and the threshold pages are not read again. Only the cumulative values of the pages
+    //!                        found by the full read are, and the threshold values from the full read are compared against the new values.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in,out] deviceStats = statistics from get_DeviceStatistics. If nothing is populated yet, a full get_DeviceStatistics is done instead.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = statistics refreshed, NOT_SUPPORTED = nothing could be read, BAD_PARAMETER, MEMORY_FAILURE
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int update_DeviceStatistics(tDevice *device, ptrDeviceStatistics deviceStats);
+
     OPENSEA_OPERATIONS_API int print_DeviceStatistics(tDevice *device, ptrDeviceStatistics deviceStats);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  find_Device_Statistic(tDevice *device, ptrDeviceStatistics deviceStats, const char *statisticName)
+    //
+    //! \brief   Description: Finds a statistic by the same name print_DeviceStatistics shows for it (ex: "Power-On Hours", "Current Temperature").
+    //!                        If a name is used on more than one page, the first one printed is returned.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure. Used to know whether deviceStats holds ATA or SCSI statistics
+    //!   \param[in] deviceStats = statistics from get_DeviceStatistics
+    //!   \param[in] statisticName = name of the statistic to find
+    //!
+    //  Exit:
+    //!   \return pointer to the statistic in deviceStats, or NULL if the name is not known for this drive type
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API statistic* find_Device_Statistic(tDevice *device, ptrDeviceStatistics deviceStats, const char *statisticName);
+
+    //Where a statistic's value is in the raw log, for decoding a log buffer without filling in a deviceStatistics structure
+    typedef struct _statisticDescription
+    {
+        const char *name;//same name print_DeviceStatistics shows
+        const char *unit;//NULL for no unit
+        uint8_t valueOffset;//ATA: always 0 (the low byte of the statistic qword). SCSI: offset from the start of the parameter, including the 4 byte parameter header
+        uint8_t valueLength;//ATA: number of low bytes of the qword that hold the value (little endian). SCSI: big endian length. 0 = the whole parameter when it is 1, 2, 4, or 8 bytes long
+    }statisticDescription, *ptrStatisticDescription;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  describe_ATA_Statistic(uint8_t logPage, uint16_t byteOffset, ptrStatisticDescription description)
+    //
+    //! \brief   Description: Looks up a statistic in the ATA device statistics log by page and byte offset in the page
+    //
+    //  Entry:
+    //!   \param[in] logPage = page of the device statistics log
+    //!   \param[in] byteOffset = offset of the statistic's qword in the page
+    //!   \param[out] description = filled in when the statistic is known
+    //!
+    //  Exit:
+    //!   \return true = statistic is known, false = not a statistic this code knows about
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API bool describe_ATA_Statistic(uint8_t logPage, uint16_t byteOffset, ptrStatisticDescription description);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  describe_SCSI_Statistic(uint8_t pageCode, uint8_t subpageCode, uint16_t parameterCode, ptrStatisticDescription description)
+    //
+    //! \brief   Description: Looks up a statistic by SCSI log page, subpage and parameter code
+    //
+    //  Entry:
+    //!   \param[in] pageCode = log page
+    //!   \param[in] subpageCode = log subpage
+    //!   \param[in] parameterCode = parameter code in the page
+    //!   \param[out] description = filled in when the statistic is known
+    //!
+    //  Exit:
+    //!   \return true = statistic is known, false = not a statistic this code knows about
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API bool describe_SCSI_Statistic(uint8_t pageCode, uint8_t subpageCode, uint16_t parameterCode, ptrStatisticDescription description);
+
 #if defined (__cplusplus)
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,161 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file device_statistics_history.h
+// \brief This file defines the functions for recording device statistics over time into a fixed size history file
+
+#pragma once
+
+#include "operations_Common.h"
+#include "device_statistics.h"
+#include "file_mapping.h"
+
+#if defined (__cplusplus)
+extern "C"
+{
+#endif
+
+    #define DEVICE_STATISTICS_HISTORY_MAX_COLUMNS 16
+    #define DEVICE_STATISTICS_HISTORY_COLUMN_NAME_LENGTH 64 //including the NULL terminator
+    #define DEVICE_STATISTICS_HISTORY_BLOCK_SIZE 4096
+    #define DEVICE_STATISTICS_HISTORY_VALUE_NOT_AVAILABLE UINT64_MAX //statistic was not supported or not valid when the sample was taken
+
+    //The history file is a header followed by a ring of fixed size blocks. Once every block is used, the oldest block is reused.
+    //Each block holds one column of timestamps and one column per statistic. The first sample in a block is stored as-is and every
+    //sample after it is stored as the difference from the previous sample (zigzag varint), so slow moving counters and temperatures
+    //take about a byte each. Each block also records its first and last timestamp so range reads skip blocks without decoding them.
+    //Use the functions below instead of changing this structure directly.
+    typedef struct _statisticsHistory
+    {
+        mappedFile historyFile;//the whole file is mapped, so reading a range only pages in the blocks it decodes
+        char serialNumber[SERIAL_NUM_LEN + 1];//which drive this history belongs to
+        uint32_t columnCount;
+        char columnNames[DEVICE_STATISTICS_HISTORY_MAX_COLUMNS][DEVICE_STATISTICS_HISTORY_COLUMN_NAME_LENGTH];//print_DeviceStatistics names
+        uint32_t blockCount;//number of blocks in the ring
+        uint32_t blocksUsed;
+        uint32_t oldestBlock;
+        uint32_t newestBlock;//block that samples are currently added to. Only valid when blocksUsed > 0
+        uint64_t nextSequence;
+        //state of the newest block so that adding a sample only has to encode that sample
+        uint32_t newestBlockSamples;
+        uint64_t newestBlockFirstTimestamp;
+        uint64_t lastValues[DEVICE_STATISTICS_HISTORY_MAX_COLUMNS + 1];//timestamp, then each column
+        uint16_t streamLength[DEVICE_STATISTICS_HISTORY_MAX_COLUMNS + 1];
+        uint8_t *streams;//(columnCount + 1) streams of DEVICE_STATISTICS_HISTORY_BLOCK_SIZE bytes each
+    }statisticsHistory, *ptrStatisticsHistory;
+
+    typedef struct _statisticsHistorySample
+    {
+        uint64_t timestamp;//seconds since the epoch
+        uint64_t values[DEVICE_STATISTICS_HISTORY_MAX_COLUMNS];//same order as the columns. DEVICE_STATISTICS_HISTORY_VALUE_NOT_AVAILABLE when not available
+    }statisticsHistorySample, *ptrStatisticsHistorySample;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  create_Device_Statistics_History(const char *fileName, const char *serialNumber, uint32_t columnCount, const char *columnNames[], uint32_t maxFileSize, ptrStatisticsHistory history)
+    //
+    //! \brief   Description: Creates (or replaces) a history file that records the chosen statistics. The file is sized up front and never grows.
+    //
+    //  Entry:
+    //!   \param[in] fileName = name of the history file to create
+    //!   \param[in] serialNumber = serial number of the drive this history is for
+    //!   \param[in] columnCount = number of statistics to record. 1 - DEVICE_STATISTICS_HISTORY_MAX_COLUMNS
+    //!   \param[in] columnNames = names of the statistics to record, as printed by print_DeviceStatistics (see find_Device_Statistic)
+    //!   \param[in] maxFileSize = size of the file in bytes. Must leave room for at least 2 blocks after the header. The whole file is mapped into memory, so a 32 bit build may not be able to open a file of more than a few hundred MiB.
+    //!   \param[out] history = pointer to the history to set up. Close with close_Device_Statistics_History
+    //!
+    //  Exit:
+    //!   \return SUCCESS = history ready to use, BAD_PARAMETER, MEMORY_FAILURE, FILE_OPEN_ERROR, FAILURE = could not write the file
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int create_Device_Statistics_History(const char *fileName, const char *serialNumber, uint32_t columnCount, const char *columnNames[], uint32_t maxFileSize, ptrStatisticsHistory history);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  open_Device_Statistics_History(const char *fileName, ptrStatisticsHistory history)
+    //
+    //! \brief   Description: Opens an existing history file so that more samples can be added to it or it can be read
+    //
+    //  Entry:
+    //!   \param[in] fileName = name of the history file
+    //!   \param[out] history = pointer to the history to set up. Close with close_Device_Statistics_History
+    //!
+    //  Exit:
+    //!   \return SUCCESS = history ready to use, BAD_PARAMETER, MEMORY_FAILURE, FILE_OPEN_ERROR, VALIDATION_FAILURE = not a history file or it is damaged
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int open_Device_Statistics_History(const char *fileName, ptrStatisticsHistory history);
+
+    OPENSEA_OPERATIONS_API void close_Device_Statistics_History(ptrStatisticsHistory history);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  add_Device_Statistics_History_Sample(tDevice *device, ptrStatisticsHistory history, ptrDeviceStatistics deviceStats, uint64_t timestamp)
+    //
+    //! \brief   Description: Adds one sample of the history's columns from already read device statistics. The sample is written to the file before returning.
+    //!                        Samples should be added in time order.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure. Used to know whether deviceStats holds ATA or SCSI statistics
+    //!   \param[in] history = open history
+    //!   \param[in] deviceStats = statistics from get_DeviceStatistics
+    //!   \param[in] timestamp = seconds since the epoch when the statistics were read
+    //!
+    //  Exit:
+    //!   \return SUCCESS = sample added, BAD_PARAMETER, FAILURE = could not write the file
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int add_Device_Statistics_History_Sample(tDevice *device, ptrStatisticsHistory history, ptrDeviceStatistics deviceStats, uint64_t timestamp);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  record_Device_Statistics_History(tDevice *device, ptrStatisticsHistory history, uint32_t intervalSeconds, uint32_t numberOfSamples)
+    //
+    //! \brief   Description: Reads the device statistics every intervalSeconds and adds a sample to the history each time.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in] history = open history
+    //!   \param[in] intervalSeconds = time between samples
+    //!   \param[in] numberOfSamples = number of samples to take. The function does not return until they are all taken.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = all samples taken, BAD_PARAMETER, NOT_SUPPORTED = device statistics could not be read, FAILURE = could not write the file
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int record_Device_Statistics_History(tDevice *device, ptrStatisticsHistory history, uint32_t intervalSeconds, uint32_t numberOfSamples);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  read_Device_Statistics_History(ptrStatisticsHistory history, uint64_t startTime, uint64_t endTime, ptrStatisticsHistorySample samples, uint32_t maxSamples, uint32_t *samplesFound)
+    //
+    //! \brief   Description: Reads back the samples taken between startTime and endTime (inclusive), oldest first.
+    //!                        Only the blocks that overlap the range are read and decoded.
+    //
+    //  Entry:
+    //!   \param[in] history = open history
+    //!   \param[in] startTime = seconds since the epoch. 0 for the oldest sample
+    //!   \param[in] endTime = seconds since the epoch. UINT64_MAX for the newest sample
+    //!   \param[out] samples = array to hold the samples
+    //!   \param[in] maxSamples = number of entries in samples
+    //!   \param[out] samplesFound = number of samples in the range. This can be more than maxSamples, but only maxSamples are written
+    //!
+    //  Exit:
+    //!   \return SUCCESS = range read, FAILURE = a block could not be read from the file, BAD_PARAMETER
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int read_Device_Statistics_History(ptrStatisticsHistory history, uint64_t startTime, uint64_t endTime, ptrStatisticsHistorySample samples, uint32_t maxSamples, uint32_t *samplesFound);
+
+    OPENSEA_OPERATIONS_API void print_Device_Statistics_History(ptrStatisticsHistory history, ptrStatisticsHistorySample samples, uint32_t numberOfSamples);
+
+#if defined (__cplusplus)
+}
+#endif
@@ -0,0 +1,92 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file drive_health.h
+// \brief This file defines the functions for gathering SMART, DST, defect and statistics health data in a single pass
+
+#pragma once
+
+#include "operations_Common.h"
+#include "smart.h"
+#include "dst.h"
+#include "device_statistics.h"
+
+#if defined (__cplusplus)
+extern "C"
+{
+#endif
+
+    //Sections that can be requested from get_Drive_Health_Snapshot. OR these together.
+    #define HEALTH_SNAPSHOT_SMART_STATUS        BIT0 //SMART return status and trip information
+    #define HEALTH_SNAPSHOT_SMART_ATTRIBUTES    BIT1 //ATA attributes + SMART feature info, or the NVMe SMART/Health log
+    #define HEALTH_SNAPSHOT_DST_LOG             BIT2 //DST log entries
+    #define HEALTH_SNAPSHOT_DEFECT_COUNTS       BIT3 //pending and grown defect counts
+    #define HEALTH_SNAPSHOT_DEVICE_STATISTICS   BIT4 //ATA device statistics log or SCSI statistics log pages
+    #define HEALTH_SNAPSHOT_ALL                 (HEALTH_SNAPSHOT_SMART_STATUS | HEALTH_SNAPSHOT_SMART_ATTRIBUTES | HEALTH_SNAPSHOT_DST_LOG | HEALTH_SNAPSHOT_DEFECT_COUNTS | HEALTH_SNAPSHOT_DEVICE_STATISTICS)
+
+    typedef struct _driveHealthSnapshot
+    {
+        uint32_t sectionsRequested;//HEALTH_SNAPSHOT_* flags that were asked for
+        uint32_t sectionsValid;//HEALTH_SNAPSHOT_* flags that were successfully read. A requested section that is not set here is not supported or failed to read.
+        int smartStatus;//SUCCESS = good, FAILURE = tripped, UNKNOWN = could not be determined
+        smartTripInfo tripInfo;//only filled in when smartStatus is FAILURE
+        //ATA/SCSI: attribute values with thresholds (ATA only)
+        smartAttributeSnapshot attributes;
+        smartFeatureInfo smartInfo;
+#if !defined(DISABLE_NVME_PASSTHROUGH)
+        nvmeSmartLog nvmeHealth;//NVMe SMART/Health log page. Only valid on NVMe drives
+#endif
+        dstLogEntries dstLog;
+        bool pendingCountValid;
+        uint32_t pendingCount;
+        bool grownCountValid;
+        uint32_t grownCount;
+        deviceStatistics deviceStats;
+    }driveHealthSnapshot, *ptrDriveHealthSnapshot;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Drive_Health_Snapshot(tDevice *device, uint32_t sections, ptrDriveHealthSnapshot snapshot)
+    //
+    //! \brief   Description: Gathers the requested health sections from a drive in one pass. Each log (SMART data, SMART thresholds,
+    //!                        device statistics, DST log) is read at most once and shared between the sections that need it,
+    //!                        instead of each of the individual get functions re-reading the same data.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in] sections = HEALTH_SNAPSHOT_* flags for the sections to read
+    //!   \param[out] snapshot = pointer to the structure to fill in. This is cleared first.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = at least one requested section was read (check sectionsValid), NOT_SUPPORTED = none of the requested sections could be read, BAD_PARAMETER = invalid pointer
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int get_Drive_Health_Snapshot(tDevice *device, uint32_t sections, ptrDriveHealthSnapshot snapshot);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_Drive_Health_Snapshot(tDevice *device, ptrDriveHealthSnapshot snapshot)
+    //
+    //! \brief   Description: Prints each valid section of a health snapshot
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in] snapshot = pointer to a snapshot from get_Drive_Health_Snapshot
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API void print_Drive_Health_Snapshot(tDevice *device, ptrDriveHealthSnapshot snapshot);
+
+#if defined (__cplusplus)
+}
+#endif
@@ -139,11 +139,161 @@ extern "C"
         uint32_t currentCapacityInSectors;//Word 57:58
     }legacyCHSInfo;
 
-    #define MAX_FEATURES UINT8_C(50) //change this number if we need to capture more feature support
-    #define MAX_FEATURE_LENGTH UINT8_C(50) //maximum number of characters to allow for use when storing feature names.
+    //Features are stored as bits so that checking for one is a bit test, not a string compare. Names are only looked up when printing (get_Drive_Feature_Name).
+    typedef enum _eDriveFeature
+    {
+        //ATA. TCG, SCSA, IEEE 1667 and Sanitize are also reported for SCSI and NVMe
+        DRIVE_FEATURE_TCG,
+        DRIVE_FEATURE_SCSA,
+        DRIVE_FEATURE_IEEE_1667,
+        DRIVE_FEATURE_SANITIZE,
+        DRIVE_FEATURE_SATA_NCQ,
+        DRIVE_FEATURE_SATA_NCQ_STREAMING,
+        DRIVE_FEATURE_SATA_REBUILD_ASSIST,
+        DRIVE_FEATURE_SATA_HYBRID_INFORMATION,
+        DRIVE_FEATURE_SATA_DEVICE_SLEEP,
+        DRIVE_FEATURE_SATA_SOFTWARE_SETTINGS_PRESERVATION,
+        DRIVE_FEATURE_SATA_HARDWARE_FEATURE_CONTROL,
+        DRIVE_FEATURE_SATA_IN_ORDER_DATA_DELIVERY,
+        DRIVE_FEATURE_SATA_DEVICE_INITIATED_POWER_MANAGEMENT,
+        DRIVE_FEATURE_HPA,
+        DRIVE_FEATURE_POWER_MANAGEMENT,
+        DRIVE_FEATURE_SECURITY,
+        DRIVE_FEATURE_SMART,
+        DRIVE_FEATURE_DCO,
+        DRIVE_FEATURE_48BIT_ADDRESS,
+        DRIVE_FEATURE_AAM,
+        DRIVE_FEATURE_PUIS,
+        DRIVE_FEATURE_REMOVABLE_MEDIA_STATUS_NOTIFICATION,
+        DRIVE_FEATURE_APM,
+        DRIVE_FEATURE_CFA,
+        DRIVE_FEATURE_TCQ,
+        DRIVE_FEATURE_GPL,
+        DRIVE_FEATURE_STREAMING,
+        DRIVE_FEATURE_MEDIA_CARD_PASS_THROUGH,
+        DRIVE_FEATURE_PACKET,
+        DRIVE_FEATURE_FREE_FALL_CONTROL,
+        DRIVE_FEATURE_WRITE_READ_VERIFY,
+        DRIVE_FEATURE_DSN,
+        DRIVE_FEATURE_AMAC,
+        DRIVE_FEATURE_EPC,
+        DRIVE_FEATURE_SENSE_DATA_REPORTING,
+        DRIVE_FEATURE_TRIM,
+        DRIVE_FEATURE_SCT_READ_WRITE_LONG,
+        DRIVE_FEATURE_SCT_WRITE_SAME,
+        DRIVE_FEATURE_SCT_ERROR_RECOVERY_CONTROL,
+        DRIVE_FEATURE_SCT_FEATURE_CONTROL,
+        DRIVE_FEATURE_SCT_DATA_TABLES,
+        DRIVE_FEATURE_NV_CACHE,
+        DRIVE_FEATURE_NV_CACHE_POWER_MODE,
+        DRIVE_FEATURE_HOST_LOGGING,
+        DRIVE_FEATURE_STORAGE_ELEMENT_DEPOPULATION,
+        DRIVE_FEATURE_SEAGATE_IDD,
+        DRIVE_FEATURE_SEAGATE_REMANUFACTURE,
+        //SCSI
+        DRIVE_FEATURE_POWER_CONSUMPTION,
+        DRIVE_FEATURE_UNMAP,
+        DRIVE_FEATURE_WRITE_SAME,
+        DRIVE_FEATURE_SAT,
+        DRIVE_FEATURE_PROTECTION_TYPE_1,
+        DRIVE_FEATURE_PROTECTION_TYPE_2,
+        DRIVE_FEATURE_PROTECTION_TYPE_3,
+        DRIVE_FEATURE_ATA_SECURITY,
+        DRIVE_FEATURE_APPLICATION_CLIENT_LOGGING,
+        DRIVE_FEATURE_SELF_TEST,
+        DRIVE_FEATURE_AUTOMATIC_WRITE_REASSIGNMENT,
+        DRIVE_FEATURE_AUTOMATIC_READ_REASSIGNMENT,
+        DRIVE_FEATURE_DEVICE_LIFE_CONTROL,
+        DRIVE_FEATURE_IO_ADVICE_HINTS,
+        DRIVE_FEATURE_PATA_CONTROL,
+        DRIVE_FEATURE_POWER_CONDITIONS,
+        DRIVE_FEATURE_INFORMATIONAL_EXCEPTIONS,
+        DRIVE_FEATURE_BACKGROUND_MEDIA_SCAN,
+        DRIVE_FEATURE_BACKGROUND_PRE_SCAN,
+        DRIVE_FEATURE_TRANSLATE_ADDRESS,
+        DRIVE_FEATURE_REBUILD_ASSIST,
+        DRIVE_FEATURE_FORMAT_UNIT,
+        DRIVE_FEATURE_ATA_PASS_THROUGH_12,
+        DRIVE_FEATURE_ATA_PASS_THROUGH_16,
+        DRIVE_FEATURE_ATA_PASS_THROUGH_32,
+        //NVMe
+        DRIVE_FEATURE_FORMAT_NVM,
+        DRIVE_FEATURE_FIRMWARE_UPDATE,
+        DRIVE_FEATURE_NAMESPACE_MANAGEMENT,
+        DRIVE_FEATURE_DEVICE_SELF_TEST,
+        DRIVE_FEATURE_VIRTUALIZATION_MANAGEMENT,
+        DRIVE_FEATURE_DOORBELL_BUFFER_CONFIG,
+        DRIVE_FEATURE_WRITE_UNCORRECTABLE,
+        DRIVE_FEATURE_DATASET_MANAGEMENT,
+        DRIVE_FEATURE_WRITE_ZEROS,
+        DRIVE_FEATURE_NAMESPACE_SHARING,
+        DRIVE_FEATURE_COUNT
+    }eDriveFeature;
+
+    #define DRIVE_FEATURE_SET_QWORDS ((DRIVE_FEATURE_COUNT + 63) / 64)
+
+    typedef struct _driveFeatureSet
+    {
+        uint64_t supported[DRIVE_FEATURE_SET_QWORDS];//bit per eDriveFeature
+        uint64_t enabled[DRIVE_FEATURE_SET_QWORDS];//bit per eDriveFeature. Only set for features that can be turned on and off and are currently on
+    }driveFeatureSet, *ptrDriveFeatureSet;
+
+    typedef enum _eDriveSpecification
+    {
+        //ATA
+        DRIVE_SPECIFICATION_ACS_8,
+        DRIVE_SPECIFICATION_ACS_7,
+        DRIVE_SPECIFICATION_ACS_6,
+        DRIVE_SPECIFICATION_ACS_5,
+        DRIVE_SPECIFICATION_ACS_4,
+        DRIVE_SPECIFICATION_ACS_3,
+        DRIVE_SPECIFICATION_ACS_2,
+        DRIVE_SPECIFICATION_ATA8_ACS,
+        DRIVE_SPECIFICATION_ATA_ATAPI_7,
+        DRIVE_SPECIFICATION_ATA_ATAPI_6,
+        DRIVE_SPECIFICATION_ATA_ATAPI_5,
+        DRIVE_SPECIFICATION_ATA_ATAPI_4,
+        DRIVE_SPECIFICATION_ATA_3,
+        DRIVE_SPECIFICATION_ATA_2,
+        DRIVE_SPECIFICATION_ATA_1,
+        //ATA transport
+        DRIVE_SPECIFICATION_SATA_3_2,
+        DRIVE_SPECIFICATION_SATA_3_1,
+        DRIVE_SPECIFICATION_SATA_3_0,
+        DRIVE_SPECIFICATION_SATA_2_6,
+        DRIVE_SPECIFICATION_SATA_2_5,
+        DRIVE_SPECIFICATION_SATA_II_EXTENSIONS,
+        DRIVE_SPECIFICATION_SATA_1_0A,
+        DRIVE_SPECIFICATION_ATA8_AST,
+        DRIVE_SPECIFICATION_ATA8_APT,
+        DRIVE_SPECIFICATION_TRANSPORT_RESERVED,
+        //SCSI
+        DRIVE_SPECIFICATION_SPC_5,
+        DRIVE_SPECIFICATION_SPC_4,
+        DRIVE_SPECIFICATION_SPC_3,
+        DRIVE_SPECIFICATION_SPC_2,
+        DRIVE_SPECIFICATION_SPC,
+        DRIVE_SPECIFICATION_SCSI_2,
+        DRIVE_SPECIFICATION_SCSI,
+        DRIVE_SPECIFICATION_COUNT //must stay at or below 64
+    }eDriveSpecification;
+
+    #define DRIVE_SPECIFICATION_BIT(specification) (UINT64_C(1) << (specification))
+    #define MAX_VERSION_DESCRIPTORS UINT8_C(8) //SCSI inquiry data has room for 8
+
+    //Sections of drive information that can be requested. OR these together. Only the commands needed for the requested sections are sent to the drive.
+    #define DRIVE_INFO_SECTION_IDENTITY         BIT0 //vendor, model, serial number, firmware revision, world wide name
+    #define DRIVE_INFO_SECTION_CAPACITY         BIT1 //maxLBA, sector sizes and alignment, rotation rate, form factor
+    #define DRIVE_INFO_SECTION_SPECIFICATIONS   BIT2 //specifications and version descriptors
+    #define DRIVE_INFO_SECTION_FEATURES         BIT3 //feature list, encryption, security, cache settings, firmware download support
+    #define DRIVE_INFO_SECTION_INTERFACE        BIT4 //interface speed and active port
+    #define DRIVE_INFO_SECTION_HEALTH           BIT5 //SMART status, temperature, power on time, workload, endurance, last DST
+    #define DRIVE_INFO_SECTION_NATIVE_MAX_LBA   BIT6 //ATA native maxLBA. This is its own section since it takes another command (read native max address or the accessible max address path)
+    #define DRIVE_INFO_SECTION_ALL              (DRIVE_INFO_SECTION_IDENTITY | DRIVE_INFO_SECTION_CAPACITY | DRIVE_INFO_SECTION_SPECIFICATIONS | DRIVE_INFO_SECTION_FEATURES | DRIVE_INFO_SECTION_INTERFACE | DRIVE_INFO_SECTION_HEALTH | DRIVE_INFO_SECTION_NATIVE_MAX_LBA)
 
     typedef struct _driveInformationSAS_SATA
     {
+        uint32_t sections;//DRIVE_INFO_SECTION_* flags this information was gathered for. Fields that belong to other sections are left zeroed
         char modelNumber[MODEL_NUM_LEN + 1];//Null terminated
         char serialNumber[SERIAL_NUM_LEN + 1];//Null terminated
         char firmwareRevision[FW_REV_LEN + 1];//Null terminated
@@ -168,8 +318,9 @@ extern "C"
         uint16_t sectorAlignment;//first logical sector offset within the first physical sector
         uint16_t rotationRate;//Value matches the spec. 0 = not reported. 1 = SSD, everything else is an RPM
         uint8_t formFactor;//matches SBC and ACS specs
-        uint8_t numberOfSpecificationsSupported;//number of specifications added to the list in the next field
-        char specificationsSupported[30][30];//30 specs supported max, and each one can be 15 characters long in name at max
+        uint64_t specificationsSupported;//DRIVE_SPECIFICATION_BIT() of each eDriveSpecification the drive reports
+        uint8_t numberOfVersionDescriptors;//SCSI only
+        uint16_t versionDescriptors[MAX_VERSION_DESCRIPTORS];//SCSI only. Version descriptors from the inquiry data. Names come from decypher_SCSI_Version_Descriptors when printing
         eEncryptionSupport encryptionSupport;
         bool trustedCommandsBeingBlocked;//Linux blocks ATA trusted send/receive commands by default. So this bool is a going to be true on most linux systems that haven't had the kernel boot parameter to allow them set. All other systems will likely see this allowed
         uint64_t cacheSize;//Bytes
@@ -183,8 +334,8 @@ extern "C"
         double deviceReportedUtilizationRate;//ACS4 or SBC4 required for this to be valid
         //interface speed (SATA or SAS only)
         interfaceSpeed interfaceSpeedInfo;
-        uint8_t numberOfFeaturesSupported;//number of features added in the next field
-        char featuresSupported[MAX_FEATURES][MAX_FEATURE_LENGTH];//max of 50 different features, 50 characters allowed for each feature name
+        driveFeatureSet features;
+        uint8_t informationalExceptionsMode;//SCSI only. MRIE field. Valid when DRIVE_FEATURE_INFORMATIONAL_EXCEPTIONS is supported
         firmwareDownloadSupport fwdlSupport;
         ataSecurityStatus ataSecurityInformation;
         bool readLookAheadEnabled;
@@ -198,6 +349,7 @@ extern "C"
 
     typedef struct _driveInformationNVMe
     {
+        uint32_t sections;//DRIVE_INFO_SECTION_* flags this information was gathered for. Fields that belong to other sections are left zeroed
         //TODO: How to get interface speed? (PCIe gen 3, 2, 1, etc)
         //TODO: Other information people might want to show
 
@@ -229,8 +381,7 @@ extern "C"
             uint8_t numberOfFirmwareSlots;
             uint8_t nvmSubsystemNVMeQualifiedName[257];//This is a UTF8 string!
             eEncryptionSupport encryptionSupport;
-            uint16_t numberOfControllerFeatures;
-            char controllerFeaturesSupported[MAX_FEATURES][MAX_FEATURE_LENGTH];//max of 50 different features, 50 characters allowed for each feature name
+            driveFeatureSet controllerFeatures;
         }controllerData;
         //smart log data (controller, not per namespace)
         struct {
@@ -262,8 +413,7 @@ extern "C"
             uint8_t namespaceGloballyUniqueIdentifier[16];
             uint64_t ieeeExtendedUniqueIdentifier;
             //Namespace features will include protection information types, and security protocols supported
-            uint16_t numberOfNamespaceFeatures;
-            char namespaceFeaturesSupported[MAX_FEATURES][MAX_FEATURE_LENGTH];//max of 50 different features, 50 characters allowed for each feature name
+            driveFeatureSet namespaceFeatures;
         }namespaceData;
     }driveInformationNVMe, *ptrDriveInformationNVMe;
 
@@ -283,6 +433,85 @@ extern "C"
         };
     }driveInformation, *ptrDriveInformation;
 
+    //-----------------------------------------------------------------------------
+    //
+    //  set_Drive_Feature(ptrDriveFeatureSet features, eDriveFeature feature, bool enabled)
+    //
+    //! \brief   Description:  Marks a feature as supported, and optionally enabled, in a feature set
+    //
+    //  Entry:
+    //!   \param[in,out] features = feature set to update
+    //!   \param[in] feature = feature to mark as supported
+    //!   \param[in] enabled = set to true when the feature is currently enabled
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API void set_Drive_Feature(ptrDriveFeatureSet features, eDriveFeature feature, bool enabled);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  is_Drive_Feature_Supported(ptrDriveFeatureSet features, eDriveFeature feature)
+    //
+    //! \brief   Description:  Checks if a feature is marked as supported in a feature set
+    //
+    //  Entry:
+    //!   \param[in] features = feature set to check
+    //!   \param[in] feature = feature to look for
+    //!
+    //  Exit:
+    //!   \return true = supported, false = not supported, or features is NULL or feature is out of range
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API bool is_Drive_Feature_Supported(ptrDriveFeatureSet features, eDriveFeature feature);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  is_Drive_Feature_Enabled(ptrDriveFeatureSet features, eDriveFeature feature)
+    //
+    //! \brief   Description:  Checks if a feature is marked as enabled in a feature set
+    //
+    //  Entry:
+    //!   \param[in] features = feature set to check
+    //!   \param[in] feature = feature to look for
+    //!
+    //  Exit:
+    //!   \return true = enabled, false = not enabled, or features is NULL or feature is out of range
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API bool is_Drive_Feature_Enabled(ptrDriveFeatureSet features, eDriveFeature feature);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Drive_Feature_Name(eDriveFeature feature)
+    //
+    //! \brief   Description:  Gets the display name of a feature
+    //
+    //  Entry:
+    //!   \param[in] feature = feature to get the name of
+    //!
+    //  Exit:
+    //!   \return pointer to a constant string. NULL for an invalid feature. Do not free or modify this string.
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API const char* get_Drive_Feature_Name(eDriveFeature feature);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Drive_Specification_Name(eDriveSpecification specification)
+    //
+    //! \brief   Description:  Gets the display name of a specification
+    //
+    //  Entry:
+    //!   \param[in] specification = specification to get the name of
+    //!
+    //  Exit:
+    //!   \return pointer to a constant string. NULL for an invalid specification. Do not free or modify this string.
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API const char* get_Drive_Specification_Name(eDriveSpecification specification);
+
     //-----------------------------------------------------------------------------
     //
     //  get_ATA_Drive_Information(tDevice *device, ptrDriveInformation driveInfo)
@@ -317,6 +546,80 @@ extern "C"
 
     OPENSEA_OPERATIONS_API int get_NVMe_Drive_Information(tDevice *device, ptrDriveInformationNVMe driveInfo);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  get_ATA_Drive_Information_Sections(tDevice *device, uint32_t sections, ptrDriveInformationSAS_Sata driveInfo)
+    //
+    //! \brief   Description:  Same as get_ATA_Drive_Information, but only sends the commands needed for the requested sections.
+    //!                        IDENTITY, CAPACITY, SPECIFICATIONS and INTERFACE only need the identify command.
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[in] sections = DRIVE_INFO_SECTION_* flags for the information to gather
+    //!   \param driveInfo = pointer to the struct to fill in with ATA drive information.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, FAILURE = one of the operations being called inside of this function failed.
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int get_ATA_Drive_Information_Sections(tDevice *device, uint32_t sections, ptrDriveInformationSAS_Sata driveInfo);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_SCSI_Drive_Information_Sections(tDevice *device, uint32_t sections, ptrDriveInformationSAS_Sata driveInfo)
+    //
+    //! \brief   Description:  Same as get_SCSI_Drive_Information, but only sends the commands needed for the requested sections.
+    //!                        Standard inquiry data is always read. VPD pages, read capacity, log pages, mode pages and the supported
+    //!                        commands are only read when a requested section uses them.
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[in] sections = DRIVE_INFO_SECTION_* flags for the information to gather
+    //!   \param driveInfo = pointer to the struct to fill in with SCSI drive information.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, FAILURE = one of the operations being called inside of this function failed.
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int get_SCSI_Drive_Information_Sections(tDevice *device, uint32_t sections, ptrDriveInformationSAS_Sata driveInfo);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_NVMe_Drive_Information_Sections(tDevice *device, uint32_t sections, ptrDriveInformationNVMe driveInfo)
+    //
+    //! \brief   Description:  Same as get_NVMe_Drive_Information, but only sends the commands needed for the requested sections.
+    //!                        IDENTITY and CAPACITY need the identify controller and identify namespace commands.
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[in] sections = DRIVE_INFO_SECTION_* flags for the information to gather
+    //!   \param driveInfo = pointer to the struct to fill in with NVMe drive information.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, FAILURE = one of the operations being called inside of this function failed.
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int get_NVMe_Drive_Information_Sections(tDevice *device, uint32_t sections, ptrDriveInformationNVMe driveInfo);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Drive_Information(tDevice *device, uint32_t sections, ptrDriveInformation driveInfo)
+    //
+    //! \brief   Description:  Gathers the requested sections of drive information using the drive's own command set (ATA, NVMe, or SCSI).
+    //!                        Unlike print_Drive_Information, the SCSI translation is not also read for ATA and NVMe drives, so
+    //!                        an inventory scan (DRIVE_INFO_SECTION_IDENTITY | DRIVE_INFO_SECTION_CAPACITY) of an ATA drive is a single identify command.
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[in] sections = DRIVE_INFO_SECTION_* flags for the information to gather
+    //!   \param[out] driveInfo = pointer to the struct to fill in. infoType is set to match the data that was read.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, BAD_PARAMETER = invalid pointer, FAILURE = one of the operations being called inside of this function failed.
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int get_Drive_Information(tDevice *device, uint32_t sections, ptrDriveInformation driveInfo);
+
     //-----------------------------------------------------------------------------
     //
     //  get_SCSI_Drive_Information(ptrDriveInformation externalDriveInfo, ptrDriveInformation scsiDriveInfo, ptrDriveInformation ataDriveInfo)
@@ -0,0 +1,97 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file drive_info_cache.h
+// \brief This file defines the functions for keeping the static part of drive information in a file between runs
+
+#pragma once
+
+#include "operations_Common.h"
+#include "drive_info.h"
+#include "file_mapping.h"
+
+#if defined (__cplusplus)
+extern "C"
+{
+#endif
+
+    //Sections that are kept in the cache. These only change on a firmware update, format, set max LBA or a settings change.
+    //Interface speed and health change all the time, so read them with get_Drive_Information.
+    #define DRIVE_INFO_CACHE_SECTIONS (DRIVE_INFO_SECTION_IDENTITY | DRIVE_INFO_SECTION_CAPACITY | DRIVE_INFO_SECTION_SPECIFICATIONS | DRIVE_INFO_SECTION_FEATURES | DRIVE_INFO_SECTION_NATIVE_MAX_LBA)
+    #define DRIVE_INFO_CACHE_DEFAULT_ENTRIES 256
+
+    typedef struct _driveInfoCacheKey
+    {
+        uint8_t inUse;
+        uint64_t worldWideName;//0 when the check command does not report one (SCSI)
+        char serialNumber[SERIAL_NUM_LEN + 1];
+        char firmwareRevision[FW_REV_LEN + 1];
+        uint64_t validation;//hash of the data read by the check command(s)
+        uint64_t timeCached;//seconds since the epoch
+    }driveInfoCacheKey, *ptrDriveInfoCacheKey;
+
+    //An open cache file. The file is mapped and locked while it is looked up or updated, so other processes (or other threads with their own
+    //cache) can use the same file at the same time and see each other's entries.
+    //Use the functions below instead of changing this structure directly. One cache should not be used by more than one thread at a time.
+    typedef struct _driveInfoCache
+    {
+        mappedFile cacheFile;
+        uint32_t numberOfEntries;
+    }driveInfoCache, *ptrDriveInfoCache;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  open_Drive_Info_Cache(const char *fileName, uint32_t numberOfEntries, ptrDriveInfoCache cache)
+    //
+    //! \brief   Description: Opens a drive information cache file. If the file does not exist, or it was written by a build with a
+    //!                        different driveInformation layout, it is created again empty.
+    //
+    //  Entry:
+    //!   \param[in] fileName = name of the cache file
+    //!   \param[in] numberOfEntries = number of drives the file holds when it is created. 0 = DRIVE_INFO_CACHE_DEFAULT_ENTRIES. An existing file keeps its size.
+    //!   \param[out] cache = pointer to the cache to set up. Close with close_Drive_Info_Cache
+    //!
+    //  Exit:
+    //!   \return SUCCESS = cache ready to use, BAD_PARAMETER, FILE_OPEN_ERROR, FAILURE = could not size, map, lock or write the file
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int open_Drive_Info_Cache(const char *fileName, uint32_t numberOfEntries, ptrDriveInfoCache cache);
+
+    OPENSEA_OPERATIONS_API void close_Drive_Info_Cache(ptrDriveInfoCache cache);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Drive_Information_Cached(tDevice *device, ptrDriveInfoCache cache, uint32_t maxAgeSeconds, ptrDriveInformation driveInfo, bool *fromCache)
+    //
+    //! \brief   Description: Gets the DRIVE_INFO_CACHE_SECTIONS of a drive's information. A cheap check is sent to the drive first
+    //!                        (ATA: identify. SCSI: inquiry, unit serial number and read capacity. NVMe: identify controller and namespace).
+    //!                        If the serial number, firmware revision and WWN match a cached entry and the check data is unchanged, the cached
+    //!                        information is returned. Otherwise the information is read from the drive and the entry is replaced.
+    //!                        On ATA every setting shows up in the identify data, so a changed setting is always seen. SCSI mode page
+    //!                        settings are not part of the check, so use maxAgeSeconds to refresh them.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in] cache = open cache
+    //!   \param[in] maxAgeSeconds = re-read entries older than this. 0 = entries do not expire
+    //!   \param[out] driveInfo = pointer to the struct to fill in
+    //!   \param[out] fromCache = set to true when the information came from the cache. May be NULL
+    //!
+    //  Exit:
+    //!   \return SUCCESS = information returned, BAD_PARAMETER, FAILURE = the check command or reading the information failed.
+    //!           A failure to update the cache file is not reported since the information was still returned.
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int get_Drive_Information_Cached(tDevice *device, ptrDriveInfoCache cache, uint32_t maxAgeSeconds, ptrDriveInformation driveInfo, bool *fromCache);
+
+#if defined (__cplusplus)
+}
+#endif
@@ -0,0 +1,146 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file drive_info_serialize.h
+// \brief This file defines the functions for writing drive information out as JSON or a binary record for other programs to read
+
+#pragma once
+
+#include "operations_Common.h"
+#include "drive_info.h"
+
+#if defined (__cplusplus)
+extern "C"
+{
+#endif
+
+    typedef enum _eDriveInfoFormat
+    {
+        DRIVE_INFO_FORMAT_JSON,//a single JSON object. Not null terminated
+        DRIVE_INFO_FORMAT_BINARY//a driveInfoRecordHeader followed by tag/length/value fields
+    }eDriveInfoFormat;
+
+    #define DRIVE_INFO_RECORD_SIGNATURE "ODIR"
+    #define DRIVE_INFO_RECORD_VERSION 1
+
+    //Binary record layout. All values are little endian no matter what the host is.
+    //The header is followed by fields made of a 2 byte tag (eDriveInfoRecordTag), a 2 byte length, and then length bytes of value.
+    //Strings are not null terminated. Unsigned values are 1, 2, 4, 8 or 16 bytes. Doubles are 8 byte IEEE 754.
+    //Fields for sections that were not gathered are left out. Readers should skip tags they do not know so that new tags can be added.
+    typedef struct _driveInfoRecordHeader
+    {
+        char signature[4];//DRIVE_INFO_RECORD_SIGNATURE
+        uint16_t version;//DRIVE_INFO_RECORD_VERSION
+        uint16_t infoType;//eDriveInfoType
+        uint32_t recordLength;//bytes including this header
+        uint32_t sections;//DRIVE_INFO_SECTION_* flags the information was gathered for
+    }driveInfoRecordHeader;
+
+    //Do not change the value of a tag once it has been used. The JSON key for each tag is in the comment.
+    typedef enum _eDriveInfoRecordTag
+    {
+        //identity
+        DRIVE_INFO_TAG_MODEL_NUMBER                 = 0x0001,//modelNumber
+        DRIVE_INFO_TAG_SERIAL_NUMBER                = 0x0002,//serialNumber
+        DRIVE_INFO_TAG_FIRMWARE_REVISION            = 0x0003,//firmwareRevision
+        DRIVE_INFO_TAG_VENDOR_ID                    = 0x0004,//vendorID
+        DRIVE_INFO_TAG_WORLD_WIDE_NAME              = 0x0005,//worldWideName
+        DRIVE_INFO_TAG_WORLD_WIDE_NAME_EXTENSION    = 0x0006,//worldWideNameExtension
+        DRIVE_INFO_TAG_SAT_VENDOR_ID                = 0x0007,//satVendorID
+        DRIVE_INFO_TAG_SAT_PRODUCT_ID               = 0x0008,//satProductID
+        DRIVE_INFO_TAG_SAT_PRODUCT_REVISION         = 0x0009,//satProductRevision
+        DRIVE_INFO_TAG_PCI_VENDOR_ID                = 0x0010,//pciVendorID
+        DRIVE_INFO_TAG_PCI_SUBSYSTEM_VENDOR_ID      = 0x0011,//pciSubsystemVendorID
+        DRIVE_INFO_TAG_IEEE_OUI                     = 0x0012,//ieeeOUI
+        DRIVE_INFO_TAG_CONTROLLER_ID                = 0x0013,//controllerID
+        DRIVE_INFO_TAG_NVME_VERSION                 = 0x0014,//nvmeVersion. 4 bytes: tertiary, minor, major (2 bytes)
+        DRIVE_INFO_TAG_NAMESPACE_EUI64              = 0x0015,//ieeeExtendedUniqueIdentifier
+        //capacity
+        DRIVE_INFO_TAG_MAX_LBA                      = 0x0100,//maxLBA
+        DRIVE_INFO_TAG_NATIVE_MAX_LBA               = 0x0101,//nativeMaxLBA
+        DRIVE_INFO_TAG_LOGICAL_SECTOR_SIZE          = 0x0102,//logicalSectorSize
+        DRIVE_INFO_TAG_PHYSICAL_SECTOR_SIZE         = 0x0103,//physicalSectorSize
+        DRIVE_INFO_TAG_SECTOR_ALIGNMENT             = 0x0104,//sectorAlignment
+        DRIVE_INFO_TAG_ROTATION_RATE                = 0x0105,//rotationRate
+        DRIVE_INFO_TAG_FORM_FACTOR                  = 0x0106,//formFactor
+        DRIVE_INFO_TAG_ZONED_DEVICE                 = 0x0107,//zonedDevice
+        DRIVE_INFO_TAG_TOTAL_NVM_CAPACITY           = 0x0110,//totalNVMCapacity
+        DRIVE_INFO_TAG_UNALLOCATED_NVM_CAPACITY     = 0x0111,//unallocatedNVMCapacity
+        DRIVE_INFO_TAG_MAX_NAMESPACES               = 0x0112,//maxNumberOfNamespaces
+        DRIVE_INFO_TAG_NAMESPACE_SIZE               = 0x0113,//namespaceSize
+        DRIVE_INFO_TAG_NAMESPACE_CAPACITY           = 0x0114,//namespaceCapacity
+        DRIVE_INFO_TAG_NAMESPACE_UTILIZATION        = 0x0115,//namespaceUtilization
+        DRIVE_INFO_TAG_FORMATTED_LBA_SIZE           = 0x0116,//formattedLBASize
+        //specifications
+        DRIVE_INFO_TAG_SPECIFICATIONS               = 0x0200,//specifications. Binary: DRIVE_SPECIFICATION_BIT() mask. JSON: array of names
+        DRIVE_INFO_TAG_VERSION_DESCRIPTORS          = 0x0201,//versionDescriptors. Binary: 2 bytes per descriptor
+        //features
+        DRIVE_INFO_TAG_FEATURES_SUPPORTED           = 0x0300,//features. Binary: 8 bytes per qword of driveFeatureSet.supported. JSON: array of {name, enabled}
+        DRIVE_INFO_TAG_FEATURES_ENABLED             = 0x0301,//binary only. 8 bytes per qword of driveFeatureSet.enabled
+        DRIVE_INFO_TAG_NAMESPACE_FEATURES_SUPPORTED = 0x0302,//namespaceFeatures
+        DRIVE_INFO_TAG_NAMESPACE_FEATURES_ENABLED   = 0x0303,//binary only
+        DRIVE_INFO_TAG_ENCRYPTION_SUPPORT           = 0x0304,//encryptionSupport. eEncryptionSupport
+        DRIVE_INFO_TAG_CACHE_SIZE                   = 0x0305,//cacheSize
+        DRIVE_INFO_TAG_HYBRID_NAND_SIZE             = 0x0306,//hybridNANDSize
+        DRIVE_INFO_TAG_READ_LOOK_AHEAD_ENABLED      = 0x0307,//readLookAheadEnabled
+        DRIVE_INFO_TAG_WRITE_CACHE_ENABLED          = 0x0308,//writeCacheEnabled
+        DRIVE_INFO_TAG_WRITE_CACHE_SUPPORTED        = 0x0309,//writeCacheSupported
+        DRIVE_INFO_TAG_FIRMWARE_DOWNLOAD_SUPPORTED  = 0x030A,//firmwareDownloadSupported
+        DRIVE_INFO_TAG_SEGMENTED_DOWNLOAD_SUPPORTED = 0x030B,//segmentedDownloadSupported
+        DRIVE_INFO_TAG_DEFERRED_DOWNLOAD_SUPPORTED  = 0x030C,//deferredDownloadSupported
+        DRIVE_INFO_TAG_FIRMWARE_SLOTS               = 0x030D,//numberOfFirmwareSlots
+        DRIVE_INFO_TAG_LOW_CURRENT_SPINUP_ENABLED   = 0x030E,//lowCurrentSpinupEnabled
+        //health
+        DRIVE_INFO_TAG_SMART_STATUS                 = 0x0500,//smartStatus. 0 = good, 1 = bad, 2 = unknown
+        DRIVE_INFO_TAG_CURRENT_TEMPERATURE          = 0x0501,//currentTemperature. Celsius, signed 2 bytes
+        DRIVE_INFO_TAG_POWER_ON_MINUTES             = 0x0502,//powerOnMinutes
+        DRIVE_INFO_TAG_TOTAL_LBAS_READ              = 0x0503,//totalLBAsRead
+        DRIVE_INFO_TAG_TOTAL_LBAS_WRITTEN           = 0x0504,//totalLBAsWritten
+        DRIVE_INFO_TAG_TOTAL_BYTES_READ             = 0x0505,//totalBytesRead
+        DRIVE_INFO_TAG_TOTAL_BYTES_WRITTEN          = 0x0506,//totalBytesWritten
+        DRIVE_INFO_TAG_TOTAL_WRITES_TO_FLASH        = 0x0507,//totalWritesToFlash
+        DRIVE_INFO_TAG_PERCENT_ENDURANCE_USED       = 0x0508,//percentEnduranceUsed
+        DRIVE_INFO_TAG_UTILIZATION_RATE             = 0x0509,//deviceReportedUtilizationRate
+        DRIVE_INFO_TAG_DST_RESULT                   = 0x050A,//dstResult. resultOrStatus of the last DST
+        DRIVE_INFO_TAG_DST_POWER_ON_HOURS           = 0x050B,//dstPowerOnHours
+        DRIVE_INFO_TAG_COMPOSITE_TEMPERATURE_KELVIN = 0x0510,//compositeTemperatureKelvin
+        DRIVE_INFO_TAG_PERCENTAGE_USED              = 0x0511,//percentageUsed
+        DRIVE_INFO_TAG_AVAILABLE_SPARE              = 0x0512,//availableSpacePercent
+        DRIVE_INFO_TAG_DATA_UNITS_READ              = 0x0513,//dataUnitsRead. 512 byte units
+        DRIVE_INFO_TAG_DATA_UNITS_WRITTEN           = 0x0514,//dataUnitsWritten. 512 byte units
+        DRIVE_INFO_TAG_POWER_ON_HOURS               = 0x0515 //powerOnHours
+    }eDriveInfoRecordTag;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  serialize_Drive_Information(ptrDriveInformation driveInfo, eDriveInfoFormat format, uint8_t *buffer, uint32_t bufferSize, uint32_t *length)
+    //
+    //! \brief   Description: Writes drive information into a buffer as JSON or as a binary record. Values are written straight into the
+    //!                        buffer with no printf style formatting and no memory allocation, so this is cheap enough to call for every drive
+    //!                        in a large inventory. Only fields for the sections in driveInfo's sections flags are written.
+    //!                        128 bit NVMe counters are written as exact integers, not doubles.
+    //
+    //  Entry:
+    //!   \param[in] driveInfo = drive information to write (from get_Drive_Information or similar)
+    //!   \param[in] format = DRIVE_INFO_FORMAT_JSON or DRIVE_INFO_FORMAT_BINARY
+    //!   \param[out] buffer = buffer to write into. May be NULL when bufferSize is 0 to find out how big a buffer is needed
+    //!   \param[in] bufferSize = size of buffer in bytes
+    //!   \param[out] length = set to the number of bytes the output takes, even when it did not fit in the buffer
+    //!
+    //  Exit:
+    //!   \return SUCCESS = output written, BAD_PARAMETER = invalid pointer or format, MEMORY_FAILURE = buffer is too small. length says how big it needs to be.
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int serialize_Drive_Information(ptrDriveInformation driveInfo, eDriveInfoFormat format, uint8_t *buffer, uint32_t bufferSize, uint32_t *length);
+
+#if defined (__cplusplus)
+}
+#endif
@@ -0,0 +1,82 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file drive_inventory.h
+// \brief This file defines the functions for gathering drive information from many devices at once
+
+#pragma once
+
+#include "operations_Common.h"
+#include "drive_info.h"
+
+#if defined (__cplusplus)
+extern "C"
+{
+#endif
+
+    #define DRIVE_INVENTORY_DEFAULT_WORKERS 8 //used when maxWorkers is 0
+    #define DRIVE_INVENTORY_MAX_WORKERS 64
+
+    typedef struct _driveInventoryResult
+    {
+        uint32_t deviceIndex;//index of the device in the device list
+        int status;//return value from get_Drive_Information
+        uint64_t timeNS;//time it took to gather this device's information
+        ptrDriveInformation driveInfo;//only valid until the callback returns. Copy anything that is needed later.
+    }driveInventoryResult, *ptrDriveInventoryResult;
+
+    //Called once per device as each device finishes. Calls are never made at the same time, so the callback does not need its own locking,
+    //but it is called from a worker thread and should return quickly since other workers wait for it to return before reporting their results.
+    typedef void (*driveInventoryCallback)(tDevice *device, ptrDriveInventoryResult result, void *callbackData);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Drive_Inventory(tDevice *deviceList, uint32_t numberOfDevices, uint32_t sections, uint32_t maxWorkers, driveInventoryCallback callback, void *callbackData)
+    //
+    //! \brief   Description: Gathers drive information for every device in a list using a pool of worker threads. Each worker takes the next
+    //!                        device that has not been started, so each device handle is only ever used by one thread at a time.
+    //!                        Results are passed to the callback in the order the devices finish, not the order of the list.
+    //
+    //  Entry:
+    //!   \param[in] deviceList = array of devices with open handles (such as from get_Device_List)
+    //!   \param[in] numberOfDevices = number of devices in deviceList
+    //!   \param[in] sections = DRIVE_INFO_SECTION_* flags for the information to gather from each device
+    //!   \param[in] maxWorkers = maximum number of devices to talk to at once. 0 = DRIVE_INVENTORY_DEFAULT_WORKERS. Limited to DRIVE_INVENTORY_MAX_WORKERS
+    //!   \param[in] callback = function to call with each device's result
+    //!   \param[in] callbackData = passed to the callback unchanged
+    //!
+    //  Exit:
+    //!   \return SUCCESS = every device was inventoried (check each result's status). If no worker threads can be started the devices are inventoried on the calling thread. BAD_PARAMETER
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int get_Drive_Inventory(tDevice *deviceList, uint32_t numberOfDevices, uint32_t sections, uint32_t maxWorkers, driveInventoryCallback callback, void *callbackData);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_Drive_Inventory(tDevice *deviceList, uint32_t numberOfDevices, uint32_t maxWorkers)
+    //
+    //! \brief   Description: Prints one line per device with the model, serial number, firmware, capacity and how long the device took to answer.
+    //!                        Only identity and capacity are gathered so each device only needs a few commands. Lines print as devices finish.
+    //
+    //  Entry:
+    //!   \param[in] deviceList = array of devices with open handles
+    //!   \param[in] numberOfDevices = number of devices in deviceList
+    //!   \param[in] maxWorkers = maximum number of devices to talk to at once. 0 = DRIVE_INVENTORY_DEFAULT_WORKERS
+    //!
+    //  Exit:
+    //!   \return same as get_Drive_Inventory
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int print_Drive_Inventory(tDevice *deviceList, uint32_t numberOfDevices, uint32_t maxWorkers);
+
+#if defined (__cplusplus)
+}
+#endif
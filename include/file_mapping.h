@@ -0,0 +1,122 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file file_mapping.h
+// \brief This file defines the functions for mapping a file into memory and locking it against other processes
+
+#pragma once
+
+#include "operations_Common.h"
+
+#if defined (__cplusplus)
+extern "C"
+{
+#endif
+
+    typedef enum _eFileMappingMode
+    {
+        FILE_MAPPING_READ_ONLY,//maps an existing file read-only. If it can't be mapped it is read into memory instead
+        FILE_MAPPING_READ_WRITE,//maps an existing file read/write. A file shorter than the length asked for is extended with zeros. Changes go to the file.
+        FILE_MAPPING_OPEN_OR_CREATE,//same as FILE_MAPPING_READ_WRITE, but an empty file is created if it does not exist. Safe when another process may be creating the same file.
+        FILE_MAPPING_CREATE,//same as FILE_MAPPING_OPEN_OR_CREATE, but anything already in the file is thrown away so the mapping starts out all zeros
+    }eFileMappingMode;
+
+    //Use the functions below instead of changing this structure directly.
+    typedef struct _mappedFile
+    {
+        uint8_t *data;
+        uint64_t length;
+        bool writable;
+        bool memoryMapped;//false when a read-only file couldn't be mapped and was read into memory instead
+#if defined (_WIN32)
+        void *fileHandle;
+        void *mappingHandle;
+#else
+        int fileDescriptor;
+#endif
+    }mappedFile, *ptrMappedFile;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  map_File(const char * const filePath, eFileMappingMode mode, uint64_t length, ptrMappedFile mapping)
+    //
+    //! \brief   Description: Maps a file into memory. The file stays open until unmap_File so that it can be locked with lock_Mapped_File.
+    //!                        Reads past the end of the file up to the end of its last page return zeros. When a read-only file is read
+    //!                        into memory instead, the buffer is zero padded to a whole 4KiB to match.
+    //
+    //  Entry:
+    //!   \param[in] filePath = path to the file
+    //!   \param[in] mode = how to open and map the file
+    //!   \param[in] length = number of bytes to map. 0 = the whole file (not allowed with FILE_MAPPING_CREATE)
+    //!   \param[out] mapping = filled in with the mapping. Release it with unmap_File
+    //!
+    //  Exit:
+    //!   \return SUCCESS, BAD_PARAMETER, FILE_OPEN_ERROR, MEMORY_FAILURE, FAILURE = the file is empty, too large to map, or couldn't be sized or mapped
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int map_File(const char * const filePath, eFileMappingMode mode, uint64_t length, ptrMappedFile mapping);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  flush_Mapped_File(ptrMappedFile mapping, uint64_t offset, uint64_t length)
+    //
+    //! \brief   Description: Starts writing changed pages in a range of a writable mapping back to the file (like fflush, it does not wait for
+    //!                        the disk). Other processes mapping the same file see changes right away, so this is only needed before another
+    //!                        process reads the file without mapping it or to narrow what is lost if the system goes down.
+    //
+    //  Entry:
+    //!   \param[in] mapping = mapping from map_File
+    //!   \param[in] offset = offset in the file of the first byte changed
+    //!   \param[in] length = number of bytes changed. 0 = to the end of the mapping
+    //!
+    //  Exit:
+    //!   \return SUCCESS, BAD_PARAMETER, FAILURE
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int flush_Mapped_File(ptrMappedFile mapping, uint64_t offset, uint64_t length);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  lock_Mapped_File(ptrMappedFile mapping, bool exclusive)
+    //
+    //! \brief   Description: Waits for and takes a lock on the whole file. Only other callers of this function are held off (the lock is advisory).
+    //!                        Each map_File of the file has its own lock, so this also holds off other threads in the same process that mapped the file separately.
+    //
+    //  Entry:
+    //!   \param[in] mapping = mapping from map_File
+    //!   \param[in] exclusive = true to lock out every other mapping while changing the file. false to only lock out exclusive lockers while reading it.
+    //!
+    //  Exit:
+    //!   \return SUCCESS, BAD_PARAMETER, FAILURE
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int lock_Mapped_File(ptrMappedFile mapping, bool exclusive);
+
+    OPENSEA_OPERATIONS_API void unlock_Mapped_File(ptrMappedFile mapping);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  unmap_File(ptrMappedFile mapping)
+    //
+    //! \brief   Description: Unmaps (or frees) a file from map_File and closes it. Any lock held on it is released.
+    //
+    //  Entry:
+    //!   \param[in] mapping = mapping from map_File
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API void unmap_File(ptrMappedFile mapping);
+
+#if defined (__cplusplus)
+}
+#endif
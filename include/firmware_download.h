@@ -15,19 +15,28 @@
 #pragma once
 
 #include "operations_Common.h"
+#include "file_mapping.h"
 
 #if defined(__cplusplus)
 extern "C"
 {
 #endif
+    //Count field an ATA drive returns for a download microcode segment (download with offsets or deferred)
+    #define ATA_DL_MICROCODE_STATUS_NOT_INDICATED           0x00
+    #define ATA_DL_MICROCODE_STATUS_MORE_SEGMENTS_EXPECTED  0x01
+    #define ATA_DL_MICROCODE_STATUS_APPLIED                 0x02 //all segments received and the new code is in use
+    #define ATA_DL_MICROCODE_STATUS_DEFERRED_COMPLETE       0x03 //all segments received and the new code is waiting to be activated
+
 	typedef struct _firmwareUpdateData {
 		bool useDMA; //set to true to use DMA command (93h). Only set this when the drive supports the command
 		eDownloadMode	dlMode; //how to do the download. Full, Segmented, Deferred, etc
-		uint16_t		segmentSize; //size of segments to use when doing segmented. If 0, will use 64.
-		uint8_t			*firmwareFileMem; //pointer to the firmware file read into memory to send to the drive.
+		uint16_t		segmentSize; //size of segments (in 512B blocks) to use when doing segmented. If 0, will use the largest size the device reports it can take, stepping down if the first segment is turned down.
+		uint8_t			*firmwareFileMem; //pointer to the firmware file read into memory (or mapped with open_Firmware_Image) to send to the drive.
 		uint32_t		firmwareMemoryLength; //length of the memory the firmware file was read into. This should be a multiple of 512B sizes...
 		uint64_t		avgSegmentDlTime; //stores the average segment time for the download
 		uint64_t		activateFWTime; //stores the amount of time it took to issue the last segment and activate the new code (on segmented). On deferred this is only the time to activate.
+		bool			lastSegmentErrorPassed; //segmented only. Set when the last segment returned an error that was passed anyways, since some drives report one even though the download worked.
+		uint8_t			ataDownloadStatus; //segmented ATA only. Count field returned for the last segment sent (ATA_DL_MICROCODE_STATUS_*)
         union
         {
             uint8_t firmwareSlot;//NVMe
@@ -132,6 +141,47 @@ extern "C"
     //-----------------------------------------------------------------------------
     OPENSEA_OPERATIONS_API void show_Supported_FWDL_Modes(tDevice *device, ptrSupportedDLModes supportedModes);
 
+    typedef struct _firmwareImage
+    {
+        uint8_t *imageData;//the image, read-only. Set firmwareFileMem to this. Never write to it since it may be mapped from the file read-only
+        uint32_t imageLength;//set firmwareMemoryLength to this
+        mappedFile file;//the mapping imageData points into
+    }firmwareImage, *ptrFirmwareImage;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  open_Firmware_Image(const char * const filePath, ptrFirmwareImage image)
+    //
+    //! \brief   Description:  Maps a firmware file into memory read-only so it doesn't have to be copied into a buffer first.
+    //!          Segments are sent to the drive straight from the mapping, and pages are only read from the file as they are sent.
+    //!          One image can be used for any number of downloads at the same time (such as fleet_Firmware_Download), so there is only
+    //!          ever one copy of it in memory. If the file can't be mapped, it is read into memory instead.
+    //
+    //  Entry:
+    //!   \param[in] filePath = path to the firmware file
+    //!   \param[out] image = filled in with the image. Close it with close_Firmware_Image when all downloads using it are done.
+    //!
+    //  Exit:
+    //!   \return SUCCESS, BAD_PARAMETER, FILE_OPEN_ERROR, MEMORY_FAILURE, FAILURE = the file is empty, larger than 4GiB, or couldn't be read
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int open_Firmware_Image(const char * const filePath, ptrFirmwareImage image);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  close_Firmware_Image(ptrFirmwareImage image)
+    //
+    //! \brief   Description:  Unmaps (or frees) an image from open_Firmware_Image
+    //
+    //  Entry:
+    //!   \param[in] image = image from open_Firmware_Image
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API void close_Firmware_Image(ptrFirmwareImage image);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,73 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file fleet_firmware_download.h
+// \brief This file defines the functions for updating firmware on many devices at once with activation in waves
+
+#pragma once
+
+#include "operations_Common.h"
+#include "firmware_download.h"
+
+#if defined (__cplusplus)
+extern "C"
+{
+#endif
+
+    #define FLEET_FWDL_DEFAULT_WORKERS 8 //used when maxWorkers is 0
+    #define FLEET_FWDL_MAX_WORKERS 64
+
+    typedef struct _fleetFirmwareUpdate
+    {
+        firmwareUpdateData options;//used for every device: useDMA, segmentSize, firmwareFileMem, firmwareMemoryLength, and firmwareSlot/bufferID. dlMode is not used. Use open_Firmware_Image for the image so every device is sent the same mapping.
+        uint32_t maxWorkers;//most devices to download to at the same time. 0 = FLEET_FWDL_DEFAULT_WORKERS. Limited to FLEET_FWDL_MAX_WORKERS
+        uint32_t activationWaveSize;//number of devices activated together. The next wave starts after the whole wave is done. 0 = all devices in one wave
+        bool stopOnActivationFailure;//don't start the next wave when a device in this wave fails to activate
+        bool downloadOnly;//download to every device but don't activate. Activate later with firmware_Download and DL_FW_ACTIVATE
+    }fleetFirmwareUpdate, *ptrFleetFirmwareUpdate;
+
+    typedef struct _fleetFirmwareResult
+    {
+        int downloadStatus;//SUCCESS, NOT_SUPPORTED = device doesn't support a deferred download, FAILURE = last segment failed, VALIDATION_FAILURE = ATA drive did not report the deferred download complete, or the error from firmware_Download
+        int activateStatus;//SUCCESS, the error from activating, ABORTED = not activated because an earlier wave failed, UNKNOWN = not activated (download failed or downloadOnly)
+        uint32_t wave;//activation wave the device was in, starting at 1. 0 = not activated
+        uint64_t avgSegmentDlTime;//from firmware_Download, in nanoseconds
+        uint64_t activateFWTime;//from firmware_Download, in nanoseconds
+    }fleetFirmwareResult, *ptrFleetFirmwareResult;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  fleet_Firmware_Download(tDevice *deviceList, uint32_t numberOfDevices, ptrFleetFirmwareUpdate update, ptrFleetFirmwareResult results)
+    //
+    //! \brief   Description: Updates firmware on a list of devices in two stages:
+    //!                        1. A deferred (segmented, not activated) download is sent to every device, with up to maxWorkers devices downloading at once.
+    //!                           A device is only activated when the drive reports it supports deferred downloads, every segment of its download completed
+    //!                           without error (including the last one, which firmware_Download otherwise passes) and, for ATA, the drive reports the
+    //!                           deferred download is complete and waiting to be activated.
+    //!                        2. The devices that downloaded are activated in waves of activationWaveSize devices, in deviceList order.
+    //!                           Each wave is activated at the same time and finishes before the next wave starts.
+    //!                        Each device is only ever used by one thread at a time. The firmware image is shared, not copied.
+    //
+    //  Entry:
+    //!   \param[in] deviceList = array of devices with open handles (such as from get_Device_List)
+    //!   \param[in] numberOfDevices = number of devices in deviceList
+    //!   \param[in] update = the firmware image and how to update the devices
+    //!   \param[out] results = array of numberOfDevices results, in the same order as deviceList. May be NULL
+    //!
+    //  Exit:
+    //!   \return SUCCESS = every device was updated, FAILURE = one or more devices failed (see results), BAD_PARAMETER, MEMORY_FAILURE
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int fleet_Firmware_Download(tDevice *deviceList, uint32_t numberOfDevices, ptrFleetFirmwareUpdate update, ptrFleetFirmwareResult results);
+
+#if defined (__cplusplus)
+}
+#endif
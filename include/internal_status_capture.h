@@ -0,0 +1,60 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file internal_status_capture.h
+// \brief This file defines the functions for capturing internal status logs from many devices at nearly the same moment
+
+#pragma once
+
+#include "operations_Common.h"
+
+#if defined (__cplusplus)
+extern "C"
+{
+#endif
+
+    #define ISL_CAPTURE_DEFAULT_WORKERS 8 //used when maxWorkers is 0
+    #define ISL_CAPTURE_MAX_WORKERS 64
+
+    typedef struct _islCaptureResult
+    {
+        int status;//SUCCESS, or the error from creating, saving, or pulling this device's snapshot
+        time_t snapshotTime;//when the snapshot was created on this device. 0 if it wasn't created
+        uint64_t pullTimeNS;//time it took to pull the log once every snapshot was created
+    }islCaptureResult, *ptrIslCaptureResult;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  pull_Internal_Status_Logs(tDevice *deviceList, uint32_t numberOfDevices, bool currentOrSaved, uint8_t islDataSet, const char * const filePath, uint32_t transferSizeBytes, uint32_t maxWorkers, ptrIslCaptureResult results)
+    //
+    //! \brief   Description: Creates a new internal status log snapshot on every device first, one right after another, so the snapshots from
+    //!                        different drives line up in time. The snapshots are then pulled by a pool of worker threads, each device to its own
+    //!                        file named the same way pull_Internal_Status_Log names it. Each device is only ever used by one thread at a time.
+    //
+    //  Entry:
+    //!   \param[in] deviceList = array of devices with open handles (such as from get_Device_List)
+    //!   \param[in] numberOfDevices = number of devices in deviceList
+    //!   \param[in] currentOrSaved = true for the current log, false for the saved log
+    //!   \param[in] islDataSet = 1 = small, 2 = medium, 3 = large
+    //!   \param[in] filePath = pointer to the path where the logs should be created. Use NULL for current working directory.
+    //!   \param[in] transferSizeBytes = transfer size to pull the logs with. 0 = automatic for each device
+    //!   \param[in] maxWorkers = most devices to pull from at the same time. 0 = ISL_CAPTURE_DEFAULT_WORKERS. Limited to ISL_CAPTURE_MAX_WORKERS
+    //!   \param[out] results = array of numberOfDevices results, in the same order as deviceList. May be NULL
+    //!
+    //  Exit:
+    //!   \return SUCCESS = a log was saved from every device, FAILURE = one or more devices failed (see results), BAD_PARAMETER, MEMORY_FAILURE
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int pull_Internal_Status_Logs(tDevice *deviceList, uint32_t numberOfDevices, bool currentOrSaved, uint8_t islDataSet, const char * const filePath, uint32_t transferSizeBytes, uint32_t maxWorkers, ptrIslCaptureResult results);
+
+#if defined (__cplusplus)
+}
+#endif
@@ -0,0 +1,107 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file log_archive.h
+// \brief This file defines the functions for pulling a set of logs from a drive into a single indexed archive file
+
+#pragma once
+
+#include "operations_Common.h"
+
+#if defined (__cplusplus)
+extern "C"
+{
+#endif
+
+    //Logs that can be requested from pull_Log_Archive. OR these together. Each one is the same data the individual log pull saves to its own file.
+    #define LOG_ARCHIVE_SMART_EXT_COMP_ERROR_LOG    BIT0 //get_SMART_Extended_Comprehensive_Error_Log (ATA only)
+    #define LOG_ARCHIVE_DST_LOG                     BIT1 //get_DST_Log
+    #define LOG_ARCHIVE_PENDING_DEFECTS             BIT2 //get_Pending_Defect_List
+    #define LOG_ARCHIVE_IDENTIFY_DEVICE_DATA_LOG    BIT3 //get_Identify_Device_Data_Log (ATA only)
+    #define LOG_ARCHIVE_SATA_PHY_EVENT_COUNTERS     BIT4 //get_SATA_Phy_Event_Counters_Log (ATA only)
+    #define LOG_ARCHIVE_DEVICE_STATISTICS           BIT5 //get_Device_Statistics_Log
+    #define LOG_ARCHIVE_EPC                         BIT6 //get_EPC_log
+    #define LOG_ARCHIVE_INFORMATIONAL_EXCEPTIONS    BIT7 //pull_SCSI_Informational_Exceptions_Log (SCSI only)
+    #define LOG_ARCHIVE_GROWN_DEFECT_LIST           BIT8 //pull_SCSI_G_List (SCSI only)
+    #define LOG_ARCHIVE_INTERNAL_STATUS_LOG         BIT9 //pull_Internal_Status_Log, current log, largest data set the drive reports
+    #define LOG_ARCHIVE_ALL                         (LOG_ARCHIVE_SMART_EXT_COMP_ERROR_LOG | LOG_ARCHIVE_DST_LOG | LOG_ARCHIVE_PENDING_DEFECTS | LOG_ARCHIVE_IDENTIFY_DEVICE_DATA_LOG | LOG_ARCHIVE_SATA_PHY_EVENT_COUNTERS | LOG_ARCHIVE_DEVICE_STATISTICS | LOG_ARCHIVE_EPC | LOG_ARCHIVE_INFORMATIONAL_EXCEPTIONS | LOG_ARCHIVE_GROWN_DEFECT_LIST | LOG_ARCHIVE_INTERNAL_STATUS_LOG)
+    //Options for pull_Log_Archive, also ORed into logSelection. Not part of LOG_ARCHIVE_ALL.
+    #define LOG_ARCHIVE_COMPRESS                    BIT31 //compress each log (see log_compression.h) on another thread while the next log is read from the drive
+
+    //Archive file layout. All values are little endian.
+    //Header (LOG_ARCHIVE_HEADER_LENGTH bytes):
+    //  0-3 signature (LOG_ARCHIVE_SIGNATURE), 4-5 version, 6-7 number of index entries, 8-15 offset of the index from the start of the file
+    //The stored logs follow the header, one after another. The index is at the end of the file.
+    //Index entry (LOG_ARCHIVE_INDEX_ENTRY_LENGTH bytes each):
+    //  0 entry type (eLogArchiveEntryType), 1 log address/page code/buffer ID, 2 subpage, 3 compression (eLogArchiveCompression),
+    //  4-7 length of the log, 8-15 offset of the stored log from the start of the file, 16-19 stored length, 20-23 reserved,
+    //  24-47 log name (ASCII, NUL padded)
+    #define LOG_ARCHIVE_SIGNATURE "OLAR"
+    #define LOG_ARCHIVE_VERSION 1
+    #define LOG_ARCHIVE_HEADER_LENGTH 16
+    #define LOG_ARCHIVE_INDEX_ENTRY_LENGTH 48
+    #define LOG_ARCHIVE_NAME_LENGTH 24
+
+    typedef enum _eLogArchiveEntryType
+    {
+        LOG_ARCHIVE_ENTRY_ATA_GPL_LOG = 0,//read log ext
+        LOG_ARCHIVE_ENTRY_ATA_SMART_LOG = 1,//SMART read log
+        LOG_ARCHIVE_ENTRY_ATA_INTERNAL_STATUS_LOG = 2,
+        LOG_ARCHIVE_ENTRY_SCSI_LOG_PAGE = 3,//log sense
+        LOG_ARCHIVE_ENTRY_SCSI_VPD_PAGE = 4,
+        LOG_ARCHIVE_ENTRY_SCSI_GROWN_DEFECT_LIST = 5,//read defect data 12 header followed by long block format address descriptors
+        LOG_ARCHIVE_ENTRY_SCSI_INTERNAL_STATUS_LOG = 6
+    }eLogArchiveEntryType;
+
+    typedef enum _eLogArchiveCompression
+    {
+        LOG_ARCHIVE_COMPRESSION_NONE = 0,
+        LOG_ARCHIVE_COMPRESSION_GZIP = 1//blocked gzip as described in log_compression.h. Any gzip tool can decompress it, or read part of it back with decompress_Log_Range
+    }eLogArchiveCompression;
+
+    typedef struct _logArchiveIndexEntry
+    {
+        eLogArchiveEntryType entryType;
+        uint8_t logAddress;//ATA log address, SCSI log page, VPD page code, or error history buffer ID
+        uint8_t subpage;
+        eLogArchiveCompression compression;
+        uint32_t dataLength;//length of the log as it was read from the drive
+        uint64_t offset;
+        uint32_t storedLength;//length in the archive. Same as dataLength when it isn't compressed
+        char name[LOG_ARCHIVE_NAME_LENGTH];
+    }logArchiveIndexEntry, *ptrLogArchiveIndexEntry;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  pull_Log_Archive(tDevice *device, uint32_t logSelection, const char * const filePath, uint32_t transferSizeBytes)
+    //
+    //! \brief   Description: Pulls each selected log the drive supports into one archive file (see the layout above) instead of a file per log.
+    //!                        The log directories (GPL and SMART directory, supported log pages, error history directory) are each read once
+    //!                        and used for every log, and logs the drive doesn't support are skipped without sending any commands.
+    //!                        A log that fails to read is left out of the archive and the rest are still pulled.
+    //!                        With LOG_ARCHIVE_COMPRESS, each log is compressed and written while the next one is read, and stored uncompressed if it can't be.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in] logSelection = LOG_ARCHIVE_* flags for the logs to pull, and LOG_ARCHIVE_COMPRESS to compress them
+    //!   \param[in] filePath = pointer to the path where the archive should be created. Use NULL for current working directory.
+    //!   \param[in] transferSizeBytes = transfer size for the larger logs (internal status log and multi-page ATA logs). 0 = automatic
+    //!
+    //  Exit:
+    //!   \return SUCCESS = at least one log was saved, NOT_SUPPORTED = none of the selected logs are supported, FILE_OPEN_ERROR,
+    //!            MEMORY_FAILURE, FAILURE = the archive couldn't be written, BAD_PARAMETER
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int pull_Log_Archive(tDevice *device, uint32_t logSelection, const char * const filePath, uint32_t transferSizeBytes);
+
+#if defined (__cplusplus)
+}
+#endif
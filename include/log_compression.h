@@ -0,0 +1,103 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file log_compression.h
+// \brief This file defines the functions for compressing pulled logs so they take less space in support bundles
+
+#pragma once
+
+#include "operations_Common.h"
+
+#if defined (__cplusplus)
+extern "C"
+{
+#endif
+
+    //Logs are compressed to gzip (RFC 1952) so any gzip tool can read them. The log is split into blocks of LOG_COMPRESSION_BLOCK_SIZE
+    //bytes and each block is deflated (RFC 1951) into its own gzip member. Each member has the BGZF extra subfield ('B', 'C', 2 byte
+    //member length - 1) used by blocked gzip tools, so the members can be stepped through and any part of a log read back without
+    //decompressing everything in front of it. The members are followed by the BGZF end of file marker (an empty member).
+    //A block that doesn't get any smaller is stored as a deflate stored block, so a member is never more than LOG_COMPRESSION_MAX_MEMBER_LENGTH.
+    #define LOG_COMPRESSION_BLOCK_SIZE 0xFF00
+    #define LOG_COMPRESSION_MAX_MEMBER_LENGTH 0x10000
+    #define LOG_COMPRESSION_END_MARKER_LENGTH 28
+
+    //Holds the match tables for compressing a block so they are allocated once per log instead of once per block.
+    //One compressor can only be used by one thread at a time.
+    typedef struct _logCompressor logCompressor, *ptrLogCompressor;
+
+    OPENSEA_OPERATIONS_API int create_Log_Compressor(ptrLogCompressor *compressor);
+
+    OPENSEA_OPERATIONS_API void free_Log_Compressor(ptrLogCompressor *compressor);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  compress_Log_Block(ptrLogCompressor compressor, const uint8_t *block, uint32_t blockLength, uint8_t *member)
+    //
+    //! \brief   Description: Compresses one block of a log into one gzip member as described above. Use this to compress a log as it is read
+    //!                        instead of all at once. Write the members one after another, then the end marker from get_Log_Compression_End_Marker.
+    //
+    //  Entry:
+    //!   \param[in] compressor = compressor from create_Log_Compressor
+    //!   \param[in] block = data to compress
+    //!   \param[in] blockLength = length of the data. At most LOG_COMPRESSION_BLOCK_SIZE. Only the last block of a log should be shorter.
+    //!   \param[out] member = buffer of at least LOG_COMPRESSION_MAX_MEMBER_LENGTH bytes to fill in with the member
+    //!
+    //  Exit:
+    //!   \return length of the member, or 0 for a bad parameter
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API uint32_t compress_Log_Block(ptrLogCompressor compressor, const uint8_t *block, uint32_t blockLength, uint8_t *member);
+
+    //returns the LOG_COMPRESSION_END_MARKER_LENGTH bytes that end a compressed log
+    OPENSEA_OPERATIONS_API const uint8_t* get_Log_Compression_End_Marker(void);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  compress_Log(const uint8_t *logData, uint32_t logLength, uint8_t **compressedLog, uint32_t *compressedLength)
+    //
+    //! \brief   Description: Compresses a log into the layout described above
+    //
+    //  Entry:
+    //!   \param[in] logData = the log to compress
+    //!   \param[in] logLength = length of the log
+    //!   \param[out] compressedLog = set to a newly allocated buffer holding the compressed log. Free it with safe_Free
+    //!   \param[out] compressedLength = length of the compressed log
+    //!
+    //  Exit:
+    //!   \return SUCCESS, BAD_PARAMETER = the log is too large to compress in memory, MEMORY_FAILURE
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int compress_Log(const uint8_t *logData, uint32_t logLength, uint8_t **compressedLog, uint32_t *compressedLength);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  decompress_Log_Range(const uint8_t *compressedLog, uint32_t compressedLength, uint32_t logLength, uint32_t offset, uint8_t *ptrData, uint32_t dataLength)
+    //
+    //! \brief   Description: Reads part of a compressed log. Only the members that hold the requested bytes are decompressed and checked against their CRC.
+    //
+    //  Entry:
+    //!   \param[in] compressedLog = compressed log from compress_Log
+    //!   \param[in] compressedLength = length of the compressed log
+    //!   \param[in] logLength = length of the log before it was compressed
+    //!   \param[in] offset = offset into the uncompressed log to start reading from
+    //!   \param[out] ptrData = buffer to fill in
+    //!   \param[in] dataLength = number of bytes to read. Use offset 0 and logLength to read the whole log.
+    //!
+    //  Exit:
+    //!   \return SUCCESS, BAD_PARAMETER = the range is outside the log, MEMORY_FAILURE, FAILURE = the compressed log is corrupt or not laid out as described above
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int decompress_Log_Range(const uint8_t *compressedLog, uint32_t compressedLength, uint32_t logLength, uint32_t offset, uint8_t *ptrData, uint32_t dataLength);
+
+#if defined (__cplusplus)
+}
+#endif
@@ -0,0 +1,91 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file log_decode.h
+// \brief This file defines the functions for decoding raw ATA logs and SCSI log pages into records
+
+#pragma once
+
+#include "operations_Common.h"
+
+#if defined (__cplusplus)
+extern "C"
+{
+#endif
+
+    typedef enum _eLogDecodeType
+    {
+        LOG_DECODE_ATA_LOG,//ATA log read with read log ext or SMART read log. The log address says which log it is
+        LOG_DECODE_SCSI_LOG_PAGE//SCSI log page from log sense, starting with the log page header. The page and subpage come from the header
+    }eLogDecodeType;
+
+    //One decoded item from a log. Records point into the log buffer instead of copying it, so decoding a log doesn't allocate anything.
+    typedef struct _logRecord
+    {
+        const char *name;//NULL when the record isn't one this code has a name for
+        const char *unit;//NULL for no unit
+        uint8_t page;//ATA: page of the log the record is on. SCSI: log page code
+        uint8_t subpage;//SCSI log subpage code
+        uint16_t identifier;//ATA device statistic byte offset in its page, SATA phy event counter ID, SCSI parameter code, or SCSI supported page code
+        uint8_t flags;//ATA device statistic flags (bits 63:56 of the statistic), or the SCSI parameter control byte
+        uint32_t offset;//offset of the record from the start of the log
+        const uint8_t *data;//the record in the log buffer. Only valid as long as the log buffer is
+        uint32_t length;
+        bool valueValid;//false when the record isn't a single number or the drive says the value isn't valid. See data instead
+        uint64_t value;
+    }logRecord, *ptrLogRecord;
+
+    //Called for each record in the order they are in the log
+    typedef void (*logRecordCallback)(const logRecord *record, void *callbackData);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  decode_Log(eLogDecodeType logType, uint8_t logAddress, const uint8_t *logData, uint32_t logLength, logRecordCallback callback, void *callbackData)
+    //
+    //! \brief   Description: Decodes a log in place. Works on a log just read from a drive or one loaded from a saved binary file.
+    //!                        ATA: device statistics and SATA phy event counters. SCSI: any log page made of log parameters, and the supported pages lists.
+    //!                        Names for statistics come from the same tables print_DeviceStatistics uses.
+    //
+    //  Entry:
+    //!   \param[in] logType = what kind of log logData holds
+    //!   \param[in] logAddress = ATA log address. Not used for SCSI log pages.
+    //!   \param[in] logData = the log
+    //!   \param[in] logLength = length of the log
+    //!   \param[in] callback = called for each record
+    //!   \param[in] callbackData = passed to the callback
+    //!
+    //  Exit:
+    //!   \return SUCCESS, NOT_SUPPORTED = no decoder for this log, FAILURE = the log ends in the middle of a record (the records before it were still decoded), BAD_PARAMETER
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int decode_Log(eLogDecodeType logType, uint8_t logAddress, const uint8_t *logData, uint32_t logLength, logRecordCallback callback, void *callbackData);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_Decoded_Log(eLogDecodeType logType, uint8_t logAddress, const uint8_t *logData, uint32_t logLength)
+    //
+    //! \brief   Description: Decodes a log with decode_Log and prints one line per record
+    //
+    //  Entry:
+    //!   \param[in] logType = what kind of log logData holds
+    //!   \param[in] logAddress = ATA log address. Not used for SCSI log pages.
+    //!   \param[in] logData = the log
+    //!   \param[in] logLength = length of the log
+    //!
+    //  Exit:
+    //!   \return same as decode_Log
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int print_Decoded_Log(eLogDecodeType logType, uint8_t logAddress, const uint8_t *logData, uint32_t logLength);
+
+#if defined (__cplusplus)
+}
+#endif
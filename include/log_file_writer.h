@@ -0,0 +1,118 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file log_file_writer.h
+// \brief This file defines the functions for writing a log to a file on another thread while the next part of it is read from the drive
+
+#pragma once
+
+#include "operations_Common.h"
+
+#if defined (__cplusplus)
+extern "C"
+{
+#endif
+
+    #define LOG_FILE_WRITER_DEFAULT_BUFFERS 4 //used when numberOfBuffers is 0
+
+    //A ring of transfer sized buffers shared with a writer thread. The caller fills one buffer at a time from the drive and queues it,
+    //and the writer thread writes queued buffers to the file in order. Memory use is bufferSize * numberOfBuffers no matter how large the log is.
+    //If the writer thread can't be started, queued buffers are written right away on the caller's thread instead.
+    //When compressing, the writer thread also compresses the log (see log_compression.h) so that it overlaps reading the next buffers from the drive.
+    typedef struct _logFileWriter logFileWriter, *ptrLogFileWriter;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  create_Log_File_Writer(FILE *logFile, uint32_t bufferSize, uint32_t numberOfBuffers, bool compress, ptrLogFileWriter *writer)
+    //
+    //! \brief   Description: Allocates the buffers and starts the writer thread
+    //
+    //  Entry:
+    //!   \param[in] logFile = open file to write to. May be NULL if the file is opened later with set_Log_File_Writer_File (before the first buffer is queued)
+    //!   \param[in] bufferSize = size of each buffer. Usually the transfer size used to read the log
+    //!   \param[in] numberOfBuffers = number of buffers in the ring. 0 = LOG_FILE_WRITER_DEFAULT_BUFFERS
+    //!   \param[in] compress = true to write the log compressed to gzip as described in log_compression.h
+    //!   \param[out] writer = set to the new writer. Must be finished with finish_Log_File_Writer
+    //!
+    //  Exit:
+    //!   \return SUCCESS, BAD_PARAMETER, MEMORY_FAILURE
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int create_Log_File_Writer(FILE *logFile, uint32_t bufferSize, uint32_t numberOfBuffers, bool compress, ptrLogFileWriter *writer);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  set_Log_File_Writer_File(ptrLogFileWriter writer, FILE *logFile)
+    //
+    //! \brief   Description: Sets the file to write to when it is opened after the writer was created (such as after the first read succeeds)
+    //
+    //  Entry:
+    //!   \param[in] writer = writer from create_Log_File_Writer
+    //!   \param[in] logFile = open file to write to
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API void set_Log_File_Writer_File(ptrLogFileWriter writer, FILE *logFile);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Log_File_Writer_Buffer(ptrLogFileWriter writer)
+    //
+    //! \brief   Description: Gets the next buffer to fill. Waits for the writer thread when every buffer is waiting to be written.
+    //!                        Only one buffer can be taken at a time. Give it back with queue_Log_File_Writer_Buffer before taking another.
+    //
+    //  Entry:
+    //!   \param[in] writer = writer from create_Log_File_Writer
+    //!
+    //  Exit:
+    //!   \return pointer to a buffer of bufferSize bytes
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API uint8_t* get_Log_File_Writer_Buffer(ptrLogFileWriter writer);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  queue_Log_File_Writer_Buffer(ptrLogFileWriter writer, uint32_t length)
+    //
+    //! \brief   Description: Queues the buffer from get_Log_File_Writer_Buffer to be written to the file.
+    //
+    //  Entry:
+    //!   \param[in] writer = writer from create_Log_File_Writer
+    //!   \param[in] length = number of bytes in the buffer to write. 0 gives the buffer back without writing anything (such as when the read failed)
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API void queue_Log_File_Writer_Buffer(ptrLogFileWriter writer, uint32_t length);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  finish_Log_File_Writer(ptrLogFileWriter writer)
+    //
+    //! \brief   Description: Waits for everything queued to be written, flushes the file, stops the writer thread and frees the writer.
+    //!                        When compressing, the rest of the log and the end marker are written first.
+    //!                        The file is not closed.
+    //
+    //  Entry:
+    //!   \param[in] writer = writer from create_Log_File_Writer
+    //!
+    //  Exit:
+    //!   \return SUCCESS = everything was written, FAILURE = a write to the file failed
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int finish_Log_File_Writer(ptrLogFileWriter writer);
+
+#if defined (__cplusplus)
+}
+#endif
@@ -35,6 +35,7 @@ extern "C" {
 		PULL_LOG_RAW_MODE,			// Dump it to stdout. 
 		PULL_LOG_BIN_FILE_MODE,		// Create a binary file 
 		PULL_LOG_ANALYZE_MODE,		// Humanize the log
+		PULL_LOG_COMPRESSED_BIN_FILE_MODE,	// Create a gzip compressed binary file (see log_compression.h)
 	} eLogPullMode;
 
     OPENSEA_OPERATIONS_API int generate_Logfile_Name(tDevice *device,\
@@ -265,6 +266,74 @@ extern "C" {
                                                 const char * const filePath,\
                                                 uint32_t transferSizeBytes);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  pull_Compressed_Internal_Status_Log(tDevice *device, bool currentOrSaved, uint8_t islDataSet, const char * const filePath, uint32_t transferSizeBytes)
+    //
+    //! \brief   Description: Same as pull_Internal_Status_Log saving to a file, but the file is gzip compressed as described in log_compression.h
+    //!                        and named with .isl.gz. The log is compressed while it is read, so it is never all in memory at once.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in] currentOrSaved = true for the current log, false for the saved log
+    //!   \param[in] islDataSet = 1 = small, 2 = medium, 3 = large
+    //!   \param[in] filePath = pointer to the path where this log should be generated. Use NULL for current working directory.
+    //!   \param[in] transferSizeBytes = transfer size to read the log with. 0 = automatic
+    //!
+    //  Exit:
+    //!   \return SUCCESS, NOT_SUPPORTED, FAILURE, FILE_OPEN_ERROR, MEMORY_FAILURE, BAD_PARAMETER
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int pull_Compressed_Internal_Status_Log(tDevice *device, bool currentOrSaved, uint8_t islDataSet, const char * const filePath, uint32_t transferSizeBytes);
+
+    //An internal status log snapshot that has been created on the drive but not pulled yet.
+    //Creating the snapshot only takes a couple of commands, so a snapshot can be created on many drives at nearly the same moment and pulled afterwards.
+    typedef struct _internalStatusLogSnapshot
+    {
+        uint8_t logAddress;//ATA log address or SCSI error history buffer ID the snapshot is read from
+        uint16_t dataSetPages[3];//length of the small, medium and large data sets in 512B pages. 0 = data set not available
+        uint8_t firstPage[LEGACY_DRIVE_SEC_SIZE];//header page, read when the snapshot was created
+    }internalStatusLogSnapshot, *ptrInternalStatusLogSnapshot;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  trigger_Internal_Status_Log(tDevice *device, bool currentOrSaved, ptrInternalStatusLogSnapshot snapshot)
+    //
+    //! \brief   Description: Creates a new internal status log snapshot on an ATA or SCSI device by reading its first page. Pull the rest with pull_Internal_Status_Log_Snapshot.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in] currentOrSaved = true for the current log, false for the saved log
+    //!   \param[out] snapshot = filled in with where the snapshot is and how large each data set is
+    //!
+    //  Exit:
+    //!   \return SUCCESS, NOT_SUPPORTED, FAILURE, BAD_PARAMETER
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int trigger_Internal_Status_Log(tDevice *device, bool currentOrSaved, ptrInternalStatusLogSnapshot snapshot);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  pull_Internal_Status_Log_Snapshot(tDevice *device, ptrInternalStatusLogSnapshot snapshot, uint8_t islDataSet, FILE *islFile, uint8_t *ptrData, uint32_t dataSize, uint32_t transferSizeBytes, bool showProgress)
+    //
+    //! \brief   Description: Pulls a snapshot created by trigger_Internal_Status_Log, starting with the first page that was already read
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to the device the snapshot was created on
+    //!   \param[in] snapshot = snapshot from trigger_Internal_Status_Log
+    //!   \param[in] islDataSet = 1 = small, 2 = medium, 3 = large. Falls back to a smaller data set when the requested one isn't available
+    //!   \param[in] islFile = open file to write the log to. NULL to copy the log to ptrData instead
+    //!   \param[out] ptrData = buffer for the log when islFile is NULL
+    //!   \param[in] dataSize = size of ptrData
+    //!   \param[in] transferSizeBytes = transfer size to read the log with. 0 = automatic
+    //!   \param[in] showProgress = print progress dots (when not quiet). Set to false when pulling from several devices at once
+    //!
+    //  Exit:
+    //!   \return SUCCESS, FAILURE, MEMORY_FAILURE, BAD_PARAMETER
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int pull_Internal_Status_Log_Snapshot(tDevice *device, ptrInternalStatusLogSnapshot snapshot, uint8_t islDataSet, FILE *islFile, uint8_t *ptrData, uint32_t dataSize, uint32_t transferSizeBytes, bool showProgress);
+
     //-----------------------------------------------------------------------------
     //
     //! get_Pending_Defect_List( tDevice * device )
@@ -55,6 +55,22 @@ extern "C"
     //-----------------------------------------------------------------------------
     OPENSEA_OPERATIONS_API int get_SMART_Attributes(tDevice *device, smartLogData * smartAttrs);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  get_ATA_SMART_Attribute_Name(eSeagateFamily family, uint8_t attributeNumber)
+    //
+    //! \brief   Description: Looks up the name of an ATA SMART attribute for a drive family. This is a table lookup, so it is cheap enough to call for every attribute of every drive.
+    //
+    //  Entry:
+    //!   \param[in] family = drive family from is_Seagate_Family()
+    //!   \param[in] attributeNumber = attribute number to look up
+    //!
+    //  Exit:
+    //!   \return pointer to a constant string with the name. NULL when the attribute is not known for this family. Do not free or modify this string.
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API const char* get_ATA_SMART_Attribute_Name(eSeagateFamily family, uint8_t attributeNumber);
+
     typedef enum _eSMARTAttrOutMode
     {
         SMART_ATTR_OUTPUT_RAW,
@@ -77,6 +93,210 @@ extern "C"
     //-----------------------------------------------------------------------------
     OPENSEA_OPERATIONS_API int print_SMART_Attributes(tDevice *device, eSMARTAttrOutMode outputMode);
 
+    #define SMART_SNAPSHOT_MAX_ATTRIBUTES 30 //The ATA SMART data sector only has room for 30 attributes
+
+    typedef struct _smartAttributeSample
+    {
+        uint64_t rawValue;//raw data bytes 0 - 6 as a little endian value
+        uint8_t attributeNumber;
+        uint8_t nominal;
+        uint8_t worstEver;
+        uint8_t thresholdValue;//0 when thresholds were not read. NOTE: 0 is also "always passing"
+    }smartAttributeSample, *ptrSmartAttributeSample;
+
+    typedef struct _smartAttributeSnapshot
+    {
+        uint64_t timestamp;//seconds since the epoch when the attributes were read
+        bool thresholdsValid;
+        uint8_t attributeCount;
+        smartAttributeSample attributes[SMART_SNAPSHOT_MAX_ATTRIBUTES];
+    }smartAttributeSnapshot, *ptrSmartAttributeSnapshot;
+
+    typedef struct _smartSnapshotHistory
+    {
+        char serialNumber[SERIAL_NUM_LEN + 1];//which drive this history belongs to
+        uint32_t capacity;//number of snapshots that can be held before the oldest is overwritten
+        uint32_t count;//number of snapshots currently held
+        uint32_t newest;//index of the most recent snapshot. Only valid when count > 0
+        ptrSmartAttributeSnapshot snapshots;
+    }smartSnapshotHistory, *ptrSmartSnapshotHistory;
+
+    typedef struct _smartAttributeDelta
+    {
+        uint8_t attributeNumber;
+        uint64_t elapsedSeconds;//time between the oldest and newest snapshot that contain this attribute
+        int64_t rawDelta;
+        int16_t nominalDelta;
+        double rawPerDay;
+        double nominalPerDay;//negative when the attribute is wearing down toward the threshold
+        uint8_t currentNominal;
+        uint8_t thresholdValue;
+        bool thresholdValid;//threshold is known and is not "always passing" or "always failing"
+        bool trendingToThreshold;//nominal value is dropping and will reach the threshold if the rate holds
+        double daysToThreshold;//only valid when trendingToThreshold is true. 0 means the threshold has already been reached
+    }smartAttributeDelta, *ptrSmartAttributeDelta;
+
+    typedef struct _smartTrendAlert
+    {
+        uint32_t historyIndex;//index into the list of histories that was searched
+        smartAttributeDelta delta;
+    }smartTrendAlert, *ptrSmartTrendAlert;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_SMART_Attribute_Snapshot(tDevice *device, ptrSmartAttributeSnapshot previous, ptrSmartAttributeSnapshot snapshot)
+    //
+    //! \brief   Description: Reads the ATA SMART attributes into a compact snapshot for trending. This is meant to be cheap enough to poll every few minutes:
+    //!                        when a previous snapshot with thresholds is given, the thresholds are carried forward instead of read again so that only one SMART READ DATA command is sent.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to a valid device structure with a device handle
+    //!   \param[in] previous = OPTIONAL. Last snapshot from this same drive. Thresholds are copied from it when valid. Set to NULL to read the thresholds.
+    //!   \param[out] snapshot = pointer to the snapshot to fill in
+    //!
+    //  Exit:
+    //!   \return SUCCESS = got the attributes, NOT_SUPPORTED = not an ATA drive or SMART is disabled, !SUCCESS means something went wrong
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int get_SMART_Attribute_Snapshot(tDevice *device, ptrSmartAttributeSnapshot previous, ptrSmartAttributeSnapshot snapshot);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  fill_SMART_Attribute_Snapshot_From_Data(uint8_t *smartData, uint8_t *thresholdData, ptrSmartAttributeSnapshot snapshot)
+    //
+    //! \brief   Description: Parses an already read SMART READ DATA sector (and optionally the SMART READ THRESHOLDS sector) into a snapshot.
+    //!                        Use this when the SMART data is already in hand for something else so that it does not need to be read again. The timestamp is not changed.
+    //
+    //  Entry:
+    //!   \param[in] smartData = 512 byte SMART READ DATA sector
+    //!   \param[in] thresholdData = OPTIONAL. 512 byte SMART READ THRESHOLDS sector. NULL leaves the thresholds marked as not valid
+    //!   \param[out] snapshot = pointer to the snapshot to fill in
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API void fill_SMART_Attribute_Snapshot_From_Data(uint8_t *smartData, uint8_t *thresholdData, ptrSmartAttributeSnapshot snapshot);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  allocate_SMART_Snapshot_History(ptrSmartSnapshotHistory history, const char *serialNumber, uint32_t capacity)
+    //
+    //! \brief   Description: Sets up a ring of snapshots for one drive. Once full, adding a snapshot overwrites the oldest one.
+    //
+    //  Entry:
+    //!   \param[out] history = pointer to the history to set up
+    //!   \param[in] serialNumber = serial number of the drive this history is for
+    //!   \param[in] capacity = number of snapshots to keep
+    //!
+    //  Exit:
+    //!   \return SUCCESS = history ready to use, BAD_PARAMETER, MEMORY_FAILURE
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int allocate_SMART_Snapshot_History(ptrSmartSnapshotHistory history, const char *serialNumber, uint32_t capacity);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  free_SMART_Snapshot_History(ptrSmartSnapshotHistory history)
+    //
+    //! \brief   Description: Frees the snapshots held by a history from allocate_SMART_Snapshot_History. The history can be allocated again afterwards.
+    //
+    //  Entry:
+    //!   \param[in,out] history = pointer to the history to free
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API void free_SMART_Snapshot_History(ptrSmartSnapshotHistory history);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  add_SMART_Snapshot_To_History(ptrSmartSnapshotHistory history, ptrSmartAttributeSnapshot snapshot)
+    //
+    //! \brief   Description: Copies a snapshot into a history as the newest one. When the history is full the oldest snapshot is overwritten.
+    //
+    //  Entry:
+    //!   \param[in,out] history = pointer to a history set up with allocate_SMART_Snapshot_History
+    //!   \param[in] snapshot = snapshot to add. Should be newer than the snapshots already in the history
+    //!
+    //  Exit:
+    //!   \return SUCCESS = snapshot added, BAD_PARAMETER
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int add_SMART_Snapshot_To_History(ptrSmartSnapshotHistory history, ptrSmartAttributeSnapshot snapshot);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Newest_SMART_Snapshot(ptrSmartSnapshotHistory history)
+    //
+    //! \brief   Description: Gets the most recently added snapshot in a history
+    //
+    //  Entry:
+    //!   \param[in] history = pointer to the history
+    //!
+    //  Exit:
+    //!   \return pointer to the newest snapshot (owned by the history), NULL when the history is empty
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API ptrSmartAttributeSnapshot get_Newest_SMART_Snapshot(ptrSmartSnapshotHistory history);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_SMART_Attribute_Delta(ptrSmartSnapshotHistory history, uint8_t attributeNumber, ptrSmartAttributeDelta delta)
+    //
+    //! \brief   Description: Computes how much an attribute changed between the oldest and newest snapshot in a history, the rate per day,
+    //!                        and (for attributes with a real threshold) how many days until the nominal value reaches the threshold at that rate.
+    //
+    //  Entry:
+    //!   \param[in] history = pointer to the history for one drive
+    //!   \param[in] attributeNumber = attribute to compute the delta for
+    //!   \param[out] delta = pointer to hold the result
+    //!
+    //  Exit:
+    //!   \return SUCCESS = delta computed, NOT_SUPPORTED = attribute not in at least two snapshots, BAD_PARAMETER
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int get_SMART_Attribute_Delta(ptrSmartSnapshotHistory history, uint8_t attributeNumber, ptrSmartAttributeDelta delta);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  find_SMART_Attributes_Trending_To_Threshold(ptrSmartSnapshotHistory histories, uint32_t numberOfHistories, uint32_t warningDays, ptrSmartTrendAlert alerts, uint32_t maxAlerts, uint32_t *alertCount)
+    //
+    //! \brief   Description: Walks the histories for many drives and reports every attribute that has reached its threshold or will within warningDays.
+    //
+    //  Entry:
+    //!   \param[in] histories = array of histories, one per drive
+    //!   \param[in] numberOfHistories = number of entries in histories
+    //!   \param[in] warningDays = report attributes projected to reach the threshold in this many days or fewer
+    //!   \param[out] alerts = array to hold alerts
+    //!   \param[in] maxAlerts = number of entries in alerts
+    //!   \param[out] alertCount = number of alerts found. This can be more than maxAlerts, but only maxAlerts are written
+    //!
+    //  Exit:
+    //!   \return SUCCESS = search done, BAD_PARAMETER
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int find_SMART_Attributes_Trending_To_Threshold(ptrSmartSnapshotHistory histories, uint32_t numberOfHistories, uint32_t warningDays, ptrSmartTrendAlert alerts, uint32_t maxAlerts, uint32_t *alertCount);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_SMART_Trend_Alerts(ptrSmartSnapshotHistory histories, ptrSmartTrendAlert alerts, uint32_t maxAlerts, uint32_t alertCount)
+    //
+    //! \brief   Description: Prints the alerts from find_SMART_Attributes_Trending_To_Threshold
+    //
+    //  Entry:
+    //!   \param[in] histories = the same histories passed to find_SMART_Attributes_Trending_To_Threshold
+    //!   \param[in] alerts = array of alerts
+    //!   \param[in] maxAlerts = number of entries in alerts
+    //!   \param[in] alertCount = alertCount from find_SMART_Attributes_Trending_To_Threshold. Only the first maxAlerts are printed
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API void print_SMART_Trend_Alerts(ptrSmartSnapshotHistory histories, ptrSmartTrendAlert alerts, uint32_t maxAlerts, uint32_t alertCount);
+
     typedef enum _eSMARTTripInfoType
     {
         SMART_TRIP_INFO_TYPE_UNKNOWN,
@@ -134,6 +354,23 @@ extern "C"
     //-----------------------------------------------------------------------------
     OPENSEA_OPERATIONS_API int run_SMART_Check(tDevice *device, ptrSmartTripInfo tripInfo);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  ata_SMART_Status_Check()
+    //
+    //! \brief   Description:  Same as ata_SMART_Check, but never reads the SMART attributes and thresholds. When the status can't be determined
+    //!                         UNKNOWN is returned so that a caller that already has the attribute data can compare it instead of reading it again.
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[in] tripInfo = OPTIONAL pointer to a struct to get why a drive has been tripped (only filled in when reported through SAT).
+    //!
+    //  Exit:
+    //!   \return same as ata_SMART_Check
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_OPERATIONS_API int ata_SMART_Status_Check(tDevice *device, ptrSmartTripInfo tripInfo);
+
     //-----------------------------------------------------------------------------
     //
     //  ata_SMART_Check()
@@ -171,6 +408,9 @@ extern "C"
 
     OPENSEA_OPERATIONS_API int nvme_SMART_Check(tDevice *device, ptrSmartTripInfo tripInfo);
 
+    //Sets the NVMe critical warning bits and reason string in tripInfo from byte 0 of the SMART/Health log
+    OPENSEA_OPERATIONS_API void set_NVMe_SMART_Trip_Info(uint8_t criticalWarning, ptrSmartTripInfo tripInfo);
+
     OPENSEA_OPERATIONS_API bool is_SMART_Enabled(tDevice *device);
 
     OPENSEA_OPERATIONS_API int get_Pending_List_Count(tDevice *device, uint32_t *pendingCount);
@@ -227,6 +467,9 @@ extern "C"
 
     OPENSEA_OPERATIONS_API int get_SMART_Info(tDevice *device, ptrSmartFeatureInfo smartInfo);
 
+    //Parses an already read SMART READ DATA sector into smartInfo
+    OPENSEA_OPERATIONS_API void fill_SMART_Info_From_Data(uint8_t *smartData, ptrSmartFeatureInfo smartInfo);
+
     OPENSEA_OPERATIONS_API int print_SMART_Info(tDevice *device, ptrSmartFeatureInfo smartInfo);
 
     typedef struct _informationalExceptionsControl
@@ -0,0 +1,138 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file worker_pool.h
+// \brief This file defines the locks, threads and worker pool shared by the operations in this library that do work on more than one thread.
+//        These are internal to the library and are not exported.
+
+#pragma once
+
+#include "operations_Common.h"
+#if defined (_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#if defined (__cplusplus)
+extern "C"
+{
+#endif
+
+#if defined (_WIN32)
+    typedef SRWLOCK workerLock;
+    typedef CONDITION_VARIABLE workerCondition;
+    #define WORKER_LOCK_INIT SRWLOCK_INIT //for a static lock that is never destroyed
+#else
+    typedef pthread_mutex_t workerLock;
+    typedef pthread_cond_t workerCondition;
+    #define WORKER_LOCK_INIT PTHREAD_MUTEX_INITIALIZER //for a static lock that is never destroyed
+#endif
+
+    void init_Worker_Lock(workerLock *lock);
+    void destroy_Worker_Lock(workerLock *lock);
+    void acquire_Worker_Lock(workerLock *lock);
+    void release_Worker_Lock(workerLock *lock);
+
+    void init_Worker_Condition(workerCondition *condition);
+    void destroy_Worker_Condition(workerCondition *condition);
+    //lock must be held. It is released while waiting and held again when this returns. Check what was waited for again after it returns.
+    void wait_Worker_Condition(workerCondition *condition, workerLock *lock);
+    void signal_Worker_Condition(workerCondition *condition);
+
+    typedef void (*workerThreadFunction)(void *parameter);
+
+    //Use the functions below instead of changing this structure directly. It must stay in place until join_Worker_Thread returns.
+    typedef struct _workerThread
+    {
+        workerThreadFunction function;
+        void *parameter;
+#if defined (_WIN32)
+        HANDLE handle;
+#else
+        pthread_t handle;
+#endif
+    }workerThread;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  start_Worker_Thread(workerThread *thread, workerThreadFunction function, void *parameter)
+    //
+    //! \brief   Description: Starts a thread that calls function(parameter). Every thread that starts must be joined with join_Worker_Thread.
+    //
+    //  Entry:
+    //!   \param[out] thread = filled in with the thread
+    //!   \param[in] function = function to run on the thread
+    //!   \param[in] parameter = passed to function
+    //!
+    //  Exit:
+    //!   \return true = the thread started, false = it could not be started. The caller should do the work itself instead.
+    //
+    //-----------------------------------------------------------------------------
+    bool start_Worker_Thread(workerThread *thread, workerThreadFunction function, void *parameter);
+
+    void join_Worker_Thread(workerThread *thread);
+
+    typedef struct _workerPool workerPool, *ptrWorkerPool;
+
+    //Runs on each worker thread. Call get_Next_Worker_Pool_Item until it returns false. Anything set up here (such as a buffer) is kept
+    //for every item this worker takes.
+    typedef void (*workerPoolFunction)(ptrWorkerPool pool, void *poolData);
+
+    struct _workerPool
+    {
+        workerLock nextItemLock;//protects nextItem
+        uint32_t nextItem;
+        uint32_t endItem;//one past the last item
+        workerPoolFunction function;
+        void *poolData;
+    };
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Next_Worker_Pool_Item(ptrWorkerPool pool, uint32_t *item)
+    //
+    //! \brief   Description: Takes the next item that no worker has started yet
+    //
+    //  Entry:
+    //!   \param[in] pool = pool passed to the worker function
+    //!   \param[out] item = set to the item to work on
+    //!
+    //  Exit:
+    //!   \return true = item was set, false = every item has been taken and the worker should return
+    //
+    //-----------------------------------------------------------------------------
+    bool get_Next_Worker_Pool_Item(ptrWorkerPool pool, uint32_t *item);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  run_Worker_Pool(uint32_t firstItem, uint32_t endItem, uint32_t maxWorkers, workerPoolFunction function, void *poolData)
+    //
+    //! \brief   Description: Works through items firstItem to endItem - 1 with up to maxWorkers threads, each taking the next item that has not
+    //!                        been started until they are used up. Returns when every item is done. If no thread can be started, the
+    //!                        items are done on the calling thread instead so that the work still happens.
+    //
+    //  Entry:
+    //!   \param[in] firstItem = first item (such as an index in a device list)
+    //!   \param[in] endItem = one past the last item
+    //!   \param[in] maxWorkers = most threads to use. Limited to the number of items
+    //!   \param[in] function = run on each worker thread
+    //!   \param[in] poolData = passed to function
+    //!
+    //  Exit:
+    //!   \return VOID
+    //
+    //-----------------------------------------------------------------------------
+    void run_Worker_Pool(uint32_t firstItem, uint32_t endItem, uint32_t maxWorkers, workerPoolFunction function, void *poolData);
+
+#if defined (__cplusplus)
+}
+#endif
@@ -15,6 +15,7 @@
 
 #include "operations_Common.h"
 #include "ata_Security.h"
+#include "device_page_cache.h"
 
 bool sat_ATA_Security_Protocol_Supported(tDevice *device)
 {
@@ -237,6 +238,7 @@ int set_ATA_Security_Password(tDevice *device, const char *ATAPassword, bool mas
         ret = ata_Security_Set_Password(device, securityPassword);
     }
     safe_Free(securityPassword);
+    invalidate_Device_Page_Cache(device);//the security state is in the identify data
     return ret;
 }
 
@@ -263,6 +265,7 @@ int disable_ATA_Security_Password(tDevice *device, const char *ATAPassword, bool
         ret = ata_Security_Disable_Password(device, securityPassword);
     }
     safe_Free(securityPassword);
+    invalidate_Device_Page_Cache(device);//the security state is in the identify data
     return ret;
 }
 
@@ -289,6 +292,7 @@ int unlock_ATA_Security(tDevice *device, const char *ATAPassword, bool master, b
         ret = ata_Security_Unlock(device, securityPassword);
     }
     safe_Free(securityPassword);
+    invalidate_Device_Page_Cache(device);//the security state is in the identify data
     return ret;
 }
 
@@ -334,6 +338,7 @@ int start_ATA_Security_Erase(tDevice *device, const char *ATAPassword, bool mast
         }
     }
     safe_Free(securityErase);
+    invalidate_Device_Page_Cache(device);//the security state is in the identify data
     return ret;
 }
 
@@ -629,6 +634,7 @@ int run_ATA_Security_Erase(tDevice *device, bool enhanced, bool master, const ch
         {
             //force an identify information update to make sure the security protocol information is not being cached by the controller. VPD 89h will force the controller to issue a new identify command and it SHOULD also update anything the controller is caching.
             uint8_t ataVPDPage[VPD_ATA_INFORMATION_LEN] = { 0 };
+            invalidate_Device_Page_Cache(device);
             if (SUCCESS == scsi_Inquiry(device, ataVPDPage, VPD_ATA_INFORMATION_LEN, ATA_INFORMATION, true, false))
             {
                 memcpy((uint8_t*)&device->drive_info.IdentifyData.ata.Word000, &ataVPDPage[60], LEGACY_DRIVE_SEC_SIZE);
@@ -637,6 +643,7 @@ int run_ATA_Security_Erase(tDevice *device, bool enhanced, bool master, const ch
         else
         {
             //issue an identify device command before we read the ATA security bits to make sure the data isn't stale in our structure.
+            invalidate_Device_Page_Cache(device);
             ata_Identify(device, (uint8_t*)&device->drive_info.IdentifyData.ata.Word000, LEGACY_DRIVE_SEC_SIZE);
         }
         memset(&securityStatus, 0, sizeof(ataSecurityStatus));
@@ -14,6 +14,152 @@
 
 #include "buffer_test.h"
 
+//Pick the widest vector the compiler was told it can use. AVX2 is only used when the library is built for it (-mavx2 or /arch:AVX2).
+//SSE2 is baseline on x86_64 so it is almost always available there. Everything else falls back to 64bit words.
+#if defined (__AVX2__)
+    #include <immintrin.h>
+    #define BUFFER_TEST_VECTOR_BYTES 32
+#elif defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define BUFFER_TEST_VECTOR_BYTES 16
+#else
+    #define BUFFER_TEST_VECTOR_BYTES 8
+#endif
+
+static uint32_t count_Set_Bits_64(uint64_t value)
+{
+#if defined (__GNUC__) || defined (__clang__)
+    return (uint32_t)__builtin_popcountll(value);
+#else
+    //SWAR popcount. Not using __popcnt64 on MSVC since that requires a CPU with the POPCNT instruction
+    value = value - ((value >> 1) & UINT64_C(0x5555555555555555));
+    value = (value & UINT64_C(0x3333333333333333)) + ((value >> 2) & UINT64_C(0x3333333333333333));
+    value = (value + (value >> 4)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+    return (uint32_t)((value * UINT64_C(0x0101010101010101)) >> 56);
+#endif
+}
+
+void fill_Buffer_Test_Pattern(uint8_t *buffer, uint32_t bufferSize, uint32_t pattern)
+{
+    uint32_t offset = 0;
+    uint64_t widePattern = ((uint64_t)pattern << 32) | pattern;//both halves are the same, so this is the same in memory on big and little endian
+    const uint8_t *patternBytes = (const uint8_t*)&pattern;
+    if (!buffer)
+    {
+        return;
+    }
+#if BUFFER_TEST_VECTOR_BYTES == 32
+    __m256i vectorPattern = _mm256_set1_epi32((int)pattern);
+    for (; (offset + 32) <= bufferSize; offset += 32)
+    {
+        _mm256_storeu_si256((__m256i*)(buffer + offset), vectorPattern);
+    }
+#elif BUFFER_TEST_VECTOR_BYTES == 16
+    __m128i vectorPattern = _mm_set1_epi32((int)pattern);
+    for (; (offset + 16) <= bufferSize; offset += 16)
+    {
+        _mm_storeu_si128((__m128i*)(buffer + offset), vectorPattern);
+    }
+#endif
+    for (; (offset + 8) <= bufferSize; offset += 8)
+    {
+        memcpy(buffer + offset, &widePattern, sizeof(uint64_t));
+    }
+    //offset is a multiple of 4 here, so the tail always starts at the beginning of the pattern
+    for (uint8_t patternIter = 0; offset < bufferSize; ++offset, ++patternIter)
+    {
+        buffer[offset] = patternBytes[patternIter % 4];
+    }
+}
+
+//Only called for ranges that are known to miscompare, so this can afford to look at every byte for the position information
+static void record_Buffer_Miscompare(const uint8_t *expected, const uint8_t *received, uint32_t offset, uint32_t length, ptrBufferCompareResult result)
+{
+    uint32_t end = offset + length;
+    while (offset < end)
+    {
+        uint32_t wordLength = M_Min((uint32_t)sizeof(uint64_t), end - offset);
+        uint64_t expectedWord = 0, receivedWord = 0, flipped = 0;
+        memcpy(&expectedWord, expected + offset, wordLength);
+        memcpy(&receivedWord, received + offset, wordLength);
+        flipped = expectedWord ^ receivedWord;
+        if (flipped)
+        {
+            result->bitErrors += count_Set_Bits_64(flipped);
+            for (uint32_t byteIter = offset; byteIter < (offset + wordLength); ++byteIter)
+            {
+                uint8_t flippedByte = expected[byteIter] ^ received[byteIter];
+                if (flippedByte)
+                {
+                    if (result->bytesInError == 0)
+                    {
+                        result->firstErrorOffset = byteIter;
+                    }
+                    result->lastErrorOffset = byteIter;
+                    ++(result->bytesInError);
+                    for (uint8_t bitIter = 0; bitIter < 8; ++bitIter)
+                    {
+                        if (flippedByte & M_BitN(bitIter))
+                        {
+                            ++(result->bitErrorsByBitPosition[bitIter]);
+                        }
+                    }
+                }
+            }
+        }
+        offset += wordLength;
+    }
+}
+
+bool compare_Buffer_Test_Data(const uint8_t *expected, const uint8_t *received, uint32_t bufferSize, ptrBufferCompareResult result)
+{
+    bufferCompareResult localResult;
+    uint32_t offset = 0;
+    memset(&localResult, 0, sizeof(bufferCompareResult));
+    if (!expected || !received)
+    {
+        return false;
+    }
+#if BUFFER_TEST_VECTOR_BYTES == 32
+    for (; (offset + 32) <= bufferSize; offset += 32)
+    {
+        __m256i difference = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(expected + offset)), _mm256_loadu_si256((const __m256i*)(received + offset)));
+        if (!_mm256_testz_si256(difference, difference))
+        {
+            record_Buffer_Miscompare(expected, received, offset, 32, &localResult);
+        }
+    }
+#elif BUFFER_TEST_VECTOR_BYTES == 16
+    for (; (offset + 16) <= bufferSize; offset += 16)
+    {
+        __m128i difference = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(expected + offset)), _mm_loadu_si128((const __m128i*)(received + offset)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(difference, _mm_setzero_si128())) != 0xFFFF)
+        {
+            record_Buffer_Miscompare(expected, received, offset, 16, &localResult);
+        }
+    }
+#endif
+    for (; (offset + 8) <= bufferSize; offset += 8)
+    {
+        uint64_t expectedWord = 0, receivedWord = 0;
+        memcpy(&expectedWord, expected + offset, sizeof(uint64_t));
+        memcpy(&receivedWord, received + offset, sizeof(uint64_t));
+        if (expectedWord != receivedWord)
+        {
+            record_Buffer_Miscompare(expected, received, offset, 8, &localResult);
+        }
+    }
+    if (offset < bufferSize)
+    {
+        record_Buffer_Miscompare(expected, received, offset, bufferSize - offset, &localResult);
+    }
+    if (result)
+    {
+        memcpy(result, &localResult, sizeof(bufferCompareResult));
+    }
+    return localResult.bitErrors == 0;
+}
+
 
 bool are_Buffer_Commands_Available(tDevice *device)
 {
@@ -223,6 +369,83 @@ bool was_There_A_CRC_Error_On_Last_Command(tDevice *device)
     return crc;
 }
 
+//Adds one buffer comparison into the pattern test results.
+static void accumulate_Buffer_Comparison(ptrPatternTestResults testResults, ptrBufferCompareResult compareResult, uint32_t deviceBufferSize)
+{
+    ++(testResults->totalBufferComparisons);
+    testResults->totalBitsCompared += (uint64_t)deviceBufferSize * 8;
+    if (compareResult->bitErrors > 0)
+    {
+        ++(testResults->totalBufferMiscompares);
+        testResults->totalBitErrors += compareResult->bitErrors;
+        for (uint8_t bitIter = 0; bitIter < 8; ++bitIter)
+        {
+            testResults->bitErrorsByBitPosition[bitIter] += compareResult->bitErrorsByBitPosition[bitIter];
+        }
+        if (!testResults->miscompareOffsetValid)
+        {
+            testResults->miscompareOffsetValid = true;
+            testResults->firstMiscompareOffset = compareResult->firstErrorOffset;
+        }
+    }
+}
+
+//Sends one write buffer/read buffer pair and compares the result.
+//Returns false when testing should stop because the commands cannot be sent at all.
+static bool write_Read_Compare_Buffer(tDevice *device, uint8_t *patternBuffer, uint8_t *returnBuffer, uint32_t deviceBufferSize, ptrPatternTestResults testResults)
+{
+    bufferCompareResult compareResult;
+    int wbResult = send_Write_Buffer_Command(device, patternBuffer, deviceBufferSize);
+    ++(testResults->totalCommandsSent);
+    switch (wbResult)
+    {
+    case OS_PASSTHROUGH_FAILURE:
+    case NOT_SUPPORTED:
+        return false;
+    case COMMAND_TIMEOUT:
+        ++(testResults->totalCommandTimeouts);
+        break;
+    case SUCCESS:
+        break;
+    case ABORTED:
+    case COMMAND_FAILURE:
+    case FAILURE:
+    default:
+        if (was_There_A_CRC_Error_On_Last_Command(device))
+        {
+            ++(testResults->totalCommandCRCErrors);
+        }
+        return true;//skip the read since this will miscompare no matter what on the read buffer command
+    }
+    //now read back the pattern
+    memset(returnBuffer, 0, deviceBufferSize);
+    int rbResult = send_Read_Buffer_Command(device, returnBuffer, deviceBufferSize);
+    ++(testResults->totalCommandsSent);
+    switch (rbResult)
+    {
+    case OS_PASSTHROUGH_FAILURE:
+    case NOT_SUPPORTED:
+        return false;
+    case COMMAND_TIMEOUT:
+        ++(testResults->totalCommandTimeouts);
+        break;
+    case SUCCESS:
+        break;
+    case ABORTED:
+    case COMMAND_FAILURE:
+    case FAILURE:
+    default:
+        if (was_There_A_CRC_Error_On_Last_Command(device))
+        {
+            ++(testResults->totalCommandCRCErrors);
+        }
+        return true;//nothing valid to compare
+    }
+    compare_Buffer_Test_Data(patternBuffer, returnBuffer, deviceBufferSize, &compareResult);
+    accumulate_Buffer_Comparison(testResults, &compareResult, deviceBufferSize);
+    return true;
+}
+
 //Function for simple byte pattern tests. take counter for number of times to try it?
 void perform_Byte_Pattern_Test(tDevice *device, uint32_t pattern, uint32_t deviceBufferSize, ptrPatternTestResults testResults)
 {
@@ -231,75 +454,16 @@ void perform_Byte_Pattern_Test(tDevice *device, uint32_t pattern, uint32_t devic
     uint8_t *returnBuffer = (uint8_t*)malloc(deviceBufferSize);//only receive this from the drive
     if (patternBuffer && returnBuffer)
     {
-        fill_Pattern_Buffer_Into_Another_Buffer((uint8_t*)&pattern, 4, patternBuffer, deviceBufferSize);//sets the pattern to write into memory
+        fill_Buffer_Test_Pattern(patternBuffer, deviceBufferSize, pattern);//sets the pattern to write into memory
         seatimer_t patternTimer;
         memset(&patternTimer, 0, sizeof(seatimer_t));
         start_Timer(&patternTimer);
         for (uint32_t counter = 0; counter < numberOfTimesToTest; ++counter)
         {
-            bool breakFromLoop = false;//this will be set to true when we need to exit the loop for one reason or another
-            int wbResult = send_Write_Buffer_Command(device, patternBuffer, deviceBufferSize);
-            ++(testResults->totalCommandsSent);
-            switch (wbResult)
-            {
-            case OS_PASSTHROUGH_FAILURE:
-            case NOT_SUPPORTED:
-                breakFromLoop = true;
-                break;
-            case COMMAND_TIMEOUT:
-                ++(testResults->totalCommandTimeouts);
-                break;
-            case SUCCESS:
-                break;
-            case ABORTED:
-            case COMMAND_FAILURE:
-            case FAILURE:
-            default:
-                if (was_There_A_CRC_Error_On_Last_Command(device))
-                {
-                    ++(testResults->totalCommandCRCErrors);
-                }
-                continue;//continue loop since this will miscompare no matter what on the read buffer command
-            }
-            if (breakFromLoop)
-            {
-                break;
-            }
-            //now read back the pattern
-            memset(returnBuffer, 0, deviceBufferSize);
-            int rbResult = send_Read_Buffer_Command(device, returnBuffer, deviceBufferSize);
-            ++(testResults->totalCommandsSent);
-            switch (rbResult)
-            {
-            case OS_PASSTHROUGH_FAILURE:
-            case NOT_SUPPORTED:
-                breakFromLoop = true;
-                break;
-            case COMMAND_TIMEOUT:
-                ++(testResults->totalCommandTimeouts);
-                break;
-            case SUCCESS:
-                break;
-            case ABORTED:
-            case COMMAND_FAILURE:
-            case FAILURE:
-            default:
-                if (was_There_A_CRC_Error_On_Last_Command(device))
-                {
-                    ++(testResults->totalCommandCRCErrors);
-                }
-                continue;//continue loop since this will miscompare no matter what on the read buffer command
-            }
-            if (breakFromLoop)
+            if (!write_Read_Compare_Buffer(device, patternBuffer, returnBuffer, deviceBufferSize, testResults))
             {
                 break;
             }
-            ++(testResults->totalBufferComparisons);
-            //first check if the pattern matches or not
-            if (memcmp(patternBuffer, returnBuffer, deviceBufferSize))
-            {
-                ++(testResults->totalBufferMiscompares);
-            }
         }
         stop_Timer(&patternTimer);
         testResults->totalTimeNS = get_Nano_Seconds(patternTimer);
@@ -311,103 +475,43 @@ void perform_Byte_Pattern_Test(tDevice *device, uint32_t pattern, uint32_t devic
 //Function for Walking 1's/0's test
 void perform_Walking_Test(tDevice *device, bool walkingZeros, uint32_t deviceBufferSize, ptrPatternTestResults testResults)
 {
-    uint8_t *patternBuffer = (uint8_t*)calloc(deviceBufferSize, sizeof(uint8_t));//only send this to the drive
+    uint8_t *patternBuffer = (uint8_t*)malloc(deviceBufferSize);//only send this to the drive
     uint8_t *returnBuffer = (uint8_t*)malloc(deviceBufferSize);//only receive this from the drive
     if (patternBuffer && returnBuffer)
     {
-        for (uint32_t bitNumber = 0, byteNumber = 0; byteNumber < deviceBufferSize; ++bitNumber)
+        uint8_t backgroundByte = walkingZeros ? 0xFF : 0x00;
+        seatimer_t patternTimer;
+        memset(&patternTimer, 0, sizeof(seatimer_t));
+        //set the background once. Only the byte holding the walking bit changes between transfers after this.
+        fill_Buffer_Test_Pattern(patternBuffer, deviceBufferSize, walkingZeros ? UINT32_MAX : 0);
+        start_Timer(&patternTimer);
+        for (uint32_t byteNumber = 0; byteNumber < deviceBufferSize; ++byteNumber)
         {
             bool breakFromLoop = false;
-            //set the pattern
-            if (walkingZeros)
+            for (uint8_t bitNumber = 0; bitNumber < 8; ++bitNumber)
             {
-                memset(patternBuffer, 0xFF, deviceBufferSize);
-            }
-            else
-            {
-                memset(patternBuffer, 0, deviceBufferSize);
-            }
-            if (bitNumber > 7)
-            {
-                //this means we've shifted the bit through each bit of this byte, so offset to the next byte and start again
-                ++byteNumber;
-                bitNumber = 0;
-                if (byteNumber >= deviceBufferSize)
+                if (walkingZeros)
                 {
-                    break;
+                    patternBuffer[byteNumber] = backgroundByte ^ M_BitN(bitNumber);//exclusive or should turn this bit to a zero
                 }
-            }
-            if (walkingZeros)
-            {
-                patternBuffer[byteNumber] ^= M_BitN(bitNumber);//exclusive or should turn this bit to a zero
-            }
-            else
-            {
-                patternBuffer[byteNumber] |= M_BitN(bitNumber);
-            }
-            int wbResult = send_Write_Buffer_Command(device, patternBuffer, deviceBufferSize);
-            ++(testResults->totalCommandsSent);
-            switch (wbResult)
-            {
-            case OS_PASSTHROUGH_FAILURE:
-            case NOT_SUPPORTED:
-                breakFromLoop = true;
-                break;
-            case COMMAND_TIMEOUT:
-                ++(testResults->totalCommandTimeouts);
-                break;
-            case SUCCESS:
-                break;
-            case ABORTED:
-            case COMMAND_FAILURE:
-            case FAILURE:
-            default:
-                if (was_There_A_CRC_Error_On_Last_Command(device))
+                else
                 {
-                    ++(testResults->totalCommandCRCErrors);
+                    patternBuffer[byteNumber] = backgroundByte | M_BitN(bitNumber);
                 }
-                continue;//continue loop since this will miscompare no matter what on the read buffer command
-            }
-            if (breakFromLoop)
-            {
-                break;
-            }
-            //now read back the pattern
-            memset(returnBuffer, 0, deviceBufferSize);
-            int rbResult = send_Read_Buffer_Command(device, returnBuffer, deviceBufferSize);
-            ++(testResults->totalCommandsSent);
-            switch (rbResult)
-            {
-            case OS_PASSTHROUGH_FAILURE:
-            case NOT_SUPPORTED:
-                breakFromLoop = true;
-                break;
-            case COMMAND_TIMEOUT:
-                ++(testResults->totalCommandTimeouts);
-                break;
-            case SUCCESS:
-                break;
-            case ABORTED:
-            case COMMAND_FAILURE:
-            case FAILURE:
-            default:
-                if (was_There_A_CRC_Error_On_Last_Command(device))
+                if (!write_Read_Compare_Buffer(device, patternBuffer, returnBuffer, deviceBufferSize, testResults))
                 {
-                    ++(testResults->totalCommandCRCErrors);
+                    breakFromLoop = true;
+                    break;
                 }
-                continue;//continue loop since this will miscompare no matter what on the read buffer command
             }
+            patternBuffer[byteNumber] = backgroundByte;
             if (breakFromLoop)
             {
                 break;
             }
-            ++(testResults->totalBufferComparisons);
-            //first check if the pattern matches or not
-            if (memcmp(patternBuffer, returnBuffer, deviceBufferSize))
-            {
-                ++(testResults->totalBufferMiscompares);
-            }
         }
+        stop_Timer(&patternTimer);
+        testResults->totalTimeNS = get_Nano_Seconds(patternTimer);
     }
     safe_Free(patternBuffer);
     safe_Free(returnBuffer);
@@ -420,73 +524,19 @@ void perform_Random_Pattern_Test(tDevice *device, uint32_t deviceBufferSize, ptr
     uint8_t *returnBuffer = (uint8_t*)malloc(deviceBufferSize);//only receive this from the drive
     if (patternBuffer && returnBuffer)
     {
+        seatimer_t patternTimer;
+        memset(&patternTimer, 0, sizeof(seatimer_t));
+        start_Timer(&patternTimer);
         for (uint32_t counter = 0; counter < numberOfTimesToTest; ++counter)
         {
-            bool breakFromLoop = false;
             fill_Random_Pattern_In_Buffer(patternBuffer, deviceBufferSize);//set a new random pattern each time
-            int wbResult = send_Write_Buffer_Command(device, patternBuffer, deviceBufferSize);
-            ++(testResults->totalCommandsSent);
-            switch (wbResult)
-            {
-            case OS_PASSTHROUGH_FAILURE:
-            case NOT_SUPPORTED:
-                breakFromLoop = true;
-                break;
-            case COMMAND_TIMEOUT:
-                ++(testResults->totalCommandTimeouts);
-                break;
-            case SUCCESS:
-                break;
-            case ABORTED:
-            case COMMAND_FAILURE:
-            case FAILURE:
-            default:
-                if (was_There_A_CRC_Error_On_Last_Command(device))
-                {
-                    ++(testResults->totalCommandCRCErrors);
-                }
-                continue;//continue loop since this will miscompare no matter what on the read buffer command
-            }
-            if (breakFromLoop)
-            {
-                break;
-            }
-            //now read back the pattern
-            memset(returnBuffer, 0, deviceBufferSize);
-            int rbResult = send_Read_Buffer_Command(device, returnBuffer, deviceBufferSize);
-            ++(testResults->totalCommandsSent);
-            switch (rbResult)
+            if (!write_Read_Compare_Buffer(device, patternBuffer, returnBuffer, deviceBufferSize, testResults))
             {
-            case OS_PASSTHROUGH_FAILURE:
-            case NOT_SUPPORTED:
-                breakFromLoop = true;
                 break;
-            case COMMAND_TIMEOUT:
-                ++(testResults->totalCommandTimeouts);
-                break;
-            case SUCCESS:
-                break;
-            case ABORTED:
-            case COMMAND_FAILURE:
-            case FAILURE:
-            default:
-                if (was_There_A_CRC_Error_On_Last_Command(device))
-                {
-                    ++(testResults->totalCommandCRCErrors);
-                }
-                continue;//continue loop since this will miscompare no matter what on the read buffer command
-            }
-            if (breakFromLoop)
-            {
-                break;
-            }
-            ++(testResults->totalBufferComparisons);
-            //first check if the pattern matches or not
-            if (memcmp(patternBuffer, returnBuffer, deviceBufferSize))
-            {
-                ++(testResults->totalBufferMiscompares);
             }
         }
+        stop_Timer(&patternTimer);
+        testResults->totalTimeNS = get_Nano_Seconds(patternTimer);
     }
     safe_Free(patternBuffer);
     safe_Free(returnBuffer);
@@ -563,118 +613,226 @@ int perform_Cable_Test(tDevice *device, ptrCableTestResults testResults)
     return ret;
 }
 
-void print_Cable_Test_Results(cableTestResults testResults)
+//Patterns cycled through by the link stress test when random patterns are not requested
+static const uint32_t linkStressPatterns[] = { UINT32_C(0x00000000), UINT32_C(0xFFFFFFFF), UINT32_C(0x55555555), UINT32_C(0xAAAAAAAA), UINT32_C(0x00FF55AA) };
+
+int perform_Link_Stress_Test(tDevice *device, ptrLinkStressOptions options, ptrLinkStressResults results)
 {
-    int tempverbosity = g_verbosity;
-    g_verbosity = VERBOSITY_COMMAND_VERBOSE;
-    printf("Test Results:\n");
-    printf("=============\n");
-    printf("Total test time: ");
-    print_Command_Time(testResults.totalTestTimeNS);
-    printf("\n");
-    printf("00h Test Pattern:\n");
-    for (uint8_t count = 0; count < ALL_0_TEST_COUNT; ++count)
+    int ret = SUCCESS;
+    uint8_t offsetPO2 = 0;
+    uint32_t bufferSize = 0;
+    if (!options || !results || (options->timeLimitSeconds == 0 && options->byteLimit == 0))
     {
-        printf("    Run %" PRIu8 ":\n", count + 1);
-        printf("        Total commands sent: %" PRIu32 "\n", testResults.zerosTest[count].totalCommandsSent);
-        printf("        Number of command CRC errors: %" PRIu32 "\n", testResults.zerosTest[count].totalCommandCRCErrors);
-        printf("        Number of command timeouts: %" PRIu32 "\n", testResults.zerosTest[count].totalCommandTimeouts);
-        printf("        Number of buffer comparisons: %" PRIu32 "\n", testResults.zerosTest[count].totalBufferComparisons);
-        printf("        Number of buffer miscompares: %" PRIu32 "\n", testResults.zerosTest[count].totalBufferMiscompares);
-        printf("        Test time: ");
-        print_Command_Time(testResults.zerosTest[count].totalTimeNS);
-        printf("\n");
+        return BAD_PARAMETER;
     }
-    printf("FFh Test Pattern:\n");
-    for (uint8_t count = 0; count < ALL_F_TEST_COUNT; ++count)
+    memset(results, 0, sizeof(linkStressResults));
+    if (!are_Buffer_Commands_Available(device) || SUCCESS != get_Buffer_Size(device, &bufferSize, &offsetPO2) || bufferSize == 0)
     {
-        printf("    Run %" PRIu8 ":\n", count + 1);
-        printf("        Total commands sent: %" PRIu32 "\n", testResults.fTest[count].totalCommandsSent);
-        printf("        Number of command CRC errors: %" PRIu32 "\n", testResults.fTest[count].totalCommandCRCErrors);
-        printf("        Number of command timeouts: %" PRIu32 "\n", testResults.fTest[count].totalCommandTimeouts);
-        printf("        Number of buffer comparisons: %" PRIu32 "\n", testResults.fTest[count].totalBufferComparisons);
-        printf("        Number of buffer miscompares: %" PRIu32 "\n", testResults.fTest[count].totalBufferMiscompares);
-        printf("        Test time: ");
-        print_Command_Time(testResults.zerosTest[count].totalTimeNS);
-        printf("\n");
+        return NOT_SUPPORTED;
     }
-    printf("55h Test Pattern:\n");
-    for (uint8_t count = 0; count < ALL_5_TEST_COUNT; ++count)
+    uint8_t *patternBuffer = (uint8_t*)malloc(bufferSize);//only send this to the drive
+    uint8_t *returnBuffer = (uint8_t*)malloc(bufferSize);//only receive this from the drive
+    if (patternBuffer && returnBuffer)
     {
-        printf("    Run %" PRIu8 ":\n", count + 1);
-        printf("        Total commands sent: %" PRIu32 "\n", testResults.fivesTest[count].totalCommandsSent);
-        printf("        Number of command CRC errors: %" PRIu32 "\n", testResults.fivesTest[count].totalCommandCRCErrors);
-        printf("        Number of command timeouts: %" PRIu32 "\n", testResults.fivesTest[count].totalCommandTimeouts);
-        printf("        Number of buffer comparisons: %" PRIu32 "\n", testResults.fivesTest[count].totalBufferComparisons);
-        printf("        Number of buffer miscompares: %" PRIu32 "\n", testResults.fivesTest[count].totalBufferMiscompares);
-        printf("        Test time: ");
-        print_Command_Time(testResults.zerosTest[count].totalTimeNS);
-        printf("\n");
+        seatimer_t stressTimer;
+        uint64_t timeLimitNS = (uint64_t)options->timeLimitSeconds * UINT64_C(1000000000);
+        uint64_t lastErrorTimeNS = 0;
+        uint64_t bytesAttempted = 0;//includes commands that failed so a link where nothing completes still reaches the byte limit
+        uint32_t patternIter = 0;
+        memset(&stressTimer, 0, sizeof(seatimer_t));
+        results->bufferSize = bufferSize;
+        start_Timer(&stressTimer);
+        while (true)
+        {
+            patternTestResults before;
+            uint64_t elapsedNS = 0;
+            if (options->randomPatterns)
+            {
+                fill_Random_Pattern_In_Buffer(patternBuffer, bufferSize);
+            }
+            else
+            {
+                fill_Buffer_Test_Pattern(patternBuffer, bufferSize, linkStressPatterns[patternIter]);
+                patternIter = (patternIter + 1) % (sizeof(linkStressPatterns) / sizeof(linkStressPatterns[0]));
+            }
+            memcpy(&before, &results->totals, sizeof(patternTestResults));
+            if (!write_Read_Compare_Buffer(device, patternBuffer, returnBuffer, bufferSize, &results->totals))
+            {
+                ret = FAILURE;
+                break;
+            }
+            results->bytesTransferred += (uint64_t)(results->totals.totalBufferComparisons - before.totalBufferComparisons) * bufferSize * 2;
+            bytesAttempted += (uint64_t)(results->totals.totalCommandsSent - before.totalCommandsSent) * bufferSize;
+            stop_Timer(&stressTimer);//updates the stop time so the elapsed time can be checked without restarting the timer
+            elapsedNS = get_Nano_Seconds(stressTimer);
+            //no comparison means one of the commands failed. Anything else shows up in the counters
+            if (results->totals.totalBufferComparisons == before.totalBufferComparisons
+                || results->totals.totalCommandCRCErrors != before.totalCommandCRCErrors
+                || results->totals.totalCommandTimeouts != before.totalCommandTimeouts
+                || results->totals.totalBufferMiscompares != before.totalBufferMiscompares)
+            {
+                if (!results->firstErrorValid)
+                {
+                    results->firstErrorValid = true;
+                    results->timeToFirstErrorNS = elapsedNS;
+                }
+                if (results->errorIntervalCount < LINK_STRESS_MAX_ERROR_INTERVALS)
+                {
+                    results->errorIntervalNS[results->errorIntervalCount] = elapsedNS - lastErrorTimeNS;
+                    ++(results->errorIntervalCount);
+                }
+                lastErrorTimeNS = elapsedNS;
+                ++(results->errorEvents);
+            }
+            if ((timeLimitNS > 0 && elapsedNS >= timeLimitNS) || (options->byteLimit > 0 && bytesAttempted >= options->byteLimit))
+            {
+                break;
+            }
+        }
+        stop_Timer(&stressTimer);
+        results->totals.totalTimeNS = get_Nano_Seconds(stressTimer);
     }
-    printf("AAh Test Pattern:\n");
-    for (uint8_t count = 0; count < ALL_A_TEST_COUNT; ++count)
+    else
     {
-        printf("    Run %" PRIu8 ":\n", count + 1);
-        printf("        Total commands sent: %" PRIu32 "\n", testResults.aTest[count].totalCommandsSent);
-        printf("        Number of command CRC errors: %" PRIu32 "\n", testResults.aTest[count].totalCommandCRCErrors);
-        printf("        Number of command timeouts: %" PRIu32 "\n", testResults.aTest[count].totalCommandTimeouts);
-        printf("        Number of buffer comparisons: %" PRIu32 "\n", testResults.aTest[count].totalBufferComparisons);
-        printf("        Number of buffer miscompares: %" PRIu32 "\n", testResults.aTest[count].totalBufferMiscompares);
-        printf("        Test time: ");
-        print_Command_Time(testResults.zerosTest[count].totalTimeNS);
-        printf("\n");
+        ret = MEMORY_FAILURE;
     }
-    printf("00FF55AAh Test Pattern:\n");
-    for (uint8_t count = 0; count < ZERO_F_5_A_TEST_COUNT; ++count)
+    safe_Free(patternBuffer);
+    safe_Free(returnBuffer);
+    return ret;
+}
+
+static int compare_Error_Intervals(const void *a, const void *b)
+{
+    uint64_t first = *(const uint64_t*)a;
+    uint64_t second = *(const uint64_t*)b;
+    if (first < second)
     {
-        printf("    Run %" PRIu8 ":\n", count + 1);
-        printf("        Total commands sent: %" PRIu32 "\n", testResults.zeroF5ATest[count].totalCommandsSent);
-        printf("        Number of command CRC errors: %" PRIu32 "\n", testResults.zeroF5ATest[count].totalCommandCRCErrors);
-        printf("        Number of command timeouts: %" PRIu32 "\n", testResults.zeroF5ATest[count].totalCommandTimeouts);
-        printf("        Number of buffer comparisons: %" PRIu32 "\n", testResults.zeroF5ATest[count].totalBufferComparisons);
-        printf("        Number of buffer miscompares: %" PRIu32 "\n", testResults.zeroF5ATest[count].totalBufferMiscompares);
-        printf("        Test time: ");
-        print_Command_Time(testResults.zerosTest[count].totalTimeNS);
-        printf("\n");
+        return -1;
     }
-    printf("Walking 1's Test:\n");
-    for (uint8_t count = 0; count < WALKING_1_TEST_COUNT; ++count)
+    else if (first > second)
     {
-        printf("    Run %" PRIu8 ":\n", count + 1);
-        printf("        Total commands sent: %" PRIu32 "\n", testResults.walking1sTest[count].totalCommandsSent);
-        printf("        Number of command CRC errors: %" PRIu32 "\n", testResults.walking1sTest[count].totalCommandCRCErrors);
-        printf("        Number of command timeouts: %" PRIu32 "\n", testResults.walking1sTest[count].totalCommandTimeouts);
-        printf("        Number of buffer comparisons: %" PRIu32 "\n", testResults.walking1sTest[count].totalBufferComparisons);
-        printf("        Number of buffer miscompares: %" PRIu32 "\n", testResults.walking1sTest[count].totalBufferMiscompares);
-        printf("        Test time: ");
-        print_Command_Time(testResults.zerosTest[count].totalTimeNS);
-        printf("\n");
+        return 1;
     }
-    printf("Walking 0's Test:\n");
-    for (uint8_t count = 0; count < WALKING_0_TEST_COUNT; ++count)
+    return 0;
+}
+
+void print_Link_Stress_Test_Results(ptrLinkStressResults results)
+{
+    double seconds = 0, gigabytes = 0;
+    int tempverbosity = g_verbosity;
+    if (!results)
     {
-        printf("    Run %" PRIu8 ":\n", count + 1);
-        printf("        Total commands sent: %" PRIu32 "\n", testResults.walking0sTest[count].totalCommandsSent);
-        printf("        Number of command CRC errors: %" PRIu32 "\n", testResults.walking0sTest[count].totalCommandCRCErrors);
-        printf("        Number of command timeouts: %" PRIu32 "\n", testResults.walking0sTest[count].totalCommandTimeouts);
-        printf("        Number of buffer comparisons: %" PRIu32 "\n", testResults.walking0sTest[count].totalBufferComparisons);
-        printf("        Number of buffer miscompares: %" PRIu32 "\n", testResults.walking0sTest[count].totalBufferMiscompares);
-        printf("        Test time: ");
-        print_Command_Time(testResults.zerosTest[count].totalTimeNS);
+        return;
+    }
+    g_verbosity = VERBOSITY_COMMAND_VERBOSE;
+    seconds = (double)results->totals.totalTimeNS / 1000000000.0;
+    gigabytes = (double)results->bytesTransferred / 1000000000.0;
+    printf("Link Stress Test Results:\n");
+    printf("=========================\n");
+    printf("Transfer size: %" PRIu32 " bytes\n", results->bufferSize);
+    printf("Total test time: ");
+    print_Command_Time(results->totals.totalTimeNS);
+    printf("\n");
+    printf("Total data transferred: %" PRIu64 " bytes\n", results->bytesTransferred);
+    if (seconds > 0)
+    {
+        printf("Throughput: %0.2f MB/s\n", ((double)results->bytesTransferred / 1000000.0) / seconds);
+    }
+    printf("Total commands sent: %" PRIu32 "\n", results->totals.totalCommandsSent);
+    printf("Number of command CRC errors: %" PRIu32 "\n", results->totals.totalCommandCRCErrors);
+    if (gigabytes > 0)
+    {
+        printf("CRC errors per GB: %0.4f\n", (double)results->totals.totalCommandCRCErrors / gigabytes);
+    }
+    printf("Number of command timeouts: %" PRIu32 "\n", results->totals.totalCommandTimeouts);
+    printf("Number of buffer comparisons: %" PRIu32 "\n", results->totals.totalBufferComparisons);
+    printf("Number of buffer miscompares: %" PRIu32 "\n", results->totals.totalBufferMiscompares);
+    printf("Number of bit errors: %" PRIu64 " of %" PRIu64 " bits compared\n", results->totals.totalBitErrors, results->totals.totalBitsCompared);
+    if (results->totals.totalBitsCompared > 0)
+    {
+        printf("Bit error rate: %e\n", (double)results->totals.totalBitErrors / (double)results->totals.totalBitsCompared);
+    }
+    printf("Error events: %" PRIu32 "\n", results->errorEvents);
+    if (results->firstErrorValid)
+    {
+        uint64_t sortedIntervals[LINK_STRESS_MAX_ERROR_INTERVALS] = { 0 };
+        uint64_t intervalSum = 0;
+        printf("Time to first error: ");
+        print_Command_Time(results->timeToFirstErrorNS);
         printf("\n");
+        if (results->errorIntervalCount > 1)
+        {
+            memcpy(sortedIntervals, results->errorIntervalNS, results->errorIntervalCount * sizeof(uint64_t));
+            qsort(sortedIntervals, results->errorIntervalCount, sizeof(uint64_t), compare_Error_Intervals);
+            for (uint32_t intervalIter = 0; intervalIter < results->errorIntervalCount; ++intervalIter)
+            {
+                intervalSum += sortedIntervals[intervalIter];
+            }
+            printf("Time between errors (first %" PRIu32 " errors):\n", results->errorIntervalCount);
+            printf("    Minimum: ");
+            print_Command_Time(sortedIntervals[0]);
+            printf("\n    Median: ");
+            print_Command_Time(sortedIntervals[results->errorIntervalCount / 2]);
+            printf("\n    90th percentile: ");
+            print_Command_Time(sortedIntervals[(results->errorIntervalCount * 9) / 10]);
+            printf("\n    Maximum: ");
+            print_Command_Time(sortedIntervals[results->errorIntervalCount - 1]);
+            printf("\n    Average: ");
+            print_Command_Time(intervalSum / results->errorIntervalCount);
+            printf("\n");
+        }
     }
-    printf("Random Pattern Test:\n");
-    for (uint8_t count = 0; count < RANDOM_TEST_COUNT; ++count)
+    g_verbosity = tempverbosity;
+}
+
+static void print_Pattern_Test_Runs(const char *testName, ptrPatternTestResults runs, uint8_t numberOfRuns)
+{
+    printf("%s:\n", testName);
+    for (uint8_t count = 0; count < numberOfRuns; ++count)
     {
         printf("    Run %" PRIu8 ":\n", count + 1);
-        printf("        Total commands sent: %" PRIu32 "\n", testResults.randomTest[count].totalCommandsSent);
-        printf("        Number of command CRC errors: %" PRIu32 "\n", testResults.randomTest[count].totalCommandCRCErrors);
-        printf("        Number of command timeouts: %" PRIu32 "\n", testResults.randomTest[count].totalCommandTimeouts);
-        printf("        Number of buffer comparisons: %" PRIu32 "\n", testResults.randomTest[count].totalBufferComparisons);
-        printf("        Number of buffer miscompares: %" PRIu32 "\n", testResults.randomTest[count].totalBufferMiscompares);
+        printf("        Total commands sent: %" PRIu32 "\n", runs[count].totalCommandsSent);
+        printf("        Number of command CRC errors: %" PRIu32 "\n", runs[count].totalCommandCRCErrors);
+        printf("        Number of command timeouts: %" PRIu32 "\n", runs[count].totalCommandTimeouts);
+        printf("        Number of buffer comparisons: %" PRIu32 "\n", runs[count].totalBufferComparisons);
+        printf("        Number of buffer miscompares: %" PRIu32 "\n", runs[count].totalBufferMiscompares);
+        printf("        Number of bit errors: %" PRIu64 " of %" PRIu64 " bits compared\n", runs[count].totalBitErrors, runs[count].totalBitsCompared);
+        if (runs[count].totalBitsCompared > 0)
+        {
+            printf("        Bit error rate: %e\n", (double)runs[count].totalBitErrors / (double)runs[count].totalBitsCompared);
+        }
+        if (runs[count].miscompareOffsetValid)
+        {
+            printf("        First miscompare at buffer offset: %" PRIu32 "\n", runs[count].firstMiscompareOffset);
+            printf("        Bit errors by bit position (0 - 7):");
+            for (uint8_t bitIter = 0; bitIter < 8; ++bitIter)
+            {
+                printf(" %" PRIu32, runs[count].bitErrorsByBitPosition[bitIter]);
+            }
+            printf("\n");
+        }
         printf("        Test time: ");
-        print_Command_Time(testResults.zerosTest[count].totalTimeNS);
+        print_Command_Time(runs[count].totalTimeNS);
         printf("\n");
     }
+}
+
+void print_Cable_Test_Results(cableTestResults testResults)
+{
+    int tempverbosity = g_verbosity;
+    g_verbosity = VERBOSITY_COMMAND_VERBOSE;
+    printf("Test Results:\n");
+    printf("=============\n");
+    printf("Total test time: ");
+    print_Command_Time(testResults.totalTestTimeNS);
+    printf("\n");
+    print_Pattern_Test_Runs("00h Test Pattern", testResults.zerosTest, ALL_0_TEST_COUNT);
+    print_Pattern_Test_Runs("FFh Test Pattern", testResults.fTest, ALL_F_TEST_COUNT);
+    print_Pattern_Test_Runs("55h Test Pattern", testResults.fivesTest, ALL_5_TEST_COUNT);
+    print_Pattern_Test_Runs("AAh Test Pattern", testResults.aTest, ALL_A_TEST_COUNT);
+    print_Pattern_Test_Runs("00FF55AAh Test Pattern", testResults.zeroF5ATest, ZERO_F_5_A_TEST_COUNT);
+    print_Pattern_Test_Runs("Walking 1's Test", testResults.walking1sTest, WALKING_1_TEST_COUNT);
+    print_Pattern_Test_Runs("Walking 0's Test", testResults.walking0sTest, WALKING_0_TEST_COUNT);
+    print_Pattern_Test_Runs("Random Pattern Test", testResults.randomTest, RANDOM_TEST_COUNT);
     g_verbosity = tempverbosity;
-}
\ No newline at end of file
+}
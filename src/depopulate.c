@@ -13,6 +13,7 @@
 // \brief This file defines the functions for depopulating physical/storage elements on a drive (Remanufacture)
 
 #include "depopulate.h"
+#include "device_page_cache.h"
 #include "seagate_operations.h" //Including this so we can read the Seagate vendos specific version stuff and mask it to look like ACS4/SBC4
 
 bool is_Depopulation_Feature_Supported(tDevice *device, uint64_t *depopulationTime)
@@ -94,7 +95,7 @@ bool is_Depopulation_Feature_Supported(tDevice *device, uint64_t *depopulationTi
             {
                 *depopulationTime = UINT64_MAX;
                 uint8_t blockDeviceCharacteristics[VPD_BLOCK_DEVICE_CHARACTERISTICS_LEN] = { 0 };
-                if (SUCCESS == scsi_Inquiry(device, blockDeviceCharacteristics, VPD_BLOCK_DEVICE_CHARACTERISTICS_LEN, BLOCK_DEVICE_CHARACTERISTICS, true, false))
+                if (SUCCESS == scsi_Inquiry_Cached(device, blockDeviceCharacteristics, VPD_BLOCK_DEVICE_CHARACTERISTICS_LEN, BLOCK_DEVICE_CHARACTERISTICS, true))
                 {
                     *depopulationTime = M_BytesTo4ByteValue(blockDeviceCharacteristics[12], blockDeviceCharacteristics[13], blockDeviceCharacteristics[14], blockDeviceCharacteristics[15]);
                 }
@@ -286,5 +287,9 @@ int depopulate_Physical_Element(tDevice *device, uint32_t elementDescriptorID, u
     {
         ret = scsi_Remove_And_Truncate(device, requestedMaxLBA, elementDescriptorID);
     }
+    if (ret != NOT_SUPPORTED)
+    {
+        invalidate_Device_Page_Cache(device);//the capacity changes
+    }
     return ret;
 }
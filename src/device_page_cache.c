@@ -0,0 +1,409 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file device_page_cache.c
+// \brief This file defines the functions for sharing identify and inquiry/VPD data and learned transfer sizes between operations on the same device
+
+#include "operations_Common.h"
+#include "device_page_cache.h"
+#include "worker_pool.h"
+
+static workerLock pageCacheLock = WORKER_LOCK_INIT;
+
+typedef enum _eCachedPageType
+{
+    CACHED_PAGE_SCSI_INQUIRY,
+    CACHED_PAGE_SCSI_VPD,
+    CACHED_PAGE_ATA_IDENTIFY,
+    CACHED_PAGE_ATA_GPL_DIRECTORY,
+    CACHED_PAGE_ATA_SMART_DIRECTORY,
+    CACHED_PAGE_NVME_IDENTIFY
+}eCachedPageType;
+
+typedef struct _cachedPage
+{
+    eCachedPageType type;
+    uint32_t pageID;//VPD page code or NVMe CNS
+    uint32_t namespaceID;//NVMe only
+    uint32_t dataLength;
+    uint8_t *data;
+    struct _cachedPage *next;
+}cachedPage, *ptrCachedPage;
+
+typedef struct _transferSizeLimits
+{
+    uint32_t largestWorked;//0 = nothing has worked yet
+    uint32_t smallestFailed;//0 = nothing has failed yet
+}transferSizeLimits;
+
+typedef struct _devicePageCache
+{
+    tDevice *device;
+    char serialNumber[SERIAL_NUM_LEN + 1];//catches a tDevice that was closed and reused for a different drive without being invalidated
+    ptrCachedPage pages;
+    transferSizeLimits transferSizes[TRANSFER_SIZE_COMMAND_COUNT];
+    struct _devicePageCache *next;
+}devicePageCache, *ptrDevicePageCache;
+
+static ptrDevicePageCache pageCacheList = NULL;
+
+static void lock_Page_Cache(void)
+{
+    acquire_Worker_Lock(&pageCacheLock);
+}
+
+static void unlock_Page_Cache(void)
+{
+    release_Worker_Lock(&pageCacheLock);
+}
+
+static void free_Cached_Pages(ptrCachedPage pages)
+{
+    while (pages)
+    {
+        ptrCachedPage next = pages->next;
+        safe_Free(pages->data);
+        safe_Free(pages);
+        pages = next;
+    }
+}
+
+//must be called with the lock held
+static ptrDevicePageCache find_Device_Page_Cache(tDevice *device, bool create)
+{
+    ptrDevicePageCache deviceCache = pageCacheList;
+    while (deviceCache && deviceCache->device != device)
+    {
+        deviceCache = deviceCache->next;
+    }
+    if (deviceCache && strncmp(deviceCache->serialNumber, device->drive_info.serialNumber, SERIAL_NUM_LEN) != 0)
+    {
+        //same tDevice, different drive. Nothing kept is any good anymore
+        free_Cached_Pages(deviceCache->pages);
+        deviceCache->pages = NULL;
+        memset(deviceCache->transferSizes, 0, sizeof(deviceCache->transferSizes));
+        snprintf(deviceCache->serialNumber, SERIAL_NUM_LEN + 1, "%s", device->drive_info.serialNumber);
+    }
+    if (!deviceCache && create)
+    {
+        deviceCache = (ptrDevicePageCache)calloc(1, sizeof(devicePageCache));
+        if (deviceCache)
+        {
+            deviceCache->device = device;
+            snprintf(deviceCache->serialNumber, SERIAL_NUM_LEN + 1, "%s", device->drive_info.serialNumber);
+            deviceCache->next = pageCacheList;
+            pageCacheList = deviceCache;
+        }
+    }
+    return deviceCache;
+}
+
+//must be called with the lock held
+static ptrCachedPage find_Cached_Page(ptrDevicePageCache deviceCache, eCachedPageType type, uint32_t pageID, uint32_t namespaceID)
+{
+    ptrCachedPage page = deviceCache ? deviceCache->pages : NULL;
+    while (page && (page->type != type || page->pageID != pageID || page->namespaceID != namespaceID))
+    {
+        page = page->next;
+    }
+    return page;
+}
+
+//copies a kept page into the caller's buffer. Returns false when the page has not been read yet, or a shorter read of it was kept
+static bool read_Cached_Page(tDevice *device, eCachedPageType type, uint32_t pageID, uint32_t namespaceID, uint8_t *ptrData, uint32_t dataLength)
+{
+    bool found = false;
+    lock_Page_Cache();
+    ptrCachedPage page = find_Cached_Page(find_Device_Page_Cache(device, false), type, pageID, namespaceID);
+    if (page && page->dataLength >= dataLength)
+    {
+        memcpy(ptrData, page->data, dataLength);
+        found = true;
+    }
+    unlock_Page_Cache();
+    return found;
+}
+
+//keeps a copy of a page that was just read from the drive. A failed allocation only means the page will be read from the drive again next time.
+static void keep_Cached_Page(tDevice *device, eCachedPageType type, uint32_t pageID, uint32_t namespaceID, uint8_t *ptrData, uint32_t dataLength)
+{
+    uint8_t *data = (uint8_t*)malloc(dataLength);
+    if (!data)
+    {
+        return;
+    }
+    memcpy(data, ptrData, dataLength);
+    lock_Page_Cache();
+    ptrDevicePageCache deviceCache = find_Device_Page_Cache(device, true);
+    ptrCachedPage page = find_Cached_Page(deviceCache, type, pageID, namespaceID);
+    if (!page && deviceCache)
+    {
+        page = (ptrCachedPage)calloc(1, sizeof(cachedPage));
+        if (page)
+        {
+            page->type = type;
+            page->pageID = pageID;
+            page->namespaceID = namespaceID;
+            page->next = deviceCache->pages;
+            deviceCache->pages = page;
+        }
+    }
+    if (page && dataLength >= page->dataLength)
+    {
+        safe_Free(page->data);
+        page->data = data;
+        page->dataLength = dataLength;
+        data = NULL;
+    }
+    unlock_Page_Cache();
+    safe_Free(data);
+}
+
+int scsi_Inquiry_Cached(tDevice *device, uint8_t *pDataBuf, uint32_t dataLength, uint8_t pageCode, bool evpd)
+{
+    int ret = SUCCESS;
+    eCachedPageType type = evpd ? CACHED_PAGE_SCSI_VPD : CACHED_PAGE_SCSI_INQUIRY;
+    if (!device || !pDataBuf || dataLength == 0)
+    {
+        return BAD_PARAMETER;
+    }
+    if (!read_Cached_Page(device, type, pageCode, 0, pDataBuf, dataLength))
+    {
+        ret = scsi_Inquiry(device, pDataBuf, dataLength, pageCode, evpd, false);
+        if (ret == SUCCESS)
+        {
+            keep_Cached_Page(device, type, pageCode, 0, pDataBuf, dataLength);
+        }
+    }
+    return ret;
+}
+
+int ata_Identify_Cached(tDevice *device, uint8_t *ptrData, uint32_t dataSize)
+{
+    int ret = SUCCESS;
+    if (!device || !ptrData || dataSize == 0)
+    {
+        return BAD_PARAMETER;
+    }
+    if (!read_Cached_Page(device, CACHED_PAGE_ATA_IDENTIFY, 0, 0, ptrData, dataSize))
+    {
+        ret = ata_Identify(device, ptrData, dataSize);
+        if (ret == SUCCESS)
+        {
+            keep_Cached_Page(device, CACHED_PAGE_ATA_IDENTIFY, 0, 0, ptrData, dataSize);
+        }
+    }
+    return ret;
+}
+
+int ata_Read_Log_Directory_Cached(tDevice *device, bool gpl, uint8_t *ptrData, uint32_t dataSize)
+{
+    int ret = SUCCESS;
+    eCachedPageType type = gpl ? CACHED_PAGE_ATA_GPL_DIRECTORY : CACHED_PAGE_ATA_SMART_DIRECTORY;
+    if (!device || !ptrData || dataSize == 0)
+    {
+        return BAD_PARAMETER;
+    }
+    if (!read_Cached_Page(device, type, 0, 0, ptrData, dataSize))
+    {
+        if (gpl)
+        {
+            ret = ata_Read_Log_Ext(device, ATA_LOG_DIRECTORY, 0, ptrData, dataSize, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0);
+        }
+        else
+        {
+            ret = ata_SMART_Read_Log(device, ATA_LOG_DIRECTORY, ptrData, dataSize);
+        }
+        if (ret == SUCCESS)
+        {
+            keep_Cached_Page(device, type, 0, 0, ptrData, dataSize);
+        }
+    }
+    return ret;
+}
+
+#if !defined (DISABLE_NVME_PASSTHROUGH)
+int nvme_Identify_Cached(tDevice *device, uint8_t *ptrData, uint32_t nvmeNamespace, uint32_t cns)
+{
+    int ret = SUCCESS;
+    if (!device || !ptrData)
+    {
+        return BAD_PARAMETER;
+    }
+    if (!read_Cached_Page(device, CACHED_PAGE_NVME_IDENTIFY, cns, nvmeNamespace, ptrData, NVME_IDENTIFY_DATA_LEN))
+    {
+        ret = nvme_Identify(device, ptrData, nvmeNamespace, cns);
+        if (ret == SUCCESS)
+        {
+            keep_Cached_Page(device, CACHED_PAGE_NVME_IDENTIFY, cns, nvmeNamespace, ptrData, NVME_IDENTIFY_DATA_LEN);
+        }
+    }
+    return ret;
+}
+#endif
+
+//must be called with the lock held. Halfway between the largest transfer that worked and the smallest one that failed, so each failure halves what is left to search.
+static uint32_t next_Transfer_Size(transferSizeLimits *limits, uint32_t maximumSize)
+{
+    uint32_t nextSize = maximumSize;
+    if (limits->smallestFailed)
+    {
+        nextSize = (limits->largestWorked + limits->smallestFailed) / 2;
+        nextSize -= nextSize % TRANSFER_SIZE_GRANULARITY;
+        nextSize = M_Max(nextSize, limits->largestWorked);
+    }
+    nextSize = M_Min(nextSize, maximumSize);
+    return M_Max(nextSize, TRANSFER_SIZE_GRANULARITY);
+}
+
+uint32_t get_Device_Transfer_Size(tDevice *device, eTransferSizeCommand command, uint32_t maximumSize)
+{
+    uint32_t transferSize = maximumSize;
+    if (!device || command >= TRANSFER_SIZE_COMMAND_COUNT)
+    {
+        return M_Max(maximumSize, TRANSFER_SIZE_GRANULARITY);
+    }
+    lock_Page_Cache();
+    ptrDevicePageCache deviceCache = find_Device_Page_Cache(device, false);
+    if (deviceCache)
+    {
+        transferSize = next_Transfer_Size(&deviceCache->transferSizes[command], maximumSize);
+    }
+    unlock_Page_Cache();
+    return M_Max(transferSize, TRANSFER_SIZE_GRANULARITY);
+}
+
+bool is_Transfer_Size_Failure(tDevice *device, int commandResult)
+{
+    uint8_t senseKey = 0, asc = 0, ascq = 0, fru = 0;
+    if (!device)
+    {
+        return false;
+    }
+    if (commandResult == OS_PASSTHROUGH_FAILURE)
+    {
+        //the OS, driver, or adapter couldn't send it. Transfers bigger than they can map are the usual reason
+        return true;
+    }
+    if (commandResult != COMMAND_FAILURE && commandResult != NOT_SUPPORTED)
+    {
+        return false;
+    }
+    if (device->drive_info.drive_type == ATA_DRIVE && (device->drive_info.lastCommandRTFRs.status & ATA_STATUS_BIT_ERROR))
+    {
+        //the drive got the command and turned it down itself (abort, or a medium error)
+        return false;
+    }
+    //USB bridges and SATLs turn down a transfer length they can't handle as an invalid field in the CDB.
+    //An ATA abort (aborted command), busy, and medium or data errors say nothing about the size, so they are not retried smaller.
+    get_Sense_Key_ASC_ASCQ_FRU(device->drive_info.lastCommandSenseData, SPC3_SENSE_LEN, &senseKey, &asc, &ascq, &fru);
+    return senseKey == SENSE_KEY_ILLEGAL_REQUEST && asc == 0x24 && ascq == 0;
+}
+
+uint32_t reduce_Device_Transfer_Size(tDevice *device, eTransferSizeCommand command, uint32_t failedSize)
+{
+    uint32_t nextSize = 0;
+    if (!device || command >= TRANSFER_SIZE_COMMAND_COUNT || failedSize <= TRANSFER_SIZE_GRANULARITY)
+    {
+        return 0;
+    }
+    lock_Page_Cache();
+    ptrDevicePageCache deviceCache = find_Device_Page_Cache(device, true);
+    if (deviceCache)
+    {
+        transferSizeLimits *limits = &deviceCache->transferSizes[command];
+        //a size that has already worked failing means something other than the size is wrong, so don't learn anything from it
+        if (failedSize > limits->largestWorked)
+        {
+            if (limits->smallestFailed == 0 || failedSize < limits->smallestFailed)
+            {
+                limits->smallestFailed = failedSize;
+            }
+            nextSize = next_Transfer_Size(limits, failedSize);
+            if (nextSize >= failedSize)
+            {
+                nextSize = 0;
+            }
+        }
+    }
+    unlock_Page_Cache();
+    return nextSize;
+}
+
+void confirm_Device_Transfer_Size(tDevice *device, eTransferSizeCommand command, uint32_t transferSize)
+{
+    if (!device || command >= TRANSFER_SIZE_COMMAND_COUNT)
+    {
+        return;
+    }
+    lock_Page_Cache();
+    ptrDevicePageCache deviceCache = find_Device_Page_Cache(device, true);
+    if (deviceCache)
+    {
+        transferSizeLimits *limits = &deviceCache->transferSizes[command];
+        limits->largestWorked = M_Max(limits->largestWorked, transferSize);
+        if (limits->smallestFailed && limits->smallestFailed <= limits->largestWorked)
+        {
+            //the earlier failure wasn't because of the size after all
+            limits->smallestFailed = 0;
+        }
+    }
+    unlock_Page_Cache();
+}
+
+void reset_Device_Transfer_Sizes(tDevice *device)
+{
+    lock_Page_Cache();
+    for (ptrDevicePageCache deviceCache = pageCacheList; deviceCache; deviceCache = deviceCache->next)
+    {
+        if (!device || deviceCache->device == device)
+        {
+            memset(deviceCache->transferSizes, 0, sizeof(deviceCache->transferSizes));
+        }
+    }
+    unlock_Page_Cache();
+}
+
+void invalidate_Device_Page_Cache(tDevice *device)
+{
+    lock_Page_Cache();
+    for (ptrDevicePageCache deviceCache = pageCacheList; deviceCache; deviceCache = deviceCache->next)
+    {
+        if (!device || deviceCache->device == device)
+        {
+            //transfer sizes are left alone. They are limits of the path to the drive as much as the drive, and relearning them costs failed commands
+            free_Cached_Pages(deviceCache->pages);
+            deviceCache->pages = NULL;
+        }
+    }
+    unlock_Page_Cache();
+}
+
+void release_Device_Page_Cache(tDevice *device)
+{
+    lock_Page_Cache();
+    ptrDevicePageCache *link = &pageCacheList;
+    while (*link)
+    {
+        ptrDevicePageCache deviceCache = *link;
+        if (!device || deviceCache->device == device)
+        {
+            *link = deviceCache->next;
+            free_Cached_Pages(deviceCache->pages);
+            safe_Free(deviceCache);
+        }
+        else
+        {
+            link = &deviceCache->next;
+        }
+    }
+    unlock_Page_Cache();
+}
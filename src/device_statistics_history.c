@@ -0,0 +1,546 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file device_statistics_history.c
+// \brief This file defines the functions for recording device statistics over time into a fixed size history file
+
+#include "operations_Common.h"
+#include "device_statistics_history.h"
+
+//File layout. All multi-byte fields are little endian so that files can be moved between hosts.
+//File header:
+//  0 - 7    signature
+//  8 - 11   version
+//  12 - 15  column count
+//  16 - 19  block size
+//  20 - 23  block count
+//  24 - 27  blocks used
+//  28 - 31  oldest block
+//  32 - 35  newest block
+//  40 - 47  next block sequence number
+//  48 - 79  serial number
+//  80 - ... column names, DEVICE_STATISTICS_HISTORY_COLUMN_NAME_LENGTH bytes each
+//Block header:
+//  0 - 7    sequence number (0 = never written)
+//  8 - 11   sample count
+//  12 - 19  first timestamp
+//  20 - 27  last timestamp
+//  28 - ... 2 byte length of each stream (timestamps first, then each column)
+//The streams follow the block header, back to back.
+#define HISTORY_SIGNATURE "OSDSHIST"
+#define HISTORY_SIGNATURE_LENGTH 8
+#define HISTORY_VERSION 1
+#define HISTORY_FILE_HEADER_SIZE 2048
+#define HISTORY_SERIAL_NUMBER_OFFSET 48
+#define HISTORY_COLUMN_NAMES_OFFSET 80
+#define HISTORY_BLOCK_STREAM_LENGTHS_OFFSET 28
+#define HISTORY_BLOCK_HEADER_SIZE(columnCount) (HISTORY_BLOCK_STREAM_LENGTHS_OFFSET + 2 * ((columnCount) + 1))
+#define HISTORY_MAX_VARINT_LENGTH 10
+
+static void set_History_Field(uint8_t *buffer, uint64_t value, uint8_t fieldLength)
+{
+    for (uint8_t iter = 0; iter < fieldLength; ++iter)
+    {
+        buffer[iter] = (uint8_t)(value >> (8 * iter));
+    }
+}
+
+static uint64_t get_History_Field(uint8_t *buffer, uint8_t fieldLength)
+{
+    uint64_t value = 0;
+    for (uint8_t iter = 0; iter < fieldLength; ++iter)
+    {
+        value |= (uint64_t)buffer[iter] << (8 * iter);
+    }
+    return value;
+}
+
+//The first value in a block is stored as is. Every value after it is the difference from the one before it, zigzag encoded so that small
+//negative differences are also small. Unsigned wraparound is intended: NOT_AVAILABLE (UINT64_MAX) is only a small step away from 0.
+static uint8_t encode_History_Value(uint64_t value, uint64_t previousValue, bool firstValue, uint8_t *encoded)
+{
+    uint64_t varint = value;
+    uint8_t length = 0;
+    if (!firstValue)
+    {
+        int64_t delta = (int64_t)(value - previousValue);
+        varint = ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63);
+    }
+    do
+    {
+        encoded[length] = varint & 0x7F;
+        varint >>= 7;
+        if (varint)
+        {
+            encoded[length] |= BIT7;
+        }
+        ++length;
+    } while (varint);
+    return length;
+}
+
+static bool decode_History_Value(uint8_t *stream, uint16_t streamLength, uint16_t *streamOffset, uint64_t previousValue, bool firstValue, uint64_t *value)
+{
+    uint64_t varint = 0;
+    uint8_t shift = 0;
+    while (*streamOffset < streamLength && shift < 64)
+    {
+        uint8_t encodedByte = stream[*streamOffset];
+        ++(*streamOffset);
+        varint |= (uint64_t)(encodedByte & 0x7F) << shift;
+        shift += 7;
+        if (!(encodedByte & BIT7))
+        {
+            if (firstValue)
+            {
+                *value = varint;
+            }
+            else
+            {
+                int64_t delta = (int64_t)(varint >> 1) ^ -(int64_t)(varint & 1);
+                *value = previousValue + (uint64_t)delta;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+//Decodes the next sample from a block's streams. values holds the previous sample on entry and the new sample on exit.
+static bool decode_History_Sample(uint32_t streamCount, uint8_t *streams[], uint16_t streamLength[], uint16_t streamOffset[], bool firstSample, uint64_t values[])
+{
+    for (uint32_t streamIter = 0; streamIter < streamCount; ++streamIter)
+    {
+        if (!decode_History_Value(streams[streamIter], streamLength[streamIter], &streamOffset[streamIter], values[streamIter], firstSample, &values[streamIter]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void write_History_Header(ptrStatisticsHistory history)
+{
+    uint8_t *header = history->historyFile.data;
+    memset(header, 0, HISTORY_FILE_HEADER_SIZE);
+    memcpy(header, HISTORY_SIGNATURE, HISTORY_SIGNATURE_LENGTH);
+    set_History_Field(&header[8], HISTORY_VERSION, 4);
+    set_History_Field(&header[12], history->columnCount, 4);
+    set_History_Field(&header[16], DEVICE_STATISTICS_HISTORY_BLOCK_SIZE, 4);
+    set_History_Field(&header[20], history->blockCount, 4);
+    set_History_Field(&header[24], history->blocksUsed, 4);
+    set_History_Field(&header[28], history->oldestBlock, 4);
+    set_History_Field(&header[32], history->newestBlock, 4);
+    set_History_Field(&header[40], history->nextSequence, 8);
+    memcpy(&header[HISTORY_SERIAL_NUMBER_OFFSET], history->serialNumber, SERIAL_NUM_LEN);
+    for (uint32_t columnIter = 0; columnIter < history->columnCount; ++columnIter)
+    {
+        memcpy(&header[HISTORY_COLUMN_NAMES_OFFSET + columnIter * DEVICE_STATISTICS_HISTORY_COLUMN_NAME_LENGTH], history->columnNames[columnIter], DEVICE_STATISTICS_HISTORY_COLUMN_NAME_LENGTH);
+    }
+}
+
+static uint64_t get_History_Block_File_Offset(uint32_t blockIndex)
+{
+    return HISTORY_FILE_HEADER_SIZE + (uint64_t)blockIndex * DEVICE_STATISTICS_HISTORY_BLOCK_SIZE;
+}
+
+static uint8_t* get_History_Block(ptrStatisticsHistory history, uint32_t blockIndex)
+{
+    return &history->historyFile.data[get_History_Block_File_Offset(blockIndex)];
+}
+
+static void write_Newest_History_Block(ptrStatisticsHistory history)
+{
+    uint32_t streamCount = history->columnCount + 1;
+    uint32_t blockOffset = HISTORY_BLOCK_HEADER_SIZE(history->columnCount);
+    uint8_t *block = get_History_Block(history, history->newestBlock);
+    memset(block, 0, DEVICE_STATISTICS_HISTORY_BLOCK_SIZE);
+    set_History_Field(&block[0], history->nextSequence - 1, 8);
+    set_History_Field(&block[8], history->newestBlockSamples, 4);
+    set_History_Field(&block[12], history->newestBlockFirstTimestamp, 8);
+    set_History_Field(&block[20], history->lastValues[0], 8);
+    for (uint32_t streamIter = 0; streamIter < streamCount; ++streamIter)
+    {
+        set_History_Field(&block[HISTORY_BLOCK_STREAM_LENGTHS_OFFSET + 2 * streamIter], history->streamLength[streamIter], 2);
+        memcpy(&block[blockOffset], &history->streams[streamIter * DEVICE_STATISTICS_HISTORY_BLOCK_SIZE], history->streamLength[streamIter]);
+        blockOffset += history->streamLength[streamIter];
+    }
+}
+
+//Points each stream at where it is in a block of the mapped file
+static int get_History_Block_Streams(ptrStatisticsHistory history, uint8_t *block, uint8_t *streams[], uint16_t streamLength[])
+{
+    uint32_t streamCount = history->columnCount + 1;
+    uint32_t blockOffset = HISTORY_BLOCK_HEADER_SIZE(history->columnCount);
+    for (uint32_t streamIter = 0; streamIter < streamCount; ++streamIter)
+    {
+        streamLength[streamIter] = (uint16_t)get_History_Field(&block[HISTORY_BLOCK_STREAM_LENGTHS_OFFSET + 2 * streamIter], 2);
+        streams[streamIter] = &block[blockOffset];
+        blockOffset += streamLength[streamIter];
+        if (blockOffset > DEVICE_STATISTICS_HISTORY_BLOCK_SIZE)
+        {
+            return VALIDATION_FAILURE;
+        }
+    }
+    return SUCCESS;
+}
+
+int create_Device_Statistics_History(const char *fileName, const char *serialNumber, uint32_t columnCount, const char *columnNames[], uint32_t maxFileSize, ptrStatisticsHistory history)
+{
+    int ret = SUCCESS;
+    if (!fileName || !columnNames || !history || columnCount == 0 || columnCount > DEVICE_STATISTICS_HISTORY_MAX_COLUMNS || maxFileSize < HISTORY_FILE_HEADER_SIZE + 2 * DEVICE_STATISTICS_HISTORY_BLOCK_SIZE)
+    {
+        return BAD_PARAMETER;
+    }
+    for (uint32_t columnIter = 0; columnIter < columnCount; ++columnIter)
+    {
+        if (!columnNames[columnIter] || strlen(columnNames[columnIter]) >= DEVICE_STATISTICS_HISTORY_COLUMN_NAME_LENGTH)
+        {
+            return BAD_PARAMETER;
+        }
+    }
+    memset(history, 0, sizeof(statisticsHistory));
+    if (serialNumber)
+    {
+        strncpy(history->serialNumber, serialNumber, SERIAL_NUM_LEN);
+    }
+    history->columnCount = columnCount;
+    for (uint32_t columnIter = 0; columnIter < columnCount; ++columnIter)
+    {
+        strcpy(history->columnNames[columnIter], columnNames[columnIter]);
+    }
+    history->blockCount = (maxFileSize - HISTORY_FILE_HEADER_SIZE) / DEVICE_STATISTICS_HISTORY_BLOCK_SIZE;
+    history->nextSequence = 1;
+    history->streams = (uint8_t*)calloc((history->columnCount + 1) * DEVICE_STATISTICS_HISTORY_BLOCK_SIZE, sizeof(uint8_t));
+    if (!history->streams)
+    {
+        return MEMORY_FAILURE;
+    }
+    //size the whole file now so that it never grows while recording. The blocks start out zero, which is a never written block.
+    ret = map_File(fileName, FILE_MAPPING_CREATE, get_History_Block_File_Offset(history->blockCount), &history->historyFile);
+    if (ret != SUCCESS)
+    {
+        close_Device_Statistics_History(history);
+        return ret;
+    }
+    write_History_Header(history);
+    if (SUCCESS != flush_Mapped_File(&history->historyFile, 0, 0))
+    {
+        close_Device_Statistics_History(history);
+        return FAILURE;
+    }
+    return ret;
+}
+
+int open_Device_Statistics_History(const char *fileName, ptrStatisticsHistory history)
+{
+    int ret = SUCCESS;
+    uint8_t *header = NULL;
+    if (!fileName || !history)
+    {
+        return BAD_PARAMETER;
+    }
+    memset(history, 0, sizeof(statisticsHistory));
+    ret = map_File(fileName, FILE_MAPPING_READ_WRITE, 0, &history->historyFile);
+    if (ret != SUCCESS)
+    {
+        return ret == FAILURE ? VALIDATION_FAILURE : ret;
+    }
+    header = history->historyFile.data;
+    if (history->historyFile.length < HISTORY_FILE_HEADER_SIZE || memcmp(header, HISTORY_SIGNATURE, HISTORY_SIGNATURE_LENGTH) != 0
+        || get_History_Field(&header[8], 4) != HISTORY_VERSION || get_History_Field(&header[16], 4) != DEVICE_STATISTICS_HISTORY_BLOCK_SIZE)
+    {
+        close_Device_Statistics_History(history);
+        return VALIDATION_FAILURE;
+    }
+    history->columnCount = (uint32_t)get_History_Field(&header[12], 4);
+    history->blockCount = (uint32_t)get_History_Field(&header[20], 4);
+    history->blocksUsed = (uint32_t)get_History_Field(&header[24], 4);
+    history->oldestBlock = (uint32_t)get_History_Field(&header[28], 4);
+    history->newestBlock = (uint32_t)get_History_Field(&header[32], 4);
+    history->nextSequence = get_History_Field(&header[40], 8);
+    if (history->columnCount == 0 || history->columnCount > DEVICE_STATISTICS_HISTORY_MAX_COLUMNS || history->blockCount < 2 || history->historyFile.length < get_History_Block_File_Offset(history->blockCount) || history->blocksUsed > history->blockCount
+        || history->oldestBlock >= history->blockCount || history->newestBlock >= history->blockCount)
+    {
+        close_Device_Statistics_History(history);
+        return VALIDATION_FAILURE;
+    }
+    memcpy(history->serialNumber, &header[HISTORY_SERIAL_NUMBER_OFFSET], SERIAL_NUM_LEN);
+    for (uint32_t columnIter = 0; columnIter < history->columnCount; ++columnIter)
+    {
+        memcpy(history->columnNames[columnIter], &header[HISTORY_COLUMN_NAMES_OFFSET + columnIter * DEVICE_STATISTICS_HISTORY_COLUMN_NAME_LENGTH], DEVICE_STATISTICS_HISTORY_COLUMN_NAME_LENGTH - 1);
+    }
+    history->streams = (uint8_t*)calloc((history->columnCount + 1) * DEVICE_STATISTICS_HISTORY_BLOCK_SIZE, sizeof(uint8_t));
+    if (!history->streams)
+    {
+        close_Device_Statistics_History(history);
+        return MEMORY_FAILURE;
+    }
+    if (history->blocksUsed > 0)
+    {
+        //pick up where the newest block left off so new samples keep delta encoding against the last one
+        uint8_t *block = get_History_Block(history, history->newestBlock);
+        uint8_t *streams[DEVICE_STATISTICS_HISTORY_MAX_COLUMNS + 1] = { NULL };
+        uint16_t streamOffset[DEVICE_STATISTICS_HISTORY_MAX_COLUMNS + 1] = { 0 };
+        uint32_t sampleCount = (uint32_t)get_History_Field(&block[8], 4);
+        ret = get_History_Block_Streams(history, block, streams, history->streamLength);
+        for (uint32_t sampleIter = 0; ret == SUCCESS && sampleIter < sampleCount; ++sampleIter)
+        {
+            if (!decode_History_Sample(history->columnCount + 1, streams, history->streamLength, streamOffset, sampleIter == 0, history->lastValues))
+            {
+                ret = VALIDATION_FAILURE;
+            }
+        }
+        if (ret != SUCCESS)
+        {
+            close_Device_Statistics_History(history);
+            return VALIDATION_FAILURE;
+        }
+        for (uint32_t streamIter = 0; streamIter < history->columnCount + 1; ++streamIter)
+        {
+            memcpy(&history->streams[streamIter * DEVICE_STATISTICS_HISTORY_BLOCK_SIZE], streams[streamIter], history->streamLength[streamIter]);
+        }
+        history->newestBlockSamples = sampleCount;
+        history->newestBlockFirstTimestamp = get_History_Field(&block[12], 8);
+    }
+    return ret;
+}
+
+void close_Device_Statistics_History(ptrStatisticsHistory history)
+{
+    if (history)
+    {
+        unmap_File(&history->historyFile);
+        safe_Free(history->streams);
+    }
+}
+
+static void start_New_History_Block(ptrStatisticsHistory history)
+{
+    if (history->blocksUsed == 0)
+    {
+        history->oldestBlock = 0;
+        history->newestBlock = 0;
+        history->blocksUsed = 1;
+    }
+    else
+    {
+        history->newestBlock = (history->newestBlock + 1) % history->blockCount;
+        if (history->blocksUsed < history->blockCount)
+        {
+            ++history->blocksUsed;
+        }
+        else
+        {
+            //ring is full, so the oldest block is dropped
+            history->oldestBlock = (history->oldestBlock + 1) % history->blockCount;
+        }
+    }
+    ++history->nextSequence;
+    history->newestBlockSamples = 0;
+    memset(history->streamLength, 0, sizeof(history->streamLength));
+}
+
+int add_Device_Statistics_History_Sample(tDevice *device, ptrStatisticsHistory history, ptrDeviceStatistics deviceStats, uint64_t timestamp)
+{
+    int ret = SUCCESS;
+    uint64_t values[DEVICE_STATISTICS_HISTORY_MAX_COLUMNS + 1] = { 0 };
+    uint8_t encoded[DEVICE_STATISTICS_HISTORY_MAX_COLUMNS + 1][HISTORY_MAX_VARINT_LENGTH] = { { 0 } };
+    uint8_t encodedLength[DEVICE_STATISTICS_HISTORY_MAX_COLUMNS + 1] = { 0 };
+    uint32_t streamCount = 0;
+    bool newBlock = false;
+    if (!history || !history->historyFile.data || !deviceStats)
+    {
+        return BAD_PARAMETER;
+    }
+    streamCount = history->columnCount + 1;
+    values[0] = timestamp;
+    for (uint32_t columnIter = 0; columnIter < history->columnCount; ++columnIter)
+    {
+        statistic *theStatistic = find_Device_Statistic(device, deviceStats, history->columnNames[columnIter]);
+        if (theStatistic && theStatistic->isSupported && theStatistic->isValueValid)
+        {
+            values[columnIter + 1] = theStatistic->statisticValue;
+        }
+        else
+        {
+            values[columnIter + 1] = DEVICE_STATISTICS_HISTORY_VALUE_NOT_AVAILABLE;
+        }
+    }
+    newBlock = history->blocksUsed == 0;
+    if (!newBlock)
+    {
+        uint32_t blockUsed = HISTORY_BLOCK_HEADER_SIZE(history->columnCount);
+        for (uint32_t streamIter = 0; streamIter < streamCount; ++streamIter)
+        {
+            encodedLength[streamIter] = encode_History_Value(values[streamIter], history->lastValues[streamIter], false, encoded[streamIter]);
+            blockUsed += history->streamLength[streamIter] + encodedLength[streamIter];
+        }
+        newBlock = blockUsed > DEVICE_STATISTICS_HISTORY_BLOCK_SIZE;
+    }
+    if (newBlock)
+    {
+        start_New_History_Block(history);
+        for (uint32_t streamIter = 0; streamIter < streamCount; ++streamIter)
+        {
+            encodedLength[streamIter] = encode_History_Value(values[streamIter], 0, true, encoded[streamIter]);
+        }
+        history->newestBlockFirstTimestamp = timestamp;
+    }
+    for (uint32_t streamIter = 0; streamIter < streamCount; ++streamIter)
+    {
+        memcpy(&history->streams[streamIter * DEVICE_STATISTICS_HISTORY_BLOCK_SIZE + history->streamLength[streamIter]], encoded[streamIter], encodedLength[streamIter]);
+        history->streamLength[streamIter] += encodedLength[streamIter];
+        history->lastValues[streamIter] = values[streamIter];
+    }
+    ++history->newestBlockSamples;
+    write_Newest_History_Block(history);
+    ret = flush_Mapped_File(&history->historyFile, get_History_Block_File_Offset(history->newestBlock), DEVICE_STATISTICS_HISTORY_BLOCK_SIZE);
+    if (ret == SUCCESS && newBlock)
+    {
+        //the header only changes when the ring moves to another block
+        write_History_Header(history);
+        ret = flush_Mapped_File(&history->historyFile, 0, HISTORY_FILE_HEADER_SIZE);
+    }
+    return ret;
+}
+
+int record_Device_Statistics_History(tDevice *device, ptrStatisticsHistory history, uint32_t intervalSeconds, uint32_t numberOfSamples)
+{
+    int ret = SUCCESS;
+    if (!history || !history->historyFile.data)
+    {
+        return BAD_PARAMETER;
+    }
+    deviceStatistics *deviceStats = (deviceStatistics*)calloc(1, sizeof(deviceStatistics));
+    if (!deviceStats)
+    {
+        return MEMORY_FAILURE;
+    }
+    time_t nextSampleTime = time(NULL);
+    for (uint32_t sampleIter = 0; ret == SUCCESS && sampleIter < numberOfSamples; ++sampleIter)
+    {
+        if (sampleIter > 0)
+        {
+            //wait until the next interval instead of a full interval so the time spent reading the drive does not add up
+            nextSampleTime += intervalSeconds;
+            time_t currentTime = time(NULL);
+            if (currentTime < nextSampleTime)
+            {
+                delay_Seconds((uint32_t)(nextSampleTime - currentTime));
+            }
+        }
+        //the first pass reads everything, after that the statistics found are refreshed
+        if (SUCCESS != update_DeviceStatistics(device, deviceStats))
+        {
+            ret = NOT_SUPPORTED;
+            break;
+        }
+        ret = add_Device_Statistics_History_Sample(device, history, deviceStats, (uint64_t)time(NULL));
+    }
+    safe_Free(deviceStats);
+    return ret;
+}
+
+int read_Device_Statistics_History(ptrStatisticsHistory history, uint64_t startTime, uint64_t endTime, ptrStatisticsHistorySample samples, uint32_t maxSamples, uint32_t *samplesFound)
+{
+    if (!history || !history->historyFile.data || !samplesFound || (!samples && maxSamples > 0))
+    {
+        return BAD_PARAMETER;
+    }
+    *samplesFound = 0;
+    for (uint32_t blockIter = 0; blockIter < history->blocksUsed; ++blockIter)
+    {
+        uint32_t blockIndex = (history->oldestBlock + blockIter) % history->blockCount;
+        uint8_t *streams[DEVICE_STATISTICS_HISTORY_MAX_COLUMNS + 1] = { NULL };
+        uint16_t streamLength[DEVICE_STATISTICS_HISTORY_MAX_COLUMNS + 1] = { 0 };
+        uint16_t streamOffset[DEVICE_STATISTICS_HISTORY_MAX_COLUMNS + 1] = { 0 };
+        uint64_t values[DEVICE_STATISTICS_HISTORY_MAX_COLUMNS + 1] = { 0 };
+        uint8_t *block = get_History_Block(history, blockIndex);
+        uint32_t sampleCount = (uint32_t)get_History_Field(&block[8], 4);
+        //Blocks are in time order, so the first and last timestamps say whether to decode this block at all. Blocks that are skipped are never paged in from the file.
+        if (sampleCount == 0 || get_History_Field(&block[20], 8) < startTime)
+        {
+            continue;
+        }
+        if (get_History_Field(&block[12], 8) > endTime)
+        {
+            break;
+        }
+        if (SUCCESS != get_History_Block_Streams(history, block, streams, streamLength))
+        {
+            return FAILURE;
+        }
+        for (uint32_t sampleIter = 0; sampleIter < sampleCount; ++sampleIter)
+        {
+            if (!decode_History_Sample(history->columnCount + 1, streams, streamLength, streamOffset, sampleIter == 0, values))
+            {
+                return FAILURE;
+            }
+            if (values[0] < startTime || values[0] > endTime)
+            {
+                continue;
+            }
+            if (*samplesFound < maxSamples)
+            {
+                samples[*samplesFound].timestamp = values[0];
+                memcpy(samples[*samplesFound].values, &values[1], history->columnCount * sizeof(uint64_t));
+            }
+            ++(*samplesFound);
+        }
+    }
+    return SUCCESS;
+}
+
+void print_Device_Statistics_History(ptrStatisticsHistory history, ptrStatisticsHistorySample samples, uint32_t numberOfSamples)
+{
+    if (!history || !samples)
+    {
+        return;
+    }
+    printf("===Device Statistics History===\n");
+    printf("Serial Number: %s\n", history->serialNumber);
+    for (uint32_t columnIter = 0; columnIter < history->columnCount; ++columnIter)
+    {
+        printf("\tColumn %" PRIu32 " = %s\n", columnIter, history->columnNames[columnIter]);
+    }
+    printf(" %-20s", "Time:");
+    for (uint32_t columnIter = 0; columnIter < history->columnCount; ++columnIter)
+    {
+        char columnTitle[16] = { 0 };
+        sprintf(columnTitle, "Column %" PRIu32 ":", columnIter);
+        printf(" %-20s", columnTitle);
+    }
+    printf("\n");
+    for (uint32_t sampleIter = 0; sampleIter < numberOfSamples; ++sampleIter)
+    {
+        char timeString[32] = { 0 };
+        time_t sampleTime = (time_t)samples[sampleIter].timestamp;
+        struct tm *sampleTimeInfo = localtime(&sampleTime);
+        if (sampleTimeInfo)
+        {
+            strftime(timeString, 32, "%Y-%m-%d %H:%M:%S", sampleTimeInfo);
+        }
+        printf(" %-20s", timeString);
+        for (uint32_t columnIter = 0; columnIter < history->columnCount; ++columnIter)
+        {
+            if (samples[sampleIter].values[columnIter] == DEVICE_STATISTICS_HISTORY_VALUE_NOT_AVAILABLE)
+            {
+                printf(" %-20s", "N/A");
+            }
+            else
+            {
+                printf(" %-20" PRIu64, samples[sampleIter].values[columnIter]);
+            }
+        }
+        printf("\n");
+    }
+}
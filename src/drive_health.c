@@ -0,0 +1,343 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file drive_health.c
+// \brief This file defines the functions for gathering SMART, DST, defect and statistics health data in a single pass
+
+#include "operations_Common.h"
+#include "drive_health.h"
+#include "smart.h"
+#include "dst.h"
+#include "device_statistics.h"
+#include "logs.h"
+
+//Finds the attribute that caused the SMART trip from data that was already read instead of having ata_SMART_Check read it all again
+static void set_ATA_Trip_Info_From_Snapshot(tDevice *device, ptrSmartAttributeSnapshot attributes, ptrSmartTripInfo tripInfo)
+{
+    if (!attributes->thresholdsValid)
+    {
+        return;
+    }
+    for (uint8_t attrIter = 0; attrIter < attributes->attributeCount; ++attrIter)
+    {
+        ptrSmartAttributeSample sample = &attributes->attributes[attrIter];
+        if (sample->thresholdValue == 0)
+        {
+            //skip, this is an always passing attribute
+            continue;
+        }
+        if (sample->thresholdValue == 0xFF || sample->nominal <= sample->thresholdValue)
+        {
+            const char *attributeName = get_ATA_SMART_Attribute_Name(is_Seagate_Family(device), sample->attributeNumber);
+            const char *reason = sample->thresholdValue == 0xFF ? "set to test trip!" : "has tripped!";
+            tripInfo->informationIsValid = true;
+            tripInfo->additionalInformationType = SMART_TRIP_INFO_TYPE_ATA;
+            tripInfo->ataAttribute.attributeNumber = sample->attributeNumber;
+            tripInfo->ataAttribute.nominalValue = sample->nominal;
+            tripInfo->ataAttribute.thresholdValue = sample->thresholdValue;
+            if (attributeName)
+            {
+                snprintf(tripInfo->reasonString, UINT8_MAX, "%s [%" PRIu8 "] %s", attributeName, sample->attributeNumber, reason);
+            }
+            else
+            {
+                snprintf(tripInfo->reasonString, UINT8_MAX, "Attribute %" PRIu8 " %s", sample->attributeNumber, reason);
+            }
+            tripInfo->reasonStringLength = (uint8_t)strlen(tripInfo->reasonString);
+            break;
+        }
+    }
+}
+
+static bool get_Snapshot_Attribute_Raw(ptrSmartAttributeSnapshot attributes, uint8_t attributeNumber, uint32_t *rawValue)
+{
+    for (uint8_t attrIter = 0; attrIter < attributes->attributeCount; ++attrIter)
+    {
+        if (attributes->attributes[attrIter].attributeNumber == attributeNumber)
+        {
+            *rawValue = M_DoubleWord0(attributes->attributes[attrIter].rawValue);
+            return true;
+        }
+    }
+    return false;
+}
+
+static void get_ATA_Health_Snapshot(tDevice *device, ptrDriveHealthSnapshot snapshot)
+{
+    uint32_t sections = snapshot->sectionsRequested;
+    bool smartEnabled = is_SMART_Enabled(device);
+    bool smartDataRead = false;
+    if (sections & HEALTH_SNAPSHOT_DEVICE_STATISTICS)
+    {
+        if (SUCCESS == get_DeviceStatistics(device, &snapshot->deviceStats))
+        {
+            snapshot->sectionsValid |= HEALTH_SNAPSHOT_DEVICE_STATISTICS;
+        }
+    }
+    if ((sections & HEALTH_SNAPSHOT_SMART_STATUS) && smartEnabled)
+    {
+        //status only. If it trips or can't be determined, the attributes are read once below and used for the trip reason or the status
+        snapshot->smartStatus = ata_SMART_Status_Check(device, NULL);
+        if (snapshot->smartStatus == SUCCESS || snapshot->smartStatus == FAILURE)
+        {
+            snapshot->sectionsValid |= HEALTH_SNAPSHOT_SMART_STATUS;
+        }
+    }
+    if (sections & HEALTH_SNAPSHOT_DEFECT_COUNTS)
+    {
+        if (snapshot->sectionsValid & HEALTH_SNAPSHOT_DEVICE_STATISTICS)
+        {
+            statistic *pending = &snapshot->deviceStats.sataStatistics.numberOfReallocationCandidateLogicalSectors;
+            statistic *grown = &snapshot->deviceStats.sataStatistics.numberOfReallocatedLogicalSectors;
+            if (pending->isSupported && pending->isValueValid)
+            {
+                snapshot->pendingCount = M_DoubleWord0(pending->statisticValue);
+                snapshot->pendingCountValid = true;
+            }
+            if (grown->isSupported && grown->isValueValid)
+            {
+                snapshot->grownCount = M_DoubleWord0(grown->statisticValue);
+                snapshot->grownCountValid = true;
+            }
+        }
+        else if (device->drive_info.softSATFlags.deviceStatisticsSupported)
+        {
+            //both counts are on the rotating media page, so read it once for both
+            uint8_t rotatingMediaStatistics[LEGACY_DRIVE_SEC_SIZE] = { 0 };
+            if (SUCCESS == ata_Read_Log_Ext(device, ATA_LOG_DEVICE_STATISTICS, ATA_DEVICE_STATS_LOG_ROTATING_MEDIA, rotatingMediaStatistics, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0))
+            {
+                uint64_t *qWordPtr = (uint64_t*)&rotatingMediaStatistics[0];
+                if (qWordPtr[7] & BIT63 && qWordPtr[7] & BIT62)
+                {
+                    snapshot->pendingCount = M_DoubleWord0(qWordPtr[7]);
+                    snapshot->pendingCountValid = true;
+                }
+                if (qWordPtr[4] & BIT63 && qWordPtr[4] & BIT62)
+                {
+                    snapshot->grownCount = M_DoubleWord0(qWordPtr[4]);
+                    snapshot->grownCountValid = true;
+                }
+            }
+        }
+    }
+    //SMART data is shared between the attributes, the trip reason, and the defect count fallback
+    if (smartEnabled && ((sections & HEALTH_SNAPSHOT_SMART_ATTRIBUTES) || snapshot->smartStatus == FAILURE || ((sections & HEALTH_SNAPSHOT_SMART_STATUS) && snapshot->smartStatus == UNKNOWN) || ((sections & HEALTH_SNAPSHOT_DEFECT_COUNTS) && (!snapshot->pendingCountValid || !snapshot->grownCountValid))))
+    {
+        uint8_t smartData[LEGACY_DRIVE_SEC_SIZE] = { 0 };
+        snapshot->attributes.timestamp = (uint64_t)time(NULL);
+        if (SUCCESS == ata_SMART_Read_Data(device, smartData, LEGACY_DRIVE_SEC_SIZE))
+        {
+            uint8_t thresholdData[LEGACY_DRIVE_SEC_SIZE] = { 0 };
+            smartDataRead = true;
+            if (SUCCESS == ata_SMART_Read_Thresholds(device, thresholdData, LEGACY_DRIVE_SEC_SIZE))
+            {
+                fill_SMART_Attribute_Snapshot_From_Data(smartData, thresholdData, &snapshot->attributes);
+            }
+            else
+            {
+                fill_SMART_Attribute_Snapshot_From_Data(smartData, NULL, &snapshot->attributes);
+            }
+            fill_SMART_Info_From_Data(smartData, &snapshot->smartInfo);
+        }
+    }
+    if (smartDataRead)
+    {
+        if (sections & HEALTH_SNAPSHOT_SMART_ATTRIBUTES)
+        {
+            snapshot->sectionsValid |= HEALTH_SNAPSHOT_SMART_ATTRIBUTES;
+        }
+        if (snapshot->smartStatus == FAILURE)
+        {
+            set_ATA_Trip_Info_From_Snapshot(device, &snapshot->attributes, &snapshot->tripInfo);
+        }
+        else if ((sections & HEALTH_SNAPSHOT_SMART_STATUS) && snapshot->smartStatus == UNKNOWN)
+        {
+            //same comparison ata_SMART_Check makes when the status can't be read, using the attributes already read
+            set_ATA_Trip_Info_From_Snapshot(device, &snapshot->attributes, &snapshot->tripInfo);
+            if (snapshot->tripInfo.informationIsValid)
+            {
+                snapshot->smartStatus = FAILURE;
+                snapshot->sectionsValid |= HEALTH_SNAPSHOT_SMART_STATUS;
+            }
+        }
+        if ((sections & HEALTH_SNAPSHOT_DEFECT_COUNTS) && !snapshot->pendingCountValid)
+        {
+            snapshot->pendingCountValid = get_Snapshot_Attribute_Raw(&snapshot->attributes, ATTRB_NUM_PENDING_SPARES, &snapshot->pendingCount);
+        }
+        if ((sections & HEALTH_SNAPSHOT_DEFECT_COUNTS) && !snapshot->grownCountValid)
+        {
+            snapshot->grownCountValid = get_Snapshot_Attribute_Raw(&snapshot->attributes, ATTRB_NUM_RETIRED_SECTOR, &snapshot->grownCount);
+        }
+    }
+    if ((sections & HEALTH_SNAPSHOT_DEFECT_COUNTS) && (snapshot->pendingCountValid || snapshot->grownCountValid))
+    {
+        snapshot->sectionsValid |= HEALTH_SNAPSHOT_DEFECT_COUNTS;
+    }
+}
+
+static void get_SCSI_Health_Snapshot(tDevice *device, ptrDriveHealthSnapshot snapshot)
+{
+    uint32_t sections = snapshot->sectionsRequested;
+    if (sections & HEALTH_SNAPSHOT_DEVICE_STATISTICS)
+    {
+        if (SUCCESS == get_DeviceStatistics(device, &snapshot->deviceStats))
+        {
+            snapshot->sectionsValid |= HEALTH_SNAPSHOT_DEVICE_STATISTICS;
+        }
+    }
+    if (sections & HEALTH_SNAPSHOT_SMART_STATUS)
+    {
+        snapshot->smartStatus = scsi_SMART_Check(device, &snapshot->tripInfo);
+        if (snapshot->smartStatus == SUCCESS || snapshot->smartStatus == FAILURE)
+        {
+            snapshot->sectionsValid |= HEALTH_SNAPSHOT_SMART_STATUS;
+        }
+    }
+    if (sections & HEALTH_SNAPSHOT_DEFECT_COUNTS)
+    {
+        //the pending defects log page was already read with the statistics, so only go back to the drive when it wasn't
+        if ((snapshot->sectionsValid & HEALTH_SNAPSHOT_DEVICE_STATISTICS) && snapshot->deviceStats.sasStatistics.pendingDefectCount.isSupported && snapshot->deviceStats.sasStatistics.pendingDefectCount.isValueValid)
+        {
+            snapshot->pendingCount = M_DoubleWord0(snapshot->deviceStats.sasStatistics.pendingDefectCount.statisticValue);
+            snapshot->pendingCountValid = true;
+        }
+        else if (SUCCESS == get_Pending_List_Count(device, &snapshot->pendingCount))
+        {
+            snapshot->pendingCountValid = true;
+        }
+        if (SUCCESS == get_Grown_List_Count(device, &snapshot->grownCount))
+        {
+            snapshot->grownCountValid = true;
+        }
+        if (snapshot->pendingCountValid || snapshot->grownCountValid)
+        {
+            snapshot->sectionsValid |= HEALTH_SNAPSHOT_DEFECT_COUNTS;
+        }
+    }
+}
+
+#if !defined (DISABLE_NVME_PASSTHROUGH)
+static void get_NVMe_Health_Snapshot(tDevice *device, ptrDriveHealthSnapshot snapshot)
+{
+    uint32_t sections = snapshot->sectionsRequested;
+    //status and attributes both come from the SMART/Health log, so only read it once
+    if (sections & (HEALTH_SNAPSHOT_SMART_STATUS | HEALTH_SNAPSHOT_SMART_ATTRIBUTES))
+    {
+        if (SUCCESS == nvme_Get_SMART_Log_Page(device, NVME_ALL_NAMESPACES, (uint8_t *)&snapshot->nvmeHealth, NVME_SMART_HEALTH_LOG_LEN))
+        {
+            if (sections & HEALTH_SNAPSHOT_SMART_STATUS)
+            {
+                uint8_t criticalWarning = ((uint8_t *)&snapshot->nvmeHealth)[0];
+                if (criticalWarning > 0)
+                {
+                    snapshot->smartStatus = FAILURE;
+                    set_NVMe_SMART_Trip_Info(criticalWarning, &snapshot->tripInfo);
+                }
+                else
+                {
+                    snapshot->smartStatus = SUCCESS;
+                }
+                snapshot->sectionsValid |= HEALTH_SNAPSHOT_SMART_STATUS;
+            }
+            if (sections & HEALTH_SNAPSHOT_SMART_ATTRIBUTES)
+            {
+                snapshot->sectionsValid |= HEALTH_SNAPSHOT_SMART_ATTRIBUTES;
+            }
+        }
+    }
+}
+#endif
+
+int get_Drive_Health_Snapshot(tDevice *device, uint32_t sections, ptrDriveHealthSnapshot snapshot)
+{
+    if (!device || !snapshot)
+    {
+        return BAD_PARAMETER;
+    }
+    memset(snapshot, 0, sizeof(driveHealthSnapshot));
+    snapshot->sectionsRequested = sections;
+    snapshot->smartStatus = UNKNOWN;
+    switch (device->drive_info.drive_type)
+    {
+    case ATA_DRIVE:
+        get_ATA_Health_Snapshot(device, snapshot);
+        break;
+    case SCSI_DRIVE:
+        get_SCSI_Health_Snapshot(device, snapshot);
+        break;
+#if !defined (DISABLE_NVME_PASSTHROUGH)
+    case NVME_DRIVE:
+        get_NVMe_Health_Snapshot(device, snapshot);
+        break;
+#endif
+    default:
+        break;
+    }
+    if (sections & HEALTH_SNAPSHOT_DST_LOG)
+    {
+        if (SUCCESS == get_DST_Log_Entries(device, &snapshot->dstLog))
+        {
+            snapshot->sectionsValid |= HEALTH_SNAPSHOT_DST_LOG;
+        }
+    }
+    if (snapshot->sectionsValid == 0)
+    {
+        return NOT_SUPPORTED;
+    }
+    return SUCCESS;
+}
+
+void print_Drive_Health_Snapshot(tDevice *device, ptrDriveHealthSnapshot snapshot)
+{
+    if (!snapshot)
+    {
+        return;
+    }
+    if (snapshot->sectionsValid & HEALTH_SNAPSHOT_SMART_STATUS)
+    {
+        printf("SMART Check Result: ");
+        if (snapshot->smartStatus == SUCCESS)
+        {
+            printf("PASS\n");
+        }
+        else
+        {
+            printf("FAIL\n");
+            if (snapshot->tripInfo.reasonStringLength > 0)
+            {
+                printf("\t%s\n", snapshot->tripInfo.reasonString);
+            }
+        }
+    }
+    if (snapshot->sectionsValid & HEALTH_SNAPSHOT_DEFECT_COUNTS)
+    {
+        if (snapshot->pendingCountValid)
+        {
+            printf("Pending Defect Count: %" PRIu32 "\n", snapshot->pendingCount);
+        }
+        if (snapshot->grownCountValid)
+        {
+            printf("Grown Defect Count: %" PRIu32 "\n", snapshot->grownCount);
+        }
+    }
+    if ((snapshot->sectionsValid & HEALTH_SNAPSHOT_SMART_ATTRIBUTES) && device->drive_info.drive_type == ATA_DRIVE)
+    {
+        print_SMART_Info(device, &snapshot->smartInfo);
+    }
+    if (snapshot->sectionsValid & HEALTH_SNAPSHOT_DST_LOG)
+    {
+        print_DST_Log_Entries(&snapshot->dstLog);
+    }
+    if (snapshot->sectionsValid & HEALTH_SNAPSHOT_DEVICE_STATISTICS)
+    {
+        print_DeviceStatistics(device, &snapshot->deviceStats);
+    }
+}
@@ -17,16 +17,215 @@
 #include "scsi_helper.h"
 #include "nvme_helper_func.h"
 #include "firmware_download.h"
+#include "device_page_cache.h"
 #if !defined(DISABLE_NVME_PASSTHROUGH)
 #include "math.h"
 #endif
 
+static const char * const driveFeatureNames[DRIVE_FEATURE_COUNT] = {
+    [DRIVE_FEATURE_TCG] = "TCG",
+    [DRIVE_FEATURE_SCSA] = "SCSA",
+    [DRIVE_FEATURE_IEEE_1667] = "IEEE 1667",
+    [DRIVE_FEATURE_SANITIZE] = "Sanitize",
+    [DRIVE_FEATURE_SATA_NCQ] = "SATA NCQ",
+    [DRIVE_FEATURE_SATA_NCQ_STREAMING] = "SATA NCQ Streaming",
+    [DRIVE_FEATURE_SATA_REBUILD_ASSIST] = "SATA Rebuild Assist",
+    [DRIVE_FEATURE_SATA_HYBRID_INFORMATION] = "SATA Hybrid Information",
+    [DRIVE_FEATURE_SATA_DEVICE_SLEEP] = "SATA Device Sleep",
+    [DRIVE_FEATURE_SATA_SOFTWARE_SETTINGS_PRESERVATION] = "SATA Software Settings Preservation",
+    [DRIVE_FEATURE_SATA_HARDWARE_FEATURE_CONTROL] = "SATA Hardware Feature Control",
+    [DRIVE_FEATURE_SATA_IN_ORDER_DATA_DELIVERY] = "SATA In-Order Data Delivery",
+    [DRIVE_FEATURE_SATA_DEVICE_INITIATED_POWER_MANAGEMENT] = "SATA Device Initiated Power Management",
+    [DRIVE_FEATURE_HPA] = "HPA",
+    [DRIVE_FEATURE_POWER_MANAGEMENT] = "Power Management",
+    [DRIVE_FEATURE_SECURITY] = "Security",
+    [DRIVE_FEATURE_SMART] = "SMART",
+    [DRIVE_FEATURE_DCO] = "DCO",
+    [DRIVE_FEATURE_48BIT_ADDRESS] = "48bit Address",
+    [DRIVE_FEATURE_AAM] = "AAM",
+    [DRIVE_FEATURE_PUIS] = "PUIS",
+    [DRIVE_FEATURE_REMOVABLE_MEDIA_STATUS_NOTIFICATION] = "Removable Media Status Notification",
+    [DRIVE_FEATURE_APM] = "APM",
+    [DRIVE_FEATURE_CFA] = "CFA",
+    [DRIVE_FEATURE_TCQ] = "TCQ",
+    [DRIVE_FEATURE_GPL] = "GPL",
+    [DRIVE_FEATURE_STREAMING] = "Streaming",
+    [DRIVE_FEATURE_MEDIA_CARD_PASS_THROUGH] = "Media Card Pass-through",
+    [DRIVE_FEATURE_PACKET] = "Packet",
+    [DRIVE_FEATURE_FREE_FALL_CONTROL] = "Free-fall Control",
+    [DRIVE_FEATURE_WRITE_READ_VERIFY] = "Write-Read-Verify",
+    [DRIVE_FEATURE_DSN] = "DSN",
+    [DRIVE_FEATURE_AMAC] = "AMAC",
+    [DRIVE_FEATURE_EPC] = "EPC",
+    [DRIVE_FEATURE_SENSE_DATA_REPORTING] = "Sense Data Reporting",
+    [DRIVE_FEATURE_TRIM] = "TRIM",
+    [DRIVE_FEATURE_SCT_READ_WRITE_LONG] = "SCT Read/Write Long",
+    [DRIVE_FEATURE_SCT_WRITE_SAME] = "SCT Write Same",
+    [DRIVE_FEATURE_SCT_ERROR_RECOVERY_CONTROL] = "SCT Error Recovery Control",
+    [DRIVE_FEATURE_SCT_FEATURE_CONTROL] = "SCT Feature Control",
+    [DRIVE_FEATURE_SCT_DATA_TABLES] = "SCT Data Tables",
+    [DRIVE_FEATURE_NV_CACHE] = "NV Cache",
+    [DRIVE_FEATURE_NV_CACHE_POWER_MODE] = "NV Cache Power Mode",
+    [DRIVE_FEATURE_HOST_LOGGING] = "Host Logging",
+    [DRIVE_FEATURE_STORAGE_ELEMENT_DEPOPULATION] = "Storage Element Depopulation",
+    [DRIVE_FEATURE_SEAGATE_IDD] = "Seagate In Drive Diagnostics (IDD)",
+    [DRIVE_FEATURE_SEAGATE_REMANUFACTURE] = "Seagate Remanufacture",
+    [DRIVE_FEATURE_POWER_CONSUMPTION] = "Power Consumption",
+    [DRIVE_FEATURE_UNMAP] = "UNMAP",
+    [DRIVE_FEATURE_WRITE_SAME] = "Write Same",
+    [DRIVE_FEATURE_SAT] = "SAT",
+    [DRIVE_FEATURE_PROTECTION_TYPE_1] = "Protection Type 1",
+    [DRIVE_FEATURE_PROTECTION_TYPE_2] = "Protection Type 2",
+    [DRIVE_FEATURE_PROTECTION_TYPE_3] = "Protection Type 3",
+    [DRIVE_FEATURE_ATA_SECURITY] = "ATA Security",
+    [DRIVE_FEATURE_APPLICATION_CLIENT_LOGGING] = "Application Client Logging",
+    [DRIVE_FEATURE_SELF_TEST] = "Self Test",
+    [DRIVE_FEATURE_AUTOMATIC_WRITE_REASSIGNMENT] = "Automatic Write Reassignment",
+    [DRIVE_FEATURE_AUTOMATIC_READ_REASSIGNMENT] = "Automatic Read Reassignment",
+    [DRIVE_FEATURE_DEVICE_LIFE_CONTROL] = "Device Life Control",
+    [DRIVE_FEATURE_IO_ADVICE_HINTS] = "IO Advice Hints",
+    [DRIVE_FEATURE_PATA_CONTROL] = "PATA Control",
+    [DRIVE_FEATURE_POWER_CONDITIONS] = "Power Conditions",
+    [DRIVE_FEATURE_INFORMATIONAL_EXCEPTIONS] = "Informational Exceptions",
+    [DRIVE_FEATURE_BACKGROUND_MEDIA_SCAN] = "Background Media Scan",
+    [DRIVE_FEATURE_BACKGROUND_PRE_SCAN] = "Background Pre-Scan",
+    [DRIVE_FEATURE_TRANSLATE_ADDRESS] = "Translate Address",
+    [DRIVE_FEATURE_REBUILD_ASSIST] = "Rebuild Assist",
+    [DRIVE_FEATURE_FORMAT_UNIT] = "Format Unit",
+    [DRIVE_FEATURE_ATA_PASS_THROUGH_12] = "ATA Pass-Through 12",
+    [DRIVE_FEATURE_ATA_PASS_THROUGH_16] = "ATA Pass-Through 16",
+    [DRIVE_FEATURE_ATA_PASS_THROUGH_32] = "ATA Pass-Through 32",
+    [DRIVE_FEATURE_FORMAT_NVM] = "Format NVM",
+    [DRIVE_FEATURE_FIRMWARE_UPDATE] = "Firmware Update",
+    [DRIVE_FEATURE_NAMESPACE_MANAGEMENT] = "Namespace Management",
+    [DRIVE_FEATURE_DEVICE_SELF_TEST] = "Device Self Test",
+    [DRIVE_FEATURE_VIRTUALIZATION_MANAGEMENT] = "Virtualization Management",
+    [DRIVE_FEATURE_DOORBELL_BUFFER_CONFIG] = "Doorbell Buffer Config",
+    [DRIVE_FEATURE_WRITE_UNCORRECTABLE] = "Write Uncorrectable",
+    [DRIVE_FEATURE_DATASET_MANAGEMENT] = "Dataset Management",
+    [DRIVE_FEATURE_WRITE_ZEROS] = "Write Zeros",
+    [DRIVE_FEATURE_NAMESPACE_SHARING] = "Namespace Sharing"
+};
+
+static const char * const driveSpecificationNames[DRIVE_SPECIFICATION_COUNT] = {
+    [DRIVE_SPECIFICATION_ACS_8] = "ACS-8",
+    [DRIVE_SPECIFICATION_ACS_7] = "ACS-7",
+    [DRIVE_SPECIFICATION_ACS_6] = "ACS-6",
+    [DRIVE_SPECIFICATION_ACS_5] = "ACS-5",
+    [DRIVE_SPECIFICATION_ACS_4] = "ACS-4",
+    [DRIVE_SPECIFICATION_ACS_3] = "ACS-3",
+    [DRIVE_SPECIFICATION_ACS_2] = "ACS-2",
+    [DRIVE_SPECIFICATION_ATA8_ACS] = "ATA8-ACS",
+    [DRIVE_SPECIFICATION_ATA_ATAPI_7] = "ATA/ATAPI-7",
+    [DRIVE_SPECIFICATION_ATA_ATAPI_6] = "ATA/ATAPI-6",
+    [DRIVE_SPECIFICATION_ATA_ATAPI_5] = "ATA/ATAPI-5",
+    [DRIVE_SPECIFICATION_ATA_ATAPI_4] = "ATA/ATAPI-4",
+    [DRIVE_SPECIFICATION_ATA_3] = "ATA-3",
+    [DRIVE_SPECIFICATION_ATA_2] = "ATA-2",
+    [DRIVE_SPECIFICATION_ATA_1] = "ATA-1",
+    [DRIVE_SPECIFICATION_SATA_3_2] = "SATA 3.2",
+    [DRIVE_SPECIFICATION_SATA_3_1] = "SATA 3.1",
+    [DRIVE_SPECIFICATION_SATA_3_0] = "SATA 3.0",
+    [DRIVE_SPECIFICATION_SATA_2_6] = "SATA 2.6",
+    [DRIVE_SPECIFICATION_SATA_2_5] = "SATA 2.5",
+    [DRIVE_SPECIFICATION_SATA_II_EXTENSIONS] = "SATA II: Extensions",
+    [DRIVE_SPECIFICATION_SATA_1_0A] = "SATA 1.0a",
+    [DRIVE_SPECIFICATION_ATA8_AST] = "ATA8-AST",
+    [DRIVE_SPECIFICATION_ATA8_APT] = "ATA8-APT",
+    [DRIVE_SPECIFICATION_TRANSPORT_RESERVED] = "Reserved",
+    [DRIVE_SPECIFICATION_SPC_5] = "SPC-5",
+    [DRIVE_SPECIFICATION_SPC_4] = "SPC-4",
+    [DRIVE_SPECIFICATION_SPC_3] = "SPC-3",
+    [DRIVE_SPECIFICATION_SPC_2] = "SPC-2",
+    [DRIVE_SPECIFICATION_SPC] = "SPC",
+    [DRIVE_SPECIFICATION_SCSI_2] = "SCSI-2",
+    [DRIVE_SPECIFICATION_SCSI] = "SCSI"
+};
+
+void set_Drive_Feature(ptrDriveFeatureSet features, eDriveFeature feature, bool enabled)
+{
+    if (features && feature < DRIVE_FEATURE_COUNT)
+    {
+        features->supported[feature / 64] |= UINT64_C(1) << (feature % 64);
+        if (enabled)
+        {
+            features->enabled[feature / 64] |= UINT64_C(1) << (feature % 64);
+        }
+    }
+}
+
+bool is_Drive_Feature_Supported(ptrDriveFeatureSet features, eDriveFeature feature)
+{
+    if (features && feature < DRIVE_FEATURE_COUNT)
+    {
+        return features->supported[feature / 64] & (UINT64_C(1) << (feature % 64));
+    }
+    return false;
+}
+
+bool is_Drive_Feature_Enabled(ptrDriveFeatureSet features, eDriveFeature feature)
+{
+    if (features && feature < DRIVE_FEATURE_COUNT)
+    {
+        return features->enabled[feature / 64] & (UINT64_C(1) << (feature % 64));
+    }
+    return false;
+}
+
+const char* get_Drive_Feature_Name(eDriveFeature feature)
+{
+    if (feature < DRIVE_FEATURE_COUNT)
+    {
+        return driveFeatureNames[feature];
+    }
+    return NULL;
+}
+
+const char* get_Drive_Specification_Name(eDriveSpecification specification)
+{
+    if (specification < DRIVE_SPECIFICATION_COUNT)
+    {
+        return driveSpecificationNames[specification];
+    }
+    return NULL;
+}
+
+//prints each supported feature in the set, one per line. Returns the number printed.
+static uint16_t print_Drive_Features(ptrDriveFeatureSet features, uint8_t informationalExceptionsMode)
+{
+    uint16_t featuresPrinted = 0;
+    for (uint16_t featureIter = 0; featureIter < DRIVE_FEATURE_COUNT; ++featureIter)
+    {
+        if (is_Drive_Feature_Supported(features, (eDriveFeature)featureIter))
+        {
+            printf("\t\t%s", driveFeatureNames[featureIter]);
+            if (featureIter == DRIVE_FEATURE_INFORMATIONAL_EXCEPTIONS)
+            {
+                printf(" [Mode %" PRIu8 "]", informationalExceptionsMode);
+            }
+            else if (is_Drive_Feature_Enabled(features, (eDriveFeature)featureIter))
+            {
+                printf(" [Enabled]");
+            }
+            printf("\n");
+            ++featuresPrinted;
+        }
+    }
+    return featuresPrinted;
+}
+
 int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driveInfo)
+{
+    return get_ATA_Drive_Information_Sections(device, DRIVE_INFO_SECTION_ALL, driveInfo);
+}
+
+int get_ATA_Drive_Information_Sections(tDevice *device, uint32_t sections, ptrDriveInformationSAS_Sata driveInfo)
 {
     int ret = SUCCESS;
     bool sctSupported = false;
-    memset(driveInfo, 0, sizeof(driveInformation));
-    if (SUCCESS == ata_Identify(device, (uint8_t*)&device->drive_info.IdentifyData.ata, LEGACY_DRIVE_SEC_SIZE))
+    memset(driveInfo, 0, sizeof(driveInformationSAS_SATA));
+    driveInfo->sections = sections;
+    if (SUCCESS == ata_Identify_Cached(device, (uint8_t*)&device->drive_info.IdentifyData.ata, LEGACY_DRIVE_SEC_SIZE))
     {
         uint8_t *bytePtr = (uint8_t*)&device->drive_info.IdentifyData.ata.Word000;
         uint16_t *wordPtr = &device->drive_info.IdentifyData.ata.Word000;
@@ -133,78 +332,63 @@ int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata drive
         //Guessed name as this doesn't exist yet
         if (specsBits & BIT15)
         {
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ACS-8");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ACS_8);
         }
         if (specsBits & BIT14)
         {
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ACS-7");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ACS_7);
         }
         if (specsBits & BIT13)
         {
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ACS-6");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ACS_6);
         }
         if (specsBits & BIT12)
         {
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ACS-5");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ACS_5);
         }
         if (specsBits & BIT11)
         {
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ACS-4");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ACS_4);
         }
         if (specsBits & BIT10)
         {
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ACS-3");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ACS_3);
         }
         if (specsBits & BIT9)
         {
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ACS-2");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ACS_2);
         }
         if (specsBits & BIT8)
         {
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ATA8-ACS");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ATA8_ACS);
         }
         if (specsBits & BIT7)
         {
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ATA/ATAPI-7");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ATA_ATAPI_7);
         }
         if (specsBits & BIT6)
         {
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ATA/ATAPI-6");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ATA_ATAPI_6);
         }
         if (specsBits & BIT5)
         {
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ATA/ATAPI-5");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ATA_ATAPI_5);
         }
         if (specsBits & BIT4)
         {
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ATA/ATAPI-4");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ATA_ATAPI_4);
         }
         if (specsBits & BIT3)
         {
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ATA-3");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ATA_3);
         }
         if (specsBits & BIT2)
         {
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ATA-2");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ATA_2);
         }
         if (specsBits & BIT1)
         {
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ATA-1");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ATA_1);
         }
         //now get the Transport specs supported.
         specsBits = wordPtr[222];
@@ -213,105 +397,97 @@ int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata drive
         {
             if (transportType == 0x01)
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SATA 3.2");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SATA_3_2);
             }
             else
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "Reserved");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_TRANSPORT_RESERVED);
             }
-            driveInfo->numberOfSpecificationsSupported++;
         }
         if (specsBits & BIT6)
         {
             if (transportType == 0x01)
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SATA 3.1");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SATA_3_1);
             }
             else
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "Reserved");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_TRANSPORT_RESERVED);
             }
-            driveInfo->numberOfSpecificationsSupported++;
         }
         if (specsBits & BIT5)
         {
             if (transportType == 0x01)
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SATA 3.0");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SATA_3_0);
             }
             else
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "Reserved");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_TRANSPORT_RESERVED);
             }
-            driveInfo->numberOfSpecificationsSupported++;
         }
         if (specsBits & BIT4)
         {
             if (transportType == 0x01)
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SATA 2.6");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SATA_2_6);
             }
             else
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "Reserved");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_TRANSPORT_RESERVED);
             }
-            driveInfo->numberOfSpecificationsSupported++;
         }
         if (specsBits & BIT3)
         {
             if (transportType == 0x01)
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SATA 2.5");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SATA_2_5);
             }
             else
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "Reserved");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_TRANSPORT_RESERVED);
             }
-            driveInfo->numberOfSpecificationsSupported++;
         }
         if (specsBits & BIT2)
         {
             if (transportType == 0x01)
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SATA II: Extensions");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SATA_II_EXTENSIONS);
             }
             else
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "Reserved");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_TRANSPORT_RESERVED);
             }
-            driveInfo->numberOfSpecificationsSupported++;
         }
         if (specsBits & BIT1)
         {
             if (transportType == 0x01)
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SATA 1.0a");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SATA_1_0A);
             }
             else if (transportType == 0)
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ATA/ATAPI-7");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ATA_ATAPI_7);
             }
             else
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "Reserved");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_TRANSPORT_RESERVED);
             }
-            driveInfo->numberOfSpecificationsSupported++;
         }
         if (specsBits & BIT0)
         {
             if (transportType == 0x01)
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ATA8-AST");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ATA8_AST);
             }
             else if (transportType == 0)
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "ATA8-APT");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_ATA8_APT);
             }
             else
             {
-                sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "Reserved");
+                driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_TRANSPORT_RESERVED);
             }
-            driveInfo->numberOfSpecificationsSupported++;
         }
         //get if it's FDE/TCG
         if (wordPtr[69] & BIT4)
@@ -324,7 +500,7 @@ int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata drive
             //FDE
             driveInfo->encryptionSupport = ENCRYPTION_FULL_DISK;
         }
-        if (wordPtr[48] & BIT0)
+        if ((sections & DRIVE_INFO_SECTION_FEATURES) && wordPtr[48] & BIT0)
         {
             //TCG - SED drive (need to test a trusted command to see if it is being blocked or not)
             if (SUCCESS != ata_Trusted_Non_Data(device, 0, true, 0))
@@ -353,8 +529,7 @@ int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata drive
                             case SECURITY_PROTOCOL_TCG_5:
                             case SECURITY_PROTOCOL_TCG_6:
                                 driveInfo->encryptionSupport = ENCRYPTION_SELF_ENCRYPTING;
-                                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "TCG");
-                                driveInfo->numberOfFeaturesSupported++;
+                                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_TCG, false);
                                 break;
                             case SECURITY_PROTOCOL_CbCS:
                             case SECURITY_PROTOCOL_TAPE_DATA_ENCRYPTION:
@@ -364,15 +539,13 @@ int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata drive
                             case SECURITY_PROTOCOL_NVM_EXPRESS:
                                 break;
                             case SECURITY_PROTOCOL_SCSA:
-                                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SCSA");
-                                driveInfo->numberOfFeaturesSupported++;
+                                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SCSA, false);
                                 break;
                             case SECURITY_PROTOCOL_JEDEC_UFS:
                             case SECURITY_PROTOCOL_SDcard_TRUSTEDFLASH_SECURITY:
                                 break;
                             case SECURITY_PROTOCOL_IEEE_1667:
-                                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "IEEE 1667");
-                                driveInfo->numberOfFeaturesSupported++;
+                                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_IEEE_1667, false);
                                 break;
                             case SECURITY_PROTOCOL_ATA_DEVICE_SERVER_PASSWORD://T10 only (SAT)
                                 break;
@@ -891,12 +1064,15 @@ int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata drive
         {
             driveInfo->fwdlSupport.seagateDeferredPowerCycleRequired = true;
         }
-        //ata security status
-        get_ATA_Security_Info(device, &driveInfo->ataSecurityInformation, false);
-        //read look ahead
-        driveInfo->readLookAheadEnabled = is_Read_Look_Ahead_Enabled(device);
-        //write cache
-        driveInfo->writeCacheEnabled = is_Write_Cache_Enabled(device);
+        if (sections & DRIVE_INFO_SECTION_FEATURES)
+        {
+            //ata security status
+            get_ATA_Security_Info(device, &driveInfo->ataSecurityInformation, false);
+            //read look ahead
+            driveInfo->readLookAheadEnabled = is_Read_Look_Ahead_Enabled(device);
+            //write cache
+            driveInfo->writeCacheEnabled = is_Write_Cache_Enabled(device);
+        }
         //NV Cache Size logical blocks - needs testing against different drives to make sure the value is correct
         driveInfo->hybridNANDSize = M_WordsTo4ByteValue(wordPtr[215], wordPtr[216]) * driveInfo->logicalSectorSize;
         //create a list of supported features
@@ -904,365 +1080,225 @@ int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata drive
         {
             if (wordPtr[48] & BIT0)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "TCG");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_TCG, false);
             }
             if (wordPtr[69] & BIT7)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "IEEE 1667");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_IEEE_1667, false);
             }
         }
         if (wordPtr[59] & BIT12)
         {
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Sanitize");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SANITIZE, false);
         }
         if (wordPtr[76] != 0 && wordPtr[76] != 0xFFFF && wordPtr[76] & BIT8)
         {
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA NCQ");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_NCQ, false);
         }
         if (wordPtr[77] != 0 && wordPtr[77] != 0xFFFF && wordPtr[77] & BIT4)
         {
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA NCQ Streaming");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_NCQ_STREAMING, false);
         }
         if (wordPtr[78] != 0 && wordPtr[78] != 0xFFFF && wordPtr[78] & BIT11)
         {
             if (wordPtr[79] != 0 && wordPtr[79] != 0xFFFF && wordPtr[79] & BIT11)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA Rebuild Assist [Enabled]");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_REBUILD_ASSIST, true);
             }
             else
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA Rebuild Assist");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_REBUILD_ASSIST, false);
             }
         }
         if (wordPtr[78] != 0 && wordPtr[78] != 0xFFFF && wordPtr[78] & BIT9)
         {
             if (wordPtr[79] != 0 && wordPtr[79] != 0xFFFF && wordPtr[79] & BIT9)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA Hybrid Information [Enabled]");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_HYBRID_INFORMATION, true);
             }
             else
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA Hybrid Information");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_HYBRID_INFORMATION, false);
             }
         }
         if (wordPtr[78] != 0 && wordPtr[78] != 0xFFFF && wordPtr[78] & BIT8)
         {
             if (wordPtr[79] != 0 && wordPtr[79] != 0xFFFF && wordPtr[79] & BIT8)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA Device Sleep [Enabled]");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_DEVICE_SLEEP, true);
             }
             else
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA Device Sleep Preservation");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_DEVICE_SLEEP, false);
             }
         }
         if (wordPtr[78] != 0 && wordPtr[78] != 0xFFFF && wordPtr[78] & BIT6)
         {
             if (wordPtr[79] != 0 && wordPtr[79] != 0xFFFF && wordPtr[79] & BIT6)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA Software Settings Preservation [Enabled]");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_SOFTWARE_SETTINGS_PRESERVATION, true);
             }
             else
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA Software Settings Preservation");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_SOFTWARE_SETTINGS_PRESERVATION, false);
             }
         }
         if (wordPtr[78] != 0 && wordPtr[78] != 0xFFFF && wordPtr[78] & BIT5)
         {
             if (wordPtr[79] != 0 && wordPtr[79] != 0xFFFF && wordPtr[79] & BIT5)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA Hardware Feature Control [Enabled]");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_HARDWARE_FEATURE_CONTROL, true);
             }
             else
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA Hardware Feature Control");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_HARDWARE_FEATURE_CONTROL, false);
             }
         }
         if (wordPtr[78] != 0 && wordPtr[78] != 0xFFFF && wordPtr[78] & BIT4)
         {
             if (wordPtr[79] != 0 && wordPtr[79] != 0xFFFF && wordPtr[79] & BIT4)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA In-Order Data Delivery [Enabled]");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_IN_ORDER_DATA_DELIVERY, true);
             }
             else
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA In-Order Data Delivery");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_IN_ORDER_DATA_DELIVERY, false);
             }
         }
         if (wordPtr[78] != 0 && wordPtr[78] != 0xFFFF && wordPtr[78] & BIT3)
         {
             if (wordPtr[79] != 0 && wordPtr[79] != 0xFFFF && wordPtr[79] & BIT3)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA Device Initiated Power Management [Enabled]");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_DEVICE_INITIATED_POWER_MANAGEMENT, true);
             }
             else
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SATA Device Initiated Power Management");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SATA_DEVICE_INITIATED_POWER_MANAGEMENT, false);
             }
         }
         if (wordPtr[82] & BIT10 || wordPtr[85] & BIT10)
         {
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "HPA");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_HPA, false);
         }
         if (wordPtr[82] & BIT3)
         {
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Power Management");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_POWER_MANAGEMENT, false);
         }
         if (wordPtr[82] & BIT1)
         {
-            if (wordPtr[85] & BIT1)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Security [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Security");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SECURITY, wordPtr[85] & BIT1);
         }
         if (wordPtr[82] & BIT0)
         {
-            if (wordPtr[85] & BIT0)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SMART [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SMART");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SMART, wordPtr[85] & BIT0);
         }
         if (wordPtr[83] & BIT11 || wordPtr[86] & BIT11)
         {
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "DCO");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_DCO, false);
         }
         if (wordPtr[83] & BIT10 || wordPtr[86] & BIT10)
         {
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "48bit Address");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_48BIT_ADDRESS, false);
         }
         if (wordPtr[83] & BIT9)
         {
-            if (wordPtr[86] & BIT9)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "AAM [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "AAM");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_AAM, wordPtr[86] & BIT9);
         }
         if (wordPtr[83] & BIT5)
         {
-            if (wordPtr[86] & BIT5)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "PUIS [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "PUIS");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_PUIS, wordPtr[86] & BIT5);
         }
         if (wordPtr[83] & BIT4)
         {
-            if (wordPtr[86] & BIT4)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Removable Media Status Notification [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Removable Media Status Notification");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_REMOVABLE_MEDIA_STATUS_NOTIFICATION, wordPtr[86] & BIT4);
         }
         if (wordPtr[83] & BIT3)
         {
-            if (wordPtr[86] & BIT3)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "APM [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "APM");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_APM, wordPtr[86] & BIT3);
         }
         if (wordPtr[83] & BIT2)
         {
-            if (wordPtr[86] & BIT2)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "CFA [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "CFA");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_CFA, wordPtr[86] & BIT2);
         }
         if (wordPtr[83] & BIT1 || wordPtr[86] & BIT1)
         {
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "TCQ");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_TCQ, false);
         }
         if (wordPtr[84] & BIT5 || wordPtr[86] & BIT5)
         {
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "GPL");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_GPL, false);
         }
         if (wordPtr[84] & BIT4)
         {
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Streaming");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_STREAMING, false);
         }
         if (wordPtr[84] & BIT3 || wordPtr[87] & BIT3)
         {
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Media Card Pass-through");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_MEDIA_CARD_PASS_THROUGH, false);
         }
         if (wordPtr[82] & BIT4 || wordPtr[85] & BIT4)
         {
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Packet");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_PACKET, false);
         }
         if (wordPtr[119] & BIT5)
         {
-            if (wordPtr[120] & BIT5)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Free-fall Control [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Free-fall Control");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_FREE_FALL_CONTROL, wordPtr[120] & BIT5);
         }
         if (wordPtr[119] & BIT1)
         {
-            if (wordPtr[120] & BIT1)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Write-Read-Verify [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Write-Read-Verify");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_WRITE_READ_VERIFY, wordPtr[120] & BIT1);
         }
         if (wordPtr[119] & BIT9)
         {
-            if (wordPtr[120] & BIT9)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "DSN [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "DSN");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_DSN, wordPtr[120] & BIT9);
         }
         if (wordPtr[119] & BIT8)
         {
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "AMAC");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_AMAC, false);
         }
         if (wordPtr[119] & BIT7)
         {
-            if (wordPtr[120] & BIT7)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "EPC [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "EPC");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_EPC, wordPtr[120] & BIT7);
         }
         if (wordPtr[119] & BIT6)
         {
-            if (wordPtr[120] & BIT6)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Sense Data Reporting [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Sense Data Reporting");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SENSE_DATA_REPORTING, wordPtr[120] & BIT6);
         }
         if (wordPtr[169] & BIT0)
         {
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "TRIM");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_TRIM, false);
         }
         if (wordPtr[206] & BIT0)
         {
             sctSupported = true;
             if (wordPtr[206] & BIT1)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SCT Read/Write Long");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SCT_READ_WRITE_LONG, false);
             }
             if (wordPtr[206] & BIT2)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SCT Write Same");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SCT_WRITE_SAME, false);
             }
             if (wordPtr[206] & BIT3)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SCT Error Recovery Control");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SCT_ERROR_RECOVERY_CONTROL, false);
             }
             if (wordPtr[206] & BIT4)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SCT Feature Control");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SCT_FEATURE_CONTROL, false);
             }
             if (wordPtr[206] & BIT5)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SCT Data Tables");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SCT_DATA_TABLES, false);
             }
         }
         if (M_Byte3(wordPtr[214]) > 0)
         {
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "NV Cache");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_NV_CACHE, false);
         }
         if (wordPtr[214] & BIT0)
         {
-            if (wordPtr[214] & BIT1)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "NV Cache Power Mode [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "NV Cache Power Mode");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_NV_CACHE_POWER_MODE, wordPtr[214] & BIT1);
         }
     }
     driveInfo->percentEnduranceUsed = -1;//start with this to filter out this value later if necessary
@@ -1275,16 +1311,22 @@ int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata drive
     }
     uint32_t devStatsSize = 0, idDataLog = 0, hybridInfoSize = 0, smartSelfTest = 0, extSelfTest = 0, hostlogging = 0;
     //we're only checking the GPL directory so we can only read the pages we want, instead of the whole log (as a SMART read log requires)
-    get_ATA_Log_Size(device, ATA_LOG_IDENTIFY_DEVICE_DATA, &idDataLog, true, false);
-    get_ATA_Log_Size(device, ATA_LOG_DEVICE_STATISTICS, &devStatsSize, true, false);
-    get_ATA_Log_Size(device, ATA_LOG_HYBRID_INFORMATION, &hybridInfoSize, true, false);
-    get_ATA_Log_Size(device, ATA_LOG_SMART_SELF_TEST_LOG, &smartSelfTest, false, true);
-    get_ATA_Log_Size(device, ATA_LOG_EXTENDED_SMART_SELF_TEST_LOG, &extSelfTest, true, false);
-    get_ATA_Log_Size(device, 0x80, &hostlogging, true, true);
+    //logs that are not needed for the requested sections are left with a size of zero so they are not read below
+    if (sections & DRIVE_INFO_SECTION_FEATURES)
+    {
+        get_ATA_Log_Size(device, ATA_LOG_IDENTIFY_DEVICE_DATA, &idDataLog, true, false);
+        get_ATA_Log_Size(device, ATA_LOG_HYBRID_INFORMATION, &hybridInfoSize, true, false);
+        get_ATA_Log_Size(device, 0x80, &hostlogging, true, true);
+    }
+    if (sections & DRIVE_INFO_SECTION_HEALTH)
+    {
+        get_ATA_Log_Size(device, ATA_LOG_DEVICE_STATISTICS, &devStatsSize, true, false);
+        get_ATA_Log_Size(device, ATA_LOG_SMART_SELF_TEST_LOG, &smartSelfTest, false, true);
+        get_ATA_Log_Size(device, ATA_LOG_EXTENDED_SMART_SELF_TEST_LOG, &extSelfTest, true, false);
+    }
     if (hostlogging > 0)
     {
-        sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Host Logging");
-        driveInfo->numberOfFeaturesSupported++;
+        set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_HOST_LOGGING, false);
     }
     //read identify device data log (only some pages are needed)
     if (idDataLog > 0)
@@ -1331,8 +1373,7 @@ int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata drive
             {
                 if (supportedCapabilitiesQWord18 & BIT1 && supportedCapabilitiesQWord18 & BIT0)//checking for both commands to be supported
                 {
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Storage Element Depopulation");
-                    driveInfo->numberOfFeaturesSupported++;
+                    set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_STORAGE_ELEMENT_DEPOPULATION, false);
                 }
             }
         }
@@ -1503,7 +1544,7 @@ int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata drive
         }
     }
     bool smartStatusFromSCTStatusLog = false;
-    if (sctSupported)
+    if ((sections & DRIVE_INFO_SECTION_HEALTH) && sctSupported)
     {
         //Read the SCT status log
         bool sctStatusRead = false;
@@ -1559,7 +1600,7 @@ int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata drive
             }
         }
     }
-    if (SUCCESS == ata_SMART_Read_Data(device, tempBuf, LEGACY_DRIVE_SEC_SIZE))
+    if ((sections & DRIVE_INFO_SECTION_HEALTH) && SUCCESS == ata_SMART_Read_Data(device, tempBuf, LEGACY_DRIVE_SEC_SIZE))
     {
         //read temperature (194), poh (9) for all, then read 241, 242, and 231 for Seagate only
         ataSMARTAttribute *currentAttribute = NULL;
@@ -1590,13 +1631,11 @@ int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata drive
             //set features supported
             if (iddSupported)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Seagate In Drive Diagnostics (IDD)");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SEAGATE_IDD, false);
             }
             if (remanSupported)
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Seagate Remanufacture");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SEAGATE_REMANUFACTURE, false);
             }
         }
         //first get the SMART attributes that we care about
@@ -1704,8 +1743,15 @@ int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata drive
     driveInfo->totalBytesRead = driveInfo->totalLBAsRead * driveInfo->logicalSectorSize;
     driveInfo->totalBytesWritten = driveInfo->totalLBAsWritten * driveInfo->logicalSectorSize;
     //get the native maxLBA
-    ata_Get_Native_Max_LBA(device, &driveInfo->nativeMaxLBA);
-    if (!smartStatusFromSCTStatusLog)
+    if (sections & DRIVE_INFO_SECTION_NATIVE_MAX_LBA)
+    {
+        ata_Get_Native_Max_LBA(device, &driveInfo->nativeMaxLBA);
+    }
+    if (!(sections & DRIVE_INFO_SECTION_HEALTH))
+    {
+        driveInfo->smartStatus = 2;
+    }
+    else if (!smartStatusFromSCTStatusLog)
     {
         //SMART status
         switch (ata_SMART_Check(device, NULL))
@@ -1721,7 +1767,7 @@ int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata drive
             break;
         }
     }
-    if (is_Seagate_Family(device) == SEAGATE)
+    if ((sections & DRIVE_INFO_SECTION_FEATURES) && is_Seagate_Family(device) == SEAGATE)
     {
         driveInfo->lowCurrentSpinupValid = true;
         driveInfo->lowCurrentSpinupEnabled = is_Low_Current_Spin_Up_Enabled(device);
@@ -1732,9 +1778,65 @@ int get_ATA_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata drive
 }
 
 int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driveInfo)
+{
+    return get_SCSI_Drive_Information_Sections(device, DRIVE_INFO_SECTION_ALL, driveInfo);
+}
+
+//Returns the DRIVE_INFO_SECTION_* flags that use data from a VPD page. Pages that are not used return 0 and are not read.
+static uint32_t scsi_VPD_Page_Drive_Info_Sections(uint8_t pageCode)
+{
+    switch (pageCode)
+    {
+    case UNIT_SERIAL_NUMBER:
+        return DRIVE_INFO_SECTION_IDENTITY;
+    case DEVICE_IDENTIFICATION://WWN and the active SAS port
+        return DRIVE_INFO_SECTION_IDENTITY | DRIVE_INFO_SECTION_INTERFACE;
+    case BLOCK_DEVICE_CHARACTERISTICS://rotation rate and form factor
+        return DRIVE_INFO_SECTION_CAPACITY;
+    case EXTENDED_INQUIRY_DATA:
+    case POWER_CONSUMPTION:
+    case LOGICAL_BLOCK_PROVISIONING:
+    case BLOCK_LIMITS:
+    case ATA_INFORMATION:
+        return DRIVE_INFO_SECTION_FEATURES;
+    default:
+        return 0;
+    }
+}
+
+//Returns the DRIVE_INFO_SECTION_* flags that use data from a log page
+static uint32_t scsi_Log_Page_Drive_Info_Sections(uint8_t pageCode)
+{
+    switch (pageCode)
+    {
+    case LP_APPLICATION_CLIENT:
+        return DRIVE_INFO_SECTION_FEATURES;
+    case LP_SELF_TEST_RESULTS:
+        return DRIVE_INFO_SECTION_FEATURES | DRIVE_INFO_SECTION_HEALTH;
+    default:
+        return DRIVE_INFO_SECTION_HEALTH;
+    }
+}
+
+//Returns the DRIVE_INFO_SECTION_* flags that use data from a mode page
+static uint32_t scsi_Mode_Page_Drive_Info_Sections(uint8_t pageCode)
+{
+    switch (pageCode)
+    {
+    case MP_RIGID_DISK_GEOMETRY://rotation rate on old drives
+        return DRIVE_INFO_SECTION_CAPACITY;
+    case MP_PROTOCOL_SPECIFIC_PORT:
+        return DRIVE_INFO_SECTION_INTERFACE;
+    default:
+        return DRIVE_INFO_SECTION_FEATURES;
+    }
+}
+
+int get_SCSI_Drive_Information_Sections(tDevice *device, uint32_t sections, ptrDriveInformationSAS_Sata driveInfo)
 {
     int ret = SUCCESS;
-    memset(driveInfo, 0, sizeof(driveInformation));
+    memset(driveInfo, 0, sizeof(driveInformationSAS_SATA));
+    driveInfo->sections = sections;
     //start with standard inquiry data
     uint8_t peripheralQualifier = 0;
     uint8_t peripheralDeviceType = 0;
@@ -1743,7 +1845,7 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
     bool isSCSI1drive = false;
     bool isSCSI2drive = false;
     bool isSEAGATEVendorID = false;//matches SCSI/SAS/FC for Seagate
-    if (SUCCESS == scsi_Inquiry(device, inquiryData, 255, 0, false, false))
+    if (SUCCESS == scsi_Inquiry_Cached(device, inquiryData, 255, 0, false))
     {
         //copy the read data to the device struct
         memcpy(device->drive_info.scsiVpdData.inquiryData, inquiryData, INQ_RETURN_DATA_LENGTH);
@@ -1764,50 +1866,39 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
             //New standards (SPC6 or whatever is next) may use these values and they should be used.
         case 0x81:
         case 0x01:
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SCSI");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SCSI);
             isSCSI1drive = true;
             break;
         case 0x02:
         case 0x80:
         case 0x82:
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SCSI-2");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SCSI_2);
             isSCSI2drive = true;
             break;
         case 0x83:
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SPC");
-            driveInfo->numberOfSpecificationsSupported++;
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SCSI-2");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SPC);
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SCSI_2);
             isSCSI2drive = true;
             break;
         case 0x84:
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SPC-2");
-            driveInfo->numberOfSpecificationsSupported++;
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SCSI-2");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SPC_2);
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SCSI_2);
             isSCSI2drive = true;
             break;
         case 0x03:
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SPC");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SPC);
             break;
         case 0x04:
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SPC-2");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SPC_2);
             break;
         case 0x05:
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SPC-3");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SPC_3);
             break;
         case 0x06:
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SPC-4");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SPC_4);
             break;
         case 0x07:
-            sprintf(driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported], "SPC-5");
-            driveInfo->numberOfSpecificationsSupported++;
+            driveInfo->specificationsSupported |= DRIVE_SPECIFICATION_BIT(DRIVE_SPECIFICATION_SPC_5);
             break;
         default:
             break;
@@ -1822,8 +1913,9 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
             versionDescriptor = M_BytesTo2ByteValue(device->drive_info.scsiVpdData.inquiryData[(versionIter * 2) + 58], device->drive_info.scsiVpdData.inquiryData[(versionIter * 2) + 59]);
             if (versionDescriptor > 0)
             {
-                decypher_SCSI_Version_Descriptors(versionDescriptor, driveInfo->specificationsSupported[driveInfo->numberOfSpecificationsSupported]);
-                driveInfo->numberOfSpecificationsSupported++;
+                //the name is looked up when printing
+                driveInfo->versionDescriptors[driveInfo->numberOfVersionDescriptors] = versionDescriptor;
+                driveInfo->numberOfVersionDescriptors++;
             }
         }
         if (strcmp(driveInfo->vendorID, "SEAGATE ") == 0)
@@ -1844,7 +1936,11 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
         return MEMORY_FAILURE;
     }
     bool dummyUpVPDSupport = false;
-    if (SUCCESS != scsi_Inquiry(device, tempBuf, 255, 0, true, false))
+    if (!(sections & (DRIVE_INFO_SECTION_IDENTITY | DRIVE_INFO_SECTION_CAPACITY | DRIVE_INFO_SECTION_FEATURES | DRIVE_INFO_SECTION_INTERFACE)))
+    {
+        //none of the requested sections use VPD pages. Leave the list empty so that nothing is read.
+    }
+    else if (SUCCESS != scsi_Inquiry_Cached(device, tempBuf, 255, 0, true))
     {
         //for whatever reason, this device didn't return support for the list of supported pages, so set a flag telling us to dummy up a list so that we can still attempt to issue commands to pages we do need to try and get (this is a workaround for some really stupid USB bridges)
         dummyUpVPDSupport = true;
@@ -1879,7 +1975,7 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
     //first, get the length of the supported pages
     uint16_t supportedVPDPagesLength = M_BytesTo2ByteValue(tempBuf[2], tempBuf[3]);
     uint8_t *supportedVPDPages = (uint8_t*)calloc(supportedVPDPagesLength, sizeof(uint8_t));
-    if (!supportedVPDPages)
+    if (supportedVPDPagesLength > 0 && !supportedVPDPages)
     {
         perror("Error allocating memory for supported VPD pages!\n");
         return MEMORY_FAILURE;
@@ -1891,6 +1987,10 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
     bool protectionType1Supported = false, protectionType2Supported = false, protectionType3Supported = false;
     for (vpdIter = 0; vpdIter < supportedVPDPagesLength; vpdIter++)
     {
+        if (!(sections & scsi_VPD_Page_Drive_Info_Sections(supportedVPDPages[vpdIter])))
+        {
+            continue;
+        }
         switch (supportedVPDPages[vpdIter])
         {
         case UNIT_SERIAL_NUMBER:
@@ -1902,7 +2002,7 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                 perror("Error allocating memory to read the unit serial number");
                 continue;//continue the loop
             }
-            if (SUCCESS == scsi_Inquiry(device, unitSerialNumber, unitSerialNumberPageLength, supportedVPDPages[vpdIter], true, false))
+            if (SUCCESS == scsi_Inquiry_Cached(device, unitSerialNumber, unitSerialNumberPageLength, supportedVPDPages[vpdIter], true))
             {
                 uint16_t serialNumberLength = M_BytesTo2ByteValue(unitSerialNumber[2], unitSerialNumber[3]);
                 if (serialNumberLength > 0)
@@ -1923,7 +2023,7 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                 perror("Error allocating memory to read device identification VPD page");
                 continue;
             }
-            if (SUCCESS == scsi_Inquiry(device, deviceIdentification, INQ_RETURN_DATA_LENGTH, DEVICE_IDENTIFICATION, true, false))
+            if (SUCCESS == scsi_Inquiry_Cached(device, deviceIdentification, INQ_RETURN_DATA_LENGTH, DEVICE_IDENTIFICATION, true))
             {
                 uint16_t devIDPageLen = M_BytesTo2ByteValue(deviceIdentification[2], deviceIdentification[3]);
                 if (devIDPageLen + 4 > INQ_RETURN_DATA_LENGTH)
@@ -1936,7 +2036,7 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                         return 101;
                     }
                     deviceIdentification = temp;
-                    if (SUCCESS != scsi_Inquiry(device, deviceIdentification, devIDPageLen + 4, DEVICE_IDENTIFICATION, true, false))
+                    if (SUCCESS != scsi_Inquiry_Cached(device, deviceIdentification, devIDPageLen + 4, DEVICE_IDENTIFICATION, true))
                     {
                         //we had an error while trying to read the page...
                     }
@@ -2017,7 +2117,7 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                     perror("Error allocating memory to read extended inquiry VPD page");
                     continue;
                 }
-                if (SUCCESS == scsi_Inquiry(device, extendedInquiryData, VPD_EXTENDED_INQUIRY_LEN, EXTENDED_INQUIRY_DATA, true, false))
+                if (SUCCESS == scsi_Inquiry_Cached(device, extendedInquiryData, VPD_EXTENDED_INQUIRY_LEN, EXTENDED_INQUIRY_DATA, true))
                 {
                     switch (M_GETBITRANGE(extendedInquiryData[4], 5, 3))
                     {
@@ -2049,12 +2149,12 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                         uint8_t *supportedBlockSizesAndProtectionTypes = (uint8_t*)calloc(supportedBlockSizesAndProtectionTypesLength, sizeof(uint8_t));
                         if (supportedBlockSizesAndProtectionTypes)
                         {
-                            if (SUCCESS == scsi_Inquiry(device, supportedBlockSizesAndProtectionTypes, supportedBlockSizesAndProtectionTypesLength, SUPPORTED_BLOCK_LENGTHS_AND_PROTECTION_TYPES, true, false))
+                            if (SUCCESS == scsi_Inquiry_Cached(device, supportedBlockSizesAndProtectionTypes, supportedBlockSizesAndProtectionTypesLength, SUPPORTED_BLOCK_LENGTHS_AND_PROTECTION_TYPES, true))
                             {
                                 supportedBlockSizesAndProtectionTypesLength = M_BytesTo2ByteValue(supportedBlockSizesAndProtectionTypes[2], supportedBlockSizesAndProtectionTypes[3]);
                                 uint8_t *temp = (uint8_t*)realloc(supportedBlockSizesAndProtectionTypes, supportedBlockSizesAndProtectionTypesLength * sizeof(uint8_t));
                                 supportedBlockSizesAndProtectionTypes = temp;
-                                if (SUCCESS == scsi_Inquiry(device, supportedBlockSizesAndProtectionTypes, supportedBlockSizesAndProtectionTypesLength, SUPPORTED_BLOCK_LENGTHS_AND_PROTECTION_TYPES, true, false))
+                                if (SUCCESS == scsi_Inquiry_Cached(device, supportedBlockSizesAndProtectionTypes, supportedBlockSizesAndProtectionTypesLength, SUPPORTED_BLOCK_LENGTHS_AND_PROTECTION_TYPES, true))
                                 {
                                     //loop through and find supported protection types...
                                     for (uint16_t offset = 4; offset < (supportedBlockSizesAndProtectionTypesLength + 4); offset += 8)
@@ -2103,7 +2203,7 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                 perror("Error allocating memory to read block device characteistics VPD page");
                 continue;
             }
-            if (SUCCESS == scsi_Inquiry(device, blockDeviceCharacteristics, VPD_BLOCK_DEVICE_CHARACTERISTICS_LEN, BLOCK_DEVICE_CHARACTERISTICS, true, false))
+            if (SUCCESS == scsi_Inquiry_Cached(device, blockDeviceCharacteristics, VPD_BLOCK_DEVICE_CHARACTERISTICS_LEN, BLOCK_DEVICE_CHARACTERISTICS, true))
             {
                 driveInfo->rotationRate = M_BytesTo2ByteValue(blockDeviceCharacteristics[4], blockDeviceCharacteristics[5]);
                 gotRotationRate = true;
@@ -2115,12 +2215,10 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
         }
         case POWER_CONDITION:
             //reading this information has been moved to the mode pages below. - TJE
-            //sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "EPC");
-            //driveInfo->numberOfFeaturesSupported++;
+            //set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_EPC, false);
             break;
         case POWER_CONSUMPTION:
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Power Comsumption");
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_POWER_CONSUMPTION, false);
             break;
         case LOGICAL_BLOCK_PROVISIONING:
         {
@@ -2130,12 +2228,11 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                 perror("Error allocating memory to read logical block provisioning VPD page");
                 continue;
             }
-            if (SUCCESS == scsi_Inquiry(device, logicalBlockProvisioning, VPD_LOGICAL_BLOCK_PROVISIONING_LEN, LOGICAL_BLOCK_PROVISIONING, true, false))
+            if (SUCCESS == scsi_Inquiry_Cached(device, logicalBlockProvisioning, VPD_LOGICAL_BLOCK_PROVISIONING_LEN, LOGICAL_BLOCK_PROVISIONING, true))
             {
                 if (logicalBlockProvisioning[5] & BIT7)
                 {
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "UNMAP");
-                    driveInfo->numberOfFeaturesSupported++;
+                    set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_UNMAP, false);
                 }
             }
             safe_Free(logicalBlockProvisioning);
@@ -2149,13 +2246,12 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                 perror("Error allocating memory to read logical block provisioning VPD page");
                 continue;
             }
-            if (SUCCESS == scsi_Inquiry(device, blockLimits, VPD_BLOCK_LIMITS_LEN, BLOCK_LIMITS, true, false))
+            if (SUCCESS == scsi_Inquiry_Cached(device, blockLimits, VPD_BLOCK_LIMITS_LEN, BLOCK_LIMITS, true))
             {
                 uint64_t writeSameLength = M_BytesTo8ByteValue(blockLimits[36], blockLimits[37], blockLimits[38], blockLimits[39], blockLimits[40], blockLimits[41], blockLimits[42], blockLimits[43]);
                 if (writeSameLength > 0)
                 {
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Write Same");
-                    driveInfo->numberOfFeaturesSupported++;
+                    set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_WRITE_SAME, false);
                 }
             }
             safe_Free(blockLimits);
@@ -2169,13 +2265,12 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                 perror("Error allocating memory to read ATA Information VPD page");
                 continue;
             }
-            if (SUCCESS == scsi_Inquiry(device, ataInformation, VPD_ATA_INFORMATION_LEN, ATA_INFORMATION, true, false))
+            if (SUCCESS == scsi_Inquiry_Cached(device, ataInformation, VPD_ATA_INFORMATION_LEN, ATA_INFORMATION, true))
             {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SAT");
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SAT, false);
 				memcpy(driveInfo->satVendorID, &ataInformation[8], 8);
 				memcpy(driveInfo->satProductID, &ataInformation[16], 16);
 				memcpy(driveInfo->satProductRevision, &ataInformation[32], 4);
-                driveInfo->numberOfFeaturesSupported++;
             }
             safe_Free(ataInformation);
             break;
@@ -2186,138 +2281,118 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
     }
     safe_Free(supportedVPDPages);
     uint8_t protectionTypeEnabled = 0;//default to type 0
-    //read capacity data - try read capacity 10 first, then do a read capacity 16. This is to work around some USB bridges passing the command and returning no data.
-    uint8_t *readCapBuf = (uint8_t*)calloc(READ_CAPACITY_10_LEN, sizeof(uint8_t));
-    if (!readCapBuf)
-    {
-        safe_Free(tempBuf);
-        return MEMORY_FAILURE;
-    }
-    if (SUCCESS == scsi_Read_Capacity_10(device, readCapBuf, READ_CAPACITY_10_LEN))
+    //capacity is also needed to read the protection type that is enabled and to convert the workload log counters between bytes and LBAs
+    if (sections & (DRIVE_INFO_SECTION_CAPACITY | DRIVE_INFO_SECTION_FEATURES | DRIVE_INFO_SECTION_HEALTH))
     {
-        copy_Read_Capacity_Info(&driveInfo->logicalSectorSize, &driveInfo->physicalSectorSize, &driveInfo->maxLBA, &driveInfo->sectorAlignment, readCapBuf, false);
-        //try a read capacity 16 anyways and see if the data from that was valid or not since that will give us a physical sector size whereas readcap10 data will not
-        uint8_t* temp = (uint8_t*)realloc(readCapBuf, READ_CAPACITY_16_LEN * sizeof(uint8_t));
-        if (!temp)
+        //read capacity data - try read capacity 10 first, then do a read capacity 16. This is to work around some USB bridges passing the command and returning no data.
+        uint8_t *readCapBuf = (uint8_t*)calloc(READ_CAPACITY_10_LEN, sizeof(uint8_t));
+        if (!readCapBuf)
         {
-			safe_Free(tempBuf);
-			safe_Free(readCapBuf);
+            safe_Free(tempBuf);
             return MEMORY_FAILURE;
         }
-        readCapBuf = temp;
-        memset(readCapBuf, 0, READ_CAPACITY_16_LEN);
-        if (SUCCESS == scsi_Read_Capacity_16(device, readCapBuf, READ_CAPACITY_16_LEN))
+        if (SUCCESS == scsi_Read_Capacity_10(device, readCapBuf, READ_CAPACITY_10_LEN))
         {
-            uint32_t logicalBlockSize = 0;
-            uint32_t physicalBlockSize = 0;
-            uint64_t maxLBA = 0;
-            uint16_t sectorAlignment = 0;
-            copy_Read_Capacity_Info(&logicalBlockSize, &physicalBlockSize, &maxLBA, &sectorAlignment, readCapBuf, true);
-            //some USB drives will return success and no data, so check if this local var is 0 or not...if not, we can use this data
-            if (maxLBA != 0)
+            copy_Read_Capacity_Info(&driveInfo->logicalSectorSize, &driveInfo->physicalSectorSize, &driveInfo->maxLBA, &driveInfo->sectorAlignment, readCapBuf, false);
+            //try a read capacity 16 anyways and see if the data from that was valid or not since that will give us a physical sector size whereas readcap10 data will not
+            uint8_t* temp = (uint8_t*)realloc(readCapBuf, READ_CAPACITY_16_LEN * sizeof(uint8_t));
+            if (!temp)
             {
-                driveInfo->logicalSectorSize = logicalBlockSize;
-                driveInfo->physicalSectorSize = physicalBlockSize;
-                driveInfo->maxLBA = maxLBA;
-                driveInfo->sectorAlignment = sectorAlignment;
+				safe_Free(tempBuf);
+				safe_Free(readCapBuf);
+                return MEMORY_FAILURE;
             }
-            if (protectionSupported && readCapBuf[12] & BIT0)//protection enabled
+            readCapBuf = temp;
+            memset(readCapBuf, 0, READ_CAPACITY_16_LEN);
+            if (SUCCESS == scsi_Read_Capacity_16(device, readCapBuf, READ_CAPACITY_16_LEN))
             {
-                switch (M_GETBITRANGE(readCapBuf[12], 3, 1))
+                uint32_t logicalBlockSize = 0;
+                uint32_t physicalBlockSize = 0;
+                uint64_t maxLBA = 0;
+                uint16_t sectorAlignment = 0;
+                copy_Read_Capacity_Info(&logicalBlockSize, &physicalBlockSize, &maxLBA, &sectorAlignment, readCapBuf, true);
+                //some USB drives will return success and no data, so check if this local var is 0 or not...if not, we can use this data
+                if (maxLBA != 0)
                 {
-                case 0:
-                    protectionTypeEnabled = 1;
-                    break;
-                case 1:
-                    protectionTypeEnabled = 2;
-                    break;
-                case 2:
-                    protectionTypeEnabled = 3;
-                    break;
-                default:
-                    break;
+                    driveInfo->logicalSectorSize = logicalBlockSize;
+                    driveInfo->physicalSectorSize = physicalBlockSize;
+                    driveInfo->maxLBA = maxLBA;
+                    driveInfo->sectorAlignment = sectorAlignment;
+                }
+                if (protectionSupported && readCapBuf[12] & BIT0)//protection enabled
+                {
+                    switch (M_GETBITRANGE(readCapBuf[12], 3, 1))
+                    {
+                    case 0:
+                        protectionTypeEnabled = 1;
+                        break;
+                    case 1:
+                        protectionTypeEnabled = 2;
+                        break;
+                    case 2:
+                        protectionTypeEnabled = 3;
+                        break;
+                    default:
+                        break;
+                    }
                 }
             }
         }
-    }
-    else
-    {
-        //try read capacity 16, if that fails we are done trying
-        uint8_t* temp = (uint8_t*)realloc(readCapBuf, READ_CAPACITY_16_LEN * sizeof(uint8_t));
-        if (temp == NULL)
-        {
-            safe_Free(tempBuf);
-			safe_Free(readCapBuf);
-            return MEMORY_FAILURE;
-        }
-        readCapBuf = temp;
-        memset(readCapBuf, 0, READ_CAPACITY_16_LEN);
-        if (SUCCESS == scsi_Read_Capacity_16(device, readCapBuf, READ_CAPACITY_16_LEN))
+        else
         {
-            copy_Read_Capacity_Info(&driveInfo->logicalSectorSize, &driveInfo->physicalSectorSize, &driveInfo->maxLBA, &driveInfo->sectorAlignment, readCapBuf, true);
-            if (protectionSupported && readCapBuf[12] & BIT0)//protection enabled
+            //try read capacity 16, if that fails we are done trying
+            uint8_t* temp = (uint8_t*)realloc(readCapBuf, READ_CAPACITY_16_LEN * sizeof(uint8_t));
+            if (temp == NULL)
+            {
+                safe_Free(tempBuf);
+				safe_Free(readCapBuf);
+                return MEMORY_FAILURE;
+            }
+            readCapBuf = temp;
+            memset(readCapBuf, 0, READ_CAPACITY_16_LEN);
+            if (SUCCESS == scsi_Read_Capacity_16(device, readCapBuf, READ_CAPACITY_16_LEN))
             {
-                switch (M_GETBITRANGE(readCapBuf[12], 3, 1))
+                copy_Read_Capacity_Info(&driveInfo->logicalSectorSize, &driveInfo->physicalSectorSize, &driveInfo->maxLBA, &driveInfo->sectorAlignment, readCapBuf, true);
+                if (protectionSupported && readCapBuf[12] & BIT0)//protection enabled
                 {
-                case 0:
-                    protectionTypeEnabled = 1;
-                    break;
-                case 1:
-                    protectionTypeEnabled = 2;
-                    break;
-                case 2:
-                    protectionTypeEnabled = 3;
-                    break;
-                default:
-                    break;
+                    switch (M_GETBITRANGE(readCapBuf[12], 3, 1))
+                    {
+                    case 0:
+                        protectionTypeEnabled = 1;
+                        break;
+                    case 1:
+                        protectionTypeEnabled = 2;
+                        break;
+                    case 2:
+                        protectionTypeEnabled = 3;
+                        break;
+                    default:
+                        break;
+                    }
                 }
             }
         }
+        safe_Free(readCapBuf);
     }
-    safe_Free(readCapBuf);
     if (protectionSupported)
     {
         //set protection types supported up here.
         if (protectionType1Supported)
         {
-            if (protectionTypeEnabled == 1)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Protection Type 1 [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Protection Type 1");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_PROTECTION_TYPE_1, protectionTypeEnabled == 1);
         }
         if (protectionType2Supported)
         {
-            if (protectionTypeEnabled == 2)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Protection Type 2 [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Protection Type 2");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_PROTECTION_TYPE_2, protectionTypeEnabled == 2);
         }
         if (protectionType3Supported)
         {
-            if (protectionTypeEnabled == 3)
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Protection Type 3 [Enabled]");
-            }
-            else
-            {
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Protection Type 3");
-            }
-            driveInfo->numberOfFeaturesSupported++;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_PROTECTION_TYPE_3, protectionTypeEnabled == 3);
         }
     }
     //Check for TCG support - try sending a security protocol in command to get the list of security protocols (check for security protocol EFh? We can do that for ATA Security information)
 	memset(tempBuf, 0, LEGACY_DRIVE_SEC_SIZE);
-    if (SUCCESS == scsi_SecurityProtocol_In(device, SECURITY_PROTOCOL_INFORMATION, 0, false, 512, tempBuf))
+    if ((sections & DRIVE_INFO_SECTION_FEATURES) && SUCCESS == scsi_SecurityProtocol_In(device, SECURITY_PROTOCOL_INFORMATION, 0, false, 512, tempBuf))
     {
         bool tcgFeatureFound = false;
         uint16_t length = M_BytesTo2ByteValue(tempBuf[6], tempBuf[7]);
@@ -2337,8 +2412,7 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                 driveInfo->encryptionSupport = ENCRYPTION_SELF_ENCRYPTING;
                 if (!tcgFeatureFound)
                 {
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "TCG");
-                    driveInfo->numberOfFeaturesSupported++;
+                    set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_TCG, false);
                     tcgFeatureFound = true;
                 }
                 break;
@@ -2350,15 +2424,13 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
             case SECURITY_PROTOCOL_NVM_EXPRESS:
                 break;
             case SECURITY_PROTOCOL_SCSA:
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "SCSA");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SCSA, false);
                 break;
             case SECURITY_PROTOCOL_JEDEC_UFS:
             case SECURITY_PROTOCOL_SDcard_TRUSTEDFLASH_SECURITY:
                 break;
             case SECURITY_PROTOCOL_IEEE_1667:
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "IEEE 1667");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_IEEE_1667, false);
                 break;
             case SECURITY_PROTOCOL_ATA_DEVICE_SERVER_PASSWORD:
             {
@@ -2399,8 +2471,7 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                         driveInfo->ataSecurityInformation.securitySupported = true;
                     }
                 }
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "ATA Security");
-                driveInfo->numberOfFeaturesSupported++;
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_ATA_SECURITY, false);
             }
                 break;
             default:
@@ -2410,401 +2481,406 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
     }
     driveInfo->percentEnduranceUsed = -1;//set to this to filter out later
 
-    //Check log pages for data->start with list of pages and subpages
-    memset(tempBuf, 0, LEGACY_DRIVE_SEC_SIZE);
-    bool dummyUpLogPages = false;
-	bool subpagesSupported = true;
-	if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES_AND_SUBPAGES, 0xFF, 0, tempBuf, LEGACY_DRIVE_SEC_SIZE))
-    {
-		//either device doesn't support logs, or it just doesn't support subpages, so let's try reading the list of supported pages (no subpages) before saying we need to dummy up the list
-		if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES, 0, 0, tempBuf, LEGACY_DRIVE_SEC_SIZE))
-		{
-			dummyUpLogPages = true;
-		}
-		else
-		{
-			subpagesSupported = false;
-		}
-    }
-    if (!dummyUpLogPages)
-    {
-        //memcmp to make sure we weren't given zeros
-        uint8_t zeroMem[LEGACY_DRIVE_SEC_SIZE] = { 0 };
-        if (memcmp(zeroMem, tempBuf, LEGACY_DRIVE_SEC_SIZE) == 0)
-        {
-            dummyUpLogPages = true;
-        }
-    }
-    //this is really a work-around for USB drives since some DO support pages, but the don't actually list them (same as the VPD pages above). Most USB drives don't work though - TJE
-    if (dummyUpLogPages)
+	bool smartStatusRead = false;
+    if (sections & (DRIVE_INFO_SECTION_HEALTH | DRIVE_INFO_SECTION_FEATURES))
     {
-		subpagesSupported = true;
+        //Check log pages for data->start with list of pages and subpages
         memset(tempBuf, 0, LEGACY_DRIVE_SEC_SIZE);
-        tempBuf[0] = 0;
-        tempBuf[1] = 0;
-        //page length
-        tempBuf[2] = 0;
-        tempBuf[3] = 0x1C;// <---increment me when adding a new dummy page below
-        //descriptors (1 byte per page) if you add a new page here, make the page length above bigger
-		tempBuf[4] = LP_SUPPORTED_LOG_PAGES;//just to be correct/accurate
-		tempBuf[5] = 0;//subpage
-		tempBuf[6] = LP_SUPPORTED_LOG_PAGES_AND_SUBPAGES;//just to be correct/accurate
-		tempBuf[7] = 0xFF;//supported subpages
-        tempBuf[8] = LP_WRITE_ERROR_COUNTERS;//not likely available on USB
-        tempBuf[9] = 0;//subpage
-        tempBuf[10] = LP_READ_ERROR_COUNTERS;//not likely available on USB
-        tempBuf[11] = 0;//subpage
-        tempBuf[12] = LP_LOGICAL_BLOCK_PROVISIONING;
-        tempBuf[13] = 0;//subpage
-        tempBuf[14] = LP_TEMPERATURE;//not likely available on USB
-        tempBuf[15] = 0;//subpage
-        tempBuf[16] = LP_ENVIRONMENTAL_REPORTING;//not likely available on USB
-        tempBuf[17] = 0x01;//subpage (page number is same as temperature)
-		tempBuf[18] = LP_START_STOP_CYCLE_COUNTER;//just to be correct, we're not reading this today
-		tempBuf[19] = 0;
-        tempBuf[20] = LP_UTILIZATION;//not likely available on USB
-        tempBuf[21] = 0x01;//subpage
-        tempBuf[22] = LP_APPLICATION_CLIENT;
-        tempBuf[23] = 0;
-        tempBuf[24] = LP_SELF_TEST_RESULTS;
-        tempBuf[25] = 0;
-        tempBuf[26] = LP_SOLID_STATE_MEDIA;//not likely available on USB
-        tempBuf[27] = 0;//subpage
-        tempBuf[28] = LP_BACKGROUND_SCAN_RESULTS;//not likely available on USB
-        tempBuf[29] = 0;//subpage
-        tempBuf[30] = LP_GENERAL_STATISTICS_AND_PERFORMANCE;//not likely available on USB
-        tempBuf[31] = 0;//subpage
-        tempBuf[32] = LP_INFORMATION_EXCEPTIONS;
-        tempBuf[33] = 0;//subpage
-    }
-    //loop through log pages and read them:
-	bool smartStatusRead = false;
-	uint16_t logPageIter = LOG_PAGE_HEADER_LENGTH;//log page descriptors start on offset 4 and are 2 bytes long each
-    uint16_t supportedPagesLength = M_BytesTo2ByteValue(tempBuf[2],tempBuf[3]);
-	uint8_t incrementAmount = subpagesSupported ? 2 : 1;
-	for (; logPageIter < M_Min(supportedPagesLength + LOG_PAGE_HEADER_LENGTH, LEGACY_DRIVE_SEC_SIZE); logPageIter += incrementAmount)
-    {
-        uint8_t pageCode = tempBuf[logPageIter] & 0x3F;//outer switch statement
-		uint8_t subpageCode = 0;
-		if (subpagesSupported)
-		{
-			subpageCode = tempBuf[logPageIter + 1];//inner switch statement
-		}
-        switch (pageCode)
+        bool dummyUpLogPages = false;
+		bool subpagesSupported = true;
+		if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES_AND_SUBPAGES, 0xFF, 0, tempBuf, LEGACY_DRIVE_SEC_SIZE))
         {
-        case LP_WRITE_ERROR_COUNTERS:
-            if (subpageCode == 0)
+			//either device doesn't support logs, or it just doesn't support subpages, so let's try reading the list of supported pages (no subpages) before saying we need to dummy up the list
+			if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES, 0, 0, tempBuf, LEGACY_DRIVE_SEC_SIZE))
+			{
+				dummyUpLogPages = true;
+			}
+			else
+			{
+				subpagesSupported = false;
+			}
+        }
+        if (!dummyUpLogPages)
+        {
+            //memcmp to make sure we weren't given zeros
+            uint8_t zeroMem[LEGACY_DRIVE_SEC_SIZE] = { 0 };
+            if (memcmp(zeroMem, tempBuf, LEGACY_DRIVE_SEC_SIZE) == 0)
+            {
+                dummyUpLogPages = true;
+            }
+        }
+        //this is really a work-around for USB drives since some DO support pages, but the don't actually list them (same as the VPD pages above). Most USB drives don't work though - TJE
+        if (dummyUpLogPages)
+        {
+			subpagesSupported = true;
+            memset(tempBuf, 0, LEGACY_DRIVE_SEC_SIZE);
+            tempBuf[0] = 0;
+            tempBuf[1] = 0;
+            //page length
+            tempBuf[2] = 0;
+            tempBuf[3] = 0x1C;// <---increment me when adding a new dummy page below
+            //descriptors (1 byte per page) if you add a new page here, make the page length above bigger
+			tempBuf[4] = LP_SUPPORTED_LOG_PAGES;//just to be correct/accurate
+			tempBuf[5] = 0;//subpage
+			tempBuf[6] = LP_SUPPORTED_LOG_PAGES_AND_SUBPAGES;//just to be correct/accurate
+			tempBuf[7] = 0xFF;//supported subpages
+            tempBuf[8] = LP_WRITE_ERROR_COUNTERS;//not likely available on USB
+            tempBuf[9] = 0;//subpage
+            tempBuf[10] = LP_READ_ERROR_COUNTERS;//not likely available on USB
+            tempBuf[11] = 0;//subpage
+            tempBuf[12] = LP_LOGICAL_BLOCK_PROVISIONING;
+            tempBuf[13] = 0;//subpage
+            tempBuf[14] = LP_TEMPERATURE;//not likely available on USB
+            tempBuf[15] = 0;//subpage
+            tempBuf[16] = LP_ENVIRONMENTAL_REPORTING;//not likely available on USB
+            tempBuf[17] = 0x01;//subpage (page number is same as temperature)
+			tempBuf[18] = LP_START_STOP_CYCLE_COUNTER;//just to be correct, we're not reading this today
+			tempBuf[19] = 0;
+            tempBuf[20] = LP_UTILIZATION;//not likely available on USB
+            tempBuf[21] = 0x01;//subpage
+            tempBuf[22] = LP_APPLICATION_CLIENT;
+            tempBuf[23] = 0;
+            tempBuf[24] = LP_SELF_TEST_RESULTS;
+            tempBuf[25] = 0;
+            tempBuf[26] = LP_SOLID_STATE_MEDIA;//not likely available on USB
+            tempBuf[27] = 0;//subpage
+            tempBuf[28] = LP_BACKGROUND_SCAN_RESULTS;//not likely available on USB
+            tempBuf[29] = 0;//subpage
+            tempBuf[30] = LP_GENERAL_STATISTICS_AND_PERFORMANCE;//not likely available on USB
+            tempBuf[31] = 0;//subpage
+            tempBuf[32] = LP_INFORMATION_EXCEPTIONS;
+            tempBuf[33] = 0;//subpage
+        }
+        //loop through log pages and read them:
+		uint16_t logPageIter = LOG_PAGE_HEADER_LENGTH;//log page descriptors start on offset 4 and are 2 bytes long each
+        uint16_t supportedPagesLength = M_BytesTo2ByteValue(tempBuf[2],tempBuf[3]);
+		uint8_t incrementAmount = subpagesSupported ? 2 : 1;
+		for (; logPageIter < M_Min(supportedPagesLength + LOG_PAGE_HEADER_LENGTH, LEGACY_DRIVE_SEC_SIZE); logPageIter += incrementAmount)
+        {
+            uint8_t pageCode = tempBuf[logPageIter] & 0x3F;//outer switch statement
+			uint8_t subpageCode = 0;
+			if (subpagesSupported)
+			{
+				subpageCode = tempBuf[logPageIter + 1];//inner switch statement
+			}
+            if (!(sections & scsi_Log_Page_Drive_Info_Sections(pageCode)))
             {
-                //we need parameter code 5h (total bytes processed)
-				//assume we only need to read 16 bytes to get this value
-				uint8_t *writeErrorData = (uint8_t*)calloc(16 * sizeof(uint8_t), sizeof(uint8_t));
-				if (!writeErrorData)
-				{
-					break;
-				}
-				if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0005, writeErrorData, 16))
-				{
-					//check the length before we start trying to read the number of bytes in.
-                    if (M_BytesTo2ByteValue(writeErrorData[4], writeErrorData[5]) == 0x0005)
-                    {
-                        uint8_t paramLength = writeErrorData[7];
-                        switch (paramLength)
-                        {
-                        case 1://single byte
-                            driveInfo->totalBytesWritten = writeErrorData[8];
-                            break;
-                        case 2://word
-                            driveInfo->totalBytesWritten = M_BytesTo2ByteValue(writeErrorData[8], writeErrorData[9]);
-                            break;
-                        case 4://double word
-                            driveInfo->totalBytesWritten = M_BytesTo4ByteValue(writeErrorData[8], writeErrorData[9], writeErrorData[10], writeErrorData[11]);
-                            break;
-                        case 8://quad word
-                            driveInfo->totalBytesWritten = M_BytesTo8ByteValue(writeErrorData[8], writeErrorData[9], writeErrorData[10], writeErrorData[11], writeErrorData[12], writeErrorData[13], writeErrorData[14], writeErrorData[15]);
-                            break;
-                        default://don't bother trying to read the data since it's in a more complicated format to read than we care to handle in this code right now
-                            break;
-                        }
-                        //now convert this to LBAs based on the logical sector size
-                        if (driveInfo->logicalSectorSize)
-                        {
-                            driveInfo->totalLBAsWritten = driveInfo->totalBytesWritten / driveInfo->logicalSectorSize;
-                        }
-                    }
-				}
-				safe_Free(writeErrorData);
+                continue;
             }
-            break;
-        case LP_READ_ERROR_COUNTERS:
-            if (subpageCode == 0)
-            {
-				//we need parameter code 5h (total bytes processed)
-				//assume we only need to read 16 bytes to get this value
-				uint8_t *readErrorData = (uint8_t*)calloc(16 * sizeof(uint8_t), sizeof(uint8_t));
-				if (!readErrorData)
-				{
-					break;
-				}
-				if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0005, readErrorData, 16))
-				{
-                    if (M_BytesTo2ByteValue(readErrorData[4], readErrorData[5]) == 0x0005)
-                    {
-                        //check the length before we start trying to read the number of bytes in.
-                        uint8_t paramLength = readErrorData[7];
-                        switch (paramLength)
+            switch (pageCode)
+            {
+            case LP_WRITE_ERROR_COUNTERS:
+                if (subpageCode == 0)
+                {
+                    //we need parameter code 5h (total bytes processed)
+					//assume we only need to read 16 bytes to get this value
+					uint8_t *writeErrorData = (uint8_t*)calloc(16 * sizeof(uint8_t), sizeof(uint8_t));
+					if (!writeErrorData)
+					{
+						break;
+					}
+					if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0005, writeErrorData, 16))
+					{
+						//check the length before we start trying to read the number of bytes in.
+                        if (M_BytesTo2ByteValue(writeErrorData[4], writeErrorData[5]) == 0x0005)
                         {
-                        case 1://single byte
-                            driveInfo->totalBytesRead = readErrorData[8];
-                            break;
-                        case 2://word
-                            driveInfo->totalBytesRead = M_BytesTo2ByteValue(readErrorData[8], readErrorData[9]);
-                            break;
-                        case 4://double word
-                            driveInfo->totalBytesRead = M_BytesTo4ByteValue(readErrorData[8], readErrorData[9], readErrorData[10], readErrorData[11]);
-                            break;
-                        case 8://quad word
-                            driveInfo->totalBytesRead = M_BytesTo8ByteValue(readErrorData[8], readErrorData[9], readErrorData[10], readErrorData[11], readErrorData[12], readErrorData[13], readErrorData[14], readErrorData[15]);
-                            break;
-                        default://don't bother trying to read the data since it's in a more complicated format to read than we care to handle in this code right now
-                            break;
+                            uint8_t paramLength = writeErrorData[7];
+                            switch (paramLength)
+                            {
+                            case 1://single byte
+                                driveInfo->totalBytesWritten = writeErrorData[8];
+                                break;
+                            case 2://word
+                                driveInfo->totalBytesWritten = M_BytesTo2ByteValue(writeErrorData[8], writeErrorData[9]);
+                                break;
+                            case 4://double word
+                                driveInfo->totalBytesWritten = M_BytesTo4ByteValue(writeErrorData[8], writeErrorData[9], writeErrorData[10], writeErrorData[11]);
+                                break;
+                            case 8://quad word
+                                driveInfo->totalBytesWritten = M_BytesTo8ByteValue(writeErrorData[8], writeErrorData[9], writeErrorData[10], writeErrorData[11], writeErrorData[12], writeErrorData[13], writeErrorData[14], writeErrorData[15]);
+                                break;
+                            default://don't bother trying to read the data since it's in a more complicated format to read than we care to handle in this code right now
+                                break;
+                            }
+                            //now convert this to LBAs based on the logical sector size
+                            if (driveInfo->logicalSectorSize)
+                            {
+                                driveInfo->totalLBAsWritten = driveInfo->totalBytesWritten / driveInfo->logicalSectorSize;
+                            }
                         }
-                        //now convert this to LBAs based on the logical sector size
-                        if (driveInfo->logicalSectorSize)
+					}
+					safe_Free(writeErrorData);
+                }
+                break;
+            case LP_READ_ERROR_COUNTERS:
+                if (subpageCode == 0)
+                {
+					//we need parameter code 5h (total bytes processed)
+					//assume we only need to read 16 bytes to get this value
+					uint8_t *readErrorData = (uint8_t*)calloc(16 * sizeof(uint8_t), sizeof(uint8_t));
+					if (!readErrorData)
+					{
+						break;
+					}
+					if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0005, readErrorData, 16))
+					{
+                        if (M_BytesTo2ByteValue(readErrorData[4], readErrorData[5]) == 0x0005)
                         {
-                            driveInfo->totalLBAsRead = driveInfo->totalBytesRead / driveInfo->logicalSectorSize;
+                            //check the length before we start trying to read the number of bytes in.
+                            uint8_t paramLength = readErrorData[7];
+                            switch (paramLength)
+                            {
+                            case 1://single byte
+                                driveInfo->totalBytesRead = readErrorData[8];
+                                break;
+                            case 2://word
+                                driveInfo->totalBytesRead = M_BytesTo2ByteValue(readErrorData[8], readErrorData[9]);
+                                break;
+                            case 4://double word
+                                driveInfo->totalBytesRead = M_BytesTo4ByteValue(readErrorData[8], readErrorData[9], readErrorData[10], readErrorData[11]);
+                                break;
+                            case 8://quad word
+                                driveInfo->totalBytesRead = M_BytesTo8ByteValue(readErrorData[8], readErrorData[9], readErrorData[10], readErrorData[11], readErrorData[12], readErrorData[13], readErrorData[14], readErrorData[15]);
+                                break;
+                            default://don't bother trying to read the data since it's in a more complicated format to read than we care to handle in this code right now
+                                break;
+                            }
+                            //now convert this to LBAs based on the logical sector size
+                            if (driveInfo->logicalSectorSize)
+                            {
+                                driveInfo->totalLBAsRead = driveInfo->totalBytesRead / driveInfo->logicalSectorSize;
+                            }
                         }
-                    }
-				}
-				safe_Free(readErrorData);
-            }
-            break;
-        case LP_LOGICAL_BLOCK_PROVISIONING:
-            /*if (subpageCode == 0)
-            {
+					}
+					safe_Free(readErrorData);
+                }
+                break;
+            case LP_LOGICAL_BLOCK_PROVISIONING:
+                /*if (subpageCode == 0)
+                {
 
-            }*/
-            break;
-        case LP_TEMPERATURE://also environmental reporting
-            switch (subpageCode)
-            {
-			case 0://temperature
-			{
-				uint8_t *temperatureData = (uint8_t*)calloc(10 * sizeof(uint8_t), sizeof(uint8_t));
-				if (!temperatureData)
-				{
-					break;
-				}
-				if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0, temperatureData, 10))
-				{
-					driveInfo->temperatureData.temperatureDataValid = true;
-					driveInfo->temperatureData.currentTemperature = temperatureData[9];
-				}
-				safe_Free(temperatureData);
-			}
-			break;
-			case 1://environmental reporting
-			{
-				uint8_t *environmentReporting = (uint8_t*)calloc(16 * sizeof(uint8_t), sizeof(uint8_t));
-				if (!environmentReporting)
-				{
-					break;
-				}
-				//get temperature data first
-				if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0, environmentReporting, 16))
-				{
-					driveInfo->temperatureData.temperatureDataValid = true;
-					driveInfo->temperatureData.currentTemperature = (int8_t)environmentReporting[9];
-					driveInfo->temperatureData.highestTemperature = (int8_t)environmentReporting[10];
-					driveInfo->temperatureData.lowestTemperature = (int8_t)environmentReporting[11];
-                    driveInfo->temperatureData.highestValid = true;
-                    driveInfo->temperatureData.lowestValid = true;
-				}
-				//now get humidity data if available
-				if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0100, environmentReporting, 16))
-				{
-					driveInfo->humidityData.humidityDataValid = true;
-					driveInfo->humidityData.currentHumidity = environmentReporting[9];
-					driveInfo->humidityData.highestHumidity = environmentReporting[10];
-					driveInfo->humidityData.lowestHumidity = environmentReporting[11];
-                    driveInfo->humidityData.highestValid = true;
-                    driveInfo->humidityData.lowestValid = true;
-				}
-				safe_Free(environmentReporting);
-			}
-			break;
-            default:
+                }*/
                 break;
-            }
-            break;
-        case LP_UTILIZATION://also start-stop cycle counter
-            switch (subpageCode)
-            {
-			case 0x01://utilization
-			{
-				uint8_t *utilizationData = (uint8_t*)calloc(10 * sizeof(uint8_t), sizeof(uint8_t));
-				if (!utilizationData)
+            case LP_TEMPERATURE://also environmental reporting
+                switch (subpageCode)
+                {
+				case 0://temperature
 				{
-					break;
+					uint8_t *temperatureData = (uint8_t*)calloc(10 * sizeof(uint8_t), sizeof(uint8_t));
+					if (!temperatureData)
+					{
+						break;
+					}
+					if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0, temperatureData, 10))
+					{
+						driveInfo->temperatureData.temperatureDataValid = true;
+						driveInfo->temperatureData.currentTemperature = temperatureData[9];
+					}
+					safe_Free(temperatureData);
 				}
-				if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0, utilizationData, 10))
+				break;
+				case 1://environmental reporting
 				{
-					//bytes 9 & 10
-					driveInfo->deviceReportedUtilizationRate = ((double)M_BytesTo2ByteValue(utilizationData[8], utilizationData[9])) / 1000.0;
+					uint8_t *environmentReporting = (uint8_t*)calloc(16 * sizeof(uint8_t), sizeof(uint8_t));
+					if (!environmentReporting)
+					{
+						break;
+					}
+					//get temperature data first
+					if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0, environmentReporting, 16))
+					{
+						driveInfo->temperatureData.temperatureDataValid = true;
+						driveInfo->temperatureData.currentTemperature = (int8_t)environmentReporting[9];
+						driveInfo->temperatureData.highestTemperature = (int8_t)environmentReporting[10];
+						driveInfo->temperatureData.lowestTemperature = (int8_t)environmentReporting[11];
+                        driveInfo->temperatureData.highestValid = true;
+                        driveInfo->temperatureData.lowestValid = true;
+					}
+					//now get humidity data if available
+					if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0100, environmentReporting, 16))
+					{
+						driveInfo->humidityData.humidityDataValid = true;
+						driveInfo->humidityData.currentHumidity = environmentReporting[9];
+						driveInfo->humidityData.highestHumidity = environmentReporting[10];
+						driveInfo->humidityData.lowestHumidity = environmentReporting[11];
+                        driveInfo->humidityData.highestValid = true;
+                        driveInfo->humidityData.lowestValid = true;
+					}
+					safe_Free(environmentReporting);
 				}
-				safe_Free(utilizationData);
-			}
 				break;
-            default:
+                default:
+                    break;
+                }
                 break;
-            }
-            break;
-        case LP_APPLICATION_CLIENT:
-            switch (subpageCode)
-            {
-            case 0x00://application client
-            {
-                uint8_t *applicationClient = (uint8_t*)calloc(4 * sizeof(uint8_t), sizeof(uint8_t));
-                if (!applicationClient)
+            case LP_UTILIZATION://also start-stop cycle counter
+                switch (subpageCode)
                 {
+				case 0x01://utilization
+				{
+					uint8_t *utilizationData = (uint8_t*)calloc(10 * sizeof(uint8_t), sizeof(uint8_t));
+					if (!utilizationData)
+					{
+						break;
+					}
+					if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0, utilizationData, 10))
+					{
+						//bytes 9 & 10
+						driveInfo->deviceReportedUtilizationRate = ((double)M_BytesTo2ByteValue(utilizationData[8], utilizationData[9])) / 1000.0;
+					}
+					safe_Free(utilizationData);
+				}
+					break;
+                default:
                     break;
                 }
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0, applicationClient, 4))
+                break;
+            case LP_APPLICATION_CLIENT:
+                switch (subpageCode)
+                {
+                case 0x00://application client
                 {
-                    //add "Application Client Logging" to supported features :)
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Application Client Logging");
-                    driveInfo->numberOfFeaturesSupported++;
+                    uint8_t *applicationClient = (uint8_t*)calloc(4 * sizeof(uint8_t), sizeof(uint8_t));
+                    if (!applicationClient)
+                    {
+                        break;
+                    }
+                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0, applicationClient, 4))
+                    {
+                        //add "Application Client Logging" to supported features :)
+                        set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_APPLICATION_CLIENT_LOGGING, false);
+                    }
+                    safe_Free(applicationClient);
                 }
-                safe_Free(applicationClient);
-            }
-            break;
-            default:
                 break;
-            }
-            break;
-        case LP_SELF_TEST_RESULTS:
-            if (subpageCode == 0)
-            {
-                uint8_t *selfTestResults = (uint8_t*)calloc(LP_SELF_TEST_RESULTS_LEN * sizeof(uint8_t), sizeof(uint8_t));
-                if (!selfTestResults)
-                {
+                default:
                     break;
                 }
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0, selfTestResults, LP_SELF_TEST_RESULTS_LEN))
-                {
-                    uint8_t parameterOffset = 4;
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Self Test");
-                    driveInfo->numberOfFeaturesSupported++;
-                    //get the last DST information (parameter code 1)
-                    driveInfo->dstInfo.informationValid = true;
-                    driveInfo->dstInfo.resultOrStatus = M_Nibble0(selfTestResults[parameterOffset + 4]);
-                    driveInfo->dstInfo.testNumber = M_Nibble1(selfTestResults[parameterOffset + 4]) >> 1;
-                    driveInfo->dstInfo.powerOnHours = M_BytesTo2ByteValue(selfTestResults[parameterOffset + 6], selfTestResults[parameterOffset + 7]);
-                    driveInfo->dstInfo.errorLBA = M_BytesTo8ByteValue(selfTestResults[parameterOffset + 8], selfTestResults[parameterOffset + 9], selfTestResults[parameterOffset + 10], selfTestResults[parameterOffset + 11], selfTestResults[parameterOffset + 12], selfTestResults[parameterOffset + 13], selfTestResults[parameterOffset + 14], selfTestResults[parameterOffset + 15]);
-                }
-                safe_Free(selfTestResults);
-            }
-            break;
-        case LP_SOLID_STATE_MEDIA:
-            if (subpageCode == 0)
-            {
-				//need parameter 0001h
-				uint8_t *ssdEnduranceData = (uint8_t*)calloc(12 * sizeof(uint8_t), sizeof(uint8_t));
-				if (!ssdEnduranceData)
-				{
-					break;
-				}
-				if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0001, ssdEnduranceData, 12))
-				{
-					//bytes 7 of parameter 1 (or byte 12)
-					driveInfo->percentEnduranceUsed = (double)ssdEnduranceData[11];
-				}
-				safe_Free(ssdEnduranceData);
-            }
-            break;
-        case LP_BACKGROUND_SCAN_RESULTS:
-            if (subpageCode == 0)
-            {
-                //reading power on minutes from here
-				uint8_t *backgroundScanResults = (uint8_t*)calloc(19 * sizeof(uint8_t), sizeof(uint8_t));
-				if (!backgroundScanResults)
-				{
-					break;
-				}
-				if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0, backgroundScanResults, 19))
-				{
-					//bytes 8 to 11
-					driveInfo->powerOnMinutes = M_BytesTo4ByteValue(backgroundScanResults[8], backgroundScanResults[9], backgroundScanResults[10], backgroundScanResults[11]);
-				}
-				safe_Free(backgroundScanResults);
-            }
-            break;
-        case LP_GENERAL_STATISTICS_AND_PERFORMANCE:
-            if (subpageCode == 0)
-            {
-				//parameter code 1 is what we're interested in for this one
-				uint8_t *generalStatsAndPerformance = (uint8_t*)calloc(72 * sizeof(uint8_t), sizeof(uint8_t));
-				if (!generalStatsAndPerformance)
-				{
-					break;
-				}
-				if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0001, generalStatsAndPerformance, 72))
-				{
-					//total lbas written (number of logical blocks received)
-					driveInfo->totalLBAsWritten = M_BytesTo8ByteValue(generalStatsAndPerformance[24], generalStatsAndPerformance[25], generalStatsAndPerformance[26], generalStatsAndPerformance[27], generalStatsAndPerformance[28], generalStatsAndPerformance[29], generalStatsAndPerformance[30], generalStatsAndPerformance[31]);
-					//convert to bytes written
-					driveInfo->totalBytesWritten = driveInfo->totalLBAsWritten * driveInfo->logicalSectorSize;
-					//total lbas read (number of logical blocks transmitted)
-					driveInfo->totalLBAsRead = M_BytesTo8ByteValue(generalStatsAndPerformance[32], generalStatsAndPerformance[33], generalStatsAndPerformance[34], generalStatsAndPerformance[35], generalStatsAndPerformance[36], generalStatsAndPerformance[37], generalStatsAndPerformance[38], generalStatsAndPerformance[39]);
-					//convert to bytes written
-					driveInfo->totalBytesRead = driveInfo->totalLBAsRead * driveInfo->logicalSectorSize;
-				}
-				safe_Free(generalStatsAndPerformance);
-            }
-            break;
-        case LP_INFORMATION_EXCEPTIONS:
-            if (subpageCode == 0)
-            {
-				uint8_t *informationExceptions = (uint8_t*)calloc(11 * sizeof(uint8_t), sizeof(uint8_t));
-				if (!informationExceptions)
-				{
-					break;
-				}
-                if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0, informationExceptions, 11))
+                break;
+            case LP_SELF_TEST_RESULTS:
+                if (subpageCode == 0)
                 {
-					smartStatusRead = true;
-                    if (informationExceptions[8] == 0)//if the ASC is 0, then no trip
+                    uint8_t *selfTestResults = (uint8_t*)calloc(LP_SELF_TEST_RESULTS_LEN * sizeof(uint8_t), sizeof(uint8_t));
+                    if (!selfTestResults)
                     {
-                        driveInfo->smartStatus = 0;
+                        break;
                     }
-                    else//we have a trip condition...don't care what the specific trip is though
+                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0, selfTestResults, LP_SELF_TEST_RESULTS_LEN))
                     {
-                        driveInfo->smartStatus = 1;
+                        uint8_t parameterOffset = 4;
+                        set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SELF_TEST, false);
+                        //get the last DST information (parameter code 1)
+                        driveInfo->dstInfo.informationValid = true;
+                        driveInfo->dstInfo.resultOrStatus = M_Nibble0(selfTestResults[parameterOffset + 4]);
+                        driveInfo->dstInfo.testNumber = M_Nibble1(selfTestResults[parameterOffset + 4]) >> 1;
+                        driveInfo->dstInfo.powerOnHours = M_BytesTo2ByteValue(selfTestResults[parameterOffset + 6], selfTestResults[parameterOffset + 7]);
+                        driveInfo->dstInfo.errorLBA = M_BytesTo8ByteValue(selfTestResults[parameterOffset + 8], selfTestResults[parameterOffset + 9], selfTestResults[parameterOffset + 10], selfTestResults[parameterOffset + 11], selfTestResults[parameterOffset + 12], selfTestResults[parameterOffset + 13], selfTestResults[parameterOffset + 14], selfTestResults[parameterOffset + 15]);
                     }
+                    safe_Free(selfTestResults);
                 }
-                else
-                {
-                    driveInfo->smartStatus = 2;
+                break;
+            case LP_SOLID_STATE_MEDIA:
+                if (subpageCode == 0)
+                {
+					//need parameter 0001h
+					uint8_t *ssdEnduranceData = (uint8_t*)calloc(12 * sizeof(uint8_t), sizeof(uint8_t));
+					if (!ssdEnduranceData)
+					{
+						break;
+					}
+					if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0001, ssdEnduranceData, 12))
+					{
+						//bytes 7 of parameter 1 (or byte 12)
+						driveInfo->percentEnduranceUsed = (double)ssdEnduranceData[11];
+					}
+					safe_Free(ssdEnduranceData);
                 }
-                safe_Free(informationExceptions);
-            }
-            break;
-		case 0x3C://Vendor specific page. we're checking this page on Seagate drives for an enhanced usage indicator on SSDs (PPM value)
-			if (is_Seagate_Family(device) == SEAGATE || is_Seagate_Family(device) == SEAGATE_VENDOR_A)
-			{
-				uint8_t *ssdUsage = (uint8_t*)calloc(12 * sizeof(uint8_t), sizeof(uint8_t));
-				if (!ssdUsage)
-				{
-					break;
-				}
-				if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, 0, 0x8004, ssdUsage, 12))
+                break;
+            case LP_BACKGROUND_SCAN_RESULTS:
+                if (subpageCode == 0)
+                {
+                    //reading power on minutes from here
+					uint8_t *backgroundScanResults = (uint8_t*)calloc(19 * sizeof(uint8_t), sizeof(uint8_t));
+					if (!backgroundScanResults)
+					{
+						break;
+					}
+					if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0, backgroundScanResults, 19))
+					{
+						//bytes 8 to 11
+						driveInfo->powerOnMinutes = M_BytesTo4ByteValue(backgroundScanResults[8], backgroundScanResults[9], backgroundScanResults[10], backgroundScanResults[11]);
+					}
+					safe_Free(backgroundScanResults);
+                }
+                break;
+            case LP_GENERAL_STATISTICS_AND_PERFORMANCE:
+                if (subpageCode == 0)
+                {
+					//parameter code 1 is what we're interested in for this one
+					uint8_t *generalStatsAndPerformance = (uint8_t*)calloc(72 * sizeof(uint8_t), sizeof(uint8_t));
+					if (!generalStatsAndPerformance)
+					{
+						break;
+					}
+					if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0x0001, generalStatsAndPerformance, 72))
+					{
+						//total lbas written (number of logical blocks received)
+						driveInfo->totalLBAsWritten = M_BytesTo8ByteValue(generalStatsAndPerformance[24], generalStatsAndPerformance[25], generalStatsAndPerformance[26], generalStatsAndPerformance[27], generalStatsAndPerformance[28], generalStatsAndPerformance[29], generalStatsAndPerformance[30], generalStatsAndPerformance[31]);
+						//convert to bytes written
+						driveInfo->totalBytesWritten = driveInfo->totalLBAsWritten * driveInfo->logicalSectorSize;
+						//total lbas read (number of logical blocks transmitted)
+						driveInfo->totalLBAsRead = M_BytesTo8ByteValue(generalStatsAndPerformance[32], generalStatsAndPerformance[33], generalStatsAndPerformance[34], generalStatsAndPerformance[35], generalStatsAndPerformance[36], generalStatsAndPerformance[37], generalStatsAndPerformance[38], generalStatsAndPerformance[39]);
+						//convert to bytes written
+						driveInfo->totalBytesRead = driveInfo->totalLBAsRead * driveInfo->logicalSectorSize;
+					}
+					safe_Free(generalStatsAndPerformance);
+                }
+                break;
+            case LP_INFORMATION_EXCEPTIONS:
+                if (subpageCode == 0)
+                {
+					uint8_t *informationExceptions = (uint8_t*)calloc(11 * sizeof(uint8_t), sizeof(uint8_t));
+					if (!informationExceptions)
+					{
+						break;
+					}
+                    if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, subpageCode, 0, informationExceptions, 11))
+                    {
+						smartStatusRead = true;
+                        if (informationExceptions[8] == 0)//if the ASC is 0, then no trip
+                        {
+                            driveInfo->smartStatus = 0;
+                        }
+                        else//we have a trip condition...don't care what the specific trip is though
+                        {
+                            driveInfo->smartStatus = 1;
+                        }
+                    }
+                    else
+                    {
+                        driveInfo->smartStatus = 2;
+                    }
+                    safe_Free(informationExceptions);
+                }
+                break;
+			case 0x3C://Vendor specific page. we're checking this page on Seagate drives for an enhanced usage indicator on SSDs (PPM value)
+				if (is_Seagate_Family(device) == SEAGATE || is_Seagate_Family(device) == SEAGATE_VENDOR_A)
 				{
-					driveInfo->percentEnduranceUsed = (((double)M_BytesTo4ByteValue(ssdUsage[8], ssdUsage[9], ssdUsage[10], ssdUsage[11])) / 1000000.00) * 100.00;
+					uint8_t *ssdUsage = (uint8_t*)calloc(12 * sizeof(uint8_t), sizeof(uint8_t));
+					if (!ssdUsage)
+					{
+						break;
+					}
+					if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, 0, 0x8004, ssdUsage, 12))
+					{
+						driveInfo->percentEnduranceUsed = (((double)M_BytesTo4ByteValue(ssdUsage[8], ssdUsage[9], ssdUsage[10], ssdUsage[11])) / 1000000.00) * 100.00;
+					}
+					safe_Free(ssdUsage);
 				}
-				safe_Free(ssdUsage);
-			}
-			break;
-        default:
-            break;
+				break;
+            default:
+                break;
+            }
         }
     }
 	if (!smartStatusRead)
@@ -2845,6 +2921,10 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
     {
         uint8_t pageCode = listOfModePagesAndSubpages[modeIter];
         uint8_t subPageCode = listOfModePagesAndSubpages[modeIter + 1];
+        if (!(sections & scsi_Mode_Page_Drive_Info_Sections(pageCode)))
+        {
+            continue;
+        }
         switch (pageCode)
         {
         case MP_READ_WRITE_ERROR_RECOVERY:
@@ -2853,8 +2933,8 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
             case 0:
                 //check if AWRE and ARRE are supported or can be changed before checking if they are enabled or not.
             {
-                char *awreString = NULL;
-                char *arreString = NULL;
+                bool awreSupported = false, awreEnabled = false;
+                bool arreSupported = false, arreEnabled = false;
                 uint8_t readWriteErrorRecovery[12 + MODE_PARAMETER_HEADER_10_LEN] = { 0 };//need to include header length in this
                 bool pageRead = false, defaultsRead = false;
                 uint8_t headerLength = 0;
@@ -2874,30 +2954,12 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                     //awre
                     if (readWriteErrorRecovery[headerLength + 2] & BIT7)
                     {
-                        if (!awreString)
-                        {
-                            awreString = (char*)calloc(30, sizeof(char));
-                        }
-                        else
-                        {
-                            awreString = (char*)realloc(awreString, 30 * sizeof(char));
-                            memset(awreString, 0, 30);
-                        }
-                        strcpy(awreString, "Automatic Write Reassignment");
+                        awreSupported = true;
                     }
                     //arre
                     if (readWriteErrorRecovery[headerLength + 2] & BIT6)
                     {
-                        if (!arreString)
-                        {
-                            arreString = (char*)calloc(30, sizeof(char));
-                        }
-                        else
-                        {
-                            arreString = (char*)realloc(arreString, 30 * sizeof(char));
-                            memset(arreString, 0, 30);
-                        }
-                        strcpy(arreString, "Automatic Read Reassignment");
+                        arreSupported = true;
                     }
                 }
                 if (SUCCESS == scsi_Mode_Sense_10(device, pageCode, 12 + MODE_PARAMETER_HEADER_10_LEN, subPageCode, true, false, MPC_CURRENT_VALUES, readWriteErrorRecovery))
@@ -2916,44 +2978,24 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                     //awre
                     if (readWriteErrorRecovery[headerLength + 2] & BIT7)
                     {
-                        if (!awreString)
-                        {
-                            awreString = (char*)calloc(40, sizeof(char));
-                        }
-                        else
-                        {
-                            awreString = (char*)realloc(awreString, 40 * sizeof(char));
-                            memset(awreString, 0, 40);
-                        }
-                        strcpy(awreString, "Automatic Write Reassignment [Enabled]");
+                        awreSupported = true;
+                        awreEnabled = true;
                     }
                     //arre
                     if (readWriteErrorRecovery[headerLength + 2] & BIT6)
                     {
-                        if (!arreString)
-                        {
-                            arreString = (char*)calloc(40, sizeof(char));
-                        }
-                        else
-                        {
-                            arreString = (char*)realloc(arreString, 40 * sizeof(char));
-                            memset(arreString, 0, 40);
-                        }
-                        strcpy(arreString, "Automatic Read Reassignment [Enabled]");
+                        arreSupported = true;
+                        arreEnabled = true;
                     }
                 }
-                if (awreString)
+                if (awreSupported)
                 {
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "%s", awreString);
-                    driveInfo->numberOfFeaturesSupported++;
+                    set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_AUTOMATIC_WRITE_REASSIGNMENT, awreEnabled);
                 }
-                if (arreString)
+                if (arreSupported)
                 {
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "%s", arreString);
-                    driveInfo->numberOfFeaturesSupported++;
+                    set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_AUTOMATIC_READ_REASSIGNMENT, arreEnabled);
                 }
-                safe_Free(awreString);
-                safe_Free(arreString);
             }
                 break;
             default:
@@ -3028,7 +3070,7 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
             case 1://controlExtension
             {
                 //check if DLC is supported or can be changed before checking if they are enabled or not.
-                char *dlcString = NULL;
+                bool dlcSupported = false, dlcEnabled = false;
                 uint8_t controlExtensionPage[32 + MODE_PARAMETER_HEADER_10_LEN] = { 0 };//need to include header length in this
                 bool pageRead = false, defaultsRead = false;
                 uint8_t headerLength = 0;
@@ -3062,16 +3104,7 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                     //dlc
                     if (controlExtensionPage[headerLength + 4] & BIT3)
                     {
-                        if (!dlcString)
-                        {
-                            dlcString = (char*)calloc(50, sizeof(char));
-                        }
-                        else
-                        {
-                            dlcString = (char*)realloc(dlcString, 50 * sizeof(char));
-                            memset(dlcString, 0, 50);
-                        }
-                        strcpy(dlcString, "Device Life Control");
+                        dlcSupported = true;
                     }
                 }
                 if (SUCCESS == scsi_Mode_Sense_10(device, pageCode, 32 + MODE_PARAMETER_HEADER_10_LEN, subPageCode, true, false, MPC_CURRENT_VALUES, controlExtensionPage))
@@ -3104,24 +3137,14 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                     //dlc
                     if (controlExtensionPage[headerLength + 4] & BIT3)
                     {
-                        if (!dlcString)
-                        {
-                            dlcString = (char*)calloc(50, sizeof(char));
-                        }
-                        else
-                        {
-                            dlcString = (char*)realloc(dlcString, 50 * sizeof(char));
-                            memset(dlcString, 0, 50);
-                        }
-                        strcpy(dlcString, "Device Life Control [Enabled]");
+                        dlcSupported = true;
+                        dlcEnabled = true;
                     }
                 }
-                if (dlcString)
+                if (dlcSupported)
                 {
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "%s", dlcString);
-                    driveInfo->numberOfFeaturesSupported++;
+                    set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_DEVICE_LIFE_CONTROL, dlcEnabled);
                 }
-                safe_Free(dlcString);
             }
                 break;
             case 0x05://IO Advice Hints
@@ -3163,13 +3186,11 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                     }
                     if (valid)
                     {
-                        sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "IO Advice Hints [Enabled]");
-                        driveInfo->numberOfFeaturesSupported++;
+                        set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_IO_ADVICE_HINTS, true);
                     }
                     else
                     {
-                        sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "IO Advice Hints");
-                        driveInfo->numberOfFeaturesSupported++;
+                        set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_IO_ADVICE_HINTS, false);
                     }
                 }
             }
@@ -3207,8 +3228,7 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                 }
                 if (pageRead)
                 {
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "PATA Control");
-                    driveInfo->numberOfFeaturesSupported++;
+                    set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_PATA_CONTROL, false);
                 }
             }
                 break;
@@ -3577,7 +3597,8 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
             {
             case 0x00://EPC
             {
-                char *epcFeatureString = NULL;
+                eDriveFeature powerConditionsFeature = DRIVE_FEATURE_POWER_CONDITIONS;//EPC or the older power conditions page
+                bool powerConditionsSupported = false, powerConditionsEnabled = false;
                 //read the default values to check if it's supported...then try the current page...
                 bool readDefaults = false;
                 uint8_t powerConditions[40 + MODE_PARAMETER_HEADER_10_LEN] = { 0 };//need to include header length in this
@@ -3596,29 +3617,13 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                 {
                     if (powerConditions[1 + mpHeaderLen] > 0x0A)
                     {
-                        if (!epcFeatureString)
-                        {
-                            epcFeatureString = (char*)calloc(4, sizeof(char));
-                        }
-                        else
-                        {
-                            epcFeatureString = (char*)realloc(epcFeatureString, 4 * sizeof(char));
-                            memset(epcFeatureString, 0, 4);
-                        }
-                        strcpy(epcFeatureString, "EPC");
+                        powerConditionsFeature = DRIVE_FEATURE_EPC;
+                        powerConditionsSupported = true;
                     }
                     else
                     {
-                        if (!epcFeatureString)
-                        {
-                            epcFeatureString = (char*)calloc(17, sizeof(char));
-                        }
-                        else
-                        {
-                            epcFeatureString = (char*)realloc(epcFeatureString, 17 * sizeof(char));
-                            memset(epcFeatureString, 0, 17);
-                        }
-                        strcpy(epcFeatureString, "Power Conditions");
+                        powerConditionsFeature = DRIVE_FEATURE_POWER_CONDITIONS;
+                        powerConditionsSupported = true;
                     }
                 }
                 //Now read the current page to see if it's more than just supported :)
@@ -3642,37 +3647,21 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                           )
                         )
                     {
-                        if (!epcFeatureString)
-                        {
-                            epcFeatureString = (char*)calloc(14, sizeof(char));
-                        }
-                        else
-                        {
-                            epcFeatureString = (char*)realloc(epcFeatureString, 14 * sizeof(char));
-                            memset(epcFeatureString, 0, 14);
-                        }
-                        strcpy(epcFeatureString, "EPC [Enabled]");
+                        powerConditionsFeature = DRIVE_FEATURE_EPC;
+                        powerConditionsSupported = true;
+                        powerConditionsEnabled = true;
                     }
                     else if (powerConditions[3 + mpHeaderLen] & BIT0 || powerConditions[3 + mpHeaderLen] & BIT1)
                     {
-                        if (!epcFeatureString)
-                        {
-                            epcFeatureString = (char*)calloc(27, sizeof(char));
-                        }
-                        else
-                        {
-                            epcFeatureString = (char*)realloc(epcFeatureString, 27 * sizeof(char));
-                            memset(epcFeatureString, 0, 27);
-                        }
-                        strcpy(epcFeatureString, "Power Conditions [Enabled]");
+                        powerConditionsFeature = DRIVE_FEATURE_POWER_CONDITIONS;
+                        powerConditionsSupported = true;
+                        powerConditionsEnabled = true;
                     }
                 }
-                if (epcFeatureString)
+                if (powerConditionsSupported)
                 {
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "%s", epcFeatureString);
-                    driveInfo->numberOfFeaturesSupported++;
+                    set_Drive_Feature(&driveInfo->features, powerConditionsFeature, powerConditionsEnabled);
                 }
-                safe_Free(epcFeatureString);
             }
                 break;
             case 0xF1://ata power conditions
@@ -3707,13 +3696,11 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                 {
                     if (ataPowerConditions[mpHeaderLen + 0x05] & BIT0)
                     {
-                        sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "APM [Enabled]");
-                        driveInfo->numberOfFeaturesSupported++;
+                        set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_APM, true);
                     }
                     else
                     {
-                        sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "APM");
-                        driveInfo->numberOfFeaturesSupported++;
+                        set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_APM, false);
                     }
                 }
             }
@@ -3742,16 +3729,16 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                 }
                 if (pageRead)
                 {
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Informational Exceptions [Mode %"PRIu8"]", M_Nibble0(informationalExceptions[headerLength + 3]));
-                    driveInfo->numberOfFeaturesSupported++;
+                    set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_INFORMATIONAL_EXCEPTIONS, false);
+                    driveInfo->informationalExceptionsMode = M_Nibble0(informationalExceptions[headerLength + 3]);
                 }
             }
                 break;
             case 0x01://Background control
             {
                 //check if DLC is supported or can be changed before checking if they are enabled or not.
-                char *bmsString = NULL;
-                char *bmsPSString = NULL;
+                bool bmsSupported = false, bmsEnabled = false;
+                bool bmsPSSupported = false, bmsPSEnabled = false;
                 uint8_t backgroundControl[16 + MODE_PARAMETER_HEADER_10_LEN] = { 0 };//need to include header length in this
                 bool pageRead = false, defaultsRead = false;
                 uint8_t headerLength = 0;
@@ -3784,30 +3771,12 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                     //bms
                     if (backgroundControl[headerLength + 4] & BIT0)
                     {
-                        if (!bmsString)
-                        {
-                            bmsString = (char*)calloc(50, sizeof(char));
-                        }
-                        else
-                        {
-                            bmsString = (char*)realloc(bmsString, 50 * sizeof(char));
-                            memset(bmsString, 0, 50);
-                        }
-                        strcpy(bmsString, "Background Media Scan");
+                        bmsSupported = true;
                     }
                     //bms-ps
                     if (backgroundControl[headerLength + 5] & BIT0)
                     {
-                        if (!bmsPSString)
-                        {
-                            bmsPSString = (char*)calloc(50, sizeof(char));
-                        }
-                        else
-                        {
-                            bmsPSString = (char*)realloc(bmsPSString, 50 * sizeof(char));
-                            memset(bmsPSString, 0, 50);
-                        }
-                        strcpy(bmsPSString, "Background Pre-Scan");
+                        bmsPSSupported = true;
                     }
                 }
                 if (SUCCESS == scsi_Mode_Sense_10(device, pageCode, 16 + MODE_PARAMETER_HEADER_10_LEN, subPageCode, true, false, MPC_CURRENT_VALUES, backgroundControl))
@@ -3840,44 +3809,24 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
                     //bms
                     if (backgroundControl[headerLength + 4] & BIT0)
                     {
-                        if (!bmsString)
-                        {
-                            bmsString = (char*)calloc(50, sizeof(char));
-                        }
-                        else
-                        {
-                            bmsString = (char*)realloc(bmsString, 50 * sizeof(char));
-                            memset(bmsString, 0, 50);
-                        }
-                        strcpy(bmsString, "Background Media Scan [Enabled]");
+                        bmsSupported = true;
+                        bmsEnabled = true;
                     }
                     //bms-ps
                     if (backgroundControl[headerLength + 5] & BIT0)
                     {
-                        if (!bmsPSString)
-                        {
-                            bmsPSString = (char*)calloc(50, sizeof(char));
-                        }
-                        else
-                        {
-                            bmsPSString = (char*)realloc(bmsPSString, 50 * sizeof(char));
-                            memset(bmsPSString, 0, 50);
-                        }
-                        strcpy(bmsPSString, "Background Pre-Scan [Enabled]");
+                        bmsPSSupported = true;
+                        bmsPSEnabled = true;
                     }
                 }
-                if (bmsString)
+                if (bmsSupported)
                 {
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "%s", bmsString);
-                    driveInfo->numberOfFeaturesSupported++;
+                    set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_BACKGROUND_MEDIA_SCAN, bmsEnabled);
                 }
-                if (bmsPSString)
+                if (bmsPSSupported)
                 {
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "%s", bmsPSString);
-                    driveInfo->numberOfFeaturesSupported++;
+                    set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_BACKGROUND_PRE_SCAN, bmsPSEnabled);
                 }
-                safe_Free(bmsString);
-                safe_Free(bmsPSString);
             }
                 break;
             default:
@@ -3888,7 +3837,7 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
             break;
         }
     }
-    if (!driveInfo->interfaceSpeedInfo.speedIsValid)
+    if ((sections & DRIVE_INFO_SECTION_INTERFACE) && !driveInfo->interfaceSpeedInfo.speedIsValid)
     {
         //these old standards didn't report it, but we can reasonably guess the speed
         if (isSCSI1drive)
@@ -3909,261 +3858,254 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
         }
     }
 
-    //Read supported Diagnostic parameters and check for rebuild assist.
-    uint8_t *supportedDiagnostics = tempBuf;
-    memset(supportedDiagnostics, 0, 1024);
-    //transfer only 4 bytes to the drive for the page format data so we can read the supported pages, then read back the supported list with the receive diagnostics command
-    if (SUCCESS == scsi_Send_Diagnostic(device, 0, 1, 0, 0, 0, 4, supportedDiagnostics, 4, 15) && SUCCESS == scsi_Receive_Diagnostic_Results(device, true, DIAG_PAGE_SUPPORTED_PAGES, 1024, supportedDiagnostics))
+    if (sections & DRIVE_INFO_SECTION_FEATURES)
     {
-        uint16_t pageLength = M_BytesTo2ByteValue(supportedDiagnostics[2], supportedDiagnostics[3]);
-        for (uint16_t iter = 4; iter < (pageLength + 4); ++iter)
+        //Read supported Diagnostic parameters and check for rebuild assist.
+        uint8_t *supportedDiagnostics = tempBuf;
+        memset(supportedDiagnostics, 0, 1024);
+        //transfer only 4 bytes to the drive for the page format data so we can read the supported pages, then read back the supported list with the receive diagnostics command
+        if (SUCCESS == scsi_Send_Diagnostic(device, 0, 1, 0, 0, 0, 4, supportedDiagnostics, 4, 15) && SUCCESS == scsi_Receive_Diagnostic_Results(device, true, DIAG_PAGE_SUPPORTED_PAGES, 1024, supportedDiagnostics))
         {
-            switch (supportedDiagnostics[iter])
+            uint16_t pageLength = M_BytesTo2ByteValue(supportedDiagnostics[2], supportedDiagnostics[3]);
+            for (uint16_t iter = 4; iter < (pageLength + 4); ++iter)
             {
-            //Add more diagnostic pages in here if we want to check them for supported features.
-            case DIAG_PAGE_TRANSLATE_ADDRESS:
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Translate Address");
-                driveInfo->numberOfFeaturesSupported++;
-                break;
-            case DIAG_PAGE_REBUILD_ASSIST:
-                //TODO: check and see if the rebuild assist feature is enabled.
-                sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Rebuild Assist");
-                driveInfo->numberOfFeaturesSupported++;
-                break;
-            case 0x90:
-                if (is_Seagate_Family(device) == SEAGATE)
+                switch (supportedDiagnostics[iter])
                 {
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Seagate Remanufacture");
-                    driveInfo->numberOfFeaturesSupported++;
+                //Add more diagnostic pages in here if we want to check them for supported features.
+                case DIAG_PAGE_TRANSLATE_ADDRESS:
+                    set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_TRANSLATE_ADDRESS, false);
                     break;
-                }
-                break;
-            case 0x98:
-                if (is_Seagate_Family(device) == SEAGATE)
-                {
-                    sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Seagate In Drive Diagnostics (IDD)");
-                    driveInfo->numberOfFeaturesSupported++;
+                case DIAG_PAGE_REBUILD_ASSIST:
+                    //TODO: check and see if the rebuild assist feature is enabled.
+                    set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_REBUILD_ASSIST, false);
+                    break;
+                case 0x90:
+                    if (is_Seagate_Family(device) == SEAGATE)
+                    {
+                        set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SEAGATE_REMANUFACTURE, false);
+                        break;
+                    }
+                    break;
+                case 0x98:
+                    if (is_Seagate_Family(device) == SEAGATE)
+                    {
+                        set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SEAGATE_IDD, false);
+                        break;
+                    }
+                    break;
+                default:
                     break;
                 }
+            }
+        }
+
+		uint8_t *supportedCommands = tempBuf;
+		memset(supportedCommands, 0, 1024);
+
+        //Most SAT devices won't report all at once, so try asking for individual commands that are supported
+        //one at a time instead of asking for everything all at once.
+        //Format unit
+        bool formatSupported = false;
+        if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE, SCSI_FORMAT_UNIT_CMD, 0, 10, supportedCommands))
+        {
+            switch (supportedCommands[1] & 0x07)
+            {
+            case 0: //not available right now...so not supported
+            case 1://not supported
+                break;
+            case 3://supported according to spec
+            case 5://supported in vendor specific mannor in same format as case 3
+                formatSupported = true;
                 break;
             default:
                 break;
             }
         }
-    }
-
-	uint8_t *supportedCommands = tempBuf;
-	memset(supportedCommands, 0, 1024);
-
-    //Most SAT devices won't report all at once, so try asking for individual commands that are supported
-    //one at a time instead of asking for everything all at once.
-    //Format unit
-    bool formatSupported = false;
-    if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE, SCSI_FORMAT_UNIT_CMD, 0, 10, supportedCommands))
-    {
-        switch (supportedCommands[1] & 0x07)
+        else if (SUCCESS == scsi_Inquiry(device, supportedCommands, 12, SCSI_FORMAT_UNIT_CMD, false, true))
         {
-        case 0: //not available right now...so not supported
-        case 1://not supported
-            break;
-        case 3://supported according to spec
-        case 5://supported in vendor specific mannor in same format as case 3
-            formatSupported = true;
-            break;
-        default:
-            break;
+            switch (supportedCommands[1] & 0x07)
+            {
+            case 0: //not available right now...so not supported
+            case 1://not supported
+                break;
+            case 3://supported according to spec
+            case 5://supported in vendor specific mannor in same format as case 3
+                formatSupported = true;
+                break;
+            default:
+                break;
+            }
         }
-    }
-    else if (SUCCESS == scsi_Inquiry(device, supportedCommands, 12, SCSI_FORMAT_UNIT_CMD, false, true))
-    {
-        switch (supportedCommands[1] & 0x07)
+        if (formatSupported)
         {
-        case 0: //not available right now...so not supported
-        case 1://not supported
-            break;
-        case 3://supported according to spec
-        case 5://supported in vendor specific mannor in same format as case 3
-            formatSupported = true;
-            break;
-        default:
-            break;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_FORMAT_UNIT, false);
         }
-    }
-    if (formatSupported)
-    {
-        sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Format Unit");
-        driveInfo->numberOfFeaturesSupported++;
-    }
-    memset(supportedCommands, 0, 1024);
-    //Sanitize (need to check each service action to make sure at least one is supported.
-    bool sanitizeSupported = false;
-    if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE_AND_SERVICE_ACTION, SANITIZE_CMD, SCSI_SANITIZE_OVERWRITE, 14, supportedCommands))
-    {
-        switch (supportedCommands[1] & 0x07)
+        memset(supportedCommands, 0, 1024);
+        //Sanitize (need to check each service action to make sure at least one is supported.
+        bool sanitizeSupported = false;
+        if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE_AND_SERVICE_ACTION, SANITIZE_CMD, SCSI_SANITIZE_OVERWRITE, 14, supportedCommands))
         {
-        case 0: //not available right now...so not supported
-        case 1://not supported
-            break;
-        case 3://supported according to spec
-        case 5://supported in vendor specific mannor in same format as case 3
-            sanitizeSupported = true;
-            break;
-        default:
-            break;
+            switch (supportedCommands[1] & 0x07)
+            {
+            case 0: //not available right now...so not supported
+            case 1://not supported
+                break;
+            case 3://supported according to spec
+            case 5://supported in vendor specific mannor in same format as case 3
+                sanitizeSupported = true;
+                break;
+            default:
+                break;
+            }
         }
-    }
-    else if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE_AND_SERVICE_ACTION, SANITIZE_CMD, SCSI_SANITIZE_BLOCK_ERASE, 14, supportedCommands))
-    {
-        switch (supportedCommands[1] & 0x07)
+        else if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE_AND_SERVICE_ACTION, SANITIZE_CMD, SCSI_SANITIZE_BLOCK_ERASE, 14, supportedCommands))
         {
-        case 0: //not available right now...so not supported
-        case 1://not supported
-            break;
-        case 3://supported according to spec
-        case 5://supported in vendor specific mannor in same format as case 3
-            sanitizeSupported = true;
-            break;
-        default:
-            break;
+            switch (supportedCommands[1] & 0x07)
+            {
+            case 0: //not available right now...so not supported
+            case 1://not supported
+                break;
+            case 3://supported according to spec
+            case 5://supported in vendor specific mannor in same format as case 3
+                sanitizeSupported = true;
+                break;
+            default:
+                break;
+            }
         }
-    }
-    else if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE_AND_SERVICE_ACTION, SANITIZE_CMD, SCSI_SANITIZE_CRYPTOGRAPHIC_ERASE, 14, supportedCommands))
-    {
-        switch (supportedCommands[1] & 0x07)
+        else if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE_AND_SERVICE_ACTION, SANITIZE_CMD, SCSI_SANITIZE_CRYPTOGRAPHIC_ERASE, 14, supportedCommands))
         {
-        case 0: //not available right now...so not supported
-        case 1://not supported
-            break;
-        case 3://supported according to spec
-        case 5://supported in vendor specific mannor in same format as case 3
-            sanitizeSupported = true;
-            break;
-        default:
-            break;
+            switch (supportedCommands[1] & 0x07)
+            {
+            case 0: //not available right now...so not supported
+            case 1://not supported
+                break;
+            case 3://supported according to spec
+            case 5://supported in vendor specific mannor in same format as case 3
+                sanitizeSupported = true;
+                break;
+            default:
+                break;
+            }
         }
-    }
-    else if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE_AND_SERVICE_ACTION, SANITIZE_CMD, SCSI_SANITIZE_EXIT_FAILURE_MODE, 14, supportedCommands))
-    {
-        switch (supportedCommands[1] & 0x07)
+        else if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE_AND_SERVICE_ACTION, SANITIZE_CMD, SCSI_SANITIZE_EXIT_FAILURE_MODE, 14, supportedCommands))
         {
-        case 0: //not available right now...so not supported
-        case 1://not supported
-            break;
-        case 3://supported according to spec
-        case 5://supported in vendor specific mannor in same format as case 3
-            sanitizeSupported = true;
-            break;
-        default:
-            break;
+            switch (supportedCommands[1] & 0x07)
+            {
+            case 0: //not available right now...so not supported
+            case 1://not supported
+                break;
+            case 3://supported according to spec
+            case 5://supported in vendor specific mannor in same format as case 3
+                sanitizeSupported = true;
+                break;
+            default:
+                break;
+            }
         }
-    }
-    if (sanitizeSupported)
-    {
-        sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Sanitize");
-        driveInfo->numberOfFeaturesSupported++;
-    }
-    //storage element depopulation
-    bool getElementStatusSupported = false;
-    bool removeAndTruncateSupported = false;
-    if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE_AND_SERVICE_ACTION, 0x9E, 0x17, 20, supportedCommands))
-    {
-        switch (supportedCommands[1] & 0x07)
+        if (sanitizeSupported)
         {
-        case 0: //not available right now...so not supported
-        case 1://not supported
-            break;
-        case 3://supported according to spec
-        case 5://supported in vendor specific mannor in same format as case 3
-            getElementStatusSupported = true;
-            break;
-        default:
-            break;
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SANITIZE, false);
         }
-    }
-    if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE_AND_SERVICE_ACTION, 0x9E, 0x18, 20, supportedCommands))
-    {
-        switch (supportedCommands[1] & 0x07)
+        //storage element depopulation
+        bool getElementStatusSupported = false;
+        bool removeAndTruncateSupported = false;
+        if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE_AND_SERVICE_ACTION, 0x9E, 0x17, 20, supportedCommands))
         {
-        case 0: //not available right now...so not supported
-        case 1://not supported
-            break;
-        case 3://supported according to spec
-        case 5://supported in vendor specific mannor in same format as case 3
-            removeAndTruncateSupported = true;
-            break;
-        default:
-            break;
+            switch (supportedCommands[1] & 0x07)
+            {
+            case 0: //not available right now...so not supported
+            case 1://not supported
+                break;
+            case 3://supported according to spec
+            case 5://supported in vendor specific mannor in same format as case 3
+                getElementStatusSupported = true;
+                break;
+            default:
+                break;
+            }
+        }
+        if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE_AND_SERVICE_ACTION, 0x9E, 0x18, 20, supportedCommands))
+        {
+            switch (supportedCommands[1] & 0x07)
+            {
+            case 0: //not available right now...so not supported
+            case 1://not supported
+                break;
+            case 3://supported according to spec
+            case 5://supported in vendor specific mannor in same format as case 3
+                removeAndTruncateSupported = true;
+                break;
+            default:
+                break;
+            }
+        }
+        if (removeAndTruncateSupported && getElementStatusSupported)
+        {
+            set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_STORAGE_ELEMENT_DEPOPULATION, false);
         }
-    }
-    if (removeAndTruncateSupported && getElementStatusSupported)
-    {
-        sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Storage Element Depopulation");
-        driveInfo->numberOfFeaturesSupported++;
-    }
 
-    //check write buffer (firmware download) call info firmware download.h for this information.
-    supportedDLModes supportedDLModes;
-    memset(&supportedDLModes, 0, sizeof(supportedDLModes));
-	//change the device type to scsi before we enter here! Doing this so that --satinfo is correct!
-	int tempDevType = device->drive_info.drive_type;
-	device->drive_info.drive_type = SCSI_DRIVE;
-    if (SUCCESS == get_Supported_FWDL_Modes(device, &supportedDLModes))
-    {
-        driveInfo->fwdlSupport.downloadSupported = supportedDLModes.downloadMicrocodeSupported;
-        driveInfo->fwdlSupport.segmentedSupported = supportedDLModes.segmented;
-        driveInfo->fwdlSupport.deferredSupported = supportedDLModes.deferred;
-        driveInfo->fwdlSupport.dmaModeSupported = supportedDLModes.firmwareDownloadDMACommandSupported;
-        driveInfo->fwdlSupport.seagateDeferredPowerCycleRequired = supportedDLModes.seagateDeferredPowerCycleActivate;
-    }
-	device->drive_info.drive_type = tempDevType;
-    //ATA Passthrough commands
-    if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE, ATA_PASS_THROUGH_12, 0, 16, supportedCommands))
-    {
-        switch (supportedCommands[1] & 0x07)
-        {
-        case 0: //not available right now...so not supported
-        case 1://not supported
-            break;
-        case 3://supported according to spec
-        case 5://supported in vendor specific mannor in same format as case 3
-            //TODO: make sure this isn't the "blank" command being supported by a MMC device.
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "ATA Pass-Through 12");
-            driveInfo->numberOfFeaturesSupported++;
-            break;
-        default:
-            break;
+        //check write buffer (firmware download) call info firmware download.h for this information.
+        supportedDLModes supportedDLModes;
+        memset(&supportedDLModes, 0, sizeof(supportedDLModes));
+		//change the device type to scsi before we enter here! Doing this so that --satinfo is correct!
+		int tempDevType = device->drive_info.drive_type;
+		device->drive_info.drive_type = SCSI_DRIVE;
+        if (SUCCESS == get_Supported_FWDL_Modes(device, &supportedDLModes))
+        {
+            driveInfo->fwdlSupport.downloadSupported = supportedDLModes.downloadMicrocodeSupported;
+            driveInfo->fwdlSupport.segmentedSupported = supportedDLModes.segmented;
+            driveInfo->fwdlSupport.deferredSupported = supportedDLModes.deferred;
+            driveInfo->fwdlSupport.dmaModeSupported = supportedDLModes.firmwareDownloadDMACommandSupported;
+            driveInfo->fwdlSupport.seagateDeferredPowerCycleRequired = supportedDLModes.seagateDeferredPowerCycleActivate;
+        }
+		device->drive_info.drive_type = tempDevType;
+        //ATA Passthrough commands
+        if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE, ATA_PASS_THROUGH_12, 0, 16, supportedCommands))
+        {
+            switch (supportedCommands[1] & 0x07)
+            {
+            case 0: //not available right now...so not supported
+            case 1://not supported
+                break;
+            case 3://supported according to spec
+            case 5://supported in vendor specific mannor in same format as case 3
+                //TODO: make sure this isn't the "blank" command being supported by a MMC device.
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_ATA_PASS_THROUGH_12, false);
+                break;
+            default:
+                break;
+            }
         }
-    }
-    if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE, ATA_PASS_THROUGH_16, 0, 20, supportedCommands))
-    {
-        switch (supportedCommands[1] & 0x07)
+        if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE, ATA_PASS_THROUGH_16, 0, 20, supportedCommands))
         {
-        case 0: //not available right now...so not supported
-        case 1://not supported
-            break;
-        case 3://supported according to spec
-        case 5://supported in vendor specific mannor in same format as case 3
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "ATA Pass-Through 16");
-            driveInfo->numberOfFeaturesSupported++;
-            break;
-        default:
-            break;
+            switch (supportedCommands[1] & 0x07)
+            {
+            case 0: //not available right now...so not supported
+            case 1://not supported
+                break;
+            case 3://supported according to spec
+            case 5://supported in vendor specific mannor in same format as case 3
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_ATA_PASS_THROUGH_16, false);
+                break;
+            default:
+                break;
+            }
         }
-    }
-    if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE_AND_SERVICE_ACTION, 0x7F, 0x1FF0, 36, supportedCommands))
-    {
-        switch (supportedCommands[1] & 0x07)
+        if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, REPORT_OPERATION_CODE_AND_SERVICE_ACTION, 0x7F, 0x1FF0, 36, supportedCommands))
         {
-        case 0: //not available right now...so not supported
-        case 1://not supported
-            break;
-        case 3://supported according to spec
-        case 5://supported in vendor specific mannor in same format as case 3
-            sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "ATA Pass-Through 32");
-            driveInfo->numberOfFeaturesSupported++;
-            break;
-        default:
-            break;
+            switch (supportedCommands[1] & 0x07)
+            {
+            case 0: //not available right now...so not supported
+            case 1://not supported
+                break;
+            case 3://supported according to spec
+            case 5://supported in vendor specific mannor in same format as case 3
+                set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_ATA_PASS_THROUGH_32, false);
+                break;
+            default:
+                break;
+            }
         }
     }
 
@@ -4189,30 +4131,26 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
  //               //dont care about the service action since they are all sanitize operations for now
  //               if (!sanitizeFound)
  //               {
- //                   sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Sanitize");
- //                   driveInfo->numberOfFeaturesSupported++;
+ //                   set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_SANITIZE, false);
  //                   sanitizeFound = true;
  //               }
  //               break;
  //           case ATA_PASS_THROUGH_12:
  //               if (!ataPassthrough12)
  //               {
- //                   sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "ATA Pass-Through 12");
- //                   driveInfo->numberOfFeaturesSupported++;
+ //                   set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_ATA_PASS_THROUGH_12, false);
  //                   ataPassthrough12 = true;
  //               }
  //               break;
  //           case ATA_PASS_THROUGH_16:
  //               if (!ataPassthrough16)
  //               {
- //                   sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "ATA Pass-Through 16");
- //                   driveInfo->numberOfFeaturesSupported++;
+ //                   set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_ATA_PASS_THROUGH_16, false);
  //                   ataPassthrough16 = true;
  //               }
  //               break;
  //           case SCSI_FORMAT_UNIT_CMD:
- //               sprintf(driveInfo->featuresSupported[driveInfo->numberOfFeaturesSupported], "Format Unit");
- //               driveInfo->numberOfFeaturesSupported++;
+ //               set_Drive_Feature(&driveInfo->features, DRIVE_FEATURE_FORMAT_UNIT, false);
  //               break;
 	//		case WRITE_BUFFER_CMD:
 	//			if (serviceActionValid)
@@ -4252,14 +4190,20 @@ int get_SCSI_Drive_Information(tDevice *device, ptrDriveInformationSAS_Sata driv
 }
 
 int get_NVMe_Drive_Information(tDevice *device, ptrDriveInformationNVMe driveInfo)
+{
+    return get_NVMe_Drive_Information_Sections(device, DRIVE_INFO_SECTION_ALL, driveInfo);
+}
+
+int get_NVMe_Drive_Information_Sections(tDevice *device, uint32_t sections, ptrDriveInformationNVMe driveInfo)
 {
     int ret = NOT_SUPPORTED;
     memset(driveInfo, 0, sizeof(driveInformationNVMe));
+    driveInfo->sections = sections;
 #if !defined(DISABLE_NVME_PASSTHROUGH)
     //changing ret to success since we have passthrough available
     ret = SUCCESS;
     uint8_t *nvmeIdentifyData = (uint8_t*)calloc(NVME_IDENTIFY_DATA_LEN, sizeof(uint8_t));
-    if (SUCCESS == nvme_Identify(device, nvmeIdentifyData, 0, 1))
+    if (SUCCESS == nvme_Identify_Cached(device, nvmeIdentifyData, 0, 1))
     {
         //MN
         memcpy(driveInfo->controllerData.modelNumber, &nvmeIdentifyData[24], 40);
@@ -4293,7 +4237,7 @@ int get_NVMe_Drive_Information(tDevice *device, ptrDriveInformationNVMe driveInf
             uint8_t hostIdentifier[16] = { 0 };
             getHostIdentifier.prp1 = (uint64_t)hostIdentifier;
             //TODO: Need to debug why this doesn't work right now - TJE
-            if (SUCCESS == nvme_Get_Features(device, &getHostIdentifier))
+            if ((sections & DRIVE_INFO_SECTION_FEATURES) && SUCCESS == nvme_Get_Features(device, &getHostIdentifier))
             {
                 memcpy(&driveInfo->controllerData.hostIdentifier, hostIdentifier, 16);
                 if (getHostIdentifier.featSetGetValue & BIT0)
@@ -4336,7 +4280,7 @@ int get_NVMe_Drive_Information(tDevice *device, ptrDriveInformationNVMe driveInf
         }
         driveInfo->controllerData.unallocatedNVMCapacityD = convert_128bit_to_double(&driveInfo->controllerData.unallocatedNVMCapacity[0]);
         //DST info
-        if (nvmeIdentifyData[256] & BIT4)//DST command is supported
+        if ((sections & DRIVE_INFO_SECTION_HEALTH) && nvmeIdentifyData[256] & BIT4)//DST command is supported
         {
             //Read the NVMe DST log
             uint8_t nvmeDSTLog[564] = { 0 };
@@ -4376,8 +4320,7 @@ int get_NVMe_Drive_Information(tDevice *device, ptrDriveInformationNVMe driveInf
         //Sanitize
         if (nvmeIdentifyData[328] & BIT0)//Sanitize supported
         {
-            sprintf(driveInfo->controllerData.controllerFeaturesSupported[driveInfo->controllerData.numberOfControllerFeatures], "Sanitize");
-            ++(driveInfo->controllerData.numberOfControllerFeatures);
+            set_Drive_Feature(&driveInfo->controllerData.controllerFeatures, DRIVE_FEATURE_SANITIZE, false);
         }
         //max namespaces
         driveInfo->controllerData.maxNumberOfNamespaces = M_BytesTo4ByteValue(nvmeIdentifyData[519], nvmeIdentifyData[518], nvmeIdentifyData[517], nvmeIdentifyData[516]);
@@ -4389,7 +4332,7 @@ int get_NVMe_Drive_Information(tDevice *device, ptrDriveInformationNVMe driveInf
             memset(&getWriteCache, 0, sizeof(nvmeFeaturesCmdOpt));
             getWriteCache.fid = 0x06;
             getWriteCache.sel = 0;//current data
-            if (SUCCESS == nvme_Get_Features(device, &getWriteCache))
+            if ((sections & DRIVE_INFO_SECTION_FEATURES) && SUCCESS == nvme_Get_Features(device, &getWriteCache))
             {
                 if (getWriteCache.featSetGetValue & BIT0)
                 {
@@ -4400,7 +4343,7 @@ int get_NVMe_Drive_Information(tDevice *device, ptrDriveInformationNVMe driveInf
                     driveInfo->controllerData.volatileWriteCacheEnabled = false;
                 }
             }
-            else
+            else if (sections & DRIVE_INFO_SECTION_FEATURES)
             {
                 driveInfo->controllerData.volatileWriteCacheSupported = false;
             }
@@ -4410,7 +4353,7 @@ int get_NVMe_Drive_Information(tDevice *device, ptrDriveInformationNVMe driveInf
         //firmware slots
         driveInfo->controllerData.numberOfFirmwareSlots = M_GETBITRANGE(nvmeIdentifyData[260], 3, 1);
         //TODO: Add in other controller "Features"
-        if (nvmeIdentifyData[256] & BIT0)
+        if ((sections & DRIVE_INFO_SECTION_FEATURES) && nvmeIdentifyData[256] & BIT0)
         {
             //Supports security send/receive. Check for TCG and other security protocols
             uint8_t supportedSecurityProtocols[LEGACY_DRIVE_SEC_SIZE] = { 0 };
@@ -4434,8 +4377,7 @@ int get_NVMe_Drive_Information(tDevice *device, ptrDriveInformationNVMe driveInf
                         driveInfo->controllerData.encryptionSupport = ENCRYPTION_SELF_ENCRYPTING;
                         if (!tcgFeatureFound)
                         {
-                            sprintf(driveInfo->controllerData.controllerFeaturesSupported[driveInfo->controllerData.numberOfControllerFeatures], "TCG");
-                            ++(driveInfo->controllerData.numberOfControllerFeatures);
+                            set_Drive_Feature(&driveInfo->controllerData.controllerFeatures, DRIVE_FEATURE_TCG, false);
                             tcgFeatureFound = true;
                         }
                         break;
@@ -4447,15 +4389,13 @@ int get_NVMe_Drive_Information(tDevice *device, ptrDriveInformationNVMe driveInf
                     case SECURITY_PROTOCOL_NVM_EXPRESS:
                         break;
                     case SECURITY_PROTOCOL_SCSA:
-                        sprintf(driveInfo->controllerData.controllerFeaturesSupported[driveInfo->controllerData.numberOfControllerFeatures], "SCSA");
-                        ++(driveInfo->controllerData.numberOfControllerFeatures);
+                        set_Drive_Feature(&driveInfo->controllerData.controllerFeatures, DRIVE_FEATURE_SCSA, false);
                         break;
                     case SECURITY_PROTOCOL_JEDEC_UFS:
                     case SECURITY_PROTOCOL_SDcard_TRUSTEDFLASH_SECURITY:
                         break;
                     case SECURITY_PROTOCOL_IEEE_1667:
-                        sprintf(driveInfo->controllerData.controllerFeaturesSupported[driveInfo->controllerData.numberOfControllerFeatures], "IEEE1667");
-                        ++(driveInfo->controllerData.numberOfControllerFeatures);
+                        set_Drive_Feature(&driveInfo->controllerData.controllerFeatures, DRIVE_FEATURE_IEEE_1667, false);
                         break;
                     case SECURITY_PROTOCOL_ATA_DEVICE_SERVER_PASSWORD:
                     {
@@ -4497,8 +4437,7 @@ int get_NVMe_Drive_Information(tDevice *device, ptrDriveInformationNVMe driveInf
                         //        driveInfo->ataSecurityInformation.securitySupported = true;
                         //    }
                         //}
-                        sprintf(driveInfo->controllerData.controllerFeaturesSupported[driveInfo->controllerData.numberOfControllerFeatures], "ATA Security");
-                        ++(driveInfo->controllerData.numberOfControllerFeatures);
+                        set_Drive_Feature(&driveInfo->controllerData.controllerFeatures, DRIVE_FEATURE_ATA_SECURITY, false);
                     }
                     break;
                     default:
@@ -4509,54 +4448,45 @@ int get_NVMe_Drive_Information(tDevice *device, ptrDriveInformationNVMe driveInf
         }
         if (nvmeIdentifyData[256] & BIT1)
         {
-            sprintf(driveInfo->controllerData.controllerFeaturesSupported[driveInfo->controllerData.numberOfControllerFeatures], "Format NVM");
-            ++(driveInfo->controllerData.numberOfControllerFeatures);
+            set_Drive_Feature(&driveInfo->controllerData.controllerFeatures, DRIVE_FEATURE_FORMAT_NVM, false);
         }
         if (nvmeIdentifyData[256] & BIT2)
         {
-            sprintf(driveInfo->controllerData.controllerFeaturesSupported[driveInfo->controllerData.numberOfControllerFeatures], "Firmware Update");
-            ++(driveInfo->controllerData.numberOfControllerFeatures);
+            set_Drive_Feature(&driveInfo->controllerData.controllerFeatures, DRIVE_FEATURE_FIRMWARE_UPDATE, false);
         }
         if (nvmeIdentifyData[256] & BIT3)
         {
-            sprintf(driveInfo->controllerData.controllerFeaturesSupported[driveInfo->controllerData.numberOfControllerFeatures], "Namespace Management");
-            ++(driveInfo->controllerData.numberOfControllerFeatures);
+            set_Drive_Feature(&driveInfo->controllerData.controllerFeatures, DRIVE_FEATURE_NAMESPACE_MANAGEMENT, false);
         }
         if (nvmeIdentifyData[256] & BIT4)
         {
-            sprintf(driveInfo->controllerData.controllerFeaturesSupported[driveInfo->controllerData.numberOfControllerFeatures], "Device Self Test");
-            ++(driveInfo->controllerData.numberOfControllerFeatures);
+            set_Drive_Feature(&driveInfo->controllerData.controllerFeatures, DRIVE_FEATURE_DEVICE_SELF_TEST, false);
         }
         if (nvmeIdentifyData[256] & BIT7)
         {
-            sprintf(driveInfo->controllerData.controllerFeaturesSupported[driveInfo->controllerData.numberOfControllerFeatures], "Virtualization Management");
-            ++(driveInfo->controllerData.numberOfControllerFeatures);
+            set_Drive_Feature(&driveInfo->controllerData.controllerFeatures, DRIVE_FEATURE_VIRTUALIZATION_MANAGEMENT, false);
         }
         if (nvmeIdentifyData[257] & BIT1)
         {
-            sprintf(driveInfo->controllerData.controllerFeaturesSupported[driveInfo->controllerData.numberOfControllerFeatures], "Doorbell Buffer Config");
-            ++(driveInfo->controllerData.numberOfControllerFeatures);
+            set_Drive_Feature(&driveInfo->controllerData.controllerFeatures, DRIVE_FEATURE_DOORBELL_BUFFER_CONFIG, false);
         }
 
         //Before we memset the identify data, add some namespace features
         if (nvmeIdentifyData[520] & BIT1)
         {
-            sprintf(driveInfo->namespaceData.namespaceFeaturesSupported[driveInfo->namespaceData.numberOfNamespaceFeatures], "Write Uncorrectable");
-            ++(driveInfo->namespaceData.numberOfNamespaceFeatures);
+            set_Drive_Feature(&driveInfo->namespaceData.namespaceFeatures, DRIVE_FEATURE_WRITE_UNCORRECTABLE, false);
         }
         if (nvmeIdentifyData[520] & BIT2)
         {
-            sprintf(driveInfo->namespaceData.namespaceFeaturesSupported[driveInfo->namespaceData.numberOfNamespaceFeatures], "Dataset Management");
-            ++(driveInfo->namespaceData.numberOfNamespaceFeatures);
+            set_Drive_Feature(&driveInfo->namespaceData.namespaceFeatures, DRIVE_FEATURE_DATASET_MANAGEMENT, false);
         }
         if (nvmeIdentifyData[520] & BIT3)
         {
-            sprintf(driveInfo->namespaceData.namespaceFeaturesSupported[driveInfo->namespaceData.numberOfNamespaceFeatures], "Write Zeros");
-            ++(driveInfo->namespaceData.numberOfNamespaceFeatures);
+            set_Drive_Feature(&driveInfo->namespaceData.namespaceFeatures, DRIVE_FEATURE_WRITE_ZEROS, false);
         }
         
         memset(nvmeIdentifyData, 0, NVME_IDENTIFY_DATA_LEN);
-        if (SUCCESS == nvme_Identify(device, nvmeIdentifyData, 0, 0))
+        if ((sections & (DRIVE_INFO_SECTION_IDENTITY | DRIVE_INFO_SECTION_CAPACITY | DRIVE_INFO_SECTION_FEATURES)) && SUCCESS == nvme_Identify_Cached(device, nvmeIdentifyData, 0, 0))
         {
             driveInfo->namespaceData.valid = true;
             driveInfo->namespaceData.namespaceSize = M_BytesTo8ByteValue(nvmeIdentifyData[7], nvmeIdentifyData[6], nvmeIdentifyData[5], nvmeIdentifyData[4], nvmeIdentifyData[3], nvmeIdentifyData[2], nvmeIdentifyData[1], nvmeIdentifyData[0]);
@@ -4600,45 +4530,38 @@ int get_NVMe_Drive_Information(tDevice *device, ptrDriveInformationNVMe driveInf
             {
                 if (protectionEnabled == 1)
                 {
-                    sprintf(driveInfo->namespaceData.namespaceFeaturesSupported[driveInfo->namespaceData.numberOfNamespaceFeatures], "Protection Type 1 [Enabled]");
-                    ++(driveInfo->namespaceData.numberOfNamespaceFeatures);
+                    set_Drive_Feature(&driveInfo->namespaceData.namespaceFeatures, DRIVE_FEATURE_PROTECTION_TYPE_1, true);
                 }
                 else
                 {
-                    sprintf(driveInfo->namespaceData.namespaceFeaturesSupported[driveInfo->namespaceData.numberOfNamespaceFeatures], "Protection Type 1");
-                    ++(driveInfo->namespaceData.numberOfNamespaceFeatures);
+                    set_Drive_Feature(&driveInfo->namespaceData.namespaceFeatures, DRIVE_FEATURE_PROTECTION_TYPE_1, false);
                 }
             }
             if (nvmeIdentifyData[28] & BIT1)
             {
                 if (protectionEnabled == 2)
                 {
-                    sprintf(driveInfo->namespaceData.namespaceFeaturesSupported[driveInfo->namespaceData.numberOfNamespaceFeatures], "Protection Type 2 [Enabled]");
-                    ++(driveInfo->namespaceData.numberOfNamespaceFeatures);
+                    set_Drive_Feature(&driveInfo->namespaceData.namespaceFeatures, DRIVE_FEATURE_PROTECTION_TYPE_2, true);
                 }
                 else
                 {
-                    sprintf(driveInfo->namespaceData.namespaceFeaturesSupported[driveInfo->namespaceData.numberOfNamespaceFeatures], "Protection Type 2");
-                    ++(driveInfo->namespaceData.numberOfNamespaceFeatures);
+                    set_Drive_Feature(&driveInfo->namespaceData.namespaceFeatures, DRIVE_FEATURE_PROTECTION_TYPE_2, false);
                 }
             }
             if (nvmeIdentifyData[28] & BIT2)
             {
                 if (protectionEnabled == 3)
                 {
-                    sprintf(driveInfo->namespaceData.namespaceFeaturesSupported[driveInfo->namespaceData.numberOfNamespaceFeatures], "Protection Type 3 [Enabled]");
-                    ++(driveInfo->namespaceData.numberOfNamespaceFeatures);
+                    set_Drive_Feature(&driveInfo->namespaceData.namespaceFeatures, DRIVE_FEATURE_PROTECTION_TYPE_3, true);
                 }
                 else
                 {
-                    sprintf(driveInfo->namespaceData.namespaceFeaturesSupported[driveInfo->namespaceData.numberOfNamespaceFeatures], "Protection Type 3");
-                    ++(driveInfo->namespaceData.numberOfNamespaceFeatures);
+                    set_Drive_Feature(&driveInfo->namespaceData.namespaceFeatures, DRIVE_FEATURE_PROTECTION_TYPE_3, false);
                 }
             }
             if (nvmeIdentifyData[30] & BIT0)
             {
-                sprintf(driveInfo->namespaceData.namespaceFeaturesSupported[driveInfo->namespaceData.numberOfNamespaceFeatures], "Namespace Sharing");
-                ++(driveInfo->namespaceData.numberOfNamespaceFeatures);
+                set_Drive_Feature(&driveInfo->namespaceData.namespaceFeatures, DRIVE_FEATURE_NAMESPACE_SHARING, false);
             }
         }
         //Data from SMART log page
@@ -4649,7 +4572,7 @@ int get_NVMe_Drive_Information(tDevice *device, ptrDriveInformationNVMe driveInf
         smartLogOpts.dataLen = 512;
         smartLogOpts.lid = 2;
         smartLogOpts.nsid = 0;//controller data
-        if (SUCCESS == nvme_Get_Log_Page(device, &smartLogOpts))
+        if ((sections & DRIVE_INFO_SECTION_HEALTH) && SUCCESS == nvme_Get_Log_Page(device, &smartLogOpts))
         {
             driveInfo->smartData.valid = true;
             if (nvmeSMARTData[0] == 0)
@@ -4688,6 +4611,28 @@ int get_NVMe_Drive_Information(tDevice *device, ptrDriveInformationNVMe driveInf
     return ret;
 }
 
+int get_Drive_Information(tDevice *device, uint32_t sections, ptrDriveInformation driveInfo)
+{
+    if (!device || !driveInfo)
+    {
+        return BAD_PARAMETER;
+    }
+    if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        driveInfo->infoType = DRIVE_INFO_SAS_SATA;
+        return get_ATA_Drive_Information_Sections(device, sections, &driveInfo->sasSata);
+    }
+#if !defined (DISABLE_NVME_PASSTHROUGH)
+    else if (device->drive_info.drive_type == NVME_DRIVE)
+    {
+        driveInfo->infoType = DRIVE_INFO_NVME;
+        return get_NVMe_Drive_Information_Sections(device, sections, &driveInfo->nvme);
+    }
+#endif
+    driveInfo->infoType = DRIVE_INFO_SAS_SATA;
+    return get_SCSI_Drive_Information_Sections(device, sections, &driveInfo->sasSata);
+}
+
 
 //This is for use with ATA or SCSI drives where we only want to show the applicable information for each drive type. NOT RECOMMENDED ON EXTERNAL USB/IEEE1394 PRODUCTS!
 void print_Device_Information(ptrDriveInformation driveInfo)
@@ -4883,10 +4828,7 @@ void print_NVMe_Device_Information(ptrDriveInformationNVMe driveInfo)
     printf("\tNumber of Firmware Slots: %" PRIu8 "\n", driveInfo->controllerData.numberOfFirmwareSlots);
     //Print out Controller features! (admin commands, etc)
     printf("\tController Features:\n");
-    for (uint16_t featureIter = 0; featureIter < driveInfo->controllerData.numberOfControllerFeatures; ++featureIter)
-    {
-        printf("\t\t%s\n", driveInfo->controllerData.controllerFeaturesSupported[featureIter]);
-    }
+    print_Drive_Features(&driveInfo->controllerData.controllerFeatures, 0);
 
     printf("\nNVMe Namespace Information:\n");
     if (driveInfo->namespaceData.valid)
@@ -4978,10 +4920,7 @@ void print_NVMe_Device_Information(ptrDriveInformationNVMe driveInfo)
         }
         //Namespace features.
         printf("\tNamespace Features:\n");
-        for (uint16_t featureIter = 0; featureIter < driveInfo->namespaceData.numberOfNamespaceFeatures; ++featureIter)
-        {
-            printf("\t\t%s\n", driveInfo->namespaceData.namespaceFeaturesSupported[featureIter]);
-        }
+        print_Drive_Features(&driveInfo->namespaceData.namespaceFeatures, 0);
     }
     else
     {
@@ -5650,12 +5589,20 @@ void print_SAS_Sata_Device_Information(ptrDriveInformationSAS_Sata driveInfo)
     printf("\n");
     //Specifications Supported
     printf("\tSpecifications Supported:\n");
-    if (driveInfo->numberOfSpecificationsSupported > 0)
+    if (driveInfo->specificationsSupported || driveInfo->numberOfVersionDescriptors > 0)
     {
-        uint8_t specificationsIter = 0;
-        for (specificationsIter = 0; specificationsIter < driveInfo->numberOfSpecificationsSupported && specificationsIter < 30; specificationsIter++)
+        for (uint8_t specificationsIter = 0; specificationsIter < DRIVE_SPECIFICATION_COUNT; specificationsIter++)
+        {
+            if (driveInfo->specificationsSupported & DRIVE_SPECIFICATION_BIT(specificationsIter))
+            {
+                printf("\t\t%s\n", driveSpecificationNames[specificationsIter]);
+            }
+        }
+        for (uint8_t versionIter = 0; versionIter < driveInfo->numberOfVersionDescriptors && versionIter < MAX_VERSION_DESCRIPTORS; versionIter++)
         {
-            printf("\t\t%s\n", driveInfo->specificationsSupported[specificationsIter]);
+            char versionDescriptorString[30] = { 0 };
+            decypher_SCSI_Version_Descriptors(driveInfo->versionDescriptors[versionIter], versionDescriptorString);
+            printf("\t\t%s\n", versionDescriptorString);
         }
     }
     else
@@ -5664,15 +5611,7 @@ void print_SAS_Sata_Device_Information(ptrDriveInformationSAS_Sata driveInfo)
     }
     //Features Supported
     printf("\tFeatures Supported:\n");
-    if (driveInfo->numberOfFeaturesSupported > 0)
-    {
-        uint8_t featuresIter = 0;
-        for (featuresIter = 0; featuresIter < driveInfo->numberOfFeaturesSupported && featuresIter < MAX_FEATURES; featuresIter++)
-        {
-            printf("\t\t%s\n", driveInfo->featuresSupported[featuresIter]);
-        }
-    }
-    else
+    if (print_Drive_Features(&driveInfo->features, driveInfo->informationalExceptionsMode) == 0)
     {
         printf("\t\tNone reported or an error occurred while trying to determine\n\t\tthe features.\n");
     }
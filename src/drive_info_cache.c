@@ -0,0 +1,335 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file drive_info_cache.c
+// \brief This file defines the functions for keeping the static part of drive information in a file between runs
+
+#include "operations_Common.h"
+#include "drive_info_cache.h"
+#include "drive_info.h"
+#include "device_page_cache.h"
+
+//File layout: header, then numberOfEntries fixed size entries. Each entry is a driveInfoCacheKey followed by a driveInformation.
+//Both are written as-is, so the header records their sizes and a file from a build with a different layout is thrown away and created again.
+//The file is mapped. Lookups hold a shared lock on it and updates an exclusive one, so any number of processes can use the same file.
+#define DRIVE_INFO_CACHE_SIGNATURE "OSDICACH"
+#define DRIVE_INFO_CACHE_SIGNATURE_LENGTH 8
+#define DRIVE_INFO_CACHE_VERSION 1
+
+typedef struct _driveInfoCacheHeader
+{
+    char signature[DRIVE_INFO_CACHE_SIGNATURE_LENGTH];
+    uint32_t version;
+    uint32_t keySize;
+    uint32_t infoSize;
+    uint32_t numberOfEntries;
+}driveInfoCacheHeader;
+
+#define DRIVE_INFO_CACHE_ENTRY_SIZE (sizeof(driveInfoCacheKey) + sizeof(driveInformation))
+
+static uint64_t get_Drive_Info_Cache_Entry_Offset(uint32_t entry)
+{
+    return sizeof(driveInfoCacheHeader) + (uint64_t)entry * DRIVE_INFO_CACHE_ENTRY_SIZE;
+}
+
+//FNV-1a. Only used to notice that the check data changed, so it does not need to be cryptographic.
+static uint64_t hash_Drive_Info_Check_Data(uint64_t hash, uint8_t *data, uint32_t dataLength)
+{
+    for (uint32_t iter = 0; iter < dataLength; ++iter)
+    {
+        hash ^= data[iter];
+        hash *= UINT64_C(0x100000001B3);
+    }
+    return hash;
+}
+#define DRIVE_INFO_CHECK_HASH_START UINT64_C(0xCBF29CE484222325)
+
+static int get_ATA_Drive_Info_Cache_Key(tDevice *device, ptrDriveInfoCacheKey key)
+{
+    uint8_t identifyData[LEGACY_DRIVE_SEC_SIZE] = { 0 };
+    if (SUCCESS != ata_Identify(device, identifyData, LEGACY_DRIVE_SEC_SIZE))
+    {
+        return FAILURE;
+    }
+    uint16_t *wordPtr = (uint16_t*)identifyData;
+    memcpy(key->serialNumber, &identifyData[20], SERIAL_NUM_LEN);
+    byte_Swap_String(key->serialNumber);
+    remove_Leading_And_Trailing_Whitespace(key->serialNumber);
+    memcpy(key->firmwareRevision, &identifyData[46], FW_REV_LEN);
+    byte_Swap_String(key->firmwareRevision);
+    remove_Leading_And_Trailing_Whitespace(key->firmwareRevision);
+    if (wordPtr[84] & BIT8 || wordPtr[87] & BIT8)
+    {
+        memcpy(&key->worldWideName, &wordPtr[108], 8);
+        word_Swap_64(&key->worldWideName);
+    }
+    //settings (write cache, look ahead, security state, max LBA, etc) are all reported in the identify data, so hash all of it
+    key->validation = hash_Drive_Info_Check_Data(DRIVE_INFO_CHECK_HASH_START, identifyData, LEGACY_DRIVE_SEC_SIZE);
+    return SUCCESS;
+}
+
+static int get_SCSI_Drive_Info_Cache_Key(tDevice *device, ptrDriveInfoCacheKey key)
+{
+    uint8_t inquiryData[INQ_RETURN_DATA_LENGTH] = { 0 };
+    uint8_t unitSerialNumber[SERIAL_NUM_LEN + 4] = { 0 };
+    uint8_t readCapacityData[READ_CAPACITY_16_LEN] = { 0 };
+    if (SUCCESS != scsi_Inquiry(device, inquiryData, INQ_RETURN_DATA_LENGTH, 0, false, false))
+    {
+        return FAILURE;
+    }
+    memcpy(key->firmwareRevision, &inquiryData[32], 4);
+    remove_Leading_And_Trailing_Whitespace(key->firmwareRevision);
+    if (SUCCESS == scsi_Inquiry(device, unitSerialNumber, SERIAL_NUM_LEN + 4, UNIT_SERIAL_NUMBER, true, false))
+    {
+        uint16_t serialNumberLength = M_BytesTo2ByteValue(unitSerialNumber[2], unitSerialNumber[3]);
+        memcpy(key->serialNumber, &unitSerialNumber[4], M_Min(SERIAL_NUM_LEN, serialNumberLength));
+        remove_Leading_And_Trailing_Whitespace(key->serialNumber);
+    }
+    //capacity catches a format or a changed max LBA. Same read capacity 16 then 10 fallback that get_SCSI_Drive_Information uses for USB bridges.
+    if (SUCCESS != scsi_Read_Capacity_16(device, readCapacityData, READ_CAPACITY_16_LEN))
+    {
+        memset(readCapacityData, 0, READ_CAPACITY_16_LEN);
+        scsi_Read_Capacity_10(device, readCapacityData, READ_CAPACITY_10_LEN);
+    }
+    key->validation = hash_Drive_Info_Check_Data(DRIVE_INFO_CHECK_HASH_START, inquiryData, INQ_RETURN_DATA_LENGTH);
+    key->validation = hash_Drive_Info_Check_Data(key->validation, unitSerialNumber, SERIAL_NUM_LEN + 4);
+    key->validation = hash_Drive_Info_Check_Data(key->validation, readCapacityData, READ_CAPACITY_16_LEN);
+    return SUCCESS;
+}
+
+#if !defined(DISABLE_NVME_PASSTHROUGH)
+static int get_NVMe_Drive_Info_Cache_Key(tDevice *device, ptrDriveInfoCacheKey key)
+{
+    int ret = FAILURE;
+    uint8_t *identifyData = (uint8_t*)calloc(NVME_IDENTIFY_DATA_LEN, sizeof(uint8_t));
+    if (!identifyData)
+    {
+        return MEMORY_FAILURE;
+    }
+    if (SUCCESS == nvme_Identify(device, identifyData, 0, 1))
+    {
+        memcpy(key->serialNumber, &identifyData[4], SERIAL_NUM_LEN);
+        remove_Leading_And_Trailing_Whitespace(key->serialNumber);
+        memcpy(key->firmwareRevision, &identifyData[64], FW_REV_LEN);
+        remove_Leading_And_Trailing_Whitespace(key->firmwareRevision);
+        key->validation = hash_Drive_Info_Check_Data(DRIVE_INFO_CHECK_HASH_START, identifyData, NVME_IDENTIFY_DATA_LEN);
+        //namespace data catches a format
+        memset(identifyData, 0, NVME_IDENTIFY_DATA_LEN);
+        if (SUCCESS == nvme_Identify(device, identifyData, 0, 0))
+        {
+            memcpy(&key->worldWideName, &identifyData[120], 8);//EUI64
+            key->validation = hash_Drive_Info_Check_Data(key->validation, identifyData, NVME_IDENTIFY_DATA_LEN);
+        }
+        ret = SUCCESS;
+    }
+    safe_Free(identifyData);
+    return ret;
+}
+#endif
+
+static int get_Drive_Info_Cache_Key(tDevice *device, ptrDriveInfoCacheKey key)
+{
+    memset(key, 0, sizeof(driveInfoCacheKey));
+    if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        return get_ATA_Drive_Info_Cache_Key(device, key);
+    }
+#if !defined(DISABLE_NVME_PASSTHROUGH)
+    else if (device->drive_info.drive_type == NVME_DRIVE)
+    {
+        return get_NVMe_Drive_Info_Cache_Key(device, key);
+    }
+#endif
+    return get_SCSI_Drive_Info_Cache_Key(device, key);
+}
+
+static bool drive_Info_Cache_Header_Is_Valid(uint8_t *fileData, uint32_t numberOfEntries)
+{
+    driveInfoCacheHeader header;
+    memcpy(&header, fileData, sizeof(driveInfoCacheHeader));
+    return memcmp(header.signature, DRIVE_INFO_CACHE_SIGNATURE, DRIVE_INFO_CACHE_SIGNATURE_LENGTH) == 0 && header.version == DRIVE_INFO_CACHE_VERSION
+        && header.keySize == sizeof(driveInfoCacheKey) && header.infoSize == sizeof(driveInformation) && header.numberOfEntries > 0
+        && (numberOfEntries == 0 || header.numberOfEntries == numberOfEntries);
+}
+
+int open_Drive_Info_Cache(const char *fileName, uint32_t numberOfEntries, ptrDriveInfoCache cache)
+{
+    int ret = SUCCESS;
+    mappedFile headerFile;
+    bool createFile = true;
+    if (!fileName || !cache)
+    {
+        return BAD_PARAMETER;
+    }
+    memset(cache, 0, sizeof(driveInfoCache));
+    if (numberOfEntries == 0)
+    {
+        numberOfEntries = DRIVE_INFO_CACHE_DEFAULT_ENTRIES;
+    }
+    //Map just the header first to see how large the file is. Holding the lock until the whole file is mapped (and set up when
+    //it is new) keeps another process that opens it at the same time from seeing a half written header.
+    ret = map_File(fileName, FILE_MAPPING_OPEN_OR_CREATE, sizeof(driveInfoCacheHeader), &headerFile);
+    if (ret != SUCCESS)
+    {
+        return ret;
+    }
+    if (SUCCESS != lock_Mapped_File(&headerFile, true))
+    {
+        unmap_File(&headerFile);
+        return FAILURE;
+    }
+    if (drive_Info_Cache_Header_Is_Valid(headerFile.data, 0))
+    {
+        driveInfoCacheHeader header;
+        memcpy(&header, headerFile.data, sizeof(driveInfoCacheHeader));
+        createFile = false;
+        numberOfEntries = header.numberOfEntries;
+    }
+    //a file that was cut short is extended with zeros, which are empty entries
+    ret = map_File(fileName, FILE_MAPPING_READ_WRITE, get_Drive_Info_Cache_Entry_Offset(numberOfEntries), &cache->cacheFile);
+    if (ret == SUCCESS && createFile)
+    {
+        //not a cache file, or one from a build with a different layout. Start over.
+        driveInfoCacheHeader header;
+        memset(&header, 0, sizeof(driveInfoCacheHeader));
+        memcpy(header.signature, DRIVE_INFO_CACHE_SIGNATURE, DRIVE_INFO_CACHE_SIGNATURE_LENGTH);
+        header.version = DRIVE_INFO_CACHE_VERSION;
+        header.keySize = (uint32_t)sizeof(driveInfoCacheKey);
+        header.infoSize = (uint32_t)sizeof(driveInformation);
+        header.numberOfEntries = numberOfEntries;
+        memset(cache->cacheFile.data, 0, (size_t)cache->cacheFile.length);
+        memcpy(cache->cacheFile.data, &header, sizeof(driveInfoCacheHeader));
+        if (SUCCESS != flush_Mapped_File(&cache->cacheFile, 0, 0))
+        {
+            ret = FAILURE;
+        }
+    }
+    //unmapping the header releases the lock
+    unmap_File(&headerFile);
+    if (ret == SUCCESS)
+    {
+        cache->numberOfEntries = numberOfEntries;
+    }
+    else
+    {
+        close_Drive_Info_Cache(cache);
+    }
+    return ret;
+}
+
+void close_Drive_Info_Cache(ptrDriveInfoCache cache)
+{
+    if (cache)
+    {
+        unmap_File(&cache->cacheFile);
+        cache->numberOfEntries = 0;
+    }
+}
+
+static bool drive_Info_Cache_Keys_Match(ptrDriveInfoCacheKey entry, ptrDriveInfoCacheKey key)
+{
+    return entry->inUse && entry->worldWideName == key->worldWideName && strcmp(entry->serialNumber, key->serialNumber) == 0 && strcmp(entry->firmwareRevision, key->firmwareRevision) == 0;
+}
+
+//Finds this drive's entry. When it is not cached, replaceEntry is set to a free entry, or the oldest one when every entry is used.
+//Call with the file locked. Entries are copied out since they are only as aligned as the entry size allows.
+static uint32_t find_Drive_Info_Cache_Entry(ptrDriveInfoCache cache, ptrDriveInfoCacheKey key, ptrDriveInfoCacheKey matchingKey, uint32_t *replaceEntry)
+{
+    uint32_t freeEntry = UINT32_MAX, oldestEntry = 0;
+    uint64_t oldestTime = UINT64_MAX;
+    for (uint32_t entryIter = 0; entryIter < cache->numberOfEntries; ++entryIter)
+    {
+        driveInfoCacheKey entryKey;
+        memcpy(&entryKey, &cache->cacheFile.data[get_Drive_Info_Cache_Entry_Offset(entryIter)], sizeof(driveInfoCacheKey));
+        if (drive_Info_Cache_Keys_Match(&entryKey, key))
+        {
+            memcpy(matchingKey, &entryKey, sizeof(driveInfoCacheKey));
+            *replaceEntry = entryIter;
+            return entryIter;
+        }
+        if (!entryKey.inUse)
+        {
+            if (freeEntry == UINT32_MAX)
+            {
+                freeEntry = entryIter;
+            }
+        }
+        else if (entryKey.timeCached < oldestTime)
+        {
+            oldestTime = entryKey.timeCached;
+            oldestEntry = entryIter;
+        }
+    }
+    *replaceEntry = freeEntry != UINT32_MAX ? freeEntry : oldestEntry;
+    return UINT32_MAX;
+}
+
+int get_Drive_Information_Cached(tDevice *device, ptrDriveInfoCache cache, uint32_t maxAgeSeconds, ptrDriveInformation driveInfo, bool *fromCache)
+{
+    int ret = SUCCESS;
+    if (!device || !cache || !cache->cacheFile.data || !driveInfo)
+    {
+        return BAD_PARAMETER;
+    }
+    if (fromCache)
+    {
+        *fromCache = false;
+    }
+    driveInfoCacheKey key, matchingKey;
+    uint32_t matchingEntry = UINT32_MAX, replaceEntry = 0;
+    if (SUCCESS != get_Drive_Info_Cache_Key(device, &key))
+    {
+        return FAILURE;
+    }
+    key.inUse = 1;
+    key.timeCached = (uint64_t)time(NULL);
+    //Another process may have rewritten the file for a different layout since it was opened, so check the header every time.
+    //Without the lock the cache is skipped rather than risk reading an entry while it is being written.
+    if (SUCCESS == lock_Mapped_File(&cache->cacheFile, false))
+    {
+        if (drive_Info_Cache_Header_Is_Valid(cache->cacheFile.data, cache->numberOfEntries))
+        {
+            matchingEntry = find_Drive_Info_Cache_Entry(cache, &key, &matchingKey, &replaceEntry);
+        }
+        if (matchingEntry != UINT32_MAX && matchingKey.validation == key.validation
+            && (maxAgeSeconds == 0 || key.timeCached - matchingKey.timeCached <= maxAgeSeconds))
+        {
+            memcpy(driveInfo, &cache->cacheFile.data[get_Drive_Info_Cache_Entry_Offset(matchingEntry) + sizeof(driveInfoCacheKey)], sizeof(driveInformation));
+            unlock_Mapped_File(&cache->cacheFile);
+            if (fromCache)
+            {
+                *fromCache = true;
+            }
+            return SUCCESS;
+        }
+        unlock_Mapped_File(&cache->cacheFile);
+    }
+    //no usable entry, so read everything from the drive instead of from data kept in memory earlier. The file is not locked while the drive is read.
+    invalidate_Device_Page_Cache(device);
+    ret = get_Drive_Information(device, DRIVE_INFO_CACHE_SECTIONS, driveInfo);
+    if (ret == SUCCESS && SUCCESS == lock_Mapped_File(&cache->cacheFile, true))
+    {
+        if (drive_Info_Cache_Header_Is_Valid(cache->cacheFile.data, cache->numberOfEntries))
+        {
+            //look again since another process may have added this drive, or taken the free entry, while the drive was read
+            uint64_t entryOffset = 0;
+            find_Drive_Info_Cache_Entry(cache, &key, &matchingKey, &replaceEntry);
+            entryOffset = get_Drive_Info_Cache_Entry_Offset(replaceEntry);
+            //mark the entry empty until the information is in place so a process stopped part way through can't leave a bad entry in use
+            memset(&cache->cacheFile.data[entryOffset], 0, sizeof(driveInfoCacheKey));
+            memcpy(&cache->cacheFile.data[entryOffset + sizeof(driveInfoCacheKey)], driveInfo, sizeof(driveInformation));
+            memcpy(&cache->cacheFile.data[entryOffset], &key, sizeof(driveInfoCacheKey));
+            flush_Mapped_File(&cache->cacheFile, entryOffset, DRIVE_INFO_CACHE_ENTRY_SIZE);
+        }
+        unlock_Mapped_File(&cache->cacheFile);
+    }
+    return ret;
+}
@@ -0,0 +1,605 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file drive_info_serialize.c
+// \brief This file defines the functions for writing drive information out as JSON or a binary record for other programs to read
+
+#include "operations_Common.h"
+#include "drive_info_serialize.h"
+#include <math.h>
+
+//Output position in the caller's buffer. offset keeps counting after the buffer is full so the caller can be told how much room is needed.
+typedef struct _driveInfoWriter
+{
+    eDriveInfoFormat format;
+    uint8_t *buffer;
+    uint32_t bufferSize;
+    uint32_t offset;
+    bool firstField;//JSON only. No comma before the first member of an object or array
+}driveInfoWriter, *ptrDriveInfoWriter;
+
+static void put_Bytes(ptrDriveInfoWriter writer, const void *data, uint32_t dataLength)
+{
+    if (writer->buffer && writer->offset <= writer->bufferSize && dataLength <= (writer->bufferSize - writer->offset))
+    {
+        memcpy(&writer->buffer[writer->offset], data, dataLength);
+    }
+    writer->offset += dataLength;
+}
+
+static void put_Byte(ptrDriveInfoWriter writer, uint8_t value)
+{
+    put_Bytes(writer, &value, 1);
+}
+
+static void put_Little_Endian(ptrDriveInfoWriter writer, uint64_t value, uint8_t size)
+{
+    for (uint8_t byteIter = 0; byteIter < size; ++byteIter)
+    {
+        put_Byte(writer, M_Byte0(value >> (byteIter * 8)));
+    }
+}
+
+static uint32_t string_Length(const char *string, uint32_t maxLength)
+{
+    uint32_t length = 0;
+    while (length < maxLength && string[length])
+    {
+        ++length;
+    }
+    return length;
+}
+
+static void put_JSON_String(ptrDriveInfoWriter writer, const char *string, uint32_t maxLength)
+{
+    static const char hexDigits[] = "0123456789ABCDEF";
+    uint32_t length = string_Length(string, maxLength);
+    uint32_t runStart = 0;
+    put_Byte(writer, '"');
+    for (uint32_t iter = 0; iter < length; ++iter)
+    {
+        uint8_t character = (uint8_t)string[iter];
+        if (character >= 0x20 && character < 0x7F && character != '"' && character != '\\')
+        {
+            continue;//copied with the rest of the run below
+        }
+        put_Bytes(writer, &string[runStart], iter - runStart);
+        runStart = iter + 1;
+        if (character == '"' || character == '\\')
+        {
+            put_Byte(writer, '\\');
+            put_Byte(writer, character);
+        }
+        else
+        {
+            //control characters and anything that is not ASCII. Drives do not report UTF-8, so treat the byte as a Latin-1 code point
+            put_Bytes(writer, "\\u00", 4);
+            put_Byte(writer, (uint8_t)hexDigits[M_Nibble1(character)]);
+            put_Byte(writer, (uint8_t)hexDigits[M_Nibble0(character)]);
+        }
+    }
+    put_Bytes(writer, &string[runStart], length - runStart);
+    put_Byte(writer, '"');
+}
+
+static void put_JSON_Unsigned(ptrDriveInfoWriter writer, uint64_t value)
+{
+    uint8_t digits[20] = { 0 };
+    uint8_t digitCount = 0;
+    do
+    {
+        digits[sizeof(digits) - 1 - digitCount] = (uint8_t)('0' + (value % 10));
+        value /= 10;
+        ++digitCount;
+    } while (value > 0);
+    put_Bytes(writer, &digits[sizeof(digits) - digitCount], digitCount);
+}
+
+static void put_JSON_Signed(ptrDriveInfoWriter writer, int64_t value)
+{
+    if (value < 0)
+    {
+        put_Byte(writer, '-');
+        put_JSON_Unsigned(writer, (uint64_t)(-(value + 1)) + 1);
+    }
+    else
+    {
+        put_JSON_Unsigned(writer, (uint64_t)value);
+    }
+}
+
+//value is a 16 byte little endian counter from NVMe. Written exactly instead of through a double
+static void put_JSON_Unsigned_128(ptrDriveInfoWriter writer, const uint8_t value[16])
+{
+    uint8_t number[16] = { 0 };
+    uint8_t digits[40] = { 0 };
+    uint8_t digitCount = 0;
+    bool nonZero = false;
+    memcpy(number, value, 16);
+    do
+    {
+        //divide by 10, most significant byte first, keeping the remainder as the next digit
+        uint16_t remainder = 0;
+        nonZero = false;
+        for (int8_t byteIter = 15; byteIter >= 0; --byteIter)
+        {
+            uint16_t current = (uint16_t)((remainder << 8) | number[byteIter]);
+            number[byteIter] = (uint8_t)(current / 10);
+            remainder = current % 10;
+            if (number[byteIter])
+            {
+                nonZero = true;
+            }
+        }
+        digits[sizeof(digits) - 1 - digitCount] = (uint8_t)('0' + remainder);
+        ++digitCount;
+    } while (nonZero);
+    put_Bytes(writer, &digits[sizeof(digits) - digitCount], digitCount);
+}
+
+//fixed point with the requested number of decimal places. Enough for percentages and rates, which is all that is stored as a double
+static void put_JSON_Double(ptrDriveInfoWriter writer, double value, uint8_t decimalPlaces)
+{
+    uint64_t scale = 1;
+    for (uint8_t iter = 0; iter < decimalPlaces; ++iter)
+    {
+        scale *= 10;
+    }
+    //JSON has no way to write NaN or infinity, and anything too big for the scaled conversion below can't be written exactly either
+    if (!isfinite(value) || (value < 0 ? -value : value) * (double)scale + 0.5 >= (double)UINT64_MAX)
+    {
+        put_Bytes(writer, "null", 4);
+        return;
+    }
+    if (value < 0)
+    {
+        put_Byte(writer, '-');
+        value = -value;
+    }
+    uint64_t scaled = (uint64_t)(value * (double)scale + 0.5);
+    put_JSON_Unsigned(writer, scaled / scale);
+    if (decimalPlaces > 0)
+    {
+        uint64_t fraction = scaled % scale;
+        put_Byte(writer, '.');
+        for (scale /= 10; scale > 1 && fraction < scale; scale /= 10)
+        {
+            put_Byte(writer, '0');
+        }
+        put_JSON_Unsigned(writer, fraction);
+    }
+}
+
+//Starts a field. JSON writes the key, binary writes the tag and length. The caller writes the value.
+static void begin_Field(ptrDriveInfoWriter writer, eDriveInfoRecordTag tag, const char *name, uint16_t valueLength)
+{
+    if (writer->format == DRIVE_INFO_FORMAT_JSON)
+    {
+        if (!writer->firstField)
+        {
+            put_Byte(writer, ',');
+        }
+        writer->firstField = false;
+        put_JSON_String(writer, name, UINT32_MAX);
+        put_Byte(writer, ':');
+    }
+    else
+    {
+        put_Little_Endian(writer, (uint64_t)tag, 2);
+        put_Little_Endian(writer, valueLength, 2);
+    }
+}
+
+static void put_String_Field(ptrDriveInfoWriter writer, eDriveInfoRecordTag tag, const char *name, const char *value, uint32_t maxLength)
+{
+    uint32_t length = string_Length(value, maxLength);
+    begin_Field(writer, tag, name, (uint16_t)length);
+    if (writer->format == DRIVE_INFO_FORMAT_JSON)
+    {
+        put_JSON_String(writer, value, length);
+    }
+    else
+    {
+        put_Bytes(writer, value, length);
+    }
+}
+
+static void put_Unsigned_Field(ptrDriveInfoWriter writer, eDriveInfoRecordTag tag, const char *name, uint64_t value, uint8_t size)
+{
+    begin_Field(writer, tag, name, size);
+    if (writer->format == DRIVE_INFO_FORMAT_JSON)
+    {
+        put_JSON_Unsigned(writer, value);
+    }
+    else
+    {
+        put_Little_Endian(writer, value, size);
+    }
+}
+
+static void put_Signed_Field(ptrDriveInfoWriter writer, eDriveInfoRecordTag tag, const char *name, int64_t value, uint8_t size)
+{
+    begin_Field(writer, tag, name, size);
+    if (writer->format == DRIVE_INFO_FORMAT_JSON)
+    {
+        put_JSON_Signed(writer, value);
+    }
+    else
+    {
+        put_Little_Endian(writer, (uint64_t)value, size);
+    }
+}
+
+static void put_Bool_Field(ptrDriveInfoWriter writer, eDriveInfoRecordTag tag, const char *name, bool value)
+{
+    begin_Field(writer, tag, name, 1);
+    if (writer->format == DRIVE_INFO_FORMAT_JSON)
+    {
+        if (value)
+        {
+            put_Bytes(writer, "true", 4);
+        }
+        else
+        {
+            put_Bytes(writer, "false", 5);
+        }
+    }
+    else
+    {
+        put_Byte(writer, value ? 1 : 0);
+    }
+}
+
+static void put_Double_Field(ptrDriveInfoWriter writer, eDriveInfoRecordTag tag, const char *name, double value, uint8_t decimalPlaces)
+{
+    begin_Field(writer, tag, name, 8);
+    if (writer->format == DRIVE_INFO_FORMAT_JSON)
+    {
+        put_JSON_Double(writer, value, decimalPlaces);
+    }
+    else
+    {
+        uint64_t bits = 0;
+        memcpy(&bits, &value, sizeof(uint64_t));
+        put_Little_Endian(writer, bits, 8);
+    }
+}
+
+static void put_Unsigned_128_Field(ptrDriveInfoWriter writer, eDriveInfoRecordTag tag, const char *name, const uint8_t value[16])
+{
+    begin_Field(writer, tag, name, 16);
+    if (writer->format == DRIVE_INFO_FORMAT_JSON)
+    {
+        put_JSON_Unsigned_128(writer, value);
+    }
+    else
+    {
+        put_Bytes(writer, value, 16);//already little endian
+    }
+}
+
+static void put_Specifications_Field(ptrDriveInfoWriter writer, uint64_t specificationsSupported)
+{
+    begin_Field(writer, DRIVE_INFO_TAG_SPECIFICATIONS, "specifications", 8);
+    if (writer->format == DRIVE_INFO_FORMAT_JSON)
+    {
+        bool firstSpecification = true;
+        put_Byte(writer, '[');
+        for (uint32_t specIter = 0; specIter < DRIVE_SPECIFICATION_COUNT; ++specIter)
+        {
+            if (specificationsSupported & DRIVE_SPECIFICATION_BIT(specIter))
+            {
+                if (!firstSpecification)
+                {
+                    put_Byte(writer, ',');
+                }
+                firstSpecification = false;
+                put_JSON_String(writer, get_Drive_Specification_Name((eDriveSpecification)specIter), UINT32_MAX);
+            }
+        }
+        put_Byte(writer, ']');
+    }
+    else
+    {
+        put_Little_Endian(writer, specificationsSupported, 8);
+    }
+}
+
+static void put_Version_Descriptors_Field(ptrDriveInfoWriter writer, uint16_t *versionDescriptors, uint8_t numberOfVersionDescriptors)
+{
+    numberOfVersionDescriptors = M_Min(numberOfVersionDescriptors, MAX_VERSION_DESCRIPTORS);
+    begin_Field(writer, DRIVE_INFO_TAG_VERSION_DESCRIPTORS, "versionDescriptors", (uint16_t)(numberOfVersionDescriptors * 2));
+    if (writer->format == DRIVE_INFO_FORMAT_JSON)
+    {
+        put_Byte(writer, '[');
+    }
+    for (uint8_t descriptorIter = 0; descriptorIter < numberOfVersionDescriptors; ++descriptorIter)
+    {
+        if (writer->format == DRIVE_INFO_FORMAT_JSON)
+        {
+            if (descriptorIter > 0)
+            {
+                put_Byte(writer, ',');
+            }
+            put_JSON_Unsigned(writer, versionDescriptors[descriptorIter]);
+        }
+        else
+        {
+            put_Little_Endian(writer, versionDescriptors[descriptorIter], 2);
+        }
+    }
+    if (writer->format == DRIVE_INFO_FORMAT_JSON)
+    {
+        put_Byte(writer, ']');
+    }
+}
+
+//JSON gets one array of the supported features with their enabled state. Binary gets the supported and enabled bitmaps as two fields.
+static void put_Features_Field(ptrDriveInfoWriter writer, eDriveInfoRecordTag supportedTag, eDriveInfoRecordTag enabledTag, const char *name, ptrDriveFeatureSet features)
+{
+    if (writer->format == DRIVE_INFO_FORMAT_JSON)
+    {
+        bool firstFeature = true;
+        begin_Field(writer, supportedTag, name, 0);
+        put_Byte(writer, '[');
+        for (uint32_t featureIter = 0; featureIter < DRIVE_FEATURE_COUNT; ++featureIter)
+        {
+            if (is_Drive_Feature_Supported(features, (eDriveFeature)featureIter))
+            {
+                if (!firstFeature)
+                {
+                    put_Byte(writer, ',');
+                }
+                firstFeature = false;
+                put_Bytes(writer, "{\"name\":", 8);
+                put_JSON_String(writer, get_Drive_Feature_Name((eDriveFeature)featureIter), UINT32_MAX);
+                put_Bytes(writer, ",\"enabled\":", 11);
+                if (is_Drive_Feature_Enabled(features, (eDriveFeature)featureIter))
+                {
+                    put_Bytes(writer, "true}", 5);
+                }
+                else
+                {
+                    put_Bytes(writer, "false}", 6);
+                }
+            }
+        }
+        put_Byte(writer, ']');
+    }
+    else
+    {
+        begin_Field(writer, supportedTag, name, DRIVE_FEATURE_SET_QWORDS * 8);
+        for (uint8_t qwordIter = 0; qwordIter < DRIVE_FEATURE_SET_QWORDS; ++qwordIter)
+        {
+            put_Little_Endian(writer, features->supported[qwordIter], 8);
+        }
+        begin_Field(writer, enabledTag, name, DRIVE_FEATURE_SET_QWORDS * 8);
+        for (uint8_t qwordIter = 0; qwordIter < DRIVE_FEATURE_SET_QWORDS; ++qwordIter)
+        {
+            put_Little_Endian(writer, features->enabled[qwordIter], 8);
+        }
+    }
+}
+
+static void serialize_SAS_SATA_Information(ptrDriveInfoWriter writer, ptrDriveInformationSAS_Sata driveInfo)
+{
+    if (driveInfo->sections & DRIVE_INFO_SECTION_IDENTITY)
+    {
+        put_String_Field(writer, DRIVE_INFO_TAG_MODEL_NUMBER, "modelNumber", driveInfo->modelNumber, MODEL_NUM_LEN);
+        put_String_Field(writer, DRIVE_INFO_TAG_SERIAL_NUMBER, "serialNumber", driveInfo->serialNumber, SERIAL_NUM_LEN);
+        put_String_Field(writer, DRIVE_INFO_TAG_FIRMWARE_REVISION, "firmwareRevision", driveInfo->firmwareRevision, FW_REV_LEN);
+        put_String_Field(writer, DRIVE_INFO_TAG_VENDOR_ID, "vendorID", driveInfo->vendorID, T10_VENDOR_ID_LEN);
+        if (driveInfo->worldWideNameSupported)
+        {
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_WORLD_WIDE_NAME, "worldWideName", driveInfo->worldWideName, 8);
+            if (driveInfo->worldWideNameExtensionValid)
+            {
+                put_Unsigned_Field(writer, DRIVE_INFO_TAG_WORLD_WIDE_NAME_EXTENSION, "worldWideNameExtension", driveInfo->worldWideNameExtension, 8);
+            }
+        }
+        if (driveInfo->satVendorID[0])
+        {
+            put_String_Field(writer, DRIVE_INFO_TAG_SAT_VENDOR_ID, "satVendorID", driveInfo->satVendorID, T10_VENDOR_ID_LEN);
+            put_String_Field(writer, DRIVE_INFO_TAG_SAT_PRODUCT_ID, "satProductID", driveInfo->satProductID, MODEL_NUM_LEN);
+            put_String_Field(writer, DRIVE_INFO_TAG_SAT_PRODUCT_REVISION, "satProductRevision", driveInfo->satProductRevision, FW_REV_LEN);
+        }
+    }
+    if (driveInfo->sections & DRIVE_INFO_SECTION_CAPACITY)
+    {
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_MAX_LBA, "maxLBA", driveInfo->maxLBA, 8);
+        if ((driveInfo->sections & DRIVE_INFO_SECTION_NATIVE_MAX_LBA) && driveInfo->nativeMaxLBA != 0 && driveInfo->nativeMaxLBA != UINT64_MAX)
+        {
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_NATIVE_MAX_LBA, "nativeMaxLBA", driveInfo->nativeMaxLBA, 8);
+        }
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_LOGICAL_SECTOR_SIZE, "logicalSectorSize", driveInfo->logicalSectorSize, 4);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_PHYSICAL_SECTOR_SIZE, "physicalSectorSize", driveInfo->physicalSectorSize, 4);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_SECTOR_ALIGNMENT, "sectorAlignment", driveInfo->sectorAlignment, 2);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_ROTATION_RATE, "rotationRate", driveInfo->rotationRate, 2);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_FORM_FACTOR, "formFactor", driveInfo->formFactor, 1);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_ZONED_DEVICE, "zonedDevice", driveInfo->zonedDevice, 1);
+    }
+    if (driveInfo->sections & DRIVE_INFO_SECTION_SPECIFICATIONS)
+    {
+        put_Specifications_Field(writer, driveInfo->specificationsSupported);
+        if (driveInfo->numberOfVersionDescriptors > 0)
+        {
+            put_Version_Descriptors_Field(writer, driveInfo->versionDescriptors, driveInfo->numberOfVersionDescriptors);
+        }
+    }
+    if (driveInfo->sections & DRIVE_INFO_SECTION_FEATURES)
+    {
+        put_Features_Field(writer, DRIVE_INFO_TAG_FEATURES_SUPPORTED, DRIVE_INFO_TAG_FEATURES_ENABLED, "features", &driveInfo->features);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_ENCRYPTION_SUPPORT, "encryptionSupport", (uint64_t)driveInfo->encryptionSupport, 1);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_CACHE_SIZE, "cacheSize", driveInfo->cacheSize, 8);
+        if (driveInfo->hybridNANDSize > 0)
+        {
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_HYBRID_NAND_SIZE, "hybridNANDSize", driveInfo->hybridNANDSize, 8);
+        }
+        put_Bool_Field(writer, DRIVE_INFO_TAG_READ_LOOK_AHEAD_ENABLED, "readLookAheadEnabled", driveInfo->readLookAheadEnabled);
+        put_Bool_Field(writer, DRIVE_INFO_TAG_WRITE_CACHE_ENABLED, "writeCacheEnabled", driveInfo->writeCacheEnabled);
+        put_Bool_Field(writer, DRIVE_INFO_TAG_FIRMWARE_DOWNLOAD_SUPPORTED, "firmwareDownloadSupported", driveInfo->fwdlSupport.downloadSupported);
+        put_Bool_Field(writer, DRIVE_INFO_TAG_SEGMENTED_DOWNLOAD_SUPPORTED, "segmentedDownloadSupported", driveInfo->fwdlSupport.segmentedSupported);
+        put_Bool_Field(writer, DRIVE_INFO_TAG_DEFERRED_DOWNLOAD_SUPPORTED, "deferredDownloadSupported", driveInfo->fwdlSupport.deferredSupported);
+        if (driveInfo->lowCurrentSpinupValid)
+        {
+            put_Bool_Field(writer, DRIVE_INFO_TAG_LOW_CURRENT_SPINUP_ENABLED, "lowCurrentSpinupEnabled", driveInfo->lowCurrentSpinupEnabled);
+        }
+    }
+    if (driveInfo->sections & DRIVE_INFO_SECTION_HEALTH)
+    {
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_SMART_STATUS, "smartStatus", driveInfo->smartStatus, 1);
+        if (driveInfo->temperatureData.temperatureDataValid)
+        {
+            put_Signed_Field(writer, DRIVE_INFO_TAG_CURRENT_TEMPERATURE, "currentTemperature", driveInfo->temperatureData.currentTemperature, 2);
+        }
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_POWER_ON_MINUTES, "powerOnMinutes", driveInfo->powerOnMinutes, 8);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_TOTAL_LBAS_READ, "totalLBAsRead", driveInfo->totalLBAsRead, 8);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_TOTAL_LBAS_WRITTEN, "totalLBAsWritten", driveInfo->totalLBAsWritten, 8);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_TOTAL_BYTES_READ, "totalBytesRead", driveInfo->totalBytesRead, 8);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_TOTAL_BYTES_WRITTEN, "totalBytesWritten", driveInfo->totalBytesWritten, 8);
+        if (driveInfo->totalWritesToFlash > 0)
+        {
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_TOTAL_WRITES_TO_FLASH, "totalWritesToFlash", driveInfo->totalWritesToFlash, 8);
+        }
+        if (driveInfo->percentEnduranceUsed >= 0)
+        {
+            put_Double_Field(writer, DRIVE_INFO_TAG_PERCENT_ENDURANCE_USED, "percentEnduranceUsed", driveInfo->percentEnduranceUsed, 5);
+        }
+        if (driveInfo->deviceReportedUtilizationRate > 0)
+        {
+            put_Double_Field(writer, DRIVE_INFO_TAG_UTILIZATION_RATE, "deviceReportedUtilizationRate", driveInfo->deviceReportedUtilizationRate, 4);
+        }
+        if (driveInfo->dstInfo.informationValid)
+        {
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_DST_RESULT, "dstResult", driveInfo->dstInfo.resultOrStatus, 1);
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_DST_POWER_ON_HOURS, "dstPowerOnHours", driveInfo->dstInfo.powerOnHours, 8);
+        }
+    }
+}
+
+static void serialize_NVMe_Information(ptrDriveInfoWriter writer, ptrDriveInformationNVMe driveInfo)
+{
+    if (driveInfo->sections & DRIVE_INFO_SECTION_IDENTITY)
+    {
+        put_String_Field(writer, DRIVE_INFO_TAG_MODEL_NUMBER, "modelNumber", driveInfo->controllerData.modelNumber, MODEL_NUM_LEN);
+        put_String_Field(writer, DRIVE_INFO_TAG_SERIAL_NUMBER, "serialNumber", driveInfo->controllerData.serialNumber, SERIAL_NUM_LEN);
+        put_String_Field(writer, DRIVE_INFO_TAG_FIRMWARE_REVISION, "firmwareRevision", driveInfo->controllerData.firmwareRevision, FW_REV_LEN);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_PCI_VENDOR_ID, "pciVendorID", driveInfo->controllerData.pciVendorID, 2);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_PCI_SUBSYSTEM_VENDOR_ID, "pciSubsystemVendorID", driveInfo->controllerData.pciSubsystemVendorID, 2);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_IEEE_OUI, "ieeeOUI", driveInfo->controllerData.ieeeOUI, 4);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_CONTROLLER_ID, "controllerID", driveInfo->controllerData.controllerID, 2);
+        //same layout as the version register: major 31:16, minor 15:8, tertiary 7:0
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_NVME_VERSION, "nvmeVersion", M_BytesTo4ByteValue(M_Byte1(driveInfo->controllerData.majorVersion), M_Byte0(driveInfo->controllerData.majorVersion), driveInfo->controllerData.minorVersion, driveInfo->controllerData.tertiaryVersion), 4);
+        if (driveInfo->namespaceData.valid)
+        {
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_NAMESPACE_EUI64, "ieeeExtendedUniqueIdentifier", driveInfo->namespaceData.ieeeExtendedUniqueIdentifier, 8);
+        }
+    }
+    if (driveInfo->sections & DRIVE_INFO_SECTION_CAPACITY)
+    {
+        put_Unsigned_128_Field(writer, DRIVE_INFO_TAG_TOTAL_NVM_CAPACITY, "totalNVMCapacity", driveInfo->controllerData.totalNVMCapacity);
+        put_Unsigned_128_Field(writer, DRIVE_INFO_TAG_UNALLOCATED_NVM_CAPACITY, "unallocatedNVMCapacity", driveInfo->controllerData.unallocatedNVMCapacity);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_MAX_NAMESPACES, "maxNumberOfNamespaces", driveInfo->controllerData.maxNumberOfNamespaces, 4);
+        if (driveInfo->namespaceData.valid)
+        {
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_NAMESPACE_SIZE, "namespaceSize", driveInfo->namespaceData.namespaceSize, 8);
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_NAMESPACE_CAPACITY, "namespaceCapacity", driveInfo->namespaceData.namespaceCapacity, 8);
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_NAMESPACE_UTILIZATION, "namespaceUtilization", driveInfo->namespaceData.namespaceUtilization, 8);
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_FORMATTED_LBA_SIZE, "formattedLBASize", driveInfo->namespaceData.formattedLBASizeBytes, 4);
+        }
+    }
+    if (driveInfo->sections & DRIVE_INFO_SECTION_FEATURES)
+    {
+        put_Features_Field(writer, DRIVE_INFO_TAG_FEATURES_SUPPORTED, DRIVE_INFO_TAG_FEATURES_ENABLED, "features", &driveInfo->controllerData.controllerFeatures);
+        if (driveInfo->namespaceData.valid)
+        {
+            put_Features_Field(writer, DRIVE_INFO_TAG_NAMESPACE_FEATURES_SUPPORTED, DRIVE_INFO_TAG_NAMESPACE_FEATURES_ENABLED, "namespaceFeatures", &driveInfo->namespaceData.namespaceFeatures);
+        }
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_ENCRYPTION_SUPPORT, "encryptionSupport", (uint64_t)driveInfo->controllerData.encryptionSupport, 1);
+        put_Bool_Field(writer, DRIVE_INFO_TAG_WRITE_CACHE_SUPPORTED, "writeCacheSupported", driveInfo->controllerData.volatileWriteCacheSupported);
+        put_Bool_Field(writer, DRIVE_INFO_TAG_WRITE_CACHE_ENABLED, "writeCacheEnabled", driveInfo->controllerData.volatileWriteCacheEnabled);
+        put_Unsigned_Field(writer, DRIVE_INFO_TAG_FIRMWARE_SLOTS, "numberOfFirmwareSlots", driveInfo->controllerData.numberOfFirmwareSlots, 1);
+    }
+    if (driveInfo->sections & DRIVE_INFO_SECTION_HEALTH)
+    {
+        if (driveInfo->smartData.valid)
+        {
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_SMART_STATUS, "smartStatus", driveInfo->smartData.smartStatus, 1);
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_COMPOSITE_TEMPERATURE_KELVIN, "compositeTemperatureKelvin", driveInfo->smartData.compositeTemperatureKelvin, 2);
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_PERCENTAGE_USED, "percentageUsed", driveInfo->smartData.percentageUsed, 1);
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_AVAILABLE_SPARE, "availableSpacePercent", driveInfo->smartData.availableSpacePercent, 1);
+            put_Unsigned_128_Field(writer, DRIVE_INFO_TAG_DATA_UNITS_READ, "dataUnitsRead", driveInfo->smartData.dataUnitsRead);
+            put_Unsigned_128_Field(writer, DRIVE_INFO_TAG_DATA_UNITS_WRITTEN, "dataUnitsWritten", driveInfo->smartData.dataUnitsWritten);
+            put_Unsigned_128_Field(writer, DRIVE_INFO_TAG_POWER_ON_HOURS, "powerOnHours", driveInfo->smartData.powerOnHours);
+        }
+        if (driveInfo->dstInfo.informationValid)
+        {
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_DST_RESULT, "dstResult", driveInfo->dstInfo.resultOrStatus, 1);
+            put_Unsigned_Field(writer, DRIVE_INFO_TAG_DST_POWER_ON_HOURS, "dstPowerOnHours", driveInfo->dstInfo.powerOnHours, 8);
+        }
+    }
+}
+
+int serialize_Drive_Information(ptrDriveInformation driveInfo, eDriveInfoFormat format, uint8_t *buffer, uint32_t bufferSize, uint32_t *length)
+{
+    uint32_t sections = 0;
+    if (!driveInfo || !length || (!buffer && bufferSize > 0) || (format != DRIVE_INFO_FORMAT_JSON && format != DRIVE_INFO_FORMAT_BINARY))
+    {
+        return BAD_PARAMETER;
+    }
+    driveInfoWriter writer;
+    memset(&writer, 0, sizeof(driveInfoWriter));
+    writer.format = format;
+    writer.buffer = buffer;
+    writer.bufferSize = bufferSize;
+    writer.firstField = true;
+    sections = driveInfo->infoType == DRIVE_INFO_NVME ? driveInfo->nvme.sections : driveInfo->sasSata.sections;
+    if (format == DRIVE_INFO_FORMAT_JSON)
+    {
+        put_Byte(&writer, '{');
+        begin_Field(&writer, (eDriveInfoRecordTag)0, "infoType", 0);
+        put_JSON_String(&writer, driveInfo->infoType == DRIVE_INFO_NVME ? "NVMe" : "SAS/SATA", UINT32_MAX);
+        begin_Field(&writer, (eDriveInfoRecordTag)0, "sections", 0);
+        put_JSON_Unsigned(&writer, sections);
+    }
+    else
+    {
+        put_Bytes(&writer, DRIVE_INFO_RECORD_SIGNATURE, 4);
+        put_Little_Endian(&writer, DRIVE_INFO_RECORD_VERSION, 2);
+        put_Little_Endian(&writer, (uint64_t)driveInfo->infoType, 2);
+        put_Little_Endian(&writer, 0, 4);//record length is filled in at the end
+        put_Little_Endian(&writer, sections, 4);
+    }
+    if (driveInfo->infoType == DRIVE_INFO_NVME)
+    {
+        serialize_NVMe_Information(&writer, &driveInfo->nvme);
+    }
+    else
+    {
+        serialize_SAS_SATA_Information(&writer, &driveInfo->sasSata);
+    }
+    if (format == DRIVE_INFO_FORMAT_JSON)
+    {
+        put_Byte(&writer, '}');
+    }
+    *length = writer.offset;
+    if (writer.offset > bufferSize)
+    {
+        return MEMORY_FAILURE;
+    }
+    if (format == DRIVE_INFO_FORMAT_BINARY)
+    {
+        uint32_t recordLength = writer.offset;
+        writer.offset = 8;//recordLength in driveInfoRecordHeader
+        put_Little_Endian(&writer, recordLength, 4);
+    }
+    return SUCCESS;
+}
@@ -0,0 +1,126 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file drive_inventory.c
+// \brief This file defines the functions for gathering drive information from many devices at once
+
+#include "operations_Common.h"
+#include "drive_inventory.h"
+#include "drive_info.h"
+#include "worker_pool.h"
+
+typedef struct _driveInventoryPool
+{
+    tDevice *deviceList;
+    uint32_t sections;
+    driveInventoryCallback callback;
+    void *callbackData;
+    workerLock callbackLock;//only one worker reports a result at a time
+}driveInventoryPool, *ptrDriveInventoryPool;
+
+//Each worker keeps taking the next device that has not been started until the list is used up.
+//The drive information buffer is only allocated once per worker.
+static void inventory_Worker(ptrWorkerPool workers, void *poolData)
+{
+    ptrDriveInventoryPool pool = (ptrDriveInventoryPool)poolData;
+    ptrDriveInformation driveInfo = (ptrDriveInformation)calloc(1, sizeof(driveInformation));
+    uint32_t deviceIndex = 0;
+    while (get_Next_Worker_Pool_Item(workers, &deviceIndex))
+    {
+        driveInventoryResult result;
+        memset(&result, 0, sizeof(driveInventoryResult));
+        result.deviceIndex = deviceIndex;
+        if (driveInfo)
+        {
+            seatimer_t deviceTimer;
+            memset(&deviceTimer, 0, sizeof(seatimer_t));
+            start_Timer(&deviceTimer);
+            result.status = get_Drive_Information(&pool->deviceList[deviceIndex], pool->sections, driveInfo);
+            stop_Timer(&deviceTimer);
+            result.timeNS = get_Nano_Seconds(deviceTimer);
+            result.driveInfo = driveInfo;
+        }
+        else
+        {
+            result.status = MEMORY_FAILURE;
+        }
+        acquire_Worker_Lock(&pool->callbackLock);
+        pool->callback(&pool->deviceList[deviceIndex], &result, pool->callbackData);
+        release_Worker_Lock(&pool->callbackLock);
+    }
+    safe_Free(driveInfo);
+}
+
+int get_Drive_Inventory(tDevice *deviceList, uint32_t numberOfDevices, uint32_t sections, uint32_t maxWorkers, driveInventoryCallback callback, void *callbackData)
+{
+    int ret = SUCCESS;
+    if (!deviceList || !callback)
+    {
+        return BAD_PARAMETER;
+    }
+    if (numberOfDevices == 0)
+    {
+        return SUCCESS;
+    }
+    if (maxWorkers == 0)
+    {
+        maxWorkers = DRIVE_INVENTORY_DEFAULT_WORKERS;
+    }
+    maxWorkers = M_Min(maxWorkers, DRIVE_INVENTORY_MAX_WORKERS);
+    maxWorkers = M_Min(maxWorkers, numberOfDevices);
+    driveInventoryPool pool;
+    memset(&pool, 0, sizeof(driveInventoryPool));
+    pool.deviceList = deviceList;
+    pool.sections = sections;
+    pool.callback = callback;
+    pool.callbackData = callbackData;
+    init_Worker_Lock(&pool.callbackLock);
+    //if no threads can be started the devices are read on this thread instead, so the inventory still happens
+    run_Worker_Pool(0, numberOfDevices, maxWorkers, inventory_Worker, &pool);
+    destroy_Worker_Lock(&pool.callbackLock);
+    return ret;
+}
+
+static void print_Drive_Inventory_Result(tDevice *device, ptrDriveInventoryResult result, void *callbackData)
+{
+    char *model = NULL, *serial = NULL, *firmware = NULL;
+    double capacity = 0;
+    if (result->status != SUCCESS || !result->driveInfo)
+    {
+        printf("%-4" PRIu32 " Unable to read drive information (%d)\n", result->deviceIndex, result->status);
+        return;
+    }
+    if (result->driveInfo->infoType == DRIVE_INFO_NVME)
+    {
+        model = result->driveInfo->nvme.controllerData.modelNumber;
+        serial = result->driveInfo->nvme.controllerData.serialNumber;
+        firmware = result->driveInfo->nvme.controllerData.firmwareRevision;
+        capacity = (double)(result->driveInfo->nvme.namespaceData.namespaceSize * result->driveInfo->nvme.namespaceData.formattedLBASizeBytes);
+    }
+    else
+    {
+        model = result->driveInfo->sasSata.modelNumber;
+        serial = result->driveInfo->sasSata.serialNumber;
+        firmware = result->driveInfo->sasSata.firmwareRevision;
+        capacity = (double)((result->driveInfo->sasSata.maxLBA + 1) * result->driveInfo->sasSata.logicalSectorSize);
+    }
+    char capUnits[4] = { 0 };
+    char *capUnit = &capUnits[0];
+    metric_Unit_Convert(&capacity, &capUnit);
+    printf("%-4" PRIu32 " %-40s %-20s %-8s %8.02f %-3s %8.03f\n", result->deviceIndex, model, serial, firmware, capacity, capUnit, (double)result->timeNS / 1000000000.0);
+    fflush(stdout);
+}
+
+int print_Drive_Inventory(tDevice *deviceList, uint32_t numberOfDevices, uint32_t maxWorkers)
+{
+    printf("%-4s %-40s %-20s %-8s %12s %8s\n", "#", "Model Number", "Serial Number", "Firmware", "Capacity", "Time (s)");
+    return get_Drive_Inventory(deviceList, numberOfDevices, DRIVE_INFO_SECTION_IDENTITY | DRIVE_INFO_SECTION_CAPACITY, maxWorkers, print_Drive_Inventory_Result, NULL);
+}
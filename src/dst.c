@@ -18,6 +18,7 @@
 #include "smart.h"
 #include "logs.h"
 #include "cmds.h"
+#include "device_page_cache.h"
 #include <stdlib.h>
 
 int ata_Abort_DST(tDevice *device)
@@ -1165,7 +1166,7 @@ int get_Long_DST_Time(tDevice *device, uint8_t *hours, uint8_t *minutes)
                 perror("calloc failure!\n");
                 return MEMORY_FAILURE;
             }
-            if (SUCCESS == scsi_Inquiry(device, extendedInqyData, VPD_EXTENDED_INQUIRY_LEN, EXTENDED_INQUIRY_DATA, true, false))
+            if (SUCCESS == scsi_Inquiry_Cached(device, extendedInqyData, VPD_EXTENDED_INQUIRY_LEN, EXTENDED_INQUIRY_DATA, true))
             {
                 //time is reported in MINUTES here
                 longDSTTime = ((uint16_t)extendedInqyData[10] << 8) | extendedInqyData[11];
@@ -0,0 +1,295 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file file_mapping.c
+// \brief This file defines the functions for mapping a file into memory and locking it against other processes
+
+#include "operations_Common.h"
+#include "file_mapping.h"
+#if defined (_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+//a read-only file that can't be mapped is read into a buffer padded to this, so it can be used the same as the end of a mapping's last page
+#define FILE_MAPPING_READ_PADDING 4096
+
+//used when a read-only file can't be mapped. The file is left open so it can still be locked.
+static int read_Mapped_File(ptrMappedFile mapping)
+{
+    uint64_t offset = 0;
+    if (mapping->length > SIZE_MAX - FILE_MAPPING_READ_PADDING)
+    {
+        return FAILURE;
+    }
+    mapping->data = (uint8_t*)calloc((size_t)(((mapping->length + FILE_MAPPING_READ_PADDING - 1) / FILE_MAPPING_READ_PADDING) * FILE_MAPPING_READ_PADDING), sizeof(uint8_t));
+    if (!mapping->data)
+    {
+        return MEMORY_FAILURE;
+    }
+    while (offset < mapping->length)
+    {
+        uint32_t readLength = (uint32_t)M_Min(mapping->length - offset, UINT32_C(0x40000000));
+#if defined (_WIN32)
+        DWORD bytesRead = 0;
+        if (!ReadFile((HANDLE)mapping->fileHandle, mapping->data + offset, readLength, &bytesRead, NULL) || bytesRead == 0)
+        {
+            safe_Free(mapping->data);
+            return FAILURE;
+        }
+#else
+        ssize_t bytesRead = read(mapping->fileDescriptor, mapping->data + offset, readLength);
+        if (bytesRead < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (bytesRead <= 0)
+        {
+            safe_Free(mapping->data);
+            return FAILURE;
+        }
+#endif
+        offset += (uint64_t)bytesRead;
+    }
+    mapping->memoryMapped = false;
+    return SUCCESS;
+}
+
+static void close_Mapped_File_Handle(ptrMappedFile mapping)
+{
+#if defined (_WIN32)
+    if (mapping->fileHandle && mapping->fileHandle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle((HANDLE)mapping->fileHandle);
+    }
+    mapping->fileHandle = NULL;
+#else
+    if (mapping->fileDescriptor >= 0)
+    {
+        close(mapping->fileDescriptor);
+    }
+    mapping->fileDescriptor = -1;
+#endif
+}
+
+int map_File(const char * const filePath, eFileMappingMode mode, uint64_t length, ptrMappedFile mapping)
+{
+    uint64_t fileSize = 0;
+    int ret = SUCCESS;
+    if (!filePath || !mapping || (mode == FILE_MAPPING_CREATE && length == 0))
+    {
+        return BAD_PARAMETER;
+    }
+    memset(mapping, 0, sizeof(mappedFile));
+    mapping->writable = mode != FILE_MAPPING_READ_ONLY;
+#if defined (_WIN32)
+    LARGE_INTEGER size;
+    HANDLE fileHandle = CreateFileA(filePath, mapping->writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ, mapping->writable ? (FILE_SHARE_READ | FILE_SHARE_WRITE) : FILE_SHARE_READ, NULL, mode == FILE_MAPPING_CREATE ? CREATE_ALWAYS : (mode == FILE_MAPPING_OPEN_OR_CREATE ? OPEN_ALWAYS : OPEN_EXISTING), FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        return FILE_OPEN_ERROR;
+    }
+    mapping->fileHandle = fileHandle;
+    if (!GetFileSizeEx(fileHandle, &size) || size.QuadPart < 0)
+    {
+        close_Mapped_File_Handle(mapping);
+        return FAILURE;
+    }
+    fileSize = (uint64_t)size.QuadPart;
+#else
+    struct stat fileStat;
+    int fileDescriptor = open(filePath, mode == FILE_MAPPING_CREATE ? (O_RDWR | O_CREAT | O_TRUNC) : (mode == FILE_MAPPING_OPEN_OR_CREATE ? (O_RDWR | O_CREAT) : (mapping->writable ? O_RDWR : O_RDONLY)), 0644);
+    if (fileDescriptor < 0)
+    {
+        mapping->fileDescriptor = -1;
+        return FILE_OPEN_ERROR;
+    }
+    mapping->fileDescriptor = fileDescriptor;
+    if (0 != fstat(fileDescriptor, &fileStat) || fileStat.st_size < 0)
+    {
+        close_Mapped_File_Handle(mapping);
+        return FAILURE;
+    }
+    fileSize = (uint64_t)fileStat.st_size;
+#endif
+    if (length == 0)
+    {
+        length = fileSize;
+    }
+    //a read-only mapping can't reach past the end of the file, and the whole mapping has to fit in the address space
+    if (length == 0 || (!mapping->writable && length > fileSize) || length > SIZE_MAX)
+    {
+        close_Mapped_File_Handle(mapping);
+        return FAILURE;
+    }
+    mapping->length = length;
+    if (mapping->writable && fileSize < length)
+    {
+        //the added bytes read back as zeros
+#if defined (_WIN32)
+        LARGE_INTEGER newSize;
+        newSize.QuadPart = (LONGLONG)length;
+        if (!SetFilePointerEx(fileHandle, newSize, NULL, FILE_BEGIN) || !SetEndOfFile(fileHandle))
+#else
+        if ((uint64_t)(off_t)length != length || 0 != ftruncate(fileDescriptor, (off_t)length))
+#endif
+        {
+            close_Mapped_File_Handle(mapping);
+            return FAILURE;
+        }
+    }
+#if defined (_WIN32)
+    HANDLE mappingHandle = CreateFileMappingA(fileHandle, NULL, mapping->writable ? PAGE_READWRITE : PAGE_READONLY, (DWORD)(length >> 32), (DWORD)length, NULL);
+    if (mappingHandle)
+    {
+        mapping->data = (uint8_t*)MapViewOfFile(mappingHandle, mapping->writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, (SIZE_T)length);
+        if (mapping->data)
+        {
+            mapping->mappingHandle = mappingHandle;
+            mapping->memoryMapped = true;
+            return SUCCESS;
+        }
+        CloseHandle(mappingHandle);
+    }
+#else
+    void *data = mmap(NULL, (size_t)length, mapping->writable ? (PROT_READ | PROT_WRITE) : PROT_READ, mapping->writable ? MAP_SHARED : MAP_PRIVATE, fileDescriptor, 0);
+    if (data != MAP_FAILED)
+    {
+        mapping->data = (uint8_t*)data;
+        mapping->memoryMapped = true;
+        return SUCCESS;
+    }
+#endif
+    if (mapping->writable)
+    {
+        ret = FAILURE;
+    }
+    else
+    {
+        ret = read_Mapped_File(mapping);
+    }
+    if (ret != SUCCESS)
+    {
+        close_Mapped_File_Handle(mapping);
+        mapping->length = 0;
+    }
+    return ret;
+}
+
+int flush_Mapped_File(ptrMappedFile mapping, uint64_t offset, uint64_t length)
+{
+    if (!mapping || !mapping->data || offset >= mapping->length)
+    {
+        return BAD_PARAMETER;
+    }
+    if (!mapping->writable || !mapping->memoryMapped)
+    {
+        return SUCCESS;
+    }
+    if (length == 0 || length > mapping->length - offset)
+    {
+        length = mapping->length - offset;
+    }
+#if defined (_WIN32)
+    if (!FlushViewOfFile(mapping->data + offset, (SIZE_T)length))
+    {
+        return FAILURE;
+    }
+#else
+    //msync needs a page aligned start
+    long pageSize = sysconf(_SC_PAGESIZE);
+    if (pageSize > 0)
+    {
+        uint64_t alignment = offset % (uint64_t)pageSize;
+        offset -= alignment;
+        length += alignment;
+    }
+    if (0 != msync(mapping->data + offset, (size_t)length, MS_ASYNC))
+    {
+        return FAILURE;
+    }
+#endif
+    return SUCCESS;
+}
+
+int lock_Mapped_File(ptrMappedFile mapping, bool exclusive)
+{
+    if (!mapping || !mapping->data)
+    {
+        return BAD_PARAMETER;
+    }
+#if defined (_WIN32)
+    OVERLAPPED overlapped;
+    memset(&overlapped, 0, sizeof(OVERLAPPED));
+    if (!LockFileEx((HANDLE)mapping->fileHandle, exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0, 0, MAXDWORD, MAXDWORD, &overlapped))
+    {
+        return FAILURE;
+    }
+#else
+    //flock locks belong to the open file, so separate map_File calls in one process lock each other out too (fcntl locks would not)
+    while (0 != flock(mapping->fileDescriptor, exclusive ? LOCK_EX : LOCK_SH))
+    {
+        if (errno != EINTR)
+        {
+            return FAILURE;
+        }
+    }
+#endif
+    return SUCCESS;
+}
+
+void unlock_Mapped_File(ptrMappedFile mapping)
+{
+    if (!mapping || !mapping->data)
+    {
+        return;
+    }
+#if defined (_WIN32)
+    OVERLAPPED overlapped;
+    memset(&overlapped, 0, sizeof(OVERLAPPED));
+    UnlockFileEx((HANDLE)mapping->fileHandle, 0, MAXDWORD, MAXDWORD, &overlapped);
+#else
+    flock(mapping->fileDescriptor, LOCK_UN);
+#endif
+}
+
+void unmap_File(ptrMappedFile mapping)
+{
+    if (!mapping || !mapping->data)
+    {
+        return;
+    }
+    if (mapping->memoryMapped)
+    {
+#if defined (_WIN32)
+        UnmapViewOfFile(mapping->data);
+        CloseHandle((HANDLE)mapping->mappingHandle);
+#else
+        munmap(mapping->data, (size_t)mapping->length);
+#endif
+    }
+    else
+    {
+        safe_Free(mapping->data);
+    }
+    //closing the file releases any lock still held
+    close_Mapped_File_Handle(mapping);
+    memset(mapping, 0, sizeof(mappedFile));
+#if !defined (_WIN32)
+    mapping->fileDescriptor = -1;
+#endif
+}
@@ -15,8 +15,79 @@
 #include "operations_Common.h"
 #include "firmware_download.h"
 #include "logs.h"
+#include "device_page_cache.h"
 #include "common_platform.h"
 
+//Largest segment tried when the caller doesn't set a segment size. It is lowered to what the device reports it can take, and any size
+//the OS or an adapter turns down (see is_Transfer_Size_Failure) is stepped down from on the first segment.
+#define FWDL_AUTOMATIC_MAX_SEGMENT_BYTES (2048 * LEGACY_DRIVE_SEC_SIZE)
+//Most times the first segment is resent smaller before giving up. Each retry halves it, so this stops at 1/16th of the starting size
+#define FWDL_AUTOMATIC_MAX_SEGMENT_RETRIES 4
+
+//Picks the largest segment size (in bytes) the device reports it can take that is a multiple of the alignment the device needs.
+static uint32_t get_Automatic_Segment_Size(tDevice *device, uint32_t firmwareMemoryLength, uint32_t *segmentAlignment)
+{
+    supportedDLModes supportedModes;
+    uint32_t maximumSize = FWDL_AUTOMATIC_MAX_SEGMENT_BYTES;
+    uint32_t alignment = LEGACY_DRIVE_SEC_SIZE;
+    uint32_t segmentSize = 0;
+    memset(&supportedModes, 0, sizeof(supportedDLModes));
+    if (SUCCESS == get_Supported_FWDL_Modes(device, &supportedModes))
+    {
+        alignment = M_Max(alignment, supportedModes.driveOffsetBoundaryInBytes);//NVMe firmware update granularity
+        //SCSI min/max come from the CDB usage data for the parameter list length, so they aren't used here. Block limits is used below instead.
+        if (device->drive_info.drive_type != SCSI_DRIVE)
+        {
+            alignment = M_Max(alignment, (uint32_t)supportedModes.minSegmentSize * LEGACY_DRIVE_SEC_SIZE);
+            if (supportedModes.maxSegmentSize > 0 && supportedModes.maxSegmentSize < (maximumSize / LEGACY_DRIVE_SEC_SIZE))
+            {
+                maximumSize = supportedModes.maxSegmentSize * LEGACY_DRIVE_SEC_SIZE;
+            }
+        }
+    }
+    if (device->drive_info.drive_type == SCSI_DRIVE)
+    {
+        uint8_t blockLimits[VPD_BLOCK_LIMITS_LEN] = { 0 };
+        if (SUCCESS == scsi_Inquiry_Cached(device, blockLimits, VPD_BLOCK_LIMITS_LEN, BLOCK_LIMITS, true))
+        {
+            uint64_t maximumTransferLength = (uint64_t)M_BytesTo4ByteValue(blockLimits[8], blockLimits[9], blockLimits[10], blockLimits[11]) * device->drive_info.deviceBlockSize;
+            if (maximumTransferLength > 0 && maximumTransferLength < maximumSize)
+            {
+                maximumSize = (uint32_t)maximumTransferLength;
+            }
+        }
+    }
+#if !defined(DISABLE_NVME_PASSTHROUGH)
+    else if (device->drive_info.drive_type == NVME_DRIVE && device->drive_info.IdentifyData.nvme.ctrl.mdts > 0 && device->drive_info.IdentifyData.nvme.ctrl.mdts < 20)
+    {
+        //MDTS is a power of 2 in units of the minimum memory page size. 4KiB is assumed since that is the smallest allowed.
+        maximumSize = M_Min(maximumSize, UINT32_C(4096) << device->drive_info.IdentifyData.nvme.ctrl.mdts);
+    }
+#endif
+#if defined (_WIN32) && defined(WINVER)
+#if WINVER >= SEA_WIN32_WINNT_WIN10
+    if (device->os_info.fwdlIOsupport.fwdlIOSupported && device->os_info.fwdlIOsupport.maxXferSize > 0)
+    {
+        //stay within what the Windows API can take so it doesn't get turned off for this download
+        maximumSize = M_Min(maximumSize, device->os_info.fwdlIOsupport.maxXferSize);
+    }
+#endif
+#endif
+    //segments are sent in 512B units
+    alignment = ((alignment + LEGACY_DRIVE_SEC_SIZE - 1) / LEGACY_DRIVE_SEC_SIZE) * LEGACY_DRIVE_SEC_SIZE;
+    //start from what has worked before if a segment this big has already been turned down
+    segmentSize = get_Device_Transfer_Size(device, TRANSFER_SIZE_FIRMWARE_DOWNLOAD, maximumSize);
+    //keep at least one full segment so a failure on the first one can be told apart from the last segment failing
+    segmentSize = M_Min(segmentSize, firmwareMemoryLength);
+    segmentSize -= segmentSize % alignment;
+    if (segmentSize == 0)
+    {
+        segmentSize = alignment;
+    }
+    *segmentAlignment = alignment;
+    return segmentSize;
+}
+
 //int firmware_Download(tDevice *device, bool useDMA, eDownloadMode dlMode, uint16_t segmentSize, uint8_t *firmwareFileMem, uint32_t firmwareMemoryLength)
 int firmware_Download(tDevice *device, firmwareUpdateData * options)
 {
@@ -28,6 +99,7 @@ int firmware_Download(tDevice *device, firmwareUpdateData * options)
     {
 		ret = firmware_Download_Command(device, DL_FW_ACTIVATE, options->useDMA, 0, 0, options->firmwareFileMem, options->firmwareSlot);
 		options->activateFWTime = options->avgSegmentDlTime = device->drive_info.lastCommandTimeNanoSeconds;
+        invalidate_Device_Page_Cache(device);//new firmware may report different identify/inquiry data
 		return ret; 
     }
 	if (options->firmwareMemoryLength == 0)
@@ -47,15 +119,19 @@ int firmware_Download(tDevice *device, firmwareUpdateData * options)
     else
     {
         //multiple commands needed to do the download (segmented)
-		if (options->segmentSize == 0)
+        bool automaticSegmentSize = options->segmentSize == 0;
+        uint32_t segmentAlignment = LEGACY_DRIVE_SEC_SIZE;
+		uint32_t downloadSize = options->segmentSize * LEGACY_DRIVE_SEC_SIZE;
+        if (automaticSegmentSize)
         {
-			options->segmentSize = 64;
+            downloadSize = get_Automatic_Segment_Size(device, options->firmwareMemoryLength, &segmentAlignment);
         }
-		uint32_t downloadSize = options->segmentSize * LEGACY_DRIVE_SEC_SIZE;
 		uint32_t downloadBlocks = options->firmwareMemoryLength / downloadSize;
 		uint32_t downloadRemainder = options->firmwareMemoryLength % downloadSize;
         uint32_t downloadOffset = 0;
         uint32_t currentDownloadBlock = 0;
+        options->lastSegmentErrorPassed = false;
+        options->ataDownloadStatus = ATA_DL_MICROCODE_STATUS_NOT_INDICATED;
 
 #if defined (_WIN32) && defined(WINVER)
 #if WINVER >= SEA_WIN32_WINNT_WIN10
@@ -80,34 +156,70 @@ int firmware_Download(tDevice *device, firmwareUpdateData * options)
 #endif
 
         //start the download
-        for (currentDownloadBlock = 0; currentDownloadBlock < downloadBlocks; currentDownloadBlock++, downloadOffset += downloadSize)
+        bool retrySmallerSegments = false;
+        uint8_t segmentRetries = 0;
+        do
         {
+            retrySmallerSegments = false;
+            for (currentDownloadBlock = 0; currentDownloadBlock < downloadBlocks; currentDownloadBlock++, downloadOffset += downloadSize)
+            {
 #if defined (_WIN32) && defined(WINVER)
 #if WINVER >= SEA_WIN32_WINNT_WIN10
-            if (currentDownloadBlock + 1 == downloadBlocks && downloadRemainder == 0)
-            {
-                device->os_info.fwdlIOsupport.isLastSegmentOfDownload = true;
-            }
+                if (currentDownloadBlock + 1 == downloadBlocks && downloadRemainder == 0)
+                {
+                    device->os_info.fwdlIOsupport.isLastSegmentOfDownload = true;
+                }
 #endif
 #endif
-			ret = firmware_Download_Command(device, options->dlMode, options->useDMA, downloadOffset, downloadSize, &options->firmwareFileMem[downloadOffset], options->bufferID);
-			options->avgSegmentDlTime += device->drive_info.lastCommandTimeNanoSeconds;
+				ret = firmware_Download_Command(device, options->dlMode, options->useDMA, downloadOffset, downloadSize, &options->firmwareFileMem[downloadOffset], options->bufferID);
+				options->avgSegmentDlTime += device->drive_info.lastCommandTimeNanoSeconds;
+                if (device->drive_info.drive_type == ATA_DRIVE)
+                {
+                    options->ataDownloadStatus = device->drive_info.lastCommandRTFRs.secCnt;
+                }
 
 #if defined(DISABLE_NVME_PASSTHROUGH)//Remove it later if someone wants to. -X
-            if (currentDownloadBlock % 20 == 0)
+                if (currentDownloadBlock % 20 == 0)
 #endif
-            {
-                if (g_verbosity > VERBOSITY_QUIET)
                 {
-                    printf(".");
-                    fflush(stdout);
+                    if (g_verbosity > VERBOSITY_QUIET)
+                    {
+                        printf(".");
+                        fflush(stdout);
+                    }
+                }
+                if (ret != SUCCESS)
+                {
+                    //a drive that turns down the image itself (wrong model, bad signature) aborts the command, which is not retried. Only a failure that
+                    //looks like the transfer length was the problem is, and only a few times so a bad image isn't sent over and over
+                    if (automaticSegmentSize && currentDownloadBlock == 0 && segmentRetries < FWDL_AUTOMATIC_MAX_SEGMENT_RETRIES && is_Transfer_Size_Failure(device, ret))
+                    {
+                        //nothing has been taken yet, so the segment may just be bigger than the device, OS, or adapter can handle. Start over with smaller segments
+                        uint32_t smallerSize = reduce_Device_Transfer_Size(device, TRANSFER_SIZE_FIRMWARE_DOWNLOAD, downloadSize);
+                        smallerSize -= smallerSize % segmentAlignment;
+                        if (smallerSize > 0)
+                        {
+                            downloadSize = smallerSize;
+                            downloadBlocks = options->firmwareMemoryLength / downloadSize;
+                            downloadRemainder = options->firmwareMemoryLength % downloadSize;
+                            options->avgSegmentDlTime = 0;
+#if defined (_WIN32) && defined(WINVER)
+#if WINVER >= SEA_WIN32_WINNT_WIN10
+                            device->os_info.fwdlIOsupport.isLastSegmentOfDownload = false;
+#endif
+#endif
+                            retrySmallerSegments = true;
+                            ++segmentRetries;
+                        }
+                    }
+                    break;
+                }
+                if (automaticSegmentSize && currentDownloadBlock == 0)
+                {
+                    confirm_Device_Transfer_Size(device, TRANSFER_SIZE_FIRMWARE_DOWNLOAD, downloadSize);
                 }
             }
-            if (ret != SUCCESS)
-            {
-                break;
-            }
-        }
+        } while (retrySmallerSegments);
 
 		if (!downloadRemainder)
 		{
@@ -117,10 +229,12 @@ int firmware_Download(tDevice *device, firmwareUpdateData * options)
         //check to make sure we haven't had a failure yet
         if (ret != SUCCESS)
         {
-            if (downloadRemainder == 0 && currentDownloadBlock + 1 == downloadBlocks)
+            //a failure on the first segment is a real failure, even when it is also the last one (image fits in one segment)
+            if (downloadRemainder == 0 && currentDownloadBlock > 0 && currentDownloadBlock + 1 == downloadBlocks)
             {
                 //this means that we had an error on the last sector, which is a drive bug, so pass it anyways
                 ret = SUCCESS;
+                options->lastSegmentErrorPassed = true;
             }
         }
 
@@ -171,15 +285,20 @@ int firmware_Download(tDevice *device, firmwareUpdateData * options)
             //not windows 10 API, so just issue the command
 			ret = firmware_Download_Command(device, options->dlMode, options->useDMA, downloadOffset, downloadRemainder, &options->firmwareFileMem[downloadOffset], options->bufferID);
 #endif
+            if (device->drive_info.drive_type == ATA_DRIVE)
+            {
+                options->ataDownloadStatus = device->drive_info.lastCommandRTFRs.secCnt;
+            }
             if (g_verbosity > VERBOSITY_QUIET)
             {
                 printf(".");
                 fflush(stdout);
             }
-            if (ret != SUCCESS)
+            if (ret != SUCCESS && downloadBlocks > 0)
             {
                 //likely a drive bug since it made it to the last transfer of the download, so pass it anyways
                 ret = SUCCESS;
+                options->lastSegmentErrorPassed = true;
             }
 			options->activateFWTime = device->drive_info.lastCommandTimeNanoSeconds;
 			options->avgSegmentDlTime += device->drive_info.lastCommandTimeNanoSeconds;
@@ -196,6 +315,10 @@ int firmware_Download(tDevice *device, firmwareUpdateData * options)
 #endif
 #endif
     }
+    if (options->dlMode != DL_FW_DEFERRED)
+    {
+        invalidate_Device_Page_Cache(device);//new firmware may report different identify/inquiry data. Deferred code isn't running until it is activated
+    }
 
 #ifdef _DEBUG
     printf("<-- %s (%d)\n",__FUNCTION__, ret);
@@ -484,7 +607,7 @@ int get_Supported_FWDL_Modes(tDevice *device, ptrSupportedDLModes supportedModes
                 }
                 //read the ext inquiry data for supported deferred activation events
                 uint8_t extInquiryData[VPD_EXTENDED_INQUIRY_LEN] = { 0 };
-                if (SUCCESS == scsi_Inquiry(device, extInquiryData, VPD_EXTENDED_INQUIRY_LEN, EXTENDED_INQUIRY_DATA, true, false))
+                if (SUCCESS == scsi_Inquiry_Cached(device, extInquiryData, VPD_EXTENDED_INQUIRY_LEN, EXTENDED_INQUIRY_DATA, true))
                 {
                     if (extInquiryData[12] & BIT7)
                     {
@@ -650,7 +773,7 @@ int get_Supported_FWDL_Modes(tDevice *device, ptrSupportedDLModes supportedModes
                 if (c3VPD)
                 {
                     //If the drive is a Seagate SCSI drive, then try reading the C3 mode page which is Seagate specific for the supported features
-                    if (SUCCESS == scsi_Inquiry(device, c3VPD, 255, 0xC3, true, false))
+                    if (SUCCESS == scsi_Inquiry_Cached(device, c3VPD, 255, 0xC3, true))
                     {
                         supportedModes->downloadMicrocodeSupported = true;
                         supportedModes->scsiInfoPossiblyIncomplete = false;//turning this off because if we read this page we SHOULD know it's capabilities
@@ -909,4 +1032,37 @@ void show_Supported_FWDL_Modes(tDevice *device, ptrSupportedDLModes supportedMod
         printf("\n");
     }
     return;
-}
\ No newline at end of file
+}
+
+int open_Firmware_Image(const char * const filePath, ptrFirmwareImage image)
+{
+    int ret = SUCCESS;
+    if (!filePath || !image)
+    {
+        return BAD_PARAMETER;
+    }
+    memset(image, 0, sizeof(firmwareImage));
+    //the last ATA segment is rounded up to a whole sector. That is still inside the mapping's last page (or the padding when it is read into memory instead)
+    ret = map_File(filePath, FILE_MAPPING_READ_ONLY, 0, &image->file);
+    if (ret == SUCCESS)
+    {
+        if (image->file.length > UINT32_MAX)
+        {
+            unmap_File(&image->file);
+            return FAILURE;
+        }
+        image->imageData = image->file.data;
+        image->imageLength = (uint32_t)image->file.length;
+    }
+    return ret;
+}
+
+void close_Firmware_Image(ptrFirmwareImage image)
+{
+    if (!image)
+    {
+        return;
+    }
+    unmap_File(&image->file);
+    memset(image, 0, sizeof(firmwareImage));
+}
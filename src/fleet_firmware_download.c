@@ -0,0 +1,170 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file fleet_firmware_download.c
+// \brief This file defines the functions for updating firmware on many devices at once with activation in waves
+
+#include "operations_Common.h"
+#include "fleet_firmware_download.h"
+#include "worker_pool.h"
+
+typedef enum _eFleetStep
+{
+    FLEET_STEP_DOWNLOAD,
+    FLEET_STEP_ACTIVATE
+}eFleetStep;
+
+typedef struct _fleetPool
+{
+    tDevice *deviceList;
+    ptrFleetFirmwareUpdate update;
+    ptrFleetFirmwareResult results;
+    eFleetStep step;
+}fleetPool, *ptrFleetPool;
+
+static void download_To_Fleet_Device(tDevice *device, ptrFleetFirmwareUpdate update, ptrFleetFirmwareResult result)
+{
+    supportedDLModes supportedModes;
+    firmwareUpdateData options = update->options;//each device gets its own copy since firmware_Download fills in the times
+    memset(&supportedModes, 0, sizeof(supportedDLModes));
+    if (SUCCESS != get_Supported_FWDL_Modes(device, &supportedModes) || !supportedModes.deferred)
+    {
+        result->downloadStatus = NOT_SUPPORTED;
+        return;
+    }
+    options.dlMode = DL_FW_DEFERRED;
+    options.avgSegmentDlTime = 0;
+    options.activateFWTime = 0;
+    result->downloadStatus = firmware_Download(device, &options);
+    result->avgSegmentDlTime = options.avgSegmentDlTime;
+    //a device is only activated when it is known to have taken the whole image
+    if (result->downloadStatus == SUCCESS && options.lastSegmentErrorPassed)
+    {
+        //firmware_Download passes this since some drives report it wrongly, but there is no way to tell those drives from a real failure
+        result->downloadStatus = FAILURE;
+    }
+    else if (result->downloadStatus == SUCCESS && device->drive_info.drive_type == ATA_DRIVE && options.ataDownloadStatus != ATA_DL_MICROCODE_STATUS_DEFERRED_COMPLETE)
+    {
+        //the drive did not report that every segment was received and the new code is waiting to be activated
+        result->downloadStatus = VALIDATION_FAILURE;
+    }
+}
+
+static void activate_Fleet_Device(tDevice *device, ptrFleetFirmwareUpdate update, ptrFleetFirmwareResult result)
+{
+    firmwareUpdateData options = update->options;
+    options.dlMode = DL_FW_ACTIVATE;
+    options.avgSegmentDlTime = 0;
+    options.activateFWTime = 0;
+    result->activateStatus = firmware_Download(device, &options);
+    result->activateFWTime = options.activateFWTime;
+}
+
+//Each worker keeps taking the next device in this step that has not been started until the step's devices are used up
+static void fleet_Worker(ptrWorkerPool workers, void *poolData)
+{
+    ptrFleetPool pool = (ptrFleetPool)poolData;
+    uint32_t deviceIndex = 0;
+    while (get_Next_Worker_Pool_Item(workers, &deviceIndex))
+    {
+        if (pool->step == FLEET_STEP_DOWNLOAD)
+        {
+            download_To_Fleet_Device(&pool->deviceList[deviceIndex], pool->update, &pool->results[deviceIndex]);
+        }
+        else if (pool->results[deviceIndex].downloadStatus == SUCCESS)
+        {
+            activate_Fleet_Device(&pool->deviceList[deviceIndex], pool->update, &pool->results[deviceIndex]);
+        }
+    }
+}
+
+int fleet_Firmware_Download(tDevice *deviceList, uint32_t numberOfDevices, ptrFleetFirmwareUpdate update, ptrFleetFirmwareResult results)
+{
+    int ret = SUCCESS;
+    uint32_t maxWorkers = 0;
+    uint32_t waveSize = 0;
+    uint32_t wave = 0;
+    bool waveFailed = false;
+    if (!deviceList || !update || !update->options.firmwareFileMem || update->options.firmwareMemoryLength == 0)
+    {
+        return BAD_PARAMETER;
+    }
+    if (numberOfDevices == 0)
+    {
+        return SUCCESS;
+    }
+    maxWorkers = update->maxWorkers == 0 ? FLEET_FWDL_DEFAULT_WORKERS : update->maxWorkers;
+    maxWorkers = M_Min(maxWorkers, FLEET_FWDL_MAX_WORKERS);
+    maxWorkers = M_Min(maxWorkers, numberOfDevices);
+    waveSize = update->activationWaveSize == 0 ? numberOfDevices : update->activationWaveSize;
+    ptrFleetFirmwareResult fleetResults = (ptrFleetFirmwareResult)calloc(numberOfDevices, sizeof(fleetFirmwareResult));
+    if (!fleetResults)
+    {
+        return MEMORY_FAILURE;
+    }
+    for (uint32_t deviceIter = 0; deviceIter < numberOfDevices; ++deviceIter)
+    {
+        fleetResults[deviceIter].activateStatus = UNKNOWN;
+    }
+    fleetPool pool;
+    memset(&pool, 0, sizeof(fleetPool));
+    pool.deviceList = deviceList;
+    pool.update = update;
+    pool.results = fleetResults;
+    pool.step = FLEET_STEP_DOWNLOAD;
+    run_Worker_Pool(0, numberOfDevices, maxWorkers, fleet_Worker, &pool);
+    for (uint32_t waveStart = 0; waveStart < numberOfDevices && !update->downloadOnly; waveStart += waveSize)
+    {
+        uint32_t waveEnd = M_Min(waveStart + waveSize, numberOfDevices);
+        if (waveFailed)
+        {
+            for (uint32_t deviceIter = waveStart; deviceIter < waveEnd; ++deviceIter)
+            {
+                if (fleetResults[deviceIter].downloadStatus == SUCCESS)
+                {
+                    fleetResults[deviceIter].activateStatus = ABORTED;
+                }
+            }
+            continue;
+        }
+        ++wave;
+        for (uint32_t deviceIter = waveStart; deviceIter < waveEnd; ++deviceIter)
+        {
+            if (fleetResults[deviceIter].downloadStatus == SUCCESS)
+            {
+                fleetResults[deviceIter].wave = wave;
+            }
+        }
+        //activation waves are not limited by maxWorkers since the devices in a wave are meant to activate together
+        pool.step = FLEET_STEP_ACTIVATE;
+        run_Worker_Pool(waveStart, waveEnd, waveEnd - waveStart, fleet_Worker, &pool);
+        for (uint32_t deviceIter = waveStart; deviceIter < waveEnd; ++deviceIter)
+        {
+            if (fleetResults[deviceIter].wave > 0 && fleetResults[deviceIter].activateStatus != SUCCESS && update->stopOnActivationFailure)
+            {
+                waveFailed = true;
+            }
+        }
+    }
+    for (uint32_t deviceIter = 0; deviceIter < numberOfDevices; ++deviceIter)
+    {
+        if (fleetResults[deviceIter].downloadStatus != SUCCESS || (!update->downloadOnly && fleetResults[deviceIter].activateStatus != SUCCESS))
+        {
+            ret = FAILURE;
+        }
+        if (results)
+        {
+            results[deviceIter] = fleetResults[deviceIter];
+        }
+    }
+    safe_Free(fleetResults);
+    return ret;
+}
@@ -14,6 +14,7 @@
 
 #include "format_unit.h"
 #include "logs.h"
+#include "device_page_cache.h"
 
 bool is_Format_Unit_Supported(tDevice *device, bool *fastFormatSupported)
 {
@@ -410,6 +411,8 @@ int run_Format_Unit(tDevice *device, runFormatUnitParameters formatParameters, b
         {
             ret = scsi_Format_Unit(device, fmtpInfo, longList, true, formatParameters.completeList, defectListFormat, 0, dataBuf, dataSize, formatParameters.formatType, formatCommandTimeout);
         }
+        //capacity, sector size and protection information are likely different now
+        invalidate_Device_Page_Cache(device);
 
         //poll for progress
         if (pollForProgress && ret == SUCCESS)
@@ -482,13 +485,13 @@ int get_Supported_Protection_Types(tDevice *device, ptrProtectionSupport protect
     {
         return MEMORY_FAILURE;
     }
-    if (SUCCESS == scsi_Inquiry(device, inquiryData, INQ_RETURN_DATA_LENGTH, 0, false, false))
+    if (SUCCESS == scsi_Inquiry_Cached(device, inquiryData, INQ_RETURN_DATA_LENGTH, 0, false))
     {
         if (inquiryData[5] & BIT0)
         {
             protectionSupportInfo->deviceSupportsProtection = true;
             //now read the extended inquiry data VPD page
-            if (SUCCESS == scsi_Inquiry(device, inquiryData, INQ_RETURN_DATA_LENGTH, EXTENDED_INQUIRY_DATA, true, false))
+            if (SUCCESS == scsi_Inquiry_Cached(device, inquiryData, INQ_RETURN_DATA_LENGTH, EXTENDED_INQUIRY_DATA, true))
             {
                 switch (inquiryData[0] & 0x1F)
                 {
@@ -0,0 +1,134 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file internal_status_capture.c
+// \brief This file defines the functions for capturing internal status logs from many devices at nearly the same moment
+
+#include "operations_Common.h"
+#include "internal_status_capture.h"
+#include "logs.h"
+#include "worker_pool.h"
+
+typedef struct _islCaptureDevice
+{
+    internalStatusLogSnapshot snapshot;
+    FILE *islFile;
+    islCaptureResult result;
+}islCaptureDevice, *ptrIslCaptureDevice;
+
+typedef struct _islCapturePool
+{
+    tDevice *deviceList;
+    ptrIslCaptureDevice captures;
+    uint8_t islDataSet;
+    uint32_t transferSizeBytes;
+}islCapturePool, *ptrIslCapturePool;
+
+//Each worker keeps taking the next device that has not been started until the list is used up.
+//Every device has its own file and its own result, so nothing else is shared between workers.
+static void capture_Worker(ptrWorkerPool workers, void *poolData)
+{
+    ptrIslCapturePool pool = (ptrIslCapturePool)poolData;
+    uint32_t deviceIndex = 0;
+    while (get_Next_Worker_Pool_Item(workers, &deviceIndex))
+    {
+        ptrIslCaptureDevice capture = &pool->captures[deviceIndex];
+        if (capture->result.status == SUCCESS)
+        {
+            seatimer_t pullTimer;
+            memset(&pullTimer, 0, sizeof(seatimer_t));
+            start_Timer(&pullTimer);
+            capture->result.status = pull_Internal_Status_Log_Snapshot(&pool->deviceList[deviceIndex], &capture->snapshot, pool->islDataSet, capture->islFile, NULL, 0, pool->transferSizeBytes, false);
+            stop_Timer(&pullTimer);
+            capture->result.pullTimeNS = get_Nano_Seconds(pullTimer);
+        }
+    }
+}
+
+int pull_Internal_Status_Logs(tDevice *deviceList, uint32_t numberOfDevices, bool currentOrSaved, uint8_t islDataSet, const char * const filePath, uint32_t transferSizeBytes, uint32_t maxWorkers, ptrIslCaptureResult results)
+{
+    int ret = SUCCESS;
+    if (!deviceList || transferSizeBytes % LEGACY_DRIVE_SEC_SIZE)
+    {
+        return BAD_PARAMETER;
+    }
+    if (numberOfDevices == 0)
+    {
+        return SUCCESS;
+    }
+    if (maxWorkers == 0)
+    {
+        maxWorkers = ISL_CAPTURE_DEFAULT_WORKERS;
+    }
+    maxWorkers = M_Min(maxWorkers, ISL_CAPTURE_MAX_WORKERS);
+    maxWorkers = M_Min(maxWorkers, numberOfDevices);
+    ptrIslCaptureDevice captures = (ptrIslCaptureDevice)calloc(numberOfDevices, sizeof(islCaptureDevice));
+    if (!captures)
+    {
+        return MEMORY_FAILURE;
+    }
+    //create every snapshot before anything else so they are as close together in time as possible
+    for (uint32_t deviceIter = 0; deviceIter < numberOfDevices; ++deviceIter)
+    {
+        captures[deviceIter].result.status = trigger_Internal_Status_Log(&deviceList[deviceIter], currentOrSaved, &captures[deviceIter].snapshot);
+        if (captures[deviceIter].result.status == SUCCESS)
+        {
+            captures[deviceIter].result.snapshotTime = time(NULL);
+        }
+    }
+    //open the files on this thread since the file names are generated with the shared current time string
+    for (uint32_t deviceIter = 0; deviceIter < numberOfDevices; ++deviceIter)
+    {
+        if (captures[deviceIter].result.status == SUCCESS)
+        {
+            char fileName[OPENSEA_PATH_MAX] = { 0 };
+            char *fileNameUsed = &fileName[0];
+            if (SUCCESS == create_And_Open_Log_File(&deviceList[deviceIter], &captures[deviceIter].islFile, filePath, "ISL", "isl", NAMING_SERIAL_NUMBER_DATE_TIME, &fileNameUsed))
+            {
+                if (VERBOSITY_QUIET < g_verbosity)
+                {
+                    printf("Saving ISL log to file %s\n", fileNameUsed);
+                }
+            }
+            else
+            {
+                captures[deviceIter].islFile = NULL;
+                captures[deviceIter].result.status = FILE_OPEN_ERROR;
+            }
+        }
+    }
+    islCapturePool pool;
+    memset(&pool, 0, sizeof(islCapturePool));
+    pool.deviceList = deviceList;
+    pool.captures = captures;
+    pool.islDataSet = islDataSet;
+    pool.transferSizeBytes = transferSizeBytes;
+    //if no threads can be started the logs are pulled on this thread instead, so the snapshots are still saved
+    run_Worker_Pool(0, numberOfDevices, maxWorkers, capture_Worker, &pool);
+    for (uint32_t deviceIter = 0; deviceIter < numberOfDevices; ++deviceIter)
+    {
+        if (captures[deviceIter].islFile)
+        {
+            fflush(captures[deviceIter].islFile);
+            fclose(captures[deviceIter].islFile);
+        }
+        if (captures[deviceIter].result.status != SUCCESS)
+        {
+            ret = FAILURE;
+        }
+        if (results)
+        {
+            results[deviceIter] = captures[deviceIter].result;
+        }
+    }
+    safe_Free(captures);
+    return ret;
+}
@@ -0,0 +1,611 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file log_archive.c
+// \brief This file defines the functions for pulling a set of logs from a drive into a single indexed archive file
+
+#include "operations_Common.h"
+#include "log_archive.h"
+#include "logs.h"
+#include "device_page_cache.h"
+#include "log_compression.h"
+#include "worker_pool.h"
+
+#define LOG_ARCHIVE_MAX_ENTRIES 16 //more than the number of logs that can be selected on any one drive type
+#define LOG_ARCHIVE_PENDING_LOGS 2 //logs waiting to be compressed before the next read waits. Bounds how much memory the pull uses
+#define ERROR_HISTORY_DIRECTORY_LENGTH 2088
+#define LOG_ARCHIVE_MAX_DEFECT_LIST_LENGTH (UINT32_C(4194304) * 8) //4M long block descriptors. Far more than any drive reports, and keeps 8 + length from wrapping
+
+typedef struct _pendingArchiveLog
+{
+    uint16_t entryIndex;
+    uint8_t *logData;
+    uint32_t logLength;
+}pendingArchiveLog;
+
+typedef struct _logArchiveWriter
+{
+    tDevice *device;
+    const char *filePath;
+    FILE *archive;
+    int openResult;//UNKNOWN until the first log is added and the file is created
+    bool compress;
+    bool writeFailed;
+    bool memoryFailure;
+    uint64_t offset;//where the next stored log goes
+    uint16_t entryCount;
+    logArchiveIndexEntry entries[LOG_ARCHIVE_MAX_ENTRIES];
+    //when compressing, logs are compressed and written on another thread while the next log is read from the drive
+    bool threadStarted;
+    bool done;
+    uint8_t pendingCount;
+    uint8_t pendingStart;
+    pendingArchiveLog pending[LOG_ARCHIVE_PENDING_LOGS];
+    workerLock lock;
+    workerCondition logQueued;
+    workerCondition logStored;
+    workerThread thread;
+}logArchiveWriter, *ptrLogArchiveWriter;
+
+typedef struct _ataArchiveLog
+{
+    uint32_t selection;
+    uint8_t logAddress;
+    bool gpl;//look in the GPL directory
+    bool smart;//look in the SMART directory
+    uint32_t transferSize;//0 = use what the caller asked for
+    const char *name;
+}ataArchiveLog;
+
+//Same logs, and the same directories, as the individual get functions for ATA drives
+static const ataArchiveLog ataArchiveLogs[] = {
+    { LOG_ARCHIVE_SMART_EXT_COMP_ERROR_LOG, ATA_LOG_EXTENDED_COMPREHENSIVE_SMART_ERROR_LOG, true, false, 0, "SMART_Ext_Comp_Error" },
+    { LOG_ARCHIVE_DST_LOG, ATA_LOG_EXTENDED_SMART_SELF_TEST_LOG, true, false, 0, "Ext_SMART_Self_Test" },
+    { LOG_ARCHIVE_DST_LOG, ATA_LOG_SMART_SELF_TEST_LOG, false, true, 0, "SMART_Self_Test_Results" },
+    { LOG_ARCHIVE_PENDING_DEFECTS, ATA_LOG_PENDING_DEFECTS_LOG, true, false, 0, "Pending_Defects" },
+    { LOG_ARCHIVE_IDENTIFY_DEVICE_DATA_LOG, ATA_LOG_IDENTIFY_DEVICE_DATA, true, true, 0, "Identify_Device_Data" },
+    { LOG_ARCHIVE_SATA_PHY_EVENT_COUNTERS, ATA_LOG_SATA_PHY_EVENT_COUNTERS_LOG, true, false, 0, "SATA_Phy_Event_Counters" },
+    { LOG_ARCHIVE_DEVICE_STATISTICS, ATA_LOG_DEVICE_STATISTICS, true, true, 0, "Device_Statistics" },
+    { LOG_ARCHIVE_EPC, ATA_LOG_POWER_CONDITIONS, true, false, LEGACY_DRIVE_SEC_SIZE * 2, "EPC" },
+};
+
+typedef struct _scsiArchiveLog
+{
+    uint32_t selection;
+    uint8_t logPage;
+    uint8_t subpage;
+    const char *name;
+}scsiArchiveLog;
+
+static const scsiArchiveLog scsiArchiveLogs[] = {
+    { LOG_ARCHIVE_DST_LOG, LP_SELF_TEST_RESULTS, 0, "Self_Test_Results" },
+    { LOG_ARCHIVE_PENDING_DEFECTS, LP_PENDING_DEFECTS, 0x01, "Pending_Defects" },
+    { LOG_ARCHIVE_DEVICE_STATISTICS, LP_GENERAL_STATISTICS_AND_PERFORMANCE, 0, "Device_Statistics" },
+    { LOG_ARCHIVE_INFORMATIONAL_EXCEPTIONS, LP_INFORMATION_EXCEPTIONS, 0, "Info_Exceptions" },
+};
+
+static void put_Archive_Value(uint8_t *ptrData, uint64_t value, uint8_t numberOfBytes)
+{
+    for (uint8_t byteIter = 0; byteIter < numberOfBytes; ++byteIter)
+    {
+        ptrData[byteIter] = (uint8_t)(value >> (8 * byteIter));
+    }
+}
+
+static void write_Archive_Bytes(ptrLogArchiveWriter writer, const uint8_t *ptrData, uint32_t dataLength)
+{
+    if (dataLength > 0 && fwrite(ptrData, sizeof(uint8_t), dataLength, writer->archive) != dataLength)
+    {
+        writer->writeFailed = true;
+    }
+}
+
+static bool open_Log_Archive(ptrLogArchiveWriter writer)
+{
+    if (writer->openResult == UNKNOWN)
+    {
+        char *fileNameUsed = NULL;
+        writer->openResult = create_And_Open_Log_File(writer->device, &writer->archive, writer->filePath, "Log_Archive", "olar", NAMING_SERIAL_NUMBER_DATE_TIME, &fileNameUsed);
+        if (writer->openResult == SUCCESS)
+        {
+            //the header is written again with the entry count and index offset once everything has been added
+            uint8_t header[LOG_ARCHIVE_HEADER_LENGTH] = { 0 };
+            if (VERBOSITY_QUIET < g_verbosity && fileNameUsed)
+            {
+                printf("Saving logs to archive %s\n", fileNameUsed);
+            }
+            write_Archive_Bytes(writer, header, LOG_ARCHIVE_HEADER_LENGTH);
+            writer->offset = LOG_ARCHIVE_HEADER_LENGTH;
+        }
+        else
+        {
+            writer->openResult = FILE_OPEN_ERROR;
+        }
+    }
+    return writer->openResult == SUCCESS;
+}
+
+//compresses (when asked to) and writes one log, then fills in where it went. Frees logData.
+//Only the archive thread calls this once it is running, so the file and offset need no lock. The index entry is updated with the lock held.
+static void store_Log_Archive_Entry(ptrLogArchiveWriter writer, uint16_t entryIndex, uint8_t *logData, uint32_t logLength)
+{
+    uint8_t *storedData = logData;
+    uint32_t storedLength = logLength;
+    uint8_t *compressedLog = NULL;
+    uint32_t compressedLength = 0;
+    eLogArchiveCompression compression = LOG_ARCHIVE_COMPRESSION_NONE;
+    if (writer->compress && SUCCESS == compress_Log(logData, logLength, &compressedLog, &compressedLength))
+    {
+        //if compressing fails (out of memory) the log is stored as-is
+        storedData = compressedLog;
+        storedLength = compressedLength;
+        compression = LOG_ARCHIVE_COMPRESSION_GZIP;
+    }
+    uint64_t offset = writer->offset;
+    write_Archive_Bytes(writer, storedData, storedLength);
+    writer->offset += storedLength;
+    if (writer->threadStarted)
+    {
+        acquire_Worker_Lock(&writer->lock);
+    }
+    writer->entries[entryIndex].offset = offset;
+    writer->entries[entryIndex].storedLength = storedLength;
+    writer->entries[entryIndex].compression = compression;
+    if (writer->threadStarted)
+    {
+        release_Worker_Lock(&writer->lock);
+    }
+    safe_Free(compressedLog);
+    safe_Free(logData);
+}
+
+static void log_Archive_Writer(void *writerParameter)
+{
+    ptrLogArchiveWriter writer = (ptrLogArchiveWriter)writerParameter;
+    acquire_Worker_Lock(&writer->lock);
+    while (true)
+    {
+        while (writer->pendingCount == 0 && !writer->done)
+        {
+            wait_Worker_Condition(&writer->logQueued, &writer->lock);
+        }
+        if (writer->pendingCount == 0)
+        {
+            break;//done and nothing left to store
+        }
+        pendingArchiveLog pendingLog = writer->pending[writer->pendingStart];
+        release_Worker_Lock(&writer->lock);
+        store_Log_Archive_Entry(writer, pendingLog.entryIndex, pendingLog.logData, pendingLog.logLength);
+        acquire_Worker_Lock(&writer->lock);
+        writer->pendingStart = (writer->pendingStart + 1) % LOG_ARCHIVE_PENDING_LOGS;
+        writer->pendingCount--;
+        signal_Worker_Condition(&writer->logStored);
+    }
+    release_Worker_Lock(&writer->lock);
+}
+
+static void start_Log_Archive_Writer(ptrLogArchiveWriter writer)
+{
+    init_Worker_Lock(&writer->lock);
+    init_Worker_Condition(&writer->logQueued);
+    init_Worker_Condition(&writer->logStored);
+    writer->threadStarted = start_Worker_Thread(&writer->thread, log_Archive_Writer, writer);
+}
+
+//waits for every queued log to be stored and stops the archive thread (if it was started)
+static void stop_Log_Archive_Writer(ptrLogArchiveWriter writer)
+{
+    if (writer->threadStarted)
+    {
+        acquire_Worker_Lock(&writer->lock);
+        writer->done = true;
+        signal_Worker_Condition(&writer->logQueued);
+        release_Worker_Lock(&writer->lock);
+        join_Worker_Thread(&writer->thread);
+        writer->threadStarted = false;
+    }
+    destroy_Worker_Condition(&writer->logQueued);
+    destroy_Worker_Condition(&writer->logStored);
+    destroy_Worker_Lock(&writer->lock);
+}
+
+//adds a log to the archive. Takes ownership of *logData (it is freed and set to NULL)
+static void add_Log_Archive_Entry(ptrLogArchiveWriter writer, eLogArchiveEntryType entryType, uint8_t logAddress, uint8_t subpage, const char *name, uint8_t **logData, uint32_t logLength)
+{
+    uint8_t *data = *logData;
+    *logData = NULL;
+    if (writer->entryCount >= LOG_ARCHIVE_MAX_ENTRIES || !open_Log_Archive(writer))
+    {
+        safe_Free(data);
+        return;
+    }
+    uint16_t entryIndex = writer->entryCount;
+    ptrLogArchiveIndexEntry entry = &writer->entries[entryIndex];
+    if (writer->threadStarted)
+    {
+        acquire_Worker_Lock(&writer->lock);
+    }
+    memset(entry, 0, sizeof(logArchiveIndexEntry));
+    entry->entryType = entryType;
+    entry->logAddress = logAddress;
+    entry->subpage = subpage;
+    entry->dataLength = logLength;
+    snprintf(entry->name, LOG_ARCHIVE_NAME_LENGTH, "%s", name);
+    writer->entryCount++;
+    if (writer->threadStarted)
+    {
+        //hand the log to the archive thread and go read the next one
+        while (writer->pendingCount == LOG_ARCHIVE_PENDING_LOGS)
+        {
+            wait_Worker_Condition(&writer->logStored, &writer->lock);
+        }
+        pendingArchiveLog *pendingLog = &writer->pending[(writer->pendingStart + writer->pendingCount) % LOG_ARCHIVE_PENDING_LOGS];
+        pendingLog->entryIndex = entryIndex;
+        pendingLog->logData = data;
+        pendingLog->logLength = logLength;
+        writer->pendingCount++;
+        signal_Worker_Condition(&writer->logQueued);
+        release_Worker_Lock(&writer->lock);
+    }
+    else
+    {
+        store_Log_Archive_Entry(writer, entryIndex, data, logLength);
+    }
+}
+
+//writes the index and the final header, then closes the archive
+static void close_Log_Archive(ptrLogArchiveWriter writer)
+{
+    uint8_t header[LOG_ARCHIVE_HEADER_LENGTH] = { 0 };
+    if (writer->compress)
+    {
+        stop_Log_Archive_Writer(writer);
+    }
+    if (!writer->archive)
+    {
+        return;
+    }
+    for (uint16_t entryIter = 0; entryIter < writer->entryCount; ++entryIter)
+    {
+        ptrLogArchiveIndexEntry entry = &writer->entries[entryIter];
+        uint8_t indexEntry[LOG_ARCHIVE_INDEX_ENTRY_LENGTH] = { 0 };
+        indexEntry[0] = (uint8_t)entry->entryType;
+        indexEntry[1] = entry->logAddress;
+        indexEntry[2] = entry->subpage;
+        indexEntry[3] = (uint8_t)entry->compression;
+        put_Archive_Value(&indexEntry[4], entry->dataLength, 4);
+        put_Archive_Value(&indexEntry[8], entry->offset, 8);
+        put_Archive_Value(&indexEntry[16], entry->storedLength, 4);
+        memcpy(&indexEntry[24], entry->name, strlen(entry->name));
+        write_Archive_Bytes(writer, indexEntry, LOG_ARCHIVE_INDEX_ENTRY_LENGTH);
+    }
+    memcpy(&header[0], LOG_ARCHIVE_SIGNATURE, 4);
+    put_Archive_Value(&header[4], LOG_ARCHIVE_VERSION, 2);
+    put_Archive_Value(&header[6], writer->entryCount, 2);
+    put_Archive_Value(&header[8], writer->offset, 8);
+    if (0 != fseek(writer->archive, 0, SEEK_SET))
+    {
+        writer->writeFailed = true;
+    }
+    else
+    {
+        write_Archive_Bytes(writer, header, LOG_ARCHIVE_HEADER_LENGTH);
+    }
+    if (0 != fflush(writer->archive))
+    {
+        writer->writeFailed = true;
+    }
+    fclose(writer->archive);
+    writer->archive = NULL;
+}
+
+//length of the data set pull_Internal_Status_Log read when asked for the large data set (it falls back to medium, then small)
+static uint32_t get_Archived_ISL_Length(uint8_t *islData, uint32_t dataSize)
+{
+    uint16_t dataSetPages[3] = { 0 };
+    uint32_t islLength = 0;
+    for (uint8_t dataSetIter = 0; dataSetIter < 3; ++dataSetIter)
+    {
+        uint8_t sizeOffset = 8 + (dataSetIter * 2);
+        if (islData[0] == RESERVED)//SAS log
+        {
+            dataSetPages[dataSetIter] = M_BytesTo2ByteValue(islData[sizeOffset], islData[sizeOffset + 1]);
+        }
+        else //ATA log (SAT translation somewhere below)
+        {
+            dataSetPages[dataSetIter] = M_BytesTo2ByteValue(islData[sizeOffset + 1], islData[sizeOffset]);
+        }
+    }
+    islLength = (uint32_t)(dataSetPages[2] ? dataSetPages[2] : (dataSetPages[1] ? dataSetPages[1] : dataSetPages[0])) * LEGACY_DRIVE_SEC_SIZE;
+    islLength = M_Max(islLength, LEGACY_DRIVE_SEC_SIZE);//the first page is always read
+    return M_Min(islLength, dataSize);
+}
+
+static void archive_Internal_Status_Log(ptrLogArchiveWriter writer, eLogArchiveEntryType entryType, uint8_t logAddress, uint32_t islSize, uint32_t transferSizeBytes)
+{
+    uint8_t *islData = NULL;
+    //round up to whole pages since the log is read in pages
+    islSize = ((islSize + LEGACY_DRIVE_SEC_SIZE - 1) / LEGACY_DRIVE_SEC_SIZE) * LEGACY_DRIVE_SEC_SIZE;
+    if (islSize == 0)
+    {
+        return;
+    }
+    islData = (uint8_t*)calloc(islSize, sizeof(uint8_t));
+    if (!islData)
+    {
+        writer->memoryFailure = true;
+        return;
+    }
+    if (SUCCESS == pull_Internal_Status_Log(writer->device, true, 3, false, islData, islSize, NULL, transferSizeBytes))
+    {
+        add_Log_Archive_Entry(writer, entryType, logAddress, 0, "ISL", &islData, get_Archived_ISL_Length(islData, islSize));
+    }
+    safe_Free(islData);
+}
+
+static void archive_ATA_Logs(ptrLogArchiveWriter writer, uint32_t logSelection, uint32_t transferSizeBytes)
+{
+    tDevice *device = writer->device;
+    uint8_t gplDirectory[LEGACY_DRIVE_SEC_SIZE] = { 0 };
+    uint8_t smartDirectory[LEGACY_DRIVE_SEC_SIZE] = { 0 };
+    //each directory is read once here. get_ATA_Log finds the same directories in the device page cache.
+    if (device->drive_info.ata_Options.generalPurposeLoggingSupported)
+    {
+        ata_Read_Log_Directory_Cached(device, true, gplDirectory, LEGACY_DRIVE_SEC_SIZE);
+    }
+    ata_Read_Log_Directory_Cached(device, false, smartDirectory, LEGACY_DRIVE_SEC_SIZE);
+    for (uint8_t logIter = 0; logIter < sizeof(ataArchiveLogs) / sizeof(ataArchiveLogs[0]); ++logIter)
+    {
+        const ataArchiveLog *log = &ataArchiveLogs[logIter];
+        uint32_t gplSize = 0;
+        uint32_t smartSize = 0;
+        if (!(logSelection & log->selection))
+        {
+            continue;
+        }
+        if (log->selection == LOG_ARCHIVE_DST_LOG && log->gpl != device->drive_info.ata_Options.generalPurposeLoggingSupported)
+        {
+            continue;//same choice get_DST_Log makes
+        }
+        if (log->gpl)
+        {
+            gplSize = M_BytesTo2ByteValue(gplDirectory[(log->logAddress * 2) + 1], gplDirectory[(log->logAddress * 2)]) * LEGACY_DRIVE_SEC_SIZE;
+        }
+        if (log->smart)
+        {
+            smartSize = M_BytesTo2ByteValue(smartDirectory[(log->logAddress * 2) + 1], smartDirectory[(log->logAddress * 2)]) * LEGACY_DRIVE_SEC_SIZE;
+        }
+        if (gplSize > 0 || smartSize > 0)
+        {
+            bool fromGPL = gplSize > 0;
+            uint32_t logSize = fromGPL ? gplSize : smartSize;
+            uint8_t *logData = (uint8_t*)calloc(logSize, sizeof(uint8_t));
+            if (!logData)
+            {
+                writer->memoryFailure = true;
+                continue;
+            }
+            if (SUCCESS == get_ATA_Log(device, log->logAddress, NULL, NULL, fromGPL, !fromGPL, true, logData, logSize, NULL, log->transferSize ? log->transferSize : transferSizeBytes))
+            {
+                add_Log_Archive_Entry(writer, fromGPL ? LOG_ARCHIVE_ENTRY_ATA_GPL_LOG : LOG_ARCHIVE_ENTRY_ATA_SMART_LOG, log->logAddress, 0, log->name, &logData, logSize);
+            }
+            safe_Free(logData);
+        }
+    }
+    if (logSelection & LOG_ARCHIVE_INTERNAL_STATUS_LOG)
+    {
+        uint32_t islSize = M_BytesTo2ByteValue(gplDirectory[(ATA_LOG_CURRENT_DEVICE_INTERNAL_STATUS_DATA_LOG * 2) + 1], gplDirectory[(ATA_LOG_CURRENT_DEVICE_INTERNAL_STATUS_DATA_LOG * 2)]) * LEGACY_DRIVE_SEC_SIZE;
+        archive_Internal_Status_Log(writer, LOG_ARCHIVE_ENTRY_ATA_INTERNAL_STATUS_LOG, ATA_LOG_CURRENT_DEVICE_INTERNAL_STATUS_DATA_LOG, islSize, transferSizeBytes);
+    }
+}
+
+static bool is_Archive_Log_Page_Supported(uint8_t *supportedPages, bool subpageList, uint8_t logPage, uint8_t subpage)
+{
+    uint16_t pageLen = M_BytesTo2ByteValue(supportedPages[2], supportedPages[3]) + SCSI_LOG_PARAMETER_HEADER_LENGTH;
+    uint16_t increment = subpageList ? 2 : 1;
+    if (!subpageList && subpage != 0)
+    {
+        return false;
+    }
+    for (uint16_t pageIter = SCSI_LOG_PARAMETER_HEADER_LENGTH; (pageIter + increment - 1) < M_Min(pageLen, LEGACY_DRIVE_SEC_SIZE * 2); pageIter += increment)
+    {
+        if ((supportedPages[pageIter] & 0x3F) == logPage && (!subpageList || supportedPages[pageIter + 1] == subpage))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void archive_SCSI_Grown_Defect_List(ptrLogArchiveWriter writer)
+{
+    uint8_t defectHeader[8] = { 0 };
+    if (SUCCESS == scsi_Read_Defect_Data_12(writer->device, false, true, AD_LONG_BLOCK_FORMAT_ADDRESS_DESCRIPTOR, 0, 8, defectHeader))
+    {
+        uint32_t defectListLength = M_BytesTo4ByteValue(defectHeader[4], defectHeader[5], defectHeader[6], defectHeader[7]);
+        uint32_t chunkSize = 4096;//header + 511 address descriptors
+        uint8_t *defectList = NULL;
+        uint8_t *defectChunk = NULL;
+        bool gotList = true;
+        if (defectListLength > LOG_ARCHIVE_MAX_DEFECT_LIST_LENGTH)
+        {
+            //not a length a drive can really report. Skip it rather than trusting it for the allocation and copies below
+            return;
+        }
+        defectList = (uint8_t*)calloc(8 + defectListLength, sizeof(uint8_t));
+        defectChunk = (uint8_t*)calloc(chunkSize, sizeof(uint8_t));
+        if (!defectList || !defectChunk)
+        {
+            writer->memoryFailure = true;
+            safe_Free(defectList);
+            safe_Free(defectChunk);
+            return;
+        }
+        memcpy(defectList, defectHeader, 8);
+        for (uint32_t addressDescriptorIndex = 0; (addressDescriptorIndex * 8) < defectListLength; addressDescriptorIndex += 511)
+        {
+            if (SUCCESS != scsi_Read_Defect_Data_12(writer->device, false, true, AD_LONG_BLOCK_FORMAT_ADDRESS_DESCRIPTOR, addressDescriptorIndex, chunkSize, defectChunk))
+            {
+                gotList = false;
+                break;
+            }
+            memcpy(&defectList[8 + (addressDescriptorIndex * 8)], &defectChunk[8], M_Min(511 * 8, defectListLength - (addressDescriptorIndex * 8)));
+        }
+        if (gotList)
+        {
+            add_Log_Archive_Entry(writer, LOG_ARCHIVE_ENTRY_SCSI_GROWN_DEFECT_LIST, 0, 0, "GLIST", &defectList, 8 + defectListLength);
+        }
+        safe_Free(defectList);
+        safe_Free(defectChunk);
+    }
+}
+
+static void archive_SCSI_Logs(ptrLogArchiveWriter writer, uint32_t logSelection, uint32_t transferSizeBytes)
+{
+    tDevice *device = writer->device;
+    uint8_t supportedPages[LEGACY_DRIVE_SEC_SIZE * 2] = { 0 };
+    bool subpageList = true;
+    bool haveSupportedPages = true;
+    //read the list of supported pages once (with subpages if the drive can report them)
+    if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES_AND_SUBPAGES, 0xFF, 0, supportedPages, LEGACY_DRIVE_SEC_SIZE * 2))
+    {
+        subpageList = false;
+        memset(supportedPages, 0, LEGACY_DRIVE_SEC_SIZE * 2);
+        if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, LP_SUPPORTED_LOG_PAGES, 0, 0, supportedPages, LEGACY_DRIVE_SEC_SIZE * 2))
+        {
+            haveSupportedPages = false;
+        }
+    }
+    for (uint8_t logIter = 0; haveSupportedPages && logIter < sizeof(scsiArchiveLogs) / sizeof(scsiArchiveLogs[0]); ++logIter)
+    {
+        const scsiArchiveLog *log = &scsiArchiveLogs[logIter];
+        uint8_t pageHeader[SCSI_LOG_PARAMETER_HEADER_LENGTH] = { 0 };
+        if (!(logSelection & log->selection) || !is_Archive_Log_Page_Supported(supportedPages, subpageList, log->logPage, log->subpage))
+        {
+            continue;
+        }
+        if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, log->logPage, log->subpage, 0, pageHeader, SCSI_LOG_PARAMETER_HEADER_LENGTH))
+        {
+            //the allocation length field is only 16 bits, so that is all that can be read (and all that is stored)
+            uint32_t pageLength = M_Min(M_BytesTo2ByteValue(pageHeader[2], pageHeader[3]) + SCSI_LOG_PARAMETER_HEADER_LENGTH, UINT16_MAX);
+            uint8_t *pageData = (uint8_t*)calloc(pageLength, sizeof(uint8_t));
+            if (!pageData)
+            {
+                writer->memoryFailure = true;
+                continue;
+            }
+            if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, log->logPage, log->subpage, 0, pageData, (uint16_t)pageLength))
+            {
+                add_Log_Archive_Entry(writer, LOG_ARCHIVE_ENTRY_SCSI_LOG_PAGE, log->logPage, log->subpage, log->name, &pageData, pageLength);
+            }
+            safe_Free(pageData);
+        }
+    }
+    if (logSelection & LOG_ARCHIVE_EPC)
+    {
+        uint32_t vpdSize = 0;
+        if (SUCCESS == get_SCSI_VPD_Page_Size(device, POWER_CONDITION, &vpdSize) && vpdSize > 0)
+        {
+            uint8_t *vpdData = (uint8_t*)calloc(vpdSize, sizeof(uint8_t));
+            if (!vpdData)
+            {
+                writer->memoryFailure = true;
+            }
+            else
+            {
+                if (SUCCESS == get_SCSI_VPD(device, POWER_CONDITION, NULL, NULL, true, vpdData, vpdSize, NULL))
+                {
+                    add_Log_Archive_Entry(writer, LOG_ARCHIVE_ENTRY_SCSI_VPD_PAGE, POWER_CONDITION, 0, "EPC", &vpdData, vpdSize);
+                }
+                safe_Free(vpdData);
+            }
+        }
+    }
+    if (logSelection & LOG_ARCHIVE_GROWN_DEFECT_LIST)
+    {
+        archive_SCSI_Grown_Defect_List(writer);
+    }
+    if (logSelection & LOG_ARCHIVE_INTERNAL_STATUS_LOG)
+    {
+        uint8_t *errorHistoryDirectory = (uint8_t*)calloc(ERROR_HISTORY_DIRECTORY_LENGTH, sizeof(uint8_t));
+        if (!errorHistoryDirectory)
+        {
+            writer->memoryFailure = true;
+        }
+        else
+        {
+            if (SUCCESS == scsi_Read_Buffer(device, 0x1C, 0, 0, ERROR_HISTORY_DIRECTORY_LENGTH, errorHistoryDirectory))
+            {
+                uint32_t directoryLength = M_BytesTo2ByteValue(errorHistoryDirectory[30], errorHistoryDirectory[31]) + 32;
+                for (uint32_t directoryIter = 32; (directoryIter + 8) <= M_Min(directoryLength, ERROR_HISTORY_DIRECTORY_LENGTH); directoryIter += 8)
+                {
+                    //current internal status parameter
+                    if (errorHistoryDirectory[directoryIter + 1] == 0x01)
+                    {
+                        uint32_t islSize = M_BytesTo4ByteValue(errorHistoryDirectory[directoryIter + 4], errorHistoryDirectory[directoryIter + 5], errorHistoryDirectory[directoryIter + 6], errorHistoryDirectory[directoryIter + 7]);
+                        archive_Internal_Status_Log(writer, LOG_ARCHIVE_ENTRY_SCSI_INTERNAL_STATUS_LOG, errorHistoryDirectory[directoryIter], islSize, transferSizeBytes);
+                        break;
+                    }
+                }
+            }
+            safe_Free(errorHistoryDirectory);
+        }
+    }
+}
+
+int pull_Log_Archive(tDevice *device, uint32_t logSelection, const char * const filePath, uint32_t transferSizeBytes)
+{
+    int ret = NOT_SUPPORTED;
+    logArchiveWriter writer;
+    if (!device || transferSizeBytes % LEGACY_DRIVE_SEC_SIZE)
+    {
+        return BAD_PARAMETER;
+    }
+    if (device->drive_info.drive_type != ATA_DRIVE && device->drive_info.drive_type != SCSI_DRIVE)
+    {
+        return NOT_SUPPORTED;
+    }
+    memset(&writer, 0, sizeof(logArchiveWriter));
+    writer.device = device;
+    writer.filePath = filePath;
+    writer.openResult = UNKNOWN;
+    if (logSelection & LOG_ARCHIVE_COMPRESS)
+    {
+        writer.compress = true;
+        start_Log_Archive_Writer(&writer);
+    }
+    if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        archive_ATA_Logs(&writer, logSelection, transferSizeBytes);
+    }
+    else if (device->drive_info.drive_type == SCSI_DRIVE)
+    {
+        archive_SCSI_Logs(&writer, logSelection, transferSizeBytes);
+    }
+    close_Log_Archive(&writer);
+    if (writer.openResult != UNKNOWN && writer.openResult != SUCCESS)
+    {
+        ret = writer.openResult;
+    }
+    else if (writer.writeFailed)
+    {
+        ret = FAILURE;
+    }
+    else if (writer.entryCount > 0)
+    {
+        ret = SUCCESS;
+    }
+    else if (writer.memoryFailure)
+    {
+        ret = MEMORY_FAILURE;
+    }
+    return ret;
+}
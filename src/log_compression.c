@@ -0,0 +1,1111 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file log_compression.c
+// \brief This file defines the functions for compressing pulled logs so they take less space in support bundles
+
+#include "operations_Common.h"
+#include "log_compression.h"
+
+//gzip member layout (RFC 1952) with the BGZF extra field that holds the member length
+#define GZIP_ID1 0x1F
+#define GZIP_ID2 0x8B
+#define GZIP_CM_DEFLATE 8
+#define GZIP_FLG_FEXTRA BIT2
+#define GZIP_OS_UNKNOWN 0xFF
+#define GZIP_HEADER_LENGTH 18
+#define GZIP_TRAILER_LENGTH 8 //CRC-32 then ISIZE
+#define BGZF_EXTRA_LENGTH 6
+#define BGZF_SUBFIELD_ID1 'B'
+#define BGZF_SUBFIELD_ID2 'C'
+
+//deflate (RFC 1951)
+#define DEFLATE_MIN_MATCH 3
+#define DEFLATE_MAX_MATCH 258
+#define DEFLATE_WINDOW_SIZE 32768
+#define DEFLATE_LITERAL_LENGTH_CODES 286
+#define DEFLATE_FIXED_LITERAL_LENGTH_CODES 288
+#define DEFLATE_DISTANCE_CODES 30
+#define DEFLATE_CODE_LENGTH_CODES 19
+#define DEFLATE_MAX_CODE_BITS 15
+#define DEFLATE_MAX_CODE_LENGTH_BITS 7
+#define DEFLATE_END_OF_BLOCK 256
+#define DEFLATE_STORED_BLOCK 0
+#define DEFLATE_FIXED_BLOCK 1
+#define DEFLATE_DYNAMIC_BLOCK 2
+
+#define MATCH_HASH_BITS 15
+#define MAX_MATCH_CHAIN 64 //candidates checked for each match. More finds slightly longer matches, but takes longer
+#define LAZY_MATCH_LENGTH 32 //a match at least this long is taken without checking whether the next byte starts a longer one
+
+static const uint16_t lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const uint8_t lengthExtraBits[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const uint16_t distanceBase[DEFLATE_DISTANCE_CODES] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const uint8_t distanceExtraBits[DEFLATE_DISTANCE_CODES] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+static const uint8_t codeLengthOrder[DEFLATE_CODE_LENGTH_CODES] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+static const uint8_t codeLengthExtraBits[DEFLATE_CODE_LENGTH_CODES] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 7 };
+
+//the BGZF end of file marker: an empty member
+static const uint8_t bgzfEndMarker[LOG_COMPRESSION_END_MARKER_LENGTH] = { 0x1F, 0x8B, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x06, 0x00, 0x42, 0x43, 0x02, 0x00, 0x1B, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+static uint32_t get_Le_Value(const uint8_t *ptrData)
+{
+    return (uint32_t)ptrData[0] | ((uint32_t)ptrData[1] << 8) | ((uint32_t)ptrData[2] << 16) | ((uint32_t)ptrData[3] << 24);
+}
+
+static void put_Le_Value(uint8_t *ptrData, uint32_t value)
+{
+    ptrData[0] = M_Byte0(value);
+    ptrData[1] = M_Byte1(value);
+    ptrData[2] = M_Byte2(value);
+    ptrData[3] = M_Byte3(value);
+}
+
+//CRC-32 as used by gzip, a nibble at a time so the table is small
+static uint32_t update_Gzip_CRC(uint32_t crc, const uint8_t *ptrData, uint32_t dataLength)
+{
+    static const uint32_t crcTable[16] = { 0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C };
+    crc = ~crc;
+    for (uint32_t iter = 0; iter < dataLength; ++iter)
+    {
+        crc ^= ptrData[iter];
+        crc = (crc >> 4) ^ crcTable[crc & 0x0F];
+        crc = (crc >> 4) ^ crcTable[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+static uint8_t get_Length_Code(uint32_t matchLength)
+{
+    uint8_t code = 28;
+    while (lengthBase[code] > matchLength)
+    {
+        --code;
+    }
+    return code;
+}
+
+static uint8_t get_Distance_Code(uint32_t distance)
+{
+    uint8_t code = DEFLATE_DISTANCE_CODES - 1;
+    while (distanceBase[code] > distance)
+    {
+        --code;
+    }
+    return code;
+}
+
+//-----------------------------------------------------------------------------
+// compression
+//-----------------------------------------------------------------------------
+
+struct _logCompressor
+{
+    int32_t hashHead[1 << MATCH_HASH_BITS];//last position with each hash. -1 = none
+    int32_t hashPrevious[LOG_COMPRESSION_BLOCK_SIZE];//earlier position with the same hash as this one
+    uint16_t tokenLength[LOG_COMPRESSION_BLOCK_SIZE];//literal byte, or match length when tokenDistance is not 0
+    uint16_t tokenDistance[LOG_COMPRESSION_BLOCK_SIZE];
+    uint32_t numberOfTokens;
+    uint32_t literalLengthFrequency[DEFLATE_FIXED_LITERAL_LENGTH_CODES];
+    uint32_t distanceFrequency[DEFLATE_DISTANCE_CODES];
+};
+
+typedef struct _bitWriter
+{
+    uint8_t *output;
+    uint32_t outputLength;
+    uint32_t offset;
+    uint64_t bits;
+    uint32_t bitCount;
+    bool overflow;
+}bitWriter;
+
+//deflate packs bits starting at the least significant bit of each byte
+static void put_Bits(bitWriter *writer, uint32_t value, uint32_t count)
+{
+    writer->bits |= (uint64_t)value << writer->bitCount;
+    writer->bitCount += count;
+    while (writer->bitCount >= 8)
+    {
+        if (writer->offset < writer->outputLength)
+        {
+            writer->output[writer->offset++] = (uint8_t)writer->bits;
+        }
+        else
+        {
+            writer->overflow = true;
+        }
+        writer->bits >>= 8;
+        writer->bitCount -= 8;
+    }
+}
+
+static void flush_Bits(bitWriter *writer)
+{
+    if (writer->bitCount > 0)
+    {
+        put_Bits(writer, 0, 8 - writer->bitCount);
+    }
+}
+
+static uint32_t hash_Match(const uint8_t *ptrData)
+{
+    return ((((uint32_t)ptrData[0] << 16) | ((uint32_t)ptrData[1] << 8) | ptrData[2]) * 2654435761U) >> (32 - MATCH_HASH_BITS);
+}
+
+static void insert_Match_Position(ptrLogCompressor compressor, const uint8_t *block, uint32_t blockLength, uint32_t position)
+{
+    if (position + DEFLATE_MIN_MATCH <= blockLength)
+    {
+        uint32_t hash = hash_Match(&block[position]);
+        compressor->hashPrevious[position] = compressor->hashHead[hash];
+        compressor->hashHead[hash] = (int32_t)position;
+    }
+}
+
+//returns the longest match for position among the earlier positions with the same hash (0 if none), and sets distance to how far back it is
+static uint32_t find_Match(ptrLogCompressor compressor, const uint8_t *block, uint32_t blockLength, uint32_t position, uint32_t *distance)
+{
+    uint32_t bestLength = 0;
+    uint32_t maxLength = M_Min(DEFLATE_MAX_MATCH, blockLength - position);
+    if (maxLength < DEFLATE_MIN_MATCH)
+    {
+        return 0;
+    }
+    int32_t candidate = compressor->hashHead[hash_Match(&block[position])];
+    for (uint32_t chain = 0; candidate >= 0 && chain < MAX_MATCH_CHAIN && (position - (uint32_t)candidate) <= DEFLATE_WINDOW_SIZE; ++chain)
+    {
+        //check the byte that would make this match longer than the best so far first, since that usually rules it out
+        if (block[(uint32_t)candidate + bestLength] == block[position + bestLength] || bestLength == 0)
+        {
+            uint32_t matchLength = 0;
+            while (matchLength < maxLength && block[(uint32_t)candidate + matchLength] == block[position + matchLength])
+            {
+                ++matchLength;
+            }
+            if (matchLength > bestLength)
+            {
+                bestLength = matchLength;
+                *distance = position - (uint32_t)candidate;
+                if (bestLength == maxLength)
+                {
+                    break;
+                }
+            }
+        }
+        candidate = compressor->hashPrevious[candidate];
+    }
+    return bestLength >= DEFLATE_MIN_MATCH ? bestLength : 0;
+}
+
+static void add_Token(ptrLogCompressor compressor, uint32_t lengthOrLiteral, uint32_t distance)
+{
+    compressor->tokenLength[compressor->numberOfTokens] = (uint16_t)lengthOrLiteral;
+    compressor->tokenDistance[compressor->numberOfTokens] = (uint16_t)distance;
+    ++compressor->numberOfTokens;
+    if (distance == 0)
+    {
+        ++compressor->literalLengthFrequency[lengthOrLiteral];
+    }
+    else
+    {
+        ++compressor->literalLengthFrequency[257 + get_Length_Code(lengthOrLiteral)];
+        ++compressor->distanceFrequency[get_Distance_Code(distance)];
+    }
+}
+
+//finds the matches in a block (LZ77) with one step of lazy matching: a match is put off by a byte when the next byte starts a longer one
+static void find_Block_Matches(ptrLogCompressor compressor, const uint8_t *block, uint32_t blockLength)
+{
+    uint32_t position = 0;
+    memset(compressor->hashHead, 0xFF, sizeof(compressor->hashHead));
+    memset(compressor->literalLengthFrequency, 0, sizeof(compressor->literalLengthFrequency));
+    memset(compressor->distanceFrequency, 0, sizeof(compressor->distanceFrequency));
+    compressor->numberOfTokens = 0;
+    while (position < blockLength)
+    {
+        uint32_t distance = 0;
+        uint32_t matchLength = find_Match(compressor, block, blockLength, position, &distance);
+        insert_Match_Position(compressor, block, blockLength, position);
+        if (matchLength > 0 && matchLength < LAZY_MATCH_LENGTH)
+        {
+            uint32_t nextDistance = 0;
+            if (find_Match(compressor, block, blockLength, position + 1, &nextDistance) > matchLength)
+            {
+                add_Token(compressor, block[position], 0);
+                ++position;
+                continue;
+            }
+        }
+        if (matchLength > 0)
+        {
+            add_Token(compressor, matchLength, distance);
+            for (uint32_t matchIter = 1; matchIter < matchLength; ++matchIter)
+            {
+                insert_Match_Position(compressor, block, blockLength, position + matchIter);
+            }
+            position += matchLength;
+        }
+        else
+        {
+            add_Token(compressor, block[position], 0);
+            ++position;
+        }
+    }
+    ++compressor->literalLengthFrequency[DEFLATE_END_OF_BLOCK];
+}
+
+//Builds Huffman code lengths no longer than maxBits. If the tree is too deep, the frequencies are halved (keeping every used symbol) and it is built again.
+//Every symbol with a frequency gets a length. A single used symbol gets length 1.
+static void build_Code_Lengths(const uint32_t *frequency, uint16_t numberOfSymbols, uint8_t maxBits, uint8_t *lengths)
+{
+    uint32_t weight[2 * DEFLATE_FIXED_LITERAL_LENGTH_CODES] = { 0 };
+    uint16_t parent[2 * DEFLATE_FIXED_LITERAL_LENGTH_CODES] = { 0 };
+    uint8_t depth[2 * DEFLATE_FIXED_LITERAL_LENGTH_CODES] = { 0 };
+    uint16_t symbols[DEFLATE_FIXED_LITERAL_LENGTH_CODES] = { 0 };
+    uint32_t scaledFrequency[DEFLATE_FIXED_LITERAL_LENGTH_CODES] = { 0 };
+    uint16_t numberOfLeaves = 0;
+    memset(lengths, 0, numberOfSymbols);
+    for (uint16_t symbolIter = 0; symbolIter < numberOfSymbols; ++symbolIter)
+    {
+        scaledFrequency[symbolIter] = frequency[symbolIter];
+        if (frequency[symbolIter] > 0)
+        {
+            symbols[numberOfLeaves++] = symbolIter;
+        }
+    }
+    if (numberOfLeaves < 2)
+    {
+        if (numberOfLeaves == 1)
+        {
+            lengths[symbols[0]] = 1;
+        }
+        return;
+    }
+    while (true)
+    {
+        //leaves sorted by weight. Internal nodes are made in order of weight, so two queues give the two smallest nodes each time
+        for (uint16_t leafIter = 1; leafIter < numberOfLeaves; ++leafIter)
+        {
+            uint16_t symbol = symbols[leafIter];
+            uint16_t sortIter = leafIter;
+            for (; sortIter > 0 && scaledFrequency[symbols[sortIter - 1]] > scaledFrequency[symbol]; --sortIter)
+            {
+                symbols[sortIter] = symbols[sortIter - 1];
+            }
+            symbols[sortIter] = symbol;
+        }
+        for (uint16_t leafIter = 0; leafIter < numberOfLeaves; ++leafIter)
+        {
+            weight[leafIter] = scaledFrequency[symbols[leafIter]];
+        }
+        uint16_t nextLeaf = 0;
+        uint16_t nextNode = numberOfLeaves;
+        uint16_t newNode = numberOfLeaves;
+        for (; newNode < (2 * numberOfLeaves) - 1; ++newNode)
+        {
+            uint16_t children[2] = { 0 };
+            for (uint8_t childIter = 0; childIter < 2; ++childIter)
+            {
+                if (nextLeaf < numberOfLeaves && (nextNode >= newNode || weight[nextLeaf] <= weight[nextNode]))
+                {
+                    children[childIter] = nextLeaf++;
+                }
+                else
+                {
+                    children[childIter] = nextNode++;
+                }
+            }
+            weight[newNode] = weight[children[0]] + weight[children[1]];
+            parent[children[0]] = newNode;
+            parent[children[1]] = newNode;
+        }
+        //the root is the last node made. Every other node was made before its parent.
+        uint8_t maxDepth = 0;
+        depth[newNode - 1] = 0;
+        for (int32_t nodeIter = (int32_t)newNode - 2; nodeIter >= 0; --nodeIter)
+        {
+            depth[nodeIter] = depth[parent[nodeIter]] + 1;
+            maxDepth = M_Max(maxDepth, depth[nodeIter]);
+        }
+        if (maxDepth <= maxBits)
+        {
+            for (uint16_t leafIter = 0; leafIter < numberOfLeaves; ++leafIter)
+            {
+                lengths[symbols[leafIter]] = depth[leafIter];
+            }
+            return;
+        }
+        for (uint16_t leafIter = 0; leafIter < numberOfLeaves; ++leafIter)
+        {
+            scaledFrequency[symbols[leafIter]] = (scaledFrequency[symbols[leafIter]] + 1) / 2;
+        }
+    }
+}
+
+//canonical Huffman codes (RFC 1951 3.2.2), bit reversed so they can be written least significant bit first
+static void build_Codes(const uint8_t *lengths, uint16_t numberOfSymbols, uint16_t *codes)
+{
+    uint16_t lengthCount[DEFLATE_MAX_CODE_BITS + 1] = { 0 };
+    uint16_t nextCode[DEFLATE_MAX_CODE_BITS + 1] = { 0 };
+    uint16_t code = 0;
+    for (uint16_t symbolIter = 0; symbolIter < numberOfSymbols; ++symbolIter)
+    {
+        ++lengthCount[lengths[symbolIter]];
+    }
+    lengthCount[0] = 0;
+    for (uint8_t bits = 1; bits <= DEFLATE_MAX_CODE_BITS; ++bits)
+    {
+        code = (uint16_t)((code + lengthCount[bits - 1]) << 1);
+        nextCode[bits] = code;
+    }
+    for (uint16_t symbolIter = 0; symbolIter < numberOfSymbols; ++symbolIter)
+    {
+        uint8_t length = lengths[symbolIter];
+        codes[symbolIter] = 0;
+        if (length > 0)
+        {
+            uint16_t symbolCode = nextCode[length]++;
+            for (uint8_t bitIter = 0; bitIter < length; ++bitIter)
+            {
+                codes[symbolIter] = (uint16_t)((codes[symbolIter] << 1) | ((symbolCode >> bitIter) & 1));
+            }
+        }
+    }
+}
+
+static void get_Fixed_Code_Lengths(uint8_t *literalLengthLengths, uint8_t *distanceLengths)
+{
+    for (uint16_t symbolIter = 0; symbolIter < DEFLATE_FIXED_LITERAL_LENGTH_CODES; ++symbolIter)
+    {
+        if (symbolIter < 144)
+        {
+            literalLengthLengths[symbolIter] = 8;
+        }
+        else if (symbolIter < 256)
+        {
+            literalLengthLengths[symbolIter] = 9;
+        }
+        else if (symbolIter < 280)
+        {
+            literalLengthLengths[symbolIter] = 7;
+        }
+        else
+        {
+            literalLengthLengths[symbolIter] = 8;
+        }
+    }
+    for (uint16_t symbolIter = 0; symbolIter < DEFLATE_DISTANCE_CODES; ++symbolIter)
+    {
+        distanceLengths[symbolIter] = 5;
+    }
+}
+
+//the literal/length and distance code lengths, run length encoded with code length symbols 16, 17 and 18
+typedef struct _codeLengthHeader
+{
+    uint8_t literalLengthLengths[DEFLATE_FIXED_LITERAL_LENGTH_CODES];
+    uint8_t distanceLengths[DEFLATE_DISTANCE_CODES];
+    uint16_t numberOfLiteralLengthCodes;//HLIT + 257
+    uint16_t numberOfDistanceCodes;//HDIST + 1
+    uint16_t numberOfCodeLengthCodes;//HCLEN + 4
+    uint8_t symbols[DEFLATE_LITERAL_LENGTH_CODES + DEFLATE_DISTANCE_CODES];
+    uint8_t symbolExtra[DEFLATE_LITERAL_LENGTH_CODES + DEFLATE_DISTANCE_CODES];
+    uint16_t numberOfSymbols;
+    uint8_t codeLengthLengths[DEFLATE_CODE_LENGTH_CODES];
+    uint16_t codeLengthCodes[DEFLATE_CODE_LENGTH_CODES];
+}codeLengthHeader;
+
+static void add_Code_Length_Symbol(codeLengthHeader *header, uint8_t symbol, uint8_t extra)
+{
+    header->symbols[header->numberOfSymbols] = symbol;
+    header->symbolExtra[header->numberOfSymbols] = extra;
+    ++header->numberOfSymbols;
+}
+
+static void build_Code_Length_Header(ptrLogCompressor compressor, codeLengthHeader *header)
+{
+    uint32_t distanceFrequency[DEFLATE_DISTANCE_CODES] = { 0 };
+    uint32_t codeLengthFrequency[DEFLATE_CODE_LENGTH_CODES] = { 0 };
+    uint8_t allLengths[DEFLATE_LITERAL_LENGTH_CODES + DEFLATE_DISTANCE_CODES] = { 0 };
+    uint16_t numberOfLengths = 0;
+    memset(header, 0, sizeof(codeLengthHeader));
+    build_Code_Lengths(compressor->literalLengthFrequency, DEFLATE_LITERAL_LENGTH_CODES, DEFLATE_MAX_CODE_BITS, header->literalLengthLengths);
+    //always send at least two distance codes. Some decoders reject a block with fewer even when it has no matches
+    memcpy(distanceFrequency, compressor->distanceFrequency, sizeof(distanceFrequency));
+    for (uint8_t codeIter = 0; codeIter < 2; ++codeIter)
+    {
+        distanceFrequency[codeIter] = M_Max(distanceFrequency[codeIter], 1);
+    }
+    build_Code_Lengths(distanceFrequency, DEFLATE_DISTANCE_CODES, DEFLATE_MAX_CODE_BITS, header->distanceLengths);
+    header->numberOfLiteralLengthCodes = DEFLATE_LITERAL_LENGTH_CODES;
+    while (header->numberOfLiteralLengthCodes > 257 && header->literalLengthLengths[header->numberOfLiteralLengthCodes - 1] == 0)
+    {
+        --header->numberOfLiteralLengthCodes;
+    }
+    header->numberOfDistanceCodes = DEFLATE_DISTANCE_CODES;
+    while (header->numberOfDistanceCodes > 1 && header->distanceLengths[header->numberOfDistanceCodes - 1] == 0)
+    {
+        --header->numberOfDistanceCodes;
+    }
+    //the two sets of lengths are run length encoded as one list
+    memcpy(allLengths, header->literalLengthLengths, header->numberOfLiteralLengthCodes);
+    memcpy(&allLengths[header->numberOfLiteralLengthCodes], header->distanceLengths, header->numberOfDistanceCodes);
+    numberOfLengths = header->numberOfLiteralLengthCodes + header->numberOfDistanceCodes;
+    for (uint16_t lengthIter = 0; lengthIter < numberOfLengths;)
+    {
+        uint8_t length = allLengths[lengthIter];
+        uint16_t runLength = 1;
+        while (lengthIter + runLength < numberOfLengths && allLengths[lengthIter + runLength] == length)
+        {
+            ++runLength;
+        }
+        lengthIter += runLength;
+        if (length == 0)
+        {
+            while (runLength >= 11)
+            {
+                uint16_t repeat = M_Min(runLength, 138);
+                add_Code_Length_Symbol(header, 18, (uint8_t)(repeat - 11));
+                runLength -= repeat;
+            }
+            if (runLength >= 3)
+            {
+                add_Code_Length_Symbol(header, 17, (uint8_t)(runLength - 3));
+                runLength = 0;
+            }
+        }
+        else
+        {
+            //the first one has to be sent before it can be repeated
+            add_Code_Length_Symbol(header, length, 0);
+            --runLength;
+            while (runLength >= 3)
+            {
+                uint16_t repeat = M_Min(runLength, 6);
+                add_Code_Length_Symbol(header, 16, (uint8_t)(repeat - 3));
+                runLength -= repeat;
+            }
+        }
+        for (; runLength > 0; --runLength)
+        {
+            add_Code_Length_Symbol(header, length, 0);
+        }
+    }
+    for (uint16_t symbolIter = 0; symbolIter < header->numberOfSymbols; ++symbolIter)
+    {
+        ++codeLengthFrequency[header->symbols[symbolIter]];
+    }
+    build_Code_Lengths(codeLengthFrequency, DEFLATE_CODE_LENGTH_CODES, DEFLATE_MAX_CODE_LENGTH_BITS, header->codeLengthLengths);
+    build_Codes(header->codeLengthLengths, DEFLATE_CODE_LENGTH_CODES, header->codeLengthCodes);
+    header->numberOfCodeLengthCodes = DEFLATE_CODE_LENGTH_CODES;
+    while (header->numberOfCodeLengthCodes > 4 && header->codeLengthLengths[codeLengthOrder[header->numberOfCodeLengthCodes - 1]] == 0)
+    {
+        --header->numberOfCodeLengthCodes;
+    }
+}
+
+//number of bits the tokens take with these code lengths, including the extra bits and the end of block code
+static uint64_t get_Token_Bits(ptrLogCompressor compressor, const uint8_t *literalLengthLengths, const uint8_t *distanceLengths)
+{
+    uint64_t bits = 0;
+    for (uint16_t symbolIter = 0; symbolIter < DEFLATE_LITERAL_LENGTH_CODES; ++symbolIter)
+    {
+        bits += (uint64_t)compressor->literalLengthFrequency[symbolIter] * literalLengthLengths[symbolIter];
+        if (symbolIter > DEFLATE_END_OF_BLOCK)
+        {
+            bits += (uint64_t)compressor->literalLengthFrequency[symbolIter] * lengthExtraBits[symbolIter - 257];
+        }
+    }
+    for (uint16_t symbolIter = 0; symbolIter < DEFLATE_DISTANCE_CODES; ++symbolIter)
+    {
+        bits += (uint64_t)compressor->distanceFrequency[symbolIter] * (distanceLengths[symbolIter] + distanceExtraBits[symbolIter]);
+    }
+    return bits;
+}
+
+static uint64_t get_Code_Length_Header_Bits(codeLengthHeader *header)
+{
+    uint64_t bits = 5 + 5 + 4 + (3 * (uint64_t)header->numberOfCodeLengthCodes);
+    for (uint16_t symbolIter = 0; symbolIter < header->numberOfSymbols; ++symbolIter)
+    {
+        bits += (uint64_t)header->codeLengthLengths[header->symbols[symbolIter]] + codeLengthExtraBits[header->symbols[symbolIter]];
+    }
+    return bits;
+}
+
+static void put_Tokens(ptrLogCompressor compressor, bitWriter *writer, const uint8_t *literalLengthLengths, const uint16_t *literalLengthCodes, const uint8_t *distanceLengths, const uint16_t *distanceCodes)
+{
+    for (uint32_t tokenIter = 0; tokenIter < compressor->numberOfTokens && !writer->overflow; ++tokenIter)
+    {
+        uint32_t lengthOrLiteral = compressor->tokenLength[tokenIter];
+        uint32_t distance = compressor->tokenDistance[tokenIter];
+        if (distance == 0)
+        {
+            put_Bits(writer, literalLengthCodes[lengthOrLiteral], literalLengthLengths[lengthOrLiteral]);
+        }
+        else
+        {
+            uint8_t lengthCode = get_Length_Code(lengthOrLiteral);
+            uint8_t distanceCode = get_Distance_Code(distance);
+            put_Bits(writer, literalLengthCodes[257 + lengthCode], literalLengthLengths[257 + lengthCode]);
+            put_Bits(writer, lengthOrLiteral - lengthBase[lengthCode], lengthExtraBits[lengthCode]);
+            put_Bits(writer, distanceCodes[distanceCode], distanceLengths[distanceCode]);
+            put_Bits(writer, distance - distanceBase[distanceCode], distanceExtraBits[distanceCode]);
+        }
+    }
+    put_Bits(writer, literalLengthCodes[DEFLATE_END_OF_BLOCK], literalLengthLengths[DEFLATE_END_OF_BLOCK]);
+}
+
+//Writes a block as one final deflate block, whichever of stored, fixed or dynamic Huffman codes is smallest.
+//Returns the deflate length, or 0 if it did not fit in outputLength.
+static uint32_t deflate_Block(ptrLogCompressor compressor, const uint8_t *block, uint32_t blockLength, uint8_t *output, uint32_t outputLength)
+{
+    bitWriter writer;
+    codeLengthHeader dynamicHeader;
+    uint8_t fixedLiteralLengthLengths[DEFLATE_FIXED_LITERAL_LENGTH_CODES] = { 0 };
+    uint8_t fixedDistanceLengths[DEFLATE_DISTANCE_CODES] = { 0 };
+    uint16_t literalLengthCodes[DEFLATE_FIXED_LITERAL_LENGTH_CODES] = { 0 };
+    uint16_t distanceCodes[DEFLATE_DISTANCE_CODES] = { 0 };
+    memset(&writer, 0, sizeof(bitWriter));
+    writer.output = output;
+    writer.outputLength = outputLength;
+    find_Block_Matches(compressor, block, blockLength);
+    build_Code_Length_Header(compressor, &dynamicHeader);
+    get_Fixed_Code_Lengths(fixedLiteralLengthLengths, fixedDistanceLengths);
+    uint64_t storedBits = 3 + 7 + 32 + (8 * (uint64_t)blockLength);//header, worst case padding to a byte, LEN and NLEN, then the data
+    uint64_t fixedBits = 3 + get_Token_Bits(compressor, fixedLiteralLengthLengths, fixedDistanceLengths);
+    uint64_t dynamicBits = 3 + get_Code_Length_Header_Bits(&dynamicHeader) + get_Token_Bits(compressor, dynamicHeader.literalLengthLengths, dynamicHeader.distanceLengths);
+    if (dynamicBits < fixedBits && dynamicBits < storedBits)
+    {
+        put_Bits(&writer, 1, 1);//final block
+        put_Bits(&writer, DEFLATE_DYNAMIC_BLOCK, 2);
+        put_Bits(&writer, dynamicHeader.numberOfLiteralLengthCodes - 257, 5);
+        put_Bits(&writer, dynamicHeader.numberOfDistanceCodes - 1, 5);
+        put_Bits(&writer, dynamicHeader.numberOfCodeLengthCodes - 4, 4);
+        for (uint16_t codeIter = 0; codeIter < dynamicHeader.numberOfCodeLengthCodes; ++codeIter)
+        {
+            put_Bits(&writer, dynamicHeader.codeLengthLengths[codeLengthOrder[codeIter]], 3);
+        }
+        for (uint16_t symbolIter = 0; symbolIter < dynamicHeader.numberOfSymbols; ++symbolIter)
+        {
+            uint8_t symbol = dynamicHeader.symbols[symbolIter];
+            put_Bits(&writer, dynamicHeader.codeLengthCodes[symbol], dynamicHeader.codeLengthLengths[symbol]);
+            put_Bits(&writer, dynamicHeader.symbolExtra[symbolIter], codeLengthExtraBits[symbol]);
+        }
+        build_Codes(dynamicHeader.literalLengthLengths, DEFLATE_LITERAL_LENGTH_CODES, literalLengthCodes);
+        build_Codes(dynamicHeader.distanceLengths, DEFLATE_DISTANCE_CODES, distanceCodes);
+        put_Tokens(compressor, &writer, dynamicHeader.literalLengthLengths, literalLengthCodes, dynamicHeader.distanceLengths, distanceCodes);
+    }
+    else if (fixedBits < storedBits)
+    {
+        put_Bits(&writer, 1, 1);
+        put_Bits(&writer, DEFLATE_FIXED_BLOCK, 2);
+        build_Codes(fixedLiteralLengthLengths, DEFLATE_FIXED_LITERAL_LENGTH_CODES, literalLengthCodes);
+        build_Codes(fixedDistanceLengths, DEFLATE_DISTANCE_CODES, distanceCodes);
+        put_Tokens(compressor, &writer, fixedLiteralLengthLengths, literalLengthCodes, fixedDistanceLengths, distanceCodes);
+    }
+    else
+    {
+        //didn't get any smaller. LOG_COMPRESSION_BLOCK_SIZE fits in one stored block.
+        put_Bits(&writer, 1, 1);
+        put_Bits(&writer, DEFLATE_STORED_BLOCK, 2);
+        flush_Bits(&writer);
+        put_Bits(&writer, blockLength, 16);
+        put_Bits(&writer, ~blockLength & UINT16_MAX, 16);
+        if (writer.outputLength - writer.offset < blockLength)
+        {
+            return 0;
+        }
+        memcpy(&writer.output[writer.offset], block, blockLength);
+        writer.offset += blockLength;
+    }
+    flush_Bits(&writer);
+    return writer.overflow ? 0 : writer.offset;
+}
+
+int create_Log_Compressor(ptrLogCompressor *compressor)
+{
+    if (!compressor)
+    {
+        return BAD_PARAMETER;
+    }
+    *compressor = (ptrLogCompressor)calloc(1, sizeof(logCompressor));
+    if (!*compressor)
+    {
+        return MEMORY_FAILURE;
+    }
+    return SUCCESS;
+}
+
+void free_Log_Compressor(ptrLogCompressor *compressor)
+{
+    if (compressor)
+    {
+        safe_Free(*compressor);
+    }
+}
+
+uint32_t compress_Log_Block(ptrLogCompressor compressor, const uint8_t *block, uint32_t blockLength, uint8_t *member)
+{
+    uint32_t deflateLength = 0;
+    uint32_t memberLength = 0;
+    if (!compressor || !member || (!block && blockLength > 0) || blockLength > LOG_COMPRESSION_BLOCK_SIZE)
+    {
+        return 0;
+    }
+    member[0] = GZIP_ID1;
+    member[1] = GZIP_ID2;
+    member[2] = GZIP_CM_DEFLATE;
+    member[3] = GZIP_FLG_FEXTRA;
+    put_Le_Value(&member[4], 0);//no modification time
+    member[8] = 0;//extra flags
+    member[9] = GZIP_OS_UNKNOWN;
+    member[10] = M_Byte0(BGZF_EXTRA_LENGTH);
+    member[11] = M_Byte1(BGZF_EXTRA_LENGTH);
+    member[12] = BGZF_SUBFIELD_ID1;
+    member[13] = BGZF_SUBFIELD_ID2;
+    member[14] = 2;//subfield length
+    member[15] = 0;
+    deflateLength = deflate_Block(compressor, block, blockLength, &member[GZIP_HEADER_LENGTH], LOG_COMPRESSION_MAX_MEMBER_LENGTH - GZIP_HEADER_LENGTH - GZIP_TRAILER_LENGTH);
+    if (deflateLength == 0)
+    {
+        return 0;
+    }
+    memberLength = GZIP_HEADER_LENGTH + deflateLength + GZIP_TRAILER_LENGTH;
+    //BSIZE is the member length - 1
+    member[16] = M_Byte0(memberLength - 1);
+    member[17] = M_Byte1(memberLength - 1);
+    put_Le_Value(&member[GZIP_HEADER_LENGTH + deflateLength], update_Gzip_CRC(0, block, blockLength));
+    put_Le_Value(&member[GZIP_HEADER_LENGTH + deflateLength + 4], blockLength);
+    return memberLength;
+}
+
+const uint8_t* get_Log_Compression_End_Marker(void)
+{
+    return bgzfEndMarker;
+}
+
+int compress_Log(const uint8_t *logData, uint32_t logLength, uint8_t **compressedLog, uint32_t *compressedLength)
+{
+    int ret = SUCCESS;
+    uint32_t numberOfBlocks = 0;
+    uint64_t maximumLength = 0;
+    uint8_t *output = NULL;
+    uint32_t outputOffset = 0;
+    ptrLogCompressor compressor = NULL;
+    if ((!logData && logLength > 0) || !compressedLog || !compressedLength)
+    {
+        return BAD_PARAMETER;
+    }
+    numberOfBlocks = (logLength + LOG_COMPRESSION_BLOCK_SIZE - 1) / LOG_COMPRESSION_BLOCK_SIZE;
+    //a block that doesn't get smaller is a stored deflate block, which always fits in a member
+    maximumLength = ((uint64_t)numberOfBlocks * LOG_COMPRESSION_MAX_MEMBER_LENGTH) + LOG_COMPRESSION_END_MARKER_LENGTH;
+    if (maximumLength > UINT32_MAX)
+    {
+        return BAD_PARAMETER;
+    }
+    output = (uint8_t*)malloc((size_t)maximumLength);
+    if (!output)
+    {
+        return MEMORY_FAILURE;
+    }
+    ret = create_Log_Compressor(&compressor);
+    if (ret != SUCCESS)
+    {
+        safe_Free(output);
+        return ret;
+    }
+    for (uint32_t blockIter = 0; blockIter < numberOfBlocks; ++blockIter)
+    {
+        uint32_t blockOffset = blockIter * LOG_COMPRESSION_BLOCK_SIZE;
+        uint32_t blockLength = M_Min(LOG_COMPRESSION_BLOCK_SIZE, logLength - blockOffset);
+        uint32_t memberLength = compress_Log_Block(compressor, &logData[blockOffset], blockLength, &output[outputOffset]);
+        if (memberLength == 0)
+        {
+            ret = FAILURE;
+            break;
+        }
+        outputOffset += memberLength;
+    }
+    free_Log_Compressor(&compressor);
+    if (ret != SUCCESS)
+    {
+        safe_Free(output);
+        return ret;
+    }
+    memcpy(&output[outputOffset], bgzfEndMarker, LOG_COMPRESSION_END_MARKER_LENGTH);
+    outputOffset += LOG_COMPRESSION_END_MARKER_LENGTH;
+    *compressedLog = output;
+    *compressedLength = outputOffset;
+    return SUCCESS;
+}
+
+//-----------------------------------------------------------------------------
+// decompression
+//-----------------------------------------------------------------------------
+
+typedef struct _bitReader
+{
+    const uint8_t *input;
+    uint32_t inputLength;
+    uint32_t offset;
+    uint32_t bits;
+    uint32_t bitCount;
+    bool overrun;
+}bitReader;
+
+static uint32_t get_Bits(bitReader *reader, uint32_t count)
+{
+    uint32_t value = 0;
+    while (reader->bitCount < count)
+    {
+        if (reader->offset >= reader->inputLength)
+        {
+            reader->overrun = true;
+            return 0;
+        }
+        reader->bits |= (uint32_t)reader->input[reader->offset++] << reader->bitCount;
+        reader->bitCount += 8;
+    }
+    value = reader->bits & ((UINT32_C(1) << count) - 1);
+    reader->bits >>= count;
+    reader->bitCount -= count;
+    return value;
+}
+
+typedef struct _huffmanTable
+{
+    uint16_t lengthCount[DEFLATE_MAX_CODE_BITS + 1];
+    uint16_t symbols[DEFLATE_FIXED_LITERAL_LENGTH_CODES];//ordered by code
+}huffmanTable;
+
+//returns false when the lengths describe more codes than fit in the bits (an incomplete set is allowed)
+static bool build_Huffman_Table(huffmanTable *table, const uint8_t *lengths, uint16_t numberOfSymbols)
+{
+    uint16_t offsets[DEFLATE_MAX_CODE_BITS + 1] = { 0 };
+    int32_t codesLeft = 1;
+    memset(table, 0, sizeof(huffmanTable));
+    for (uint16_t symbolIter = 0; symbolIter < numberOfSymbols; ++symbolIter)
+    {
+        ++table->lengthCount[lengths[symbolIter]];
+    }
+    for (uint8_t bits = 1; bits <= DEFLATE_MAX_CODE_BITS; ++bits)
+    {
+        codesLeft = (codesLeft * 2) - table->lengthCount[bits];
+        if (codesLeft < 0)
+        {
+            return false;
+        }
+    }
+    for (uint8_t bits = 1; bits < DEFLATE_MAX_CODE_BITS; ++bits)
+    {
+        offsets[bits + 1] = offsets[bits] + table->lengthCount[bits];
+    }
+    for (uint16_t symbolIter = 0; symbolIter < numberOfSymbols; ++symbolIter)
+    {
+        if (lengths[symbolIter] > 0)
+        {
+            table->symbols[offsets[lengths[symbolIter]]++] = symbolIter;
+        }
+    }
+    return true;
+}
+
+//returns the next symbol, or -1 if the input ran out or the code isn't in the table
+static int32_t decode_Symbol(bitReader *reader, const huffmanTable *table)
+{
+    int32_t code = 0;
+    int32_t first = 0;
+    int32_t index = 0;
+    for (uint8_t bits = 1; bits <= DEFLATE_MAX_CODE_BITS; ++bits)
+    {
+        code |= (int32_t)get_Bits(reader, 1);
+        if (reader->overrun)
+        {
+            return -1;
+        }
+        int32_t count = table->lengthCount[bits];
+        if (code - count < first)
+        {
+            return table->symbols[index + (code - first)];
+        }
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+    return -1;
+}
+
+static bool read_Dynamic_Tables(bitReader *reader, huffmanTable *literalLengthTable, huffmanTable *distanceTable)
+{
+    uint8_t lengths[DEFLATE_LITERAL_LENGTH_CODES + DEFLATE_DISTANCE_CODES] = { 0 };
+    uint8_t codeLengthLengths[DEFLATE_CODE_LENGTH_CODES] = { 0 };
+    huffmanTable codeLengthTable;
+    uint16_t numberOfLiteralLengthCodes = (uint16_t)get_Bits(reader, 5) + 257;
+    uint16_t numberOfDistanceCodes = (uint16_t)get_Bits(reader, 5) + 1;
+    uint16_t numberOfCodeLengthCodes = (uint16_t)get_Bits(reader, 4) + 4;
+    uint16_t numberOfLengths = numberOfLiteralLengthCodes + numberOfDistanceCodes;
+    if (numberOfLiteralLengthCodes > DEFLATE_LITERAL_LENGTH_CODES || numberOfDistanceCodes > DEFLATE_DISTANCE_CODES)
+    {
+        return false;
+    }
+    for (uint16_t codeIter = 0; codeIter < numberOfCodeLengthCodes; ++codeIter)
+    {
+        codeLengthLengths[codeLengthOrder[codeIter]] = (uint8_t)get_Bits(reader, 3);
+    }
+    if (reader->overrun || !build_Huffman_Table(&codeLengthTable, codeLengthLengths, DEFLATE_CODE_LENGTH_CODES))
+    {
+        return false;
+    }
+    for (uint16_t lengthIter = 0; lengthIter < numberOfLengths;)
+    {
+        int32_t symbol = decode_Symbol(reader, &codeLengthTable);
+        uint8_t repeatLength = 0;
+        uint32_t repeat = 0;
+        if (symbol < 0)
+        {
+            return false;
+        }
+        if (symbol < 16)
+        {
+            lengths[lengthIter++] = (uint8_t)symbol;
+            continue;
+        }
+        if (symbol == 16)
+        {
+            if (lengthIter == 0)
+            {
+                return false;//nothing to repeat
+            }
+            repeatLength = lengths[lengthIter - 1];
+            repeat = 3 + get_Bits(reader, 2);
+        }
+        else if (symbol == 17)
+        {
+            repeat = 3 + get_Bits(reader, 3);
+        }
+        else
+        {
+            repeat = 11 + get_Bits(reader, 7);
+        }
+        if (reader->overrun || lengthIter + repeat > numberOfLengths)
+        {
+            return false;
+        }
+        for (; repeat > 0; --repeat)
+        {
+            lengths[lengthIter++] = repeatLength;
+        }
+    }
+    if (lengths[DEFLATE_END_OF_BLOCK] == 0)
+    {
+        return false;//a block that can't end
+    }
+    return build_Huffman_Table(literalLengthTable, lengths, numberOfLiteralLengthCodes) && build_Huffman_Table(distanceTable, &lengths[numberOfLiteralLengthCodes], numberOfDistanceCodes);
+}
+
+static bool inflate_Codes(bitReader *reader, const huffmanTable *literalLengthTable, const huffmanTable *distanceTable, uint8_t *output, uint32_t outputLength, uint32_t *outputOffset)
+{
+    while (true)
+    {
+        int32_t symbol = decode_Symbol(reader, literalLengthTable);
+        if (symbol < 0)
+        {
+            return false;
+        }
+        if (symbol < DEFLATE_END_OF_BLOCK)
+        {
+            if (*outputOffset >= outputLength)
+            {
+                return false;
+            }
+            output[(*outputOffset)++] = (uint8_t)symbol;
+        }
+        else if (symbol == DEFLATE_END_OF_BLOCK)
+        {
+            return true;
+        }
+        else
+        {
+            symbol -= 257;
+            if (symbol >= 29)
+            {
+                return false;
+            }
+            uint32_t matchLength = lengthBase[symbol] + get_Bits(reader, lengthExtraBits[symbol]);
+            int32_t distanceSymbol = decode_Symbol(reader, distanceTable);
+            if (distanceSymbol < 0 || distanceSymbol >= DEFLATE_DISTANCE_CODES)
+            {
+                return false;
+            }
+            uint32_t distance = distanceBase[distanceSymbol] + get_Bits(reader, distanceExtraBits[distanceSymbol]);
+            if (reader->overrun || distance > *outputOffset || matchLength > outputLength - *outputOffset)
+            {
+                return false;
+            }
+            //byte at a time since the match can overlap what it is copying
+            for (uint32_t matchIter = 0; matchIter < matchLength; ++matchIter, ++(*outputOffset))
+            {
+                output[*outputOffset] = output[*outputOffset - distance];
+            }
+        }
+    }
+}
+
+//inflates a raw deflate stream that must decompress to exactly outputLength bytes
+static int inflate_Block(const uint8_t *input, uint32_t inputLength, uint8_t *output, uint32_t outputLength)
+{
+    bitReader reader;
+    huffmanTable literalLengthTable;
+    huffmanTable distanceTable;
+    uint32_t outputOffset = 0;
+    bool finalBlock = false;
+    memset(&reader, 0, sizeof(bitReader));
+    reader.input = input;
+    reader.inputLength = inputLength;
+    while (!finalBlock)
+    {
+        finalBlock = get_Bits(&reader, 1) == 1;
+        uint32_t blockType = get_Bits(&reader, 2);
+        if (reader.overrun)
+        {
+            return FAILURE;
+        }
+        if (blockType == DEFLATE_STORED_BLOCK)
+        {
+            //the rest of the current byte is padding. get_Bits never holds a whole unused byte, so dropping the held bits lines up on the next byte
+            reader.bits = 0;
+            reader.bitCount = 0;
+            if (reader.inputLength - reader.offset < 4)
+            {
+                return FAILURE;
+            }
+            uint16_t storedLength = M_BytesTo2ByteValue(reader.input[reader.offset + 1], reader.input[reader.offset]);
+            uint16_t storedLengthComplement = M_BytesTo2ByteValue(reader.input[reader.offset + 3], reader.input[reader.offset + 2]);
+            reader.offset += 4;
+            if ((storedLength ^ storedLengthComplement) != UINT16_MAX || reader.inputLength - reader.offset < storedLength || outputLength - outputOffset < storedLength)
+            {
+                return FAILURE;
+            }
+            memcpy(&output[outputOffset], &reader.input[reader.offset], storedLength);
+            reader.offset += storedLength;
+            outputOffset += storedLength;
+        }
+        else if (blockType == DEFLATE_FIXED_BLOCK)
+        {
+            uint8_t fixedLiteralLengthLengths[DEFLATE_FIXED_LITERAL_LENGTH_CODES] = { 0 };
+            uint8_t fixedDistanceLengths[DEFLATE_DISTANCE_CODES] = { 0 };
+            get_Fixed_Code_Lengths(fixedLiteralLengthLengths, fixedDistanceLengths);
+            build_Huffman_Table(&literalLengthTable, fixedLiteralLengthLengths, DEFLATE_FIXED_LITERAL_LENGTH_CODES);
+            build_Huffman_Table(&distanceTable, fixedDistanceLengths, DEFLATE_DISTANCE_CODES);
+            if (!inflate_Codes(&reader, &literalLengthTable, &distanceTable, output, outputLength, &outputOffset))
+            {
+                return FAILURE;
+            }
+        }
+        else if (blockType == DEFLATE_DYNAMIC_BLOCK)
+        {
+            if (!read_Dynamic_Tables(&reader, &literalLengthTable, &distanceTable) || !inflate_Codes(&reader, &literalLengthTable, &distanceTable, output, outputLength, &outputOffset))
+            {
+                return FAILURE;
+            }
+        }
+        else
+        {
+            return FAILURE;
+        }
+    }
+    return outputOffset == outputLength ? SUCCESS : FAILURE;
+}
+
+//checks the gzip header of a member and finds its length from the BGZF extra field
+static bool get_Member_Layout(const uint8_t *member, uint32_t availableLength, uint32_t *headerLength, uint32_t *memberLength)
+{
+    uint32_t extraLength = 0;
+    if (availableLength < GZIP_HEADER_LENGTH + GZIP_TRAILER_LENGTH || member[0] != GZIP_ID1 || member[1] != GZIP_ID2 || member[2] != GZIP_CM_DEFLATE || member[3] != GZIP_FLG_FEXTRA)
+    {
+        return false;
+    }
+    extraLength = M_BytesTo2ByteValue(member[11], member[10]);
+    *headerLength = 12 + extraLength;
+    if (*headerLength + GZIP_TRAILER_LENGTH > availableLength)
+    {
+        return false;
+    }
+    //other subfields are allowed, the BC one holds the member length
+    for (uint32_t subfieldOffset = 12; subfieldOffset + 4 <= *headerLength;)
+    {
+        uint16_t subfieldLength = M_BytesTo2ByteValue(member[subfieldOffset + 3], member[subfieldOffset + 2]);
+        if (member[subfieldOffset] == BGZF_SUBFIELD_ID1 && member[subfieldOffset + 1] == BGZF_SUBFIELD_ID2 && subfieldLength == 2 && subfieldOffset + 6 <= *headerLength)
+        {
+            *memberLength = (uint32_t)M_BytesTo2ByteValue(member[subfieldOffset + 5], member[subfieldOffset + 4]) + 1;
+            return *memberLength >= *headerLength + GZIP_TRAILER_LENGTH && *memberLength <= availableLength;
+        }
+        subfieldOffset += 4 + subfieldLength;
+    }
+    return false;
+}
+
+int decompress_Log_Range(const uint8_t *compressedLog, uint32_t compressedLength, uint32_t logLength, uint32_t offset, uint8_t *ptrData, uint32_t dataLength)
+{
+    int ret = SUCCESS;
+    uint32_t memberOffset = 0;//where the current member is in the compressed log
+    uint32_t blockStart = 0;//where the current member's data is in the log
+    uint8_t *block = NULL;
+    if (!compressedLog || (!ptrData && dataLength > 0) || offset > logLength || dataLength > (logLength - offset))
+    {
+        return BAD_PARAMETER;
+    }
+    block = (uint8_t*)malloc(LOG_COMPRESSION_MAX_MEMBER_LENGTH);
+    if (!block)
+    {
+        return MEMORY_FAILURE;
+    }
+    while (dataLength > 0 && ret == SUCCESS)
+    {
+        uint32_t headerLength = 0;
+        uint32_t memberLength = 0;
+        if (!get_Member_Layout(&compressedLog[memberOffset], compressedLength - memberOffset, &headerLength, &memberLength))
+        {
+            ret = FAILURE;
+            break;
+        }
+        uint32_t blockLength = get_Le_Value(&compressedLog[memberOffset + memberLength - 4]);
+        if (blockLength > LOG_COMPRESSION_MAX_MEMBER_LENGTH || blockLength > logLength - blockStart)
+        {
+            ret = FAILURE;
+            break;
+        }
+        if (offset < blockStart + blockLength)
+        {
+            //this member holds some of the requested data
+            uint32_t copyOffset = offset - blockStart;
+            uint32_t copyLength = M_Min(dataLength, blockLength - copyOffset);
+            ret = inflate_Block(&compressedLog[memberOffset + headerLength], memberLength - headerLength - GZIP_TRAILER_LENGTH, block, blockLength);
+            if (ret == SUCCESS && update_Gzip_CRC(0, block, blockLength) != get_Le_Value(&compressedLog[memberOffset + memberLength - GZIP_TRAILER_LENGTH]))
+            {
+                ret = FAILURE;
+            }
+            if (ret == SUCCESS)
+            {
+                memcpy(ptrData, &block[copyOffset], copyLength);
+                ptrData += copyLength;
+                offset += copyLength;
+                dataLength -= copyLength;
+            }
+        }
+        blockStart += blockLength;
+        memberOffset += memberLength;
+    }
+    safe_Free(block);
+    return ret;
+}
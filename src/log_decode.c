@@ -0,0 +1,366 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file log_decode.c
+// \brief This file defines the functions for decoding raw ATA logs and SCSI log pages into records
+
+#include "operations_Common.h"
+#include "log_decode.h"
+#include "device_statistics.h"
+
+#define SATA_PHY_EVENT_COUNTERS_END 508 //last 4 bytes of the page are reserved and the checksum
+#define LOG_RECORD_PRINT_DATA_BYTES 16 //most bytes of a record without a value to print on its line
+
+typedef int (*logDecoder)(const uint8_t *logData, uint32_t logLength, logRecordCallback callback, void *callbackData);
+
+typedef struct _logDecoderEntry
+{
+    eLogDecodeType logType;
+    uint8_t logAddress;//ATA log address. Not used for SCSI since every log page is made of log parameters
+    logDecoder decoder;
+}logDecoderEntry;
+
+typedef struct _namedIdentifier
+{
+    uint16_t identifier;
+    const char *name;
+}namedIdentifier;
+
+typedef struct _scsiParameterName
+{
+    uint8_t pageCode;
+    uint8_t subpageCode;
+    uint16_t firstParameterCode;
+    uint16_t lastParameterCode;
+    const char *name;
+}scsiParameterName;
+
+//SATA 3.x phy event counter identifiers (bits 11:0 of the counter ID)
+static const namedIdentifier sataPhyEventCounterNames[] = {
+    { 0x001, "Command Failed With ICRC Error" },
+    { 0x002, "R_ERR Response For Data FIS" },
+    { 0x003, "R_ERR Response For Device-to-Host Data FIS" },
+    { 0x004, "R_ERR Response For Host-to-Device Data FIS" },
+    { 0x005, "R_ERR Response For Non-Data FIS" },
+    { 0x006, "R_ERR Response For Device-to-Host Non-Data FIS" },
+    { 0x007, "R_ERR Response For Host-to-Device Non-Data FIS" },
+    { 0x008, "Device-to-Host Non-Data FIS Retries" },
+    { 0x009, "Transitions From PhyRdy To PhyNRdy" },
+    { 0x00A, "Register Device-to-Host FISes Sent Due To COMRESET" },
+    { 0x00B, "CRC Errors Within Host-to-Device FIS" },
+    { 0x00D, "Non-CRC Errors Within Host-to-Device FIS" },
+    { 0x00F, "R_ERR Response For Host-to-Device Data FIS, CRC" },
+    { 0x010, "R_ERR Response For Host-to-Device Data FIS, Non-CRC" },
+    { 0x012, "R_ERR Response For Host-to-Device Non-Data FIS, CRC" },
+    { 0x013, "R_ERR Response For Host-to-Device Non-Data FIS, Non-CRC" }
+};
+
+//parameters that are not device statistics, so they are not in the device statistics tables
+static const scsiParameterName scsiParameterNames[] = {
+    { LP_SELF_TEST_RESULTS, 0, 0x0001, 0x0014, "Self-Test Result" },
+    { LP_INFORMATION_EXCEPTIONS, 0, 0x0000, 0x0000, "Informational Exceptions General" }
+};
+
+static uint64_t get_Le_Bytes_Value(const uint8_t *ptrData, uint8_t numberOfBytes)
+{
+    uint64_t value = 0;
+    while (numberOfBytes > 0)
+    {
+        --numberOfBytes;
+        value = (value << 8) | ptrData[numberOfBytes];
+    }
+    return value;
+}
+
+static uint64_t get_Be_Bytes_Value(const uint8_t *ptrData, uint8_t numberOfBytes)
+{
+    uint64_t value = 0;
+    for (uint8_t byteIter = 0; byteIter < numberOfBytes; ++byteIter)
+    {
+        value = (value << 8) | ptrData[byteIter];
+    }
+    return value;
+}
+
+static const char* find_Named_Identifier(const namedIdentifier *names, size_t numberOfNames, uint16_t identifier)
+{
+    for (size_t iter = 0; iter < numberOfNames; ++iter)
+    {
+        if (names[iter].identifier == identifier)
+        {
+            return names[iter].name;
+        }
+    }
+    return NULL;
+}
+
+//Device statistics log: each page is 512 bytes. Qword 0 is the page header (byte 2 = page number) and every other qword is a statistic.
+//Bit 63 = supported, bit 62 = value valid, and the value is in the low bytes.
+static int decode_ATA_Device_Statistics(const uint8_t *logData, uint32_t logLength, logRecordCallback callback, void *callbackData)
+{
+    for (uint32_t pageOffset = 0; pageOffset + LEGACY_DRIVE_SEC_SIZE <= logLength; pageOffset += LEGACY_DRIVE_SEC_SIZE)
+    {
+        uint8_t pageNumber = logData[pageOffset + 2];
+        if (pageNumber == ATA_DEVICE_STATS_LOG_LIST)
+        {
+            //list of supported pages. Every page that is in the log is decoded below anyways
+            continue;
+        }
+        for (uint16_t statisticOffset = 8; statisticOffset < LEGACY_DRIVE_SEC_SIZE; statisticOffset += 8)
+        {
+            const uint8_t *statistic = &logData[pageOffset + statisticOffset];
+            if (!(statistic[7] & BIT7))//supported
+            {
+                continue;
+            }
+            logRecord record;
+            statisticDescription description;
+            memset(&record, 0, sizeof(logRecord));
+            record.page = pageNumber;
+            record.identifier = statisticOffset;
+            record.flags = statistic[7];
+            record.offset = pageOffset + statisticOffset;
+            record.data = statistic;
+            record.length = 8;
+            record.valueValid = (statistic[7] & BIT6) != 0;
+            if (describe_ATA_Statistic(pageNumber, statisticOffset, &description))
+            {
+                record.name = description.name;
+                record.unit = description.unit;
+                record.value = get_Le_Bytes_Value(statistic, description.valueLength);
+            }
+            else
+            {
+                //vendor specific page, or a statistic newer than this code
+                record.value = get_Le_Bytes_Value(statistic, 6);
+            }
+            callback(&record, callbackData);
+        }
+    }
+    return logLength % LEGACY_DRIVE_SEC_SIZE ? FAILURE : SUCCESS;
+}
+
+//SATA phy event counters log: 4 reserved bytes, then counters until an ID of 0.
+//Counter ID bits 14:12 = length of the value in words, bits 11:0 = identifier. Values are little endian.
+static int decode_SATA_Phy_Event_Counters(const uint8_t *logData, uint32_t logLength, logRecordCallback callback, void *callbackData)
+{
+    uint32_t counterOffset = 4;
+    uint32_t logEnd = M_Min(logLength, SATA_PHY_EVENT_COUNTERS_END);
+    while (counterOffset + 2 <= logEnd)
+    {
+        uint16_t counterID = (uint16_t)get_Le_Bytes_Value(&logData[counterOffset], 2);
+        uint8_t valueLength = (uint8_t)(((counterID >> 12) & 0x07) * 2);
+        if (counterID == 0)
+        {
+            return SUCCESS;
+        }
+        if (valueLength == 0 || valueLength > 8 || counterOffset + 2 + valueLength > logEnd)
+        {
+            return FAILURE;
+        }
+        logRecord record;
+        memset(&record, 0, sizeof(logRecord));
+        record.identifier = counterID & 0x0FFF;
+        record.name = find_Named_Identifier(sataPhyEventCounterNames, sizeof(sataPhyEventCounterNames) / sizeof(sataPhyEventCounterNames[0]), record.identifier);
+        record.offset = counterOffset;
+        record.data = &logData[counterOffset];
+        record.length = 2 + valueLength;
+        record.valueValid = true;
+        record.value = get_Le_Bytes_Value(&logData[counterOffset + 2], valueLength);
+        callback(&record, callbackData);
+        counterOffset += record.length;
+    }
+    return logLength < SATA_PHY_EVENT_COUNTERS_END ? FAILURE : SUCCESS;
+}
+
+//supported pages (subpage 0) is a list of page codes. Supported pages and subpages (subpage FFh) is a list of page and subpage code pairs.
+static int decode_SCSI_Supported_Pages(const uint8_t *logData, uint32_t pageEnd, logRecordCallback callback, void *callbackData)
+{
+    uint8_t entryLength = logData[1] == 0xFF ? 2 : 1;
+    uint32_t entryOffset = LOG_PAGE_HEADER_LENGTH;
+    for (; entryOffset + entryLength <= pageEnd; entryOffset += entryLength)
+    {
+        logRecord record;
+        memset(&record, 0, sizeof(logRecord));
+        record.name = "Supported Page";
+        record.page = M_GETBITRANGE(logData[0], 5, 0);
+        record.subpage = logData[1];
+        record.identifier = entryLength == 2 ? M_BytesTo2ByteValue(logData[entryOffset], logData[entryOffset + 1]) : logData[entryOffset];
+        record.offset = entryOffset;
+        record.data = &logData[entryOffset];
+        record.length = entryLength;
+        record.valueValid = true;
+        record.value = M_GETBITRANGE(logData[entryOffset], 5, 0);
+        callback(&record, callbackData);
+    }
+    return entryOffset == pageEnd ? SUCCESS : FAILURE;
+}
+
+//Every other log page is a list of log parameters: 2 byte parameter code, control byte, length, then the value.
+//Control byte bits 1:0 are the format: 00b = bounded data counter, 01b = ASCII, 10b = bounded or unbounded binary, 11b = binary list.
+static int decode_SCSI_Log_Page(const uint8_t *logData, uint32_t logLength, logRecordCallback callback, void *callbackData)
+{
+    uint8_t pageCode = 0;
+    uint8_t subpageCode = 0;
+    uint32_t pageEnd = 0;
+    uint32_t parameterOffset = LOG_PAGE_HEADER_LENGTH;
+    if (logLength < LOG_PAGE_HEADER_LENGTH)
+    {
+        return FAILURE;
+    }
+    pageCode = M_GETBITRANGE(logData[0], 5, 0);
+    subpageCode = logData[0] & BIT6 ? logData[1] : 0;//SPF bit
+    pageEnd = M_Min((uint32_t)M_BytesTo2ByteValue(logData[2], logData[3]) + LOG_PAGE_HEADER_LENGTH, logLength);
+    if (pageCode == LP_SUPPORTED_LOG_PAGES && (subpageCode == 0 || subpageCode == 0xFF))
+    {
+        return decode_SCSI_Supported_Pages(logData, pageEnd, callback, callbackData);
+    }
+    while (parameterOffset + 4 <= pageEnd)
+    {
+        const uint8_t *parameter = &logData[parameterOffset];
+        uint32_t parameterLength = (uint32_t)parameter[3] + 4;
+        statisticDescription description;
+        logRecord record;
+        if (parameterOffset + parameterLength > pageEnd)
+        {
+            return FAILURE;
+        }
+        memset(&record, 0, sizeof(logRecord));
+        memset(&description, 0, sizeof(statisticDescription));
+        record.page = pageCode;
+        record.subpage = subpageCode;
+        record.identifier = M_BytesTo2ByteValue(parameter[0], parameter[1]);
+        record.flags = parameter[2];
+        record.offset = parameterOffset;
+        record.data = parameter;
+        record.length = parameterLength;
+        if (describe_SCSI_Statistic(pageCode, subpageCode, record.identifier, &description))
+        {
+            record.name = description.name;
+            record.unit = description.unit;
+        }
+        else
+        {
+            for (size_t iter = 0; iter < sizeof(scsiParameterNames) / sizeof(scsiParameterNames[0]); ++iter)
+            {
+                if (scsiParameterNames[iter].pageCode == pageCode && scsiParameterNames[iter].subpageCode == subpageCode && record.identifier >= scsiParameterNames[iter].firstParameterCode && record.identifier <= scsiParameterNames[iter].lastParameterCode)
+                {
+                    record.name = scsiParameterNames[iter].name;
+                    break;
+                }
+            }
+            description.valueOffset = 4;
+            if (M_GETBITRANGE(parameter[2], 1, 0) == 1 || M_GETBITRANGE(parameter[2], 1, 0) == 3 || record.name)
+            {
+                //ASCII, a list, or a structure. Leave it to the caller to look at the data
+                description.valueLength = UINT8_MAX;
+            }
+        }
+        if (description.valueLength == 0)
+        {
+            switch (parameter[3])
+            {
+            case 1:
+            case 2:
+            case 4:
+            case 8:
+                description.valueLength = parameter[3];
+                break;
+            default:
+                break;
+            }
+        }
+        if (description.valueLength > 0 && description.valueLength <= 8 && (uint32_t)description.valueOffset + description.valueLength <= parameterLength)
+        {
+            record.valueValid = true;
+            record.value = get_Be_Bytes_Value(&parameter[description.valueOffset], description.valueLength);
+        }
+        callback(&record, callbackData);
+        parameterOffset += parameterLength;
+    }
+    return parameterOffset == pageEnd ? SUCCESS : FAILURE;
+}
+
+static const logDecoderEntry logDecoders[] = {
+    { LOG_DECODE_ATA_LOG, ATA_LOG_DEVICE_STATISTICS, decode_ATA_Device_Statistics },
+    { LOG_DECODE_ATA_LOG, ATA_LOG_SATA_PHY_EVENT_COUNTERS_LOG, decode_SATA_Phy_Event_Counters },
+    { LOG_DECODE_SCSI_LOG_PAGE, 0, decode_SCSI_Log_Page }
+};
+
+static logDecoder find_Log_Decoder(eLogDecodeType logType, uint8_t logAddress)
+{
+    for (size_t iter = 0; iter < sizeof(logDecoders) / sizeof(logDecoders[0]); ++iter)
+    {
+        if (logDecoders[iter].logType == logType && (logType == LOG_DECODE_SCSI_LOG_PAGE || logDecoders[iter].logAddress == logAddress))
+        {
+            return logDecoders[iter].decoder;
+        }
+    }
+    return NULL;
+}
+
+int decode_Log(eLogDecodeType logType, uint8_t logAddress, const uint8_t *logData, uint32_t logLength, logRecordCallback callback, void *callbackData)
+{
+    logDecoder decoder = find_Log_Decoder(logType, logAddress);
+    if (!logData || !callback)
+    {
+        return BAD_PARAMETER;
+    }
+    if (!decoder)
+    {
+        return NOT_SUPPORTED;
+    }
+    return decoder(logData, logLength, callback, callbackData);
+}
+
+static void print_Log_Record(const logRecord *record, void *callbackData)
+{
+    printf("%08" PRIX32 " %02" PRIX8 " %04" PRIX16 " %-55s ", record->offset, record->page, record->identifier, record->name ? record->name : "Unknown");
+    if (record->valueValid)
+    {
+        printf("%" PRIu64, record->value);
+        if (record->unit)
+        {
+            printf(" %s", record->unit);
+        }
+    }
+    else
+    {
+        for (uint32_t dataIter = 0; dataIter < M_Min(record->length, LOG_RECORD_PRINT_DATA_BYTES); ++dataIter)
+        {
+            printf("%02" PRIX8, record->data[dataIter]);
+        }
+        if (record->length > LOG_RECORD_PRINT_DATA_BYTES)
+        {
+            printf("...");
+        }
+    }
+    printf("\n");
+}
+
+int print_Decoded_Log(eLogDecodeType logType, uint8_t logAddress, const uint8_t *logData, uint32_t logLength)
+{
+    if (!logData)
+    {
+        return BAD_PARAMETER;
+    }
+    if (!find_Log_Decoder(logType, logAddress))
+    {
+        return NOT_SUPPORTED;
+    }
+    printf("%-8s %-2s %-4s %-55s %s\n", "Offset", "Pg", "ID", "Name", "Value");
+    int ret = decode_Log(logType, logAddress, logData, logLength, print_Log_Record, NULL);
+    if (ret == FAILURE)
+    {
+        printf("Log ends in the middle of a record\n");
+    }
+    return ret;
+}
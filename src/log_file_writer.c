@@ -0,0 +1,267 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file log_file_writer.c
+// \brief This file defines the functions for writing a log to a file on another thread while the next part of it is read from the drive
+
+#include "operations_Common.h"
+#include "log_file_writer.h"
+#include "log_compression.h"
+#include "worker_pool.h"
+
+struct _logFileWriter
+{
+    FILE *logFile;
+    uint32_t bufferSize;
+    uint32_t numberOfBuffers;
+    uint8_t **buffers;
+    uint32_t *lengths;
+    uint32_t fillIndex;//next buffer the caller fills
+    uint32_t writeIndex;//next buffer the writer thread writes
+    uint32_t queued;//buffers waiting to be written, including the one being written right now
+    bool done;//no more buffers will be queued
+    bool writeFailed;
+    bool threadStarted;
+    //only used when compressing. Only the writer thread touches these while it is running
+    bool compress;
+    ptrLogCompressor compressor;
+    uint8_t *compressionBlock;//data waiting for a whole LOG_COMPRESSION_BLOCK_SIZE block before it is compressed
+    uint32_t compressionBlockLength;
+    uint8_t *compressedMember;
+    workerLock lock;
+    workerCondition bufferQueued;
+    workerCondition bufferWritten;
+    workerThread thread;
+};
+
+static void write_Log_Bytes(ptrLogFileWriter writer, const uint8_t *ptrData, uint32_t length)
+{
+    if (!writer->logFile || fwrite(ptrData, sizeof(uint8_t), length, writer->logFile) != length)
+    {
+        writer->writeFailed = true;
+    }
+}
+
+static void write_Compression_Block(ptrLogFileWriter writer)
+{
+    uint32_t memberLength = compress_Log_Block(writer->compressor, writer->compressionBlock, writer->compressionBlockLength, writer->compressedMember);
+    if (memberLength == 0)
+    {
+        writer->writeFailed = true;
+    }
+    else
+    {
+        write_Log_Bytes(writer, writer->compressedMember, memberLength);
+    }
+    writer->compressionBlockLength = 0;
+}
+
+static void write_Log_Buffer(ptrLogFileWriter writer, uint32_t bufferIndex)
+{
+    const uint8_t *ptrData = writer->buffers[bufferIndex];
+    uint32_t length = writer->lengths[bufferIndex];
+    if (!writer->compress)
+    {
+        write_Log_Bytes(writer, ptrData, length);
+        return;
+    }
+    //buffers are usually smaller than a compression block, so they are gathered up until a block is full
+    while (length > 0)
+    {
+        uint32_t copyLength = M_Min(length, LOG_COMPRESSION_BLOCK_SIZE - writer->compressionBlockLength);
+        memcpy(&writer->compressionBlock[writer->compressionBlockLength], ptrData, copyLength);
+        writer->compressionBlockLength += copyLength;
+        ptrData += copyLength;
+        length -= copyLength;
+        if (writer->compressionBlockLength == LOG_COMPRESSION_BLOCK_SIZE)
+        {
+            write_Compression_Block(writer);
+        }
+    }
+}
+
+static void log_File_Writer(void *writerParameter)
+{
+    ptrLogFileWriter writer = (ptrLogFileWriter)writerParameter;
+    acquire_Worker_Lock(&writer->lock);
+    while (true)
+    {
+        while (writer->queued == 0 && !writer->done)
+        {
+            wait_Worker_Condition(&writer->bufferQueued, &writer->lock);
+        }
+        if (writer->queued == 0)
+        {
+            break;//done and nothing left to write
+        }
+        uint32_t bufferIndex = writer->writeIndex;
+        //the caller never fills a queued buffer, so this one can be written without holding the lock
+        release_Worker_Lock(&writer->lock);
+        write_Log_Buffer(writer, bufferIndex);
+        acquire_Worker_Lock(&writer->lock);
+        writer->writeIndex = (bufferIndex + 1) % writer->numberOfBuffers;
+        writer->queued--;
+        signal_Worker_Condition(&writer->bufferWritten);
+    }
+    release_Worker_Lock(&writer->lock);
+}
+
+static void free_Log_File_Writer(ptrLogFileWriter writer)
+{
+    if (writer->buffers)
+    {
+        for (uint32_t bufferIter = 0; bufferIter < writer->numberOfBuffers; ++bufferIter)
+        {
+            safe_Free(writer->buffers[bufferIter]);
+        }
+    }
+    safe_Free(writer->buffers);
+    safe_Free(writer->lengths);
+    free_Log_Compressor(&writer->compressor);
+    safe_Free(writer->compressionBlock);
+    safe_Free(writer->compressedMember);
+    safe_Free(writer);
+}
+
+int create_Log_File_Writer(FILE *logFile, uint32_t bufferSize, uint32_t numberOfBuffers, bool compress, ptrLogFileWriter *writer)
+{
+    if (!writer || bufferSize == 0)
+    {
+        return BAD_PARAMETER;
+    }
+    if (numberOfBuffers == 0)
+    {
+        numberOfBuffers = LOG_FILE_WRITER_DEFAULT_BUFFERS;
+    }
+    ptrLogFileWriter newWriter = (ptrLogFileWriter)calloc(1, sizeof(logFileWriter));
+    if (!newWriter)
+    {
+        return MEMORY_FAILURE;
+    }
+    newWriter->logFile = logFile;
+    newWriter->bufferSize = bufferSize;
+    newWriter->numberOfBuffers = numberOfBuffers;
+    newWriter->buffers = (uint8_t**)calloc(numberOfBuffers, sizeof(uint8_t*));
+    newWriter->lengths = (uint32_t*)calloc(numberOfBuffers, sizeof(uint32_t));
+    if (!newWriter->buffers || !newWriter->lengths)
+    {
+        free_Log_File_Writer(newWriter);
+        return MEMORY_FAILURE;
+    }
+    for (uint32_t bufferIter = 0; bufferIter < numberOfBuffers; ++bufferIter)
+    {
+        newWriter->buffers[bufferIter] = (uint8_t*)calloc(bufferSize, sizeof(uint8_t));
+        if (!newWriter->buffers[bufferIter])
+        {
+            free_Log_File_Writer(newWriter);
+            return MEMORY_FAILURE;
+        }
+    }
+    if (compress)
+    {
+        newWriter->compress = true;
+        newWriter->compressionBlock = (uint8_t*)malloc(LOG_COMPRESSION_BLOCK_SIZE);
+        newWriter->compressedMember = (uint8_t*)malloc(LOG_COMPRESSION_MAX_MEMBER_LENGTH);
+        if (SUCCESS != create_Log_Compressor(&newWriter->compressor) || !newWriter->compressionBlock || !newWriter->compressedMember)
+        {
+            free_Log_File_Writer(newWriter);
+            return MEMORY_FAILURE;
+        }
+    }
+    init_Worker_Lock(&newWriter->lock);
+    init_Worker_Condition(&newWriter->bufferQueued);
+    init_Worker_Condition(&newWriter->bufferWritten);
+    newWriter->threadStarted = start_Worker_Thread(&newWriter->thread, log_File_Writer, newWriter);
+    *writer = newWriter;
+    return SUCCESS;
+}
+
+void set_Log_File_Writer_File(ptrLogFileWriter writer, FILE *logFile)
+{
+    if (writer)
+    {
+        acquire_Worker_Lock(&writer->lock);
+        writer->logFile = logFile;
+        release_Worker_Lock(&writer->lock);
+    }
+}
+
+uint8_t* get_Log_File_Writer_Buffer(ptrLogFileWriter writer)
+{
+    uint8_t *buffer = NULL;
+    acquire_Worker_Lock(&writer->lock);
+    while (writer->queued == writer->numberOfBuffers)
+    {
+        wait_Worker_Condition(&writer->bufferWritten, &writer->lock);
+    }
+    buffer = writer->buffers[writer->fillIndex];
+    release_Worker_Lock(&writer->lock);
+    return buffer;
+}
+
+void queue_Log_File_Writer_Buffer(ptrLogFileWriter writer, uint32_t length)
+{
+    if (length == 0)
+    {
+        return;//the same buffer is handed out again next time
+    }
+    if (!writer->threadStarted)
+    {
+        writer->lengths[writer->fillIndex] = M_Min(length, writer->bufferSize);
+        write_Log_Buffer(writer, writer->fillIndex);
+        return;
+    }
+    acquire_Worker_Lock(&writer->lock);
+    writer->lengths[writer->fillIndex] = M_Min(length, writer->bufferSize);
+    writer->fillIndex = (writer->fillIndex + 1) % writer->numberOfBuffers;
+    writer->queued++;
+    signal_Worker_Condition(&writer->bufferQueued);
+    release_Worker_Lock(&writer->lock);
+}
+
+int finish_Log_File_Writer(ptrLogFileWriter writer)
+{
+    int ret = SUCCESS;
+    if (!writer)
+    {
+        return BAD_PARAMETER;
+    }
+    if (writer->threadStarted)
+    {
+        acquire_Worker_Lock(&writer->lock);
+        writer->done = true;
+        signal_Worker_Condition(&writer->bufferQueued);
+        release_Worker_Lock(&writer->lock);
+        join_Worker_Thread(&writer->thread);
+    }
+    destroy_Worker_Condition(&writer->bufferQueued);
+    destroy_Worker_Condition(&writer->bufferWritten);
+    destroy_Worker_Lock(&writer->lock);
+    if (writer->compress && writer->logFile)
+    {
+        //the writer thread is stopped, so the last partial block and the end marker can be written here
+        if (writer->compressionBlockLength > 0)
+        {
+            write_Compression_Block(writer);
+        }
+        write_Log_Bytes(writer, get_Log_Compression_End_Marker(), LOG_COMPRESSION_END_MARKER_LENGTH);
+    }
+    if (writer->logFile && fflush(writer->logFile) != 0)
+    {
+        writer->writeFailed = true;
+    }
+    if (writer->writeFailed)
+    {
+        ret = FAILURE;
+    }
+    free_Log_File_Writer(writer);
+    return ret;
+}
@@ -13,6 +13,100 @@
 #include "ata_helper_func.h"
 #include "scsi_helper_func.h"
 #include "operations_Common.h"
+#include "device_page_cache.h"
+#include "log_file_writer.h"
+#include "log_compression.h"
+#include "log_decode.h"
+
+//largest transfer tried when the caller doesn't give a transfer size. Drives and bridges that can't take this much are found by reduce_Device_Transfer_Size
+#define LOG_PULL_MAX_TRANSFER_SIZE (256 * 1024)
+
+//compressed log files keep their usual extension with this added, such as .bin.gz
+#define COMPRESSED_LOG_FILE_EXTENSION "gz"
+
+//returns the extension to name a log file with. compressedExtension is filled in and returned when the file is compressed.
+static const char* get_Log_File_Extension(const char *fileExtension, bool compressFile, char *compressedExtension, size_t compressedExtensionSize)
+{
+    if (!compressFile || !fileExtension)
+    {
+        return fileExtension;
+    }
+    snprintf(compressedExtension, compressedExtensionSize, "%s.%s", fileExtension, COMPRESSED_LOG_FILE_EXTENSION);
+    return compressedExtension;
+}
+
+//writes a log that is all in memory to a file, compressed as described in log_compression.h when compressFile is set
+static int write_Log_File_Data(FILE *logFile, const uint8_t *logData, uint32_t logLength, bool compressFile)
+{
+    int ret = SUCCESS;
+    uint8_t *compressedLog = NULL;
+    uint32_t compressedLength = 0;
+    if (compressFile)
+    {
+        ret = compress_Log(logData, logLength, &compressedLog, &compressedLength);
+        if (ret != SUCCESS)
+        {
+            return ret;
+        }
+        logData = compressedLog;
+        logLength = compressedLength;
+    }
+    if (fwrite(logData, sizeof(uint8_t), logLength, logFile) != logLength)
+    {
+        ret = FAILURE;
+    }
+    safe_Free(compressedLog);
+    return ret;
+}
+
+//reads from a log with read log ext. When probeTransferSize is set, a read that failed because of its size is retried with smaller transfers until one works, and dataSize is changed to the size that was read.
+static int read_Log_Ext_Chunk(tDevice *device, uint8_t logAddress, uint16_t pageNumber, uint8_t *ptrData, uint32_t *dataSize, uint16_t featureRegister, bool probeTransferSize)
+{
+    int ret = ata_Read_Log_Ext(device, logAddress, pageNumber, ptrData, *dataSize, device->drive_info.ata_Options.readLogWriteLogDMASupported, featureRegister);
+    if (probeTransferSize)
+    {
+        uint32_t retrySize = 0;
+        while (ret != SUCCESS && is_Transfer_Size_Failure(device, ret) && (retrySize = reduce_Device_Transfer_Size(device, TRANSFER_SIZE_ATA_READ_LOG_EXT, *dataSize)) > 0)
+        {
+            *dataSize = retrySize;
+            ret = ata_Read_Log_Ext(device, logAddress, pageNumber, ptrData, *dataSize, device->drive_info.ata_Options.readLogWriteLogDMASupported, featureRegister);
+        }
+        if (ret == SUCCESS)
+        {
+            confirm_Device_Transfer_Size(device, TRANSFER_SIZE_ATA_READ_LOG_EXT, *dataSize);
+        }
+    }
+    return ret;
+}
+
+static int read_Error_History_Buffer(tDevice *device, uint8_t bufferID, bool useReadBuffer16, uint64_t offset, uint8_t *ptrData, uint32_t dataSize)
+{
+    if (useReadBuffer16)
+    {
+        return scsi_Read_Buffer_16(device, 0x1C, 0, bufferID, offset, dataSize, ptrData);
+    }
+    return scsi_Read_Buffer(device, 0x1C, bufferID, (uint32_t)offset, dataSize, ptrData);
+}
+
+//reads from a buffer ID with read buffer (mode 1Ch). Retries the same way as read_Log_Ext_Chunk
+static int read_Buffer_Chunk(tDevice *device, uint8_t bufferID, bool useReadBuffer16, uint64_t offset, uint8_t *ptrData, uint32_t *dataSize, bool probeTransferSize)
+{
+    int ret = read_Error_History_Buffer(device, bufferID, useReadBuffer16, offset, ptrData, *dataSize);
+    if (probeTransferSize)
+    {
+        uint32_t retrySize = 0;
+        while (ret != SUCCESS && is_Transfer_Size_Failure(device, ret) && (retrySize = reduce_Device_Transfer_Size(device, TRANSFER_SIZE_SCSI_READ_BUFFER, *dataSize)) > 0)
+        {
+            *dataSize = retrySize;
+            ret = read_Error_History_Buffer(device, bufferID, useReadBuffer16, offset, ptrData, *dataSize);
+        }
+        if (ret == SUCCESS)
+        {
+            confirm_Device_Transfer_Size(device, TRANSFER_SIZE_SCSI_READ_BUFFER, *dataSize);
+        }
+    }
+    return ret;
+}
 
 int generate_Logfile_Name(tDevice *device, const char * const logName, const char * const logExtension,\
                            eLogFileNamingConvention logFileNamingConvention, char **logFileNameUsed)
@@ -155,21 +249,17 @@ int get_ATA_Log_Size(tDevice *device, uint8_t logAddress, uint32_t *logFileSize,
 {
     int ret = NOT_SUPPORTED;//assume the log is not supported
     bool foundInGPL = false;
+    uint8_t logBuffer[LEGACY_DRIVE_SEC_SIZE] = { 0 };
 
     #ifdef _DEBUG
     printf("%s: logAddress %d, gpl=%s, smart=%s\n",__FUNCTION__, logAddress, gpl ? "true":"false", smart ? "true":"false");
     #endif
 
-    uint8_t *logBuffer = (uint8_t*)calloc(LEGACY_DRIVE_SEC_SIZE * sizeof(uint8_t), sizeof(uint8_t));
-    if (!logBuffer)
-    {
-        return MEMORY_FAILURE;
-    }
     *logFileSize = 0;//make sure we set this to zero in case we don't find it.
     if (gpl && device->drive_info.ata_Options.generalPurposeLoggingSupported) //greater than one means check for it in the GPL directory
     {
-        //first, check to see if the log is in the GPL directory.
-		if (ata_Read_Log_Ext(device, ATA_LOG_DIRECTORY, 0, logBuffer, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0) == SUCCESS)
+        //first, check to see if the log is in the GPL directory. The directory is only read from the drive once per device.
+        if (ata_Read_Log_Directory_Cached(device, true, logBuffer, LEGACY_DRIVE_SEC_SIZE) == SUCCESS)
         {
             *logFileSize = M_BytesTo2ByteValue(logBuffer[(logAddress * 2) + 1], logBuffer[(logAddress * 2)]) * LEGACY_DRIVE_SEC_SIZE;
             if (*logFileSize > 0)
@@ -198,7 +288,7 @@ int get_ATA_Log_Size(tDevice *device, uint8_t logAddress, uint32_t *logFileSize,
             //if we already tried the GPL buffer, make sure we clean it back up before we check again just to be safe.
             memset(logBuffer, 0, LEGACY_DRIVE_SEC_SIZE);
         }
-        if (ata_SMART_Read_Log(device, 0, logBuffer, LEGACY_DRIVE_SEC_SIZE) == SUCCESS)
+        if (ata_Read_Log_Directory_Cached(device, false, logBuffer, LEGACY_DRIVE_SEC_SIZE) == SUCCESS)
         {
             *logFileSize = M_BytesTo2ByteValue(logBuffer[(logAddress * 2) + 1], logBuffer[(logAddress * 2)]) * LEGACY_DRIVE_SEC_SIZE;
             if (*logFileSize > 0)
@@ -207,7 +297,6 @@ int get_ATA_Log_Size(tDevice *device, uint8_t logAddress, uint32_t *logFileSize,
             }
         }
     }
-    safe_Free(logBuffer);
     return ret;
 }
 
@@ -285,7 +374,7 @@ int get_SCSI_VPD_Page_Size(tDevice *device, uint8_t vpdPage, uint32_t *vpdPageSi
         return MEMORY_FAILURE;
     }
     *vpdPageSize = 0;
-    if (SUCCESS == scsi_Inquiry(device, vpdBuffer, vpdBufferLength, SUPPORTED_VPD_PAGES, true, false))
+    if (SUCCESS == scsi_Inquiry_Cached(device, vpdBuffer, vpdBufferLength, SUPPORTED_VPD_PAGES, true))
     {
         //now search the returned buffer for the requested page code
         uint16_t vpdIter = SCSI_VPD_PAGE_HEADER_LENGTH;
@@ -302,7 +391,7 @@ int get_SCSI_VPD_Page_Size(tDevice *device, uint8_t vpdPage, uint32_t *vpdPageSi
         {
             memset(vpdBuffer, 0, vpdBufferLength);
             //read the page so we can see how large it is.
-            if (SUCCESS == scsi_Inquiry(device, vpdBuffer, vpdBufferLength, vpdPage, true, false))
+            if (SUCCESS == scsi_Inquiry_Cached(device, vpdBuffer, vpdBufferLength, vpdPage, true))
             {
                 *vpdPageSize = (uint32_t)(M_BytesTo2ByteValue(vpdBuffer[2], vpdBuffer[3]) + SCSI_VPD_PAGE_HEADER_LENGTH);
             }
@@ -375,15 +464,17 @@ int get_SCSI_Error_History_Size(tDevice *device, uint8_t bufferID, uint32_t *err
     return ret;
 }
 
-int get_SCSI_Error_History(tDevice *device, uint8_t bufferID, char *logName, bool createNewSnapshot, bool useReadBuffer16, \
-    char *fileExtension, bool toBuffer, uint8_t *myBuf, uint32_t bufSize, \
+static int pull_SCSI_Error_History(tDevice *device, uint8_t bufferID, char *logName, bool createNewSnapshot, bool useReadBuffer16, \
+    char *fileExtension, bool compressFile, bool toBuffer, uint8_t *myBuf, uint32_t bufSize, \
     const char * const filePath, uint32_t transferSizeBytes, char *fileNameUsed)
 {
     int ret = UNKNOWN;
     uint32_t historyLen = 0;
     char name[OPENSEA_PATH_MAX];
+    char compressedExtension[OPENSEA_PATH_MAX];
     FILE *fp_History = NULL;
     uint8_t *historyBuffer = NULL;
+    ptrLogFileWriter historyWriter = NULL;
     if (!fileNameUsed)
     {
         fileNameUsed = &name[0];
@@ -395,69 +486,79 @@ int get_SCSI_Error_History(tDevice *device, uint8_t bufferID, char *logName, boo
         //If the user wants it in a buffer...just return. 
         if ((toBuffer) && (bufSize < historyLen))
             return BAD_PARAMETER;
+        if (historyLen == 0)
+        {
+            //nothing to read, so there is nothing to save either
+            return SUCCESS;
+        }
 
-        uint32_t increment = 65536;//pulling in 64K chunks...this should be ok, but we may need to change this later!
+        uint32_t increment = 0;
+        bool probeTransferSize = transferSizeBytes == 0;
         if (transferSizeBytes != 0)
         {
             increment = transferSizeBytes;//use the user selected size (if it's non-zero)
         }
+        else
+        {
+            //use the largest size this device has taken so far. Smaller sizes are tried if it fails
+            increment = get_Device_Transfer_Size(device, TRANSFER_SIZE_SCSI_READ_BUFFER, LOG_PULL_MAX_TRANSFER_SIZE);
+        }
         if (increment > historyLen)
         {
             increment = historyLen;
         }
-        historyBuffer = (uint8_t *)calloc(increment, sizeof(uint8_t));
-
-        if (!historyBuffer)
+        if (logName && fileExtension) //Because you can also get a log file & get it in buffer. 
         {
-            if (VERBOSITY_QUIET < g_verbosity)
+            //the file is written (and compressed) on another thread while the next chunk is read
+            ret = create_Log_File_Writer(NULL, increment, 0, compressFile, &historyWriter);
+            if (ret != SUCCESS)
             {
-                perror("Calloc failure!\n");
+                return ret;
+            }
+        }
+        else
+        {
+            historyBuffer = (uint8_t *)calloc(increment, sizeof(uint8_t));
+            if (!historyBuffer)
+            {
+                if (VERBOSITY_QUIET < g_verbosity)
+                {
+                    perror("Calloc failure!\n");
+                }
+                return MEMORY_FAILURE;
             }
-            return MEMORY_FAILURE;
         }
 
         bool logFileOpened = false;
         for (uint64_t offset = 0; offset < historyLen; offset += increment)
         {
-            bool dataRetrieved = false;
+            uint8_t *chunkBuffer = historyWriter ? get_Log_File_Writer_Buffer(historyWriter) : historyBuffer;
             if ((offset + increment) > historyLen)
             {
                 //adjusting the pull size so we don't accidentally get an error from a drive that doesn't want to return more than the maximum it told is in this buffer ID.
                 increment = (uint32_t)(historyLen - offset);
             }
-            if (useReadBuffer16)
-            {
-                if (SUCCESS == scsi_Read_Buffer_16(device, 0x1C, 0, bufferID, offset, increment, historyBuffer))
-                {
-                    dataRetrieved = true;
-                }
-            }
-            else
-            {
-                if (SUCCESS == scsi_Read_Buffer(device, 0x1C, bufferID, (uint32_t)offset, increment, historyBuffer))
-                {
-                    dataRetrieved = true;
-                }
-            }
-            if (dataRetrieved)
+            //increment is changed to a smaller size if the device wouldn't take it
+            if (SUCCESS == read_Buffer_Chunk(device, bufferID, useReadBuffer16, offset, chunkBuffer, &increment, probeTransferSize))
             {
                 if (toBuffer)
                 {
-                    memcpy(&myBuf[offset], historyBuffer, increment);
+                    memcpy(&myBuf[offset], chunkBuffer, increment);
                 }
-                if (logName && fileExtension) //Because you can also get a log file & get it in buffer. 
+                if (historyWriter)
                 {
                     if (!logFileOpened)
                     {
-                        if (SUCCESS == create_And_Open_Log_File(device, &fp_History, filePath, logName, fileExtension, NAMING_SERIAL_NUMBER_DATE_TIME, &fileNameUsed))
+                        if (SUCCESS == create_And_Open_Log_File(device, &fp_History, filePath, logName, get_Log_File_Extension(fileExtension, compressFile, compressedExtension, OPENSEA_PATH_MAX), NAMING_SERIAL_NUMBER_DATE_TIME, &fileNameUsed))
                         {
                             logFileOpened = true;
+                            set_Log_File_Writer_File(historyWriter, fp_History);
                         }
                     }
                     if (logFileOpened)
                     {
                         //write the history data to a file
-                        fwrite(historyBuffer, sizeof(uint8_t), increment, fp_History);
+                        queue_Log_File_Writer_Buffer(historyWriter, increment);
                     }
                 }
             }
@@ -467,6 +568,14 @@ int get_SCSI_Error_History(tDevice *device, uint8_t bufferID, char *logName, boo
                 break;
             }
         }
+        if (historyWriter)
+        {
+            //wait for the last of the history to make it to the file
+            if (SUCCESS != finish_Log_File_Writer(historyWriter) && ret == SUCCESS && logFileOpened)
+            {
+                ret = FAILURE;
+            }
+        }
         if (logFileOpened && fp_History)
         {
             fflush(fp_History);
@@ -477,6 +586,13 @@ int get_SCSI_Error_History(tDevice *device, uint8_t bufferID, char *logName, boo
     return ret;
 }
 
+int get_SCSI_Error_History(tDevice *device, uint8_t bufferID, char *logName, bool createNewSnapshot, bool useReadBuffer16, \
+    char *fileExtension, bool toBuffer, uint8_t *myBuf, uint32_t bufSize, \
+    const char * const filePath, uint32_t transferSizeBytes, char *fileNameUsed)
+{
+    return pull_SCSI_Error_History(device, bufferID, logName, createNewSnapshot, useReadBuffer16, fileExtension, false, toBuffer, myBuf, bufSize, filePath, transferSizeBytes, fileNameUsed);
+}
+
 int get_SMART_Extended_Comprehensive_Error_Log(tDevice *device, const char * const filePath)
 {
     if (device->drive_info.drive_type == ATA_DRIVE)
@@ -661,11 +777,13 @@ int pull_SCSI_Informational_Exceptions_Log(tDevice *device, const char * const f
     }
 }
 
-int get_ATA_Log(tDevice *device, uint8_t logAddress, char *logName, char *fileExtension, bool GPL,\
+static int pull_ATA_Log(tDevice *device, uint8_t logAddress, char *logName, char *fileExtension, bool compressFile, bool GPL,\
     bool SMART, bool toBuffer, uint8_t *myBuf, uint32_t bufSize, const char * const filePath, uint32_t transferSizeBytes)
 {
     int ret = UNKNOWN;
     uint32_t logSize = 0;
+    char compressedExtension[OPENSEA_PATH_MAX];
+    const char *logExtension = get_Log_File_Extension(fileExtension, compressFile, compressedExtension, OPENSEA_PATH_MAX);
 
     #ifdef _DEBUG
     printf("%s: -->\n",__FUNCTION__);
@@ -682,21 +800,22 @@ int get_ATA_Log(tDevice *device, uint8_t logAddress, char *logName, char *fileEx
         bool logFromGPL = false;
         bool fileOpened = false;
         FILE *fp_log = NULL;
-        uint8_t *logBuffer = (uint8_t *)calloc(logSize, sizeof(uint8_t));
-        if (!logBuffer)
+        if (toBuffer && (!myBuf || bufSize < logSize))
         {
-            perror("Calloc Failure!\n");
-            return MEMORY_FAILURE;
+            return BAD_PARAMETER;
         }
 
         if (GPL)
         {
             char *fileNameUsed = NULL;
-            //read each log 1 page at a time since some can get to be so large some controllers won't let you pull it.
+            ptrLogFileWriter logWriter = NULL;
+            //read each log a few pages at a time since some can get to be so large some controllers won't let you pull it all at once.
             uint16_t pagesToReadAtATime = 1;
             uint16_t numberOfLogPages = logSize / LEGACY_DRIVE_SEC_SIZE;
-            uint16_t remainderPages = 0;
+            uint16_t pagesThisRead = 0;
             uint16_t currentPage = 0;
+            bool probeTransferSize = false;
+            uint32_t readSize = 0;
             switch (logAddress)
             {
             case 0xA2:
@@ -707,37 +826,47 @@ int get_ATA_Log(tDevice *device, uint8_t logAddress, char *logName, char *fileEx
                     break;
                 }
             default:
-                if (device->drive_info.interface_type != USB_INTERFACE && device->drive_info.interface_type != IEEE_1394_INTERFACE)
-                {
-                    if (numberOfLogPages >= 32)
-                    {
-                        pagesToReadAtATime = M_Min(32, logSize / LEGACY_DRIVE_SEC_SIZE);//16k at a time should be a little faster...especially on larger logs
-                    }
-                    else
-                    {
-                        pagesToReadAtATime = logSize / LEGACY_DRIVE_SEC_SIZE;
-                    }
-                }
-                else
-                {
-                    //USB and IEEE 1394 should only ever be read 1 page at a time since these interfaces use cheap bridge chips that typically don't allow larger transfers.
-                    pagesToReadAtATime = 1;
-                }
+                //Use the largest transfer this device (and any bridge chip, such as USB or IEEE 1394) has taken. If a read fails, smaller reads are tried until one works.
+                probeTransferSize = true;
+                pagesToReadAtATime = (uint16_t)M_Min(numberOfLogPages, get_Device_Transfer_Size(device, TRANSFER_SIZE_ATA_READ_LOG_EXT, LOG_PULL_MAX_TRANSFER_SIZE) / LEGACY_DRIVE_SEC_SIZE);
                 break;
             }
             if (transferSizeBytes)
             {
                 //caller is telling us how much to read at a time...so let them.
                 pagesToReadAtATime = transferSizeBytes / LEGACY_DRIVE_SEC_SIZE;
+                probeTransferSize = false;
+            }
+            if (pagesToReadAtATime == 0)
+            {
+                pagesToReadAtATime = 1;
             }
             logFromGPL = true;
-            remainderPages = numberOfLogPages % pagesToReadAtATime;
-            for (currentPage = 0; currentPage < (numberOfLogPages - remainderPages); currentPage += pagesToReadAtATime)
+            if (!toBuffer)
+            {
+                //only a few transfers worth of memory is needed no matter how big the log is. The file is written (and compressed) on another thread while the next pages are read.
+                ret = create_Log_File_Writer(NULL, pagesToReadAtATime * LEGACY_DRIVE_SEC_SIZE, 0, compressFile, &logWriter);
+                if (ret != SUCCESS)
+                {
+                    return ret;
+                }
+            }
+            for (currentPage = 0; currentPage < numberOfLogPages; currentPage += pagesThisRead)
             {
+                //the last read picks up whatever pages are left over
+                pagesThisRead = M_Min(pagesToReadAtATime, numberOfLogPages - currentPage);
+                uint8_t *pagesBuffer = toBuffer ? &myBuf[currentPage * LEGACY_DRIVE_SEC_SIZE] : get_Log_File_Writer_Buffer(logWriter);
                 ret = SUCCESS;//assume success
+                readSize = pagesThisRead * LEGACY_DRIVE_SEC_SIZE;
                 //loop and read each page or set of pages, then save to a file
-                if (SUCCESS == ata_Read_Log_Ext(device, logAddress, currentPage, &logBuffer[currentPage * LEGACY_DRIVE_SEC_SIZE], pagesToReadAtATime * LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0))
+                if (SUCCESS == read_Log_Ext_Chunk(device, logAddress, currentPage, pagesBuffer, &readSize, 0, probeTransferSize))
                 {
+                    if (readSize < (uint32_t)(pagesThisRead * LEGACY_DRIVE_SEC_SIZE))
+                    {
+                        //the device wouldn't take that many pages at once, so read fewer from here on
+                        pagesThisRead = (uint16_t)(readSize / LEGACY_DRIVE_SEC_SIZE);
+                        pagesToReadAtATime = pagesThisRead;
+                    }
                     if (g_verbosity > VERBOSITY_QUIET)
                     {
                         if (currentPage % 20 == 0)
@@ -748,27 +877,16 @@ int get_ATA_Log(tDevice *device, uint8_t logAddress, char *logName, char *fileEx
                     }
                     if (!toBuffer && !fileOpened)
                     {
-                        if (SUCCESS == create_And_Open_Log_File(device, &fp_log, filePath, logName, fileExtension, NAMING_SERIAL_NUMBER_DATE_TIME, &fileNameUsed))
+                        if (SUCCESS == create_And_Open_Log_File(device, &fp_log, filePath, logName, logExtension, NAMING_SERIAL_NUMBER_DATE_TIME, &fileNameUsed))
                         {
                             fileOpened = true;
+                            set_Log_File_Writer_File(logWriter, fp_log);
                         }
                     }
                     if (fileOpened)
                     {
                         //write out to a file
-                        fwrite(&logBuffer[currentPage * LEGACY_DRIVE_SEC_SIZE], sizeof(uint8_t), pagesToReadAtATime * LEGACY_DRIVE_SEC_SIZE, fp_log);
-                        ret = SUCCESS;
-                    }
-                    if (toBuffer)
-                    {
-                        if (bufSize >= logSize)
-                        {
-                            memcpy(&myBuf[currentPage * LEGACY_DRIVE_SEC_SIZE], &logBuffer[currentPage * LEGACY_DRIVE_SEC_SIZE], pagesToReadAtATime * LEGACY_DRIVE_SEC_SIZE);
-                        }
-                        else
-                        {
-                            return BAD_PARAMETER;
-                        }
+                        queue_Log_File_Writer_Buffer(logWriter, pagesThisRead * LEGACY_DRIVE_SEC_SIZE);
                     }
                 }
                 else
@@ -779,41 +897,12 @@ int get_ATA_Log(tDevice *device, uint8_t logAddress, char *logName, char *fileEx
                     break;
                 }
             }
-            if (remainderPages > 0 && ret == SUCCESS)
+            if (logWriter)
             {
-                //read the remaining chunk of pages at once.
-                if (SUCCESS == ata_Read_Log_Ext(device, logAddress, currentPage, &logBuffer[currentPage * LEGACY_DRIVE_SEC_SIZE], remainderPages * LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0))
-                {
-                    if (!toBuffer && !fileOpened)
-                    {
-                        if (SUCCESS == create_And_Open_Log_File(device, &fp_log, filePath, logName, fileExtension, NAMING_SERIAL_NUMBER_DATE_TIME, &fileNameUsed))
-                        {
-                            fileOpened = true;
-                        }
-                    }
-                    if (fileOpened)
-                    {
-                        //write out to a file
-                        fwrite(&logBuffer[currentPage * LEGACY_DRIVE_SEC_SIZE], sizeof(uint8_t), remainderPages * LEGACY_DRIVE_SEC_SIZE, fp_log);
-                        ret = SUCCESS;
-                    }
-                    if (toBuffer)
-                    {
-                        if (bufSize >= logSize)
-                        {
-                            memcpy(&myBuf[currentPage * LEGACY_DRIVE_SEC_SIZE], &logBuffer[currentPage * LEGACY_DRIVE_SEC_SIZE], remainderPages * LEGACY_DRIVE_SEC_SIZE);
-                        }
-                        else
-                        {
-                            return BAD_PARAMETER;
-                        }
-                    }
-                }
-                else
+                //wait for the last of the log to make it to the file
+                if (SUCCESS != finish_Log_File_Writer(logWriter) && ret == SUCCESS && fileOpened)
                 {
                     ret = FAILURE;
-                    logSize = 0;
-                    logFromGPL = true;
                 }
             }
             if (g_verbosity > VERBOSITY_QUIET)
@@ -824,6 +913,13 @@ int get_ATA_Log(tDevice *device, uint8_t logAddress, char *logName, char *fileEx
         //if the log wasn't found in the GPL directory, then try reading from the SMART directory
         if (!logFromGPL && SMART)
         {
+            //SMART logs are 255 pages at most, so these are still read in one command
+            uint8_t *logBuffer = toBuffer ? myBuf : (uint8_t *)calloc(logSize, sizeof(uint8_t));
+            if (!logBuffer)
+            {
+                perror("Calloc Failure!\n");
+                return MEMORY_FAILURE;
+            }
             ret = UNKNOWN; //start fresh again...
             //read the log from SMART
             if (ata_SMART_Read_Log(device, logAddress, logBuffer, logSize) == 0)
@@ -831,7 +927,7 @@ int get_ATA_Log(tDevice *device, uint8_t logAddress, char *logName, char *fileEx
                 if (!toBuffer && !fileOpened)
                 {
                     char *fileNameUsed = NULL;
-                    if (SUCCESS == create_And_Open_Log_File(device, &fp_log, filePath, logName, fileExtension, NAMING_SERIAL_NUMBER_DATE_TIME, &fileNameUsed))
+                    if (SUCCESS == create_And_Open_Log_File(device, &fp_log, filePath, logName, logExtension, NAMING_SERIAL_NUMBER_DATE_TIME, &fileNameUsed))
                     {
                         fileOpened = true;
                     }
@@ -839,19 +935,7 @@ int get_ATA_Log(tDevice *device, uint8_t logAddress, char *logName, char *fileEx
                 if (fileOpened)
                 {
                     //write out to a file
-                    fwrite(logBuffer, sizeof(uint8_t), logSize, fp_log);
-                    ret = SUCCESS;
-                }
-                if (toBuffer)
-                {
-                    if (bufSize >= logSize)
-                    {
-                        memcpy(myBuf, logBuffer, logSize);
-                    }
-                    else
-                    {
-                        return BAD_PARAMETER;
-                    }
+                    ret = write_Log_File_Data(fp_log, logBuffer, logSize, compressFile);
                 }
             }
             else
@@ -859,6 +943,10 @@ int get_ATA_Log(tDevice *device, uint8_t logAddress, char *logName, char *fileEx
                 //failed to read the log...
                 ret = FAILURE;
             }
+            if (!toBuffer)
+            {
+                safe_Free(logBuffer);
+            }
         }
         if (fileOpened)
         {
@@ -866,7 +954,6 @@ int get_ATA_Log(tDevice *device, uint8_t logAddress, char *logName, char *fileEx
             fclose(fp_log);
             fileOpened = false;
         }
-        safe_Free(logBuffer);
     }
 
     #ifdef _DEBUG
@@ -875,30 +962,14 @@ int get_ATA_Log(tDevice *device, uint8_t logAddress, char *logName, char *fileEx
     return ret;
 }
 
-//-----------------------------------------------------------------------------
-//
-//! get_SCSI_Log
-//
-//! \brief   generic function to pull an SCSI log and save it to a file
-//
-//  Entry:
-//!   \param[in]  device - file descriptor
-//!   \param[in]  logAddress - the address of the log you wish to pull
-//!   \param[in]  subpage - set this to something other than zero if looking for a specific subpage to a log
-//!   \param[in]  logName - a string that is the name of the log (NO SPACES please!) NULL if no file output needed
-//!   \param[in]  fileExtension - a string for the file extension. You do not need to include a dot character.
-//!   \param[in]  toBuffer - boolean flag specifying if you want to return data in buffer 
-//!   \param[in]  myBuf - buffer to return data in if toBuffer is true
-//!   \param[in]  bufSize - size of the buffer to get data filled into it (use get_SCSI_Log_Size)
-//!   \param[in]  filePath - string with path to output the file to. Can be NULL for current directory.
-//!
-//  Exit:
-//!   \return SUCCESS = good, !SUCCESS something went wrong see error codes
-//
-//-----------------------------------------------------------------------------
+int get_ATA_Log(tDevice *device, uint8_t logAddress, char *logName, char *fileExtension, bool GPL,\
+    bool SMART, bool toBuffer, uint8_t *myBuf, uint32_t bufSize, const char * const filePath, uint32_t transferSizeBytes)
+{
+    return pull_ATA_Log(device, logAddress, logName, fileExtension, false, GPL, SMART, toBuffer, myBuf, bufSize, filePath, transferSizeBytes);
+}
 
-int get_SCSI_Log(tDevice *device, uint8_t logAddress, uint8_t subpage, char *logName, \
-                 char *fileExtension, bool toBuffer, uint8_t *myBuf, uint32_t bufSize,\
+static int pull_SCSI_Log(tDevice *device, uint8_t logAddress, uint8_t subpage, char *logName, \
+                 char *fileExtension, bool compressFile, bool toBuffer, uint8_t *myBuf, uint32_t bufSize,\
                  const char * const filePath)
 {
     int ret = UNKNOWN;
@@ -907,6 +978,7 @@ int get_SCSI_Log(tDevice *device, uint8_t logAddress, uint8_t subpage, char *log
     FILE *fp_log = NULL;
     uint8_t *logBuffer = NULL;
     char *fileNameUsed = &name[0];
+    char compressedExtension[OPENSEA_PATH_MAX];
     
     ret = get_SCSI_Log_Size(device, logAddress, subpage, &pageLen);
     
@@ -936,10 +1008,13 @@ int get_SCSI_Log(tDevice *device, uint8_t logAddress, uint8_t subpage, char *log
 
             if (logName && fileExtension) //Because you can also get a log file & get it in buffer. 
             {
-                if (SUCCESS == create_And_Open_Log_File(device, &fp_log, filePath, logName, fileExtension, NAMING_SERIAL_NUMBER_DATE_TIME, &fileNameUsed))
+                if (SUCCESS == create_And_Open_Log_File(device, &fp_log, filePath, logName, get_Log_File_Extension(fileExtension, compressFile, compressedExtension, OPENSEA_PATH_MAX), NAMING_SERIAL_NUMBER_DATE_TIME, &fileNameUsed))
                 {
                     //write the log to a file
-                    fwrite(logBuffer, sizeof(uint8_t), pageLen, fp_log);
+                    if (SUCCESS != write_Log_File_Data(fp_log, logBuffer, pageLen, compressFile))
+                    {
+                        ret = FAILURE;
+                    }
                     fflush(fp_log);
                     fclose(fp_log);
                 }
@@ -959,6 +1034,35 @@ int get_SCSI_Log(tDevice *device, uint8_t logAddress, uint8_t subpage, char *log
     return ret;
 }
 
+//-----------------------------------------------------------------------------
+//
+//! get_SCSI_Log
+//
+//! \brief   generic function to pull an SCSI log and save it to a file
+//
+//  Entry:
+//!   \param[in]  device - file descriptor
+//!   \param[in]  logAddress - the address of the log you wish to pull
+//!   \param[in]  subpage - set this to something other than zero if looking for a specific subpage to a log
+//!   \param[in]  logName - a string that is the name of the log (NO SPACES please!) NULL if no file output needed
+//!   \param[in]  fileExtension - a string for the file extension. You do not need to include a dot character.
+//!   \param[in]  toBuffer - boolean flag specifying if you want to return data in buffer 
+//!   \param[in]  myBuf - buffer to return data in if toBuffer is true
+//!   \param[in]  bufSize - size of the buffer to get data filled into it (use get_SCSI_Log_Size)
+//!   \param[in]  filePath - string with path to output the file to. Can be NULL for current directory.
+//!
+//  Exit:
+//!   \return SUCCESS = good, !SUCCESS something went wrong see error codes
+//
+//-----------------------------------------------------------------------------
+
+int get_SCSI_Log(tDevice *device, uint8_t logAddress, uint8_t subpage, char *logName, \
+                 char *fileExtension, bool toBuffer, uint8_t *myBuf, uint32_t bufSize,\
+                 const char * const filePath)
+{
+    return pull_SCSI_Log(device, logAddress, subpage, logName, fileExtension, false, toBuffer, myBuf, bufSize, filePath);
+}
+
 int get_SCSI_VPD(tDevice *device, uint8_t pageCode, char *logName, char *fileExtension, bool toBuffer, uint8_t *myBuf, uint32_t bufSize, const char * const filePath)
 {
     int     ret = UNKNOWN;
@@ -978,7 +1082,7 @@ int get_SCSI_VPD(tDevice *device, uint8_t pageCode, char *logName, char *fileExt
             return MEMORY_FAILURE;
         }
         //read the requested VPD page
-        if (SUCCESS == scsi_Inquiry(device, vpdBuffer, vpdBufferLength, pageCode, true, false))
+        if (SUCCESS == scsi_Inquiry_Cached(device, vpdBuffer, vpdBufferLength, pageCode, true))
         {
             if (!toBuffer && !fileOpened && ret != FAILURE)
             {
@@ -1016,171 +1120,98 @@ int get_SCSI_VPD(tDevice *device, uint8_t pageCode, char *logName, char *fileExt
     return ret;
 }
 
-int ata_Pull_Internal_Status_Log(tDevice *device, bool currentOrSaved, uint8_t islDataSet,\
-                             bool saveToFile, uint8_t* ptrData, uint32_t dataSize,\
-                            const char * const filePath, uint32_t transferSizeBytes)
+static int ata_Trigger_Internal_Status_Log(tDevice *device, bool currentOrSaved, ptrInternalStatusLogSnapshot snapshot)
 {
     int ret = SUCCESS;
-    char fileName[OPENSEA_PATH_MAX] = {0};
-    char * fileNameUsed = &fileName[0];
-    FILE *isl = NULL;
-    if (transferSizeBytes % LEGACY_DRIVE_SEC_SIZE)
+    uint8_t logDirectory[LEGACY_DRIVE_SEC_SIZE] = { 0 };
+    uint8_t islLogToPull = 0;
+    if (currentOrSaved == true)
     {
-        return BAD_PARAMETER;
+        //current
+        islLogToPull = ATA_LOG_CURRENT_DEVICE_INTERNAL_STATUS_DATA_LOG;
     }
-    uint8_t *dataBuffer = (uint8_t*)calloc(LEGACY_DRIVE_SEC_SIZE, sizeof(uint8_t));
-    if (dataBuffer == NULL)
+    else
     {
-        perror("calloc failure");
-        return MEMORY_FAILURE;
+        //saved
+        islLogToPull = ATA_LOG_SAVED_DEVICE_INTERNAL_STATUS_DATA_LOG;
     }
     //check the GPL directory to make sure that the internal status log is supported by the drive
-	if (SUCCESS == ata_Read_Log_Ext(device, ATA_LOG_DIRECTORY, 0, dataBuffer, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0))
+    if (SUCCESS == ata_Read_Log_Directory_Cached(device, true, logDirectory, LEGACY_DRIVE_SEC_SIZE))
     {
-        uint8_t islLogToPull = 0;
-        if (currentOrSaved == true)
+        if (M_BytesTo2ByteValue(logDirectory[(islLogToPull * 2) + 1], logDirectory[(islLogToPull * 2)]) > 0)
         {
-            //current
-            islLogToPull = ATA_LOG_CURRENT_DEVICE_INTERNAL_STATUS_DATA_LOG;
+            //read the first sector of the log with the trigger bit set
+            if (SUCCESS == ata_Read_Log_Ext(device, islLogToPull, 0, snapshot->firstPage, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0x0001))
+            {
+                //getting isl sizes (little endian)
+                snapshot->logAddress = islLogToPull;
+                snapshot->dataSetPages[0] = M_BytesTo2ByteValue(snapshot->firstPage[9], snapshot->firstPage[8]);
+                snapshot->dataSetPages[1] = M_BytesTo2ByteValue(snapshot->firstPage[11], snapshot->firstPage[10]);
+                snapshot->dataSetPages[2] = M_BytesTo2ByteValue(snapshot->firstPage[13], snapshot->firstPage[12]);
+            }
+            else
+            {
+                ret = FAILURE;
+            }
         }
         else
         {
-            //saved
-            islLogToPull = ATA_LOG_SAVED_DEVICE_INTERNAL_STATUS_DATA_LOG;
+            ret = NOT_SUPPORTED;
         }
-        if (M_BytesTo2ByteValue(dataBuffer[(islLogToPull * 2) + 1], dataBuffer[(islLogToPull * 2)]) > 0)
+    }
+    else
+    {
+        ret = FAILURE;
+    }
+    return ret;
+}
+
+static int scsi_Trigger_Internal_Status_Log(tDevice *device, bool currentOrSaved, ptrInternalStatusLogSnapshot snapshot)
+{
+    int ret = SUCCESS;
+    uint8_t *dataBuffer = snapshot->firstPage;//directory is read here first, then replaced by the first page of the log
+    uint8_t islLogToPull = 0xFF;
+    if (SUCCESS == scsi_Read_Buffer(device, 0x3C, 0x01, 0, LEGACY_DRIVE_SEC_SIZE, dataBuffer))
+    {
+        bool islSupported = false;
+        uint16_t errorHistoryIter = 32;//the entries start at offset 32 according to SPC4
+        uint16_t errorHistoryLength = M_BytesTo2ByteValue(dataBuffer[30], dataBuffer[31]) + 32;
+        //we just pulled the error history directory. We need to go through each of the error history parameters until we find the 
+        //current/saved parameter for internal status log, otherwise the drive doesn't support internal status log.
+        for (errorHistoryIter = 32; errorHistoryIter < M_Min(errorHistoryLength, LEGACY_DRIVE_SEC_SIZE); errorHistoryIter += 8)//each error history parameter is 8 bytes long
         {
-            if (saveToFile == true)
+            if ((currentOrSaved && dataBuffer[errorHistoryIter + 1] == 0x01) || (!currentOrSaved && dataBuffer[errorHistoryIter + 1] == 0x02))
             {
-                if (SUCCESS == create_And_Open_Log_File(device, &isl, filePath, "ISL", "isl", NAMING_SERIAL_NUMBER_DATE_TIME, &fileNameUsed))
+                uint32_t length = ((uint32_t)dataBuffer[errorHistoryIter + 4] << 24) | ((uint32_t)dataBuffer[errorHistoryIter + 5] << 16) | ((uint32_t)dataBuffer[errorHistoryIter + 6] << 8) | ((uint32_t)dataBuffer[errorHistoryIter + 7]);
+                if (length != 0)
                 {
-                    //fileOpened = true;
-                    if (VERBOSITY_QUIET < g_verbosity)
-                    {
-                        printf("Saving ISL log to file %s\n", fileNameUsed);
-                    }
-                }
-                else
+                    islLogToPull = dataBuffer[errorHistoryIter];
+                    islSupported = true; 
+                    break;
+                }
+                else if (VERBOSITY_QUIET < g_verbosity)
                 {
-                    ret = FILE_OPEN_ERROR;
-                    safe_Free(dataBuffer);
-                    return ret;
+                    printf("Found ISL log in error history but length is 0! Cannot pull the log!\n");
                 }
             }
-            //read the first sector of the log with the trigger bit set
-            if (SUCCESS == ata_Read_Log_Ext(device, islLogToPull, 0, dataBuffer, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0x0001))
+        }
+        if (islSupported)
+        {
+            //now we can pull the first page of internal status log and find whether the short/long pages are supported by the device
+            if (SUCCESS == scsi_Read_Buffer(device, 0x1C, islLogToPull, 0, LEGACY_DRIVE_SEC_SIZE, dataBuffer))
             {
-                //now we need to check the sizes reported for the log and what the user is requesting to pull (and save what we just read to a file)
-                uint16_t reportedSmallSize = 0;
-                uint16_t reportedMediumSize = 0;
-                uint16_t reportedLargeSize = 0;
-                uint16_t islPullingSize = 0;
-                uint16_t pageNumber = 0;//keep track of the current page we are reading/saving
-                uint32_t pullChunkSize = 8 * LEGACY_DRIVE_SEC_SIZE;//pull the remainder of the log in 4k chunks
-                if (transferSizeBytes)
-                {
-                    pullChunkSize = transferSizeBytes;
-                }
-                uint8_t *temp = NULL;
-                //saving first page to file
-                if (saveToFile == true)
-                {
-                    fwrite(dataBuffer, LEGACY_DRIVE_SEC_SIZE, 1, isl);
-                    fflush(isl);
-                }
-                else if (dataSize >= (uint32_t)(pageNumber * LEGACY_DRIVE_SEC_SIZE) && ptrData != NULL)
-                {
-                    memcpy(&ptrData[0], dataBuffer, LEGACY_DRIVE_SEC_SIZE);
-                }
-                else
-                {
-                    safe_Free(dataBuffer);
-                    return BAD_PARAMETER;
-                }
-                //getting isl sizes (little endian)
-                reportedSmallSize = ((uint16_t)dataBuffer[8]) | ((uint16_t)dataBuffer[9] << 8);
-                reportedMediumSize = ((uint16_t)dataBuffer[10]) | ((uint16_t)dataBuffer[11] << 8);
-                reportedLargeSize = ((uint16_t)dataBuffer[12]) | ((uint16_t)dataBuffer[13] << 8);
-                //check what the user requested us try and pull and set a size based off of what the drive reports supporting (ex, if they asked for large, but only small is available, return the small information set)
-                switch (islDataSet)
-                {
-                case 3://large
-                    islPullingSize = reportedLargeSize;
-                    if (islPullingSize > 0)
-                    {
-                        break;
-                    }
-                case 2://medium
-                    islPullingSize = reportedMediumSize;
-                    if (islPullingSize > 0)
-                    {
-                        break;
-                    }
-                case 1://small
-                default:
-                    islPullingSize = reportedSmallSize;
-                    break;                    
-                }
-                //increment pageNumber to 1 and reallocate the local data buffer
-                pageNumber += 1;
-                temp = (uint8_t*)realloc(dataBuffer, pullChunkSize);
-                if (temp == NULL)
-                {
-                    perror("realloc failure");
-                    return MEMORY_FAILURE;
-                }
-                dataBuffer = temp;
-                memset(dataBuffer, 0, pullChunkSize);
-                //read the remaining data
-                for (pageNumber = 1; pageNumber < islPullingSize; pageNumber += (pullChunkSize / LEGACY_DRIVE_SEC_SIZE))
-                {
-                    if (VERBOSITY_QUIET < g_verbosity)
-                    {
-                        if ((pageNumber - 1) % 16 == 0)
-                        {
-                            printf(".");
-                            fflush(stdout);
-                        }
-                    }
-                    //adjust pullcheck size so we don't try and request anything that's not supported by the drive
-                    if (pageNumber + (pullChunkSize / LEGACY_DRIVE_SEC_SIZE) > islPullingSize)
-                    {
-                        pullChunkSize = (islPullingSize - pageNumber) * LEGACY_DRIVE_SEC_SIZE;
-                    }
-                    //read each remaining chunk with the trigger bit set to 0
-                    if (SUCCESS == ata_Read_Log_Ext(device, islLogToPull, pageNumber, dataBuffer, pullChunkSize, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0))
-                    {
-                        //save to file, or copy to the ptr we were given
-                        if (saveToFile == true)
-                        {
-                            fwrite(dataBuffer, pullChunkSize, 1, isl);
-                            fflush(isl);
-                        }
-                        else if (dataSize >= (uint32_t)(pageNumber * LEGACY_DRIVE_SEC_SIZE) && ptrData != NULL)
-                        {
-                            memcpy(&ptrData[pageNumber * LEGACY_DRIVE_SEC_SIZE], dataBuffer, pullChunkSize);
-                        }
-                        else
-                        {
-                            safe_Free(dataBuffer);
-                            return BAD_PARAMETER;
-                        }
-                    }
-                    else
-                    {
-                        ret = FAILURE;
-                        break;
-                    }
-                    memset(dataBuffer, 0, pullChunkSize);
-                }
-                if (VERBOSITY_QUIET < g_verbosity)
+                snapshot->logAddress = islLogToPull;
+                if (dataBuffer[0] == RESERVED)//SAS log
                 {
-                    printf("\n");
+                    snapshot->dataSetPages[0] = M_BytesTo2ByteValue(dataBuffer[8], dataBuffer[9]);
+                    snapshot->dataSetPages[1] = M_BytesTo2ByteValue(dataBuffer[10], dataBuffer[11]);
+                    snapshot->dataSetPages[2] = M_BytesTo2ByteValue(dataBuffer[12], dataBuffer[13]);
                 }
-                if (saveToFile == true)
+                else //ATA log (SAT translation somewhere below)
                 {
-                    fflush(isl);
-                    fclose(isl);
+                    snapshot->dataSetPages[0] = M_BytesTo2ByteValue(dataBuffer[9], dataBuffer[8]);
+                    snapshot->dataSetPages[1] = M_BytesTo2ByteValue(dataBuffer[11], dataBuffer[10]);
+                    snapshot->dataSetPages[2] = M_BytesTo2ByteValue(dataBuffer[13], dataBuffer[12]);
                 }
             }
             else
@@ -1195,240 +1226,244 @@ int ata_Pull_Internal_Status_Log(tDevice *device, bool currentOrSaved, uint8_t i
     }
     else
     {
+        //unable to read the error history directory from the device
         ret = FAILURE;
     }
-    safe_Free(dataBuffer);
     return ret;
 }
 
-int scsi_Pull_Internal_Status_Log(tDevice *device, bool currentOrSaved, uint8_t islDataSet,\
-                              bool saveToFile, uint8_t* ptrData, uint32_t dataSize,\
-                              const char * const filePath, uint32_t transferSizeBytes)
+int trigger_Internal_Status_Log(tDevice *device, bool currentOrSaved, ptrInternalStatusLogSnapshot snapshot)
 {
-    int ret = SUCCESS;
-    FILE *isl = NULL;
-    char fileName[OPENSEA_PATH_MAX] = {0};
-    char * fileNameUsed = &fileName[0];
-    uint8_t islLogToPull = 0xFF;
-    if (transferSizeBytes % LEGACY_DRIVE_SEC_SIZE)
+    int ret = NOT_SUPPORTED;
+    if (!device || !snapshot)
     {
-        //NOTE: We may be able to pull this in any size, but for now and for compatibility only allow 512B sizes.
         return BAD_PARAMETER;
     }
-    uint8_t *dataBuffer = (uint8_t*)calloc(LEGACY_DRIVE_SEC_SIZE, sizeof(uint8_t));
-
-    #ifdef _DEBUG
-    printf("--> %s\n",__FUNCTION__);
-    #endif
+    memset(snapshot, 0, sizeof(internalStatusLogSnapshot));
+    if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        ret = ata_Trigger_Internal_Status_Log(device, currentOrSaved, snapshot);
+    }
+    else if (device->drive_info.drive_type == SCSI_DRIVE)
+    {
+        ret = scsi_Trigger_Internal_Status_Log(device, currentOrSaved, snapshot);
+    }
+    return ret;
+}
 
-    if (dataBuffer == NULL)
+static int pull_Snapshot_Data(tDevice *device, ptrInternalStatusLogSnapshot snapshot, uint8_t islDataSet, FILE *islFile, bool compressFile, uint8_t *ptrData, uint32_t dataSize, uint32_t transferSizeBytes, bool showProgress)
+{
+    int ret = SUCCESS;
+    uint16_t islPullingSize = 0;
+    uint16_t pageNumber = 0;//keep track of the current page we are reading/saving
+    uint32_t pullChunkSize = 0;
+    bool probeTransferSize = transferSizeBytes == 0;
+    eTransferSizeCommand transferSizeCommand = TRANSFER_SIZE_ATA_READ_LOG_EXT;
+    uint8_t *dataBuffer = NULL;
+    ptrLogFileWriter islWriter = NULL;
+    if (!device || !snapshot || transferSizeBytes % LEGACY_DRIVE_SEC_SIZE)
     {
-        perror("calloc failure");
-        return MEMORY_FAILURE;
+        return BAD_PARAMETER;
     }
-    if (SUCCESS == scsi_Read_Buffer(device, 0x3C, 0x01, 0, LEGACY_DRIVE_SEC_SIZE, dataBuffer))
+    if (!islFile && (!ptrData || dataSize < LEGACY_DRIVE_SEC_SIZE))
     {
-        bool islSupported = false;
-        uint16_t errorHistoryIter = 32;//the entries start at offset 32 according to SPC4
-        uint16_t errorHistoryLength = M_BytesTo2ByteValue(dataBuffer[30], dataBuffer[31]) + 32;
-        //we just pulled the error history directory. We need to go through each of the error history parameters until we find the 
-        //current/saved parameter for internal status log, otherwise the drive doesn't support internal status log.
-        for (errorHistoryIter = 32; errorHistoryIter < M_Min(errorHistoryLength, LEGACY_DRIVE_SEC_SIZE); errorHistoryIter += 8)//each error history parameter is 8 bytes long
+        return BAD_PARAMETER;
+    }
+    if (device->drive_info.drive_type == SCSI_DRIVE)
+    {
+        transferSizeCommand = TRANSFER_SIZE_SCSI_READ_BUFFER;
+    }
+    if (transferSizeBytes)
+    {
+        pullChunkSize = transferSizeBytes;
+    }
+    else
+    {
+        //pull the remainder of the log in the largest chunks this device has taken (smaller chunks are tried if it fails)
+        pullChunkSize = get_Device_Transfer_Size(device, transferSizeCommand, LOG_PULL_MAX_TRANSFER_SIZE);
+    }
+    //saving first page to file
+    if (islFile)
+    {
+        //the file is written (and compressed) on another thread while the next chunk is read
+        ret = create_Log_File_Writer(islFile, pullChunkSize, 0, compressFile, &islWriter);
+        if (ret != SUCCESS)
+        {
+            return ret;
+        }
+        memcpy(get_Log_File_Writer_Buffer(islWriter), snapshot->firstPage, LEGACY_DRIVE_SEC_SIZE);
+        queue_Log_File_Writer_Buffer(islWriter, LEGACY_DRIVE_SEC_SIZE);
+    }
+    else
+    {
+        memcpy(&ptrData[0], snapshot->firstPage, LEGACY_DRIVE_SEC_SIZE);
+    }
+    //check what the user requested us try and pull and set a size based off of what the drive reports supporting (ex, if they asked for large, but only small is available, return the small information set)
+    switch (islDataSet)
+    {
+    case 3://large
+        islPullingSize = snapshot->dataSetPages[2];
+        if (islPullingSize > 0)
+        {
+            break;
+        }
+    case 2://medium
+        islPullingSize = snapshot->dataSetPages[1];
+        if (islPullingSize > 0)
         {
-            if (currentOrSaved && dataBuffer[errorHistoryIter + 1] == 0x01)
+            break;
+        }
+    case 1://small
+    default:
+        islPullingSize = snapshot->dataSetPages[0];
+        break;
+    }
+    if (!islWriter)
+    {
+        dataBuffer = (uint8_t*)calloc(pullChunkSize, sizeof(uint8_t));
+        if (dataBuffer == NULL)
+        {
+            perror("calloc failure");
+            return MEMORY_FAILURE;
+        }
+    }
+    //read the remaining data
+    for (pageNumber = 1; pageNumber < islPullingSize; pageNumber += (pullChunkSize / LEGACY_DRIVE_SEC_SIZE))
+    {
+        uint8_t *chunkBuffer = islWriter ? get_Log_File_Writer_Buffer(islWriter) : dataBuffer;
+        if (showProgress && VERBOSITY_QUIET < g_verbosity)
+        {
+            if ((pageNumber - 1) % 16 == 0)
             {
-                uint32_t length = ((uint32_t)dataBuffer[errorHistoryIter + 4] << 24) | ((uint32_t)dataBuffer[errorHistoryIter + 5] << 16) | ((uint32_t)dataBuffer[errorHistoryIter + 6] << 8) | ((uint32_t)dataBuffer[errorHistoryIter + 7]);
-                if (length != 0)
-                {
-                    islLogToPull = dataBuffer[errorHistoryIter];
-                    islSupported = true; 
-                    break;
-                }
-                else
-                {
-                    if (VERBOSITY_QUIET < g_verbosity)
-                    {
-                        printf("Found ISL log in error history but length is 0! Cannot pull the log!\n");
-                    }
-                    ret = NOT_SUPPORTED;
-                }
-            }
-            else if (!currentOrSaved && dataBuffer[errorHistoryIter + 1] == 0x02)
-            {
-                uint32_t length = ((uint32_t)dataBuffer[errorHistoryIter + 4] << 24) | ((uint32_t)dataBuffer[errorHistoryIter + 5] << 16) | ((uint32_t)dataBuffer[errorHistoryIter + 6] << 8) | ((uint32_t)dataBuffer[errorHistoryIter + 7]);
-                if (length != 0)
-                {
-                    islLogToPull = dataBuffer[errorHistoryIter];
-                    islSupported = true; 
-                    break;
-                }
-                else
-                {
-                    if (VERBOSITY_QUIET < g_verbosity)
-                    {
-                        printf("Found ISL log in error history but length is 0! Cannot pull the log!\n");
-                    }
-                    ret = NOT_SUPPORTED;
-                }
+                printf(".");
+                fflush(stdout);
             }
         }
-        if (islSupported)
+        //adjust pullcheck size so we don't try and request anything that's not supported by the drive
+        if (pageNumber + (pullChunkSize / LEGACY_DRIVE_SEC_SIZE) > islPullingSize)
         {
-            uint32_t pageNumber = 0;
-            //now we can pull the first page of internal status log and find whether the short/long pages are supported by the device
-            if (SUCCESS == scsi_Read_Buffer(device, 0x1C, islLogToPull, pageNumber, LEGACY_DRIVE_SEC_SIZE, dataBuffer))
+            pullChunkSize = (islPullingSize - pageNumber) * LEGACY_DRIVE_SEC_SIZE;
+        }
+        if (device->drive_info.drive_type == SCSI_DRIVE)
+        {
+            ret = read_Buffer_Chunk(device, snapshot->logAddress, false, pageNumber * LEGACY_DRIVE_SEC_SIZE, chunkBuffer, &pullChunkSize, probeTransferSize);
+        }
+        else
+        {
+            //read each remaining chunk with the trigger bit set to 0
+            ret = read_Log_Ext_Chunk(device, snapshot->logAddress, pageNumber, chunkBuffer, &pullChunkSize, 0, probeTransferSize);
+        }
+        if (SUCCESS == ret)
+        {
+            //save to file, or copy to the ptr we were given
+            if (islWriter)
             {
-                uint32_t pullChunkSize = 8 * LEGACY_DRIVE_SEC_SIZE;//pull the remainder of the log in 4k chunks
-                if (transferSizeBytes)
-                {
-                    pullChunkSize = transferSizeBytes;
-                }
-                uint16_t reportedSmallSize = 0;
-                uint16_t reportedMediumSize = 0;
-                uint16_t reportedLargeSize = 0;
-                uint16_t islPullingSize = 0;
-                uint8_t *temp = NULL;
-                if (saveToFile == true)
-                {
-                    if (SUCCESS == create_And_Open_Log_File(device, &isl, filePath, "ISL", "isl", NAMING_SERIAL_NUMBER_DATE_TIME, &fileNameUsed))
-                    {
-                        if (VERBOSITY_QUIET < g_verbosity)
-                        {
-                            printf("Saving to file %s\n", fileNameUsed);
-                        }
-
-                        fwrite(dataBuffer, LEGACY_DRIVE_SEC_SIZE, 1, isl);
-                        fflush(isl);
-                    }
-                    else
-                    {
-                        ret = FILE_OPEN_ERROR;
-                        safe_Free(dataBuffer);
-                        return ret;
-                    }
-                }
-                else if (dataSize >= (uint32_t)(pageNumber * LEGACY_DRIVE_SEC_SIZE) && ptrData != NULL)
-                {
-                    memcpy(&ptrData[0], dataBuffer, LEGACY_DRIVE_SEC_SIZE);
-                }
-                else
-                {
-                    safe_Free(dataBuffer);
-                    return BAD_PARAMETER;
-                }
-                if (dataBuffer[0] == RESERVED)//SAS log
-                {
-                    reportedSmallSize = M_BytesTo2ByteValue(dataBuffer[8], dataBuffer[9]);
-                    reportedMediumSize = M_BytesTo2ByteValue(dataBuffer[10], dataBuffer[11]);
-                    reportedLargeSize = M_BytesTo2ByteValue(dataBuffer[12], dataBuffer[13]);
-                }
-                else //ATA log (SAT translation somewhere below)
-                {
-                    reportedSmallSize = M_BytesTo2ByteValue(dataBuffer[9], dataBuffer[8]);
-                    reportedMediumSize = M_BytesTo2ByteValue(dataBuffer[11], dataBuffer[10]);
-                    reportedLargeSize = M_BytesTo2ByteValue(dataBuffer[13], dataBuffer[12]);
-                }
-                //check what the user requested us try and pull and set a size based off of what the drive reports supporting (ex, if they asked for large, but only small is available, return the small information set)
-                switch (islDataSet)
-                {
-                case 3://large
-                    islPullingSize = reportedLargeSize;
-                    if (islPullingSize > 0)
-                    {
-                        break;
-                    }
-                case 2://medium
-                    islPullingSize = reportedMediumSize;
-                    if (islPullingSize > 0)
-                    {
-                        break;
-                    }
-                case 1://small
-                default:
-                    islPullingSize = reportedSmallSize;
-                    break;
-                }
-                //increment pageNumber to 1 and reallocate the local data buffer
-                pageNumber += 1;
-                temp = (uint8_t*)realloc(dataBuffer, pullChunkSize);
-                if (temp == NULL)
-                {
-                    perror("realloc failure");
-                    return MEMORY_FAILURE;
-                }
-                dataBuffer = temp;
-                memset(dataBuffer, 0, pullChunkSize);
-                //read the remaining data
-                for (pageNumber = 1; pageNumber < islPullingSize; pageNumber += (pullChunkSize / LEGACY_DRIVE_SEC_SIZE))
-                {
-                    if (VERBOSITY_QUIET < g_verbosity)
-                    {
-                        if ((pageNumber - 1) % 16 == 0)
-                        {
-                            printf(".");
-                            fflush(stdout);
-                        }
-                    }
-                    //adjust pullcheck size so we don't try and request anything that's not supported by the drive
-                    if (pageNumber + (pullChunkSize / LEGACY_DRIVE_SEC_SIZE) > islPullingSize)
-                    {
-                        pullChunkSize = (islPullingSize - pageNumber) * LEGACY_DRIVE_SEC_SIZE;
-                    }
-                    //read each remaining chunk of the log
-                    if (SUCCESS == scsi_Read_Buffer(device, 0x1C, islLogToPull, pageNumber * LEGACY_DRIVE_SEC_SIZE, pullChunkSize, dataBuffer))
-                    {
-                        //save to file, or copy to the ptr we were given
-                        if (saveToFile == true)
-                        {
-                            fwrite(dataBuffer, pullChunkSize, 1, isl);
-                            fflush(isl);
-                        }
-                        else if (dataSize >= (uint32_t)(pageNumber * pullChunkSize) && ptrData != NULL)
-                        {
-                            memcpy(&ptrData[pageNumber * LEGACY_DRIVE_SEC_SIZE], dataBuffer, pullChunkSize);
-                        }
-                        else
-                        {
-                            safe_Free(dataBuffer);
-                            return BAD_PARAMETER;
-                        }
-                    }
-                    else
-                    {
-                        ret = FAILURE;
-                        break;
-                    }
-                    memset(dataBuffer, 0, pullChunkSize);
-                }
-                if (VERBOSITY_QUIET < g_verbosity)
-                {
-                    printf("\n");
-                }
-                if (saveToFile == true)
-                {
-                    fflush(isl);
-                    fclose(isl);
-                }
+                queue_Log_File_Writer_Buffer(islWriter, pullChunkSize);
+            }
+            else if (dataSize >= ((uint32_t)(pageNumber * LEGACY_DRIVE_SEC_SIZE) + pullChunkSize))
+            {
+                memcpy(&ptrData[pageNumber * LEGACY_DRIVE_SEC_SIZE], dataBuffer, pullChunkSize);
             }
             else
             {
-                ret = FAILURE;
+                ret = BAD_PARAMETER;
+                break;
             }
         }
         else
         {
-            ret = NOT_SUPPORTED;
+            ret = FAILURE;
+            break;
+        }
+        if (dataBuffer)
+        {
+            memset(dataBuffer, 0, pullChunkSize);
         }
     }
-    else
+    if (islWriter)
     {
-        //unable to read the error history directory from the device
-        ret = FAILURE;
+        //wait for the last of the log to make it to the file
+        if (SUCCESS != finish_Log_File_Writer(islWriter) && ret == SUCCESS)
+        {
+            ret = FAILURE;
+        }
+    }
+    if (showProgress && VERBOSITY_QUIET < g_verbosity)
+    {
+        printf("\n");
     }
     safe_Free(dataBuffer);
     return ret;
 }
 
+int pull_Internal_Status_Log_Snapshot(tDevice *device, ptrInternalStatusLogSnapshot snapshot, uint8_t islDataSet, FILE *islFile, uint8_t *ptrData, uint32_t dataSize, uint32_t transferSizeBytes, bool showProgress)
+{
+    return pull_Snapshot_Data(device, snapshot, islDataSet, islFile, false, ptrData, dataSize, transferSizeBytes, showProgress);
+}
+
+//creates a new snapshot, then pulls it to a file or to ptrData
+static int pull_New_Internal_Status_Log(tDevice *device, bool currentOrSaved, uint8_t islDataSet, bool saveToFile, bool compressFile, uint8_t* ptrData, uint32_t dataSize, const char * const filePath, uint32_t transferSizeBytes)
+{
+    int ret = SUCCESS;
+    char fileName[OPENSEA_PATH_MAX] = {0};
+    char * fileNameUsed = &fileName[0];
+    char compressedExtension[OPENSEA_PATH_MAX];
+    FILE *isl = NULL;
+    internalStatusLogSnapshot snapshot;
+    if (transferSizeBytes % LEGACY_DRIVE_SEC_SIZE)
+    {
+        //NOTE: We may be able to pull this in any size, but for now and for compatibility only allow 512B sizes.
+        return BAD_PARAMETER;
+    }
+    if (!saveToFile && (!ptrData || dataSize < LEGACY_DRIVE_SEC_SIZE))
+    {
+        return BAD_PARAMETER;
+    }
+    ret = trigger_Internal_Status_Log(device, currentOrSaved, &snapshot);
+    if (ret != SUCCESS)
+    {
+        return ret;
+    }
+    if (saveToFile == true)
+    {
+        if (SUCCESS == create_And_Open_Log_File(device, &isl, filePath, "ISL", get_Log_File_Extension("isl", compressFile, compressedExtension, OPENSEA_PATH_MAX), NAMING_SERIAL_NUMBER_DATE_TIME, &fileNameUsed))
+        {
+            if (VERBOSITY_QUIET < g_verbosity)
+            {
+                printf("Saving ISL log to file %s\n", fileNameUsed);
+            }
+        }
+        else
+        {
+            return FILE_OPEN_ERROR;
+        }
+    }
+    ret = pull_Snapshot_Data(device, &snapshot, islDataSet, isl, compressFile, ptrData, dataSize, transferSizeBytes, true);
+    if (saveToFile == true)
+    {
+        fflush(isl);
+        fclose(isl);
+    }
+    return ret;
+}
+
+int ata_Pull_Internal_Status_Log(tDevice *device, bool currentOrSaved, uint8_t islDataSet,\
+                             bool saveToFile, uint8_t* ptrData, uint32_t dataSize,\
+                            const char * const filePath, uint32_t transferSizeBytes)
+{
+    return pull_New_Internal_Status_Log(device, currentOrSaved, islDataSet, saveToFile, false, ptrData, dataSize, filePath, transferSizeBytes);
+}
+
+int scsi_Pull_Internal_Status_Log(tDevice *device, bool currentOrSaved, uint8_t islDataSet,\
+                              bool saveToFile, uint8_t* ptrData, uint32_t dataSize,\
+                              const char * const filePath, uint32_t transferSizeBytes)
+{
+    #ifdef _DEBUG
+    printf("--> %s\n",__FUNCTION__);
+    #endif
+    return pull_New_Internal_Status_Log(device, currentOrSaved, islDataSet, saveToFile, false, ptrData, dataSize, filePath, transferSizeBytes);
+}
+
 int pull_Internal_Status_Log(tDevice *device, bool currentOrSaved, uint8_t islDataSet, bool saveToFile, uint8_t* ptrData, uint32_t dataSize, const char * const filePath, uint32_t transferSizeBytes)
 {
     int ret = UNKNOWN;
@@ -1451,6 +1486,15 @@ int pull_Internal_Status_Log(tDevice *device, bool currentOrSaved, uint8_t islDa
     return ret;
 }
 
+int pull_Compressed_Internal_Status_Log(tDevice *device, bool currentOrSaved, uint8_t islDataSet, const char * const filePath, uint32_t transferSizeBytes)
+{
+    if (device->drive_info.drive_type != ATA_DRIVE && device->drive_info.drive_type != SCSI_DRIVE)
+    {
+        return NOT_SUPPORTED;
+    }
+    return pull_New_Internal_Status_Log(device, currentOrSaved, islDataSet, true, true, NULL, 0, filePath, transferSizeBytes);
+}
+
 int print_Supported_Logs(tDevice *device, uint64_t flags)
 {
 	int retStatus = NOT_SUPPORTED;
@@ -1562,7 +1606,7 @@ int print_Supported_ATA_Logs(tDevice *device, uint64_t flags)
 	uint8_t *logBuffer = (uint8_t*)calloc(LEGACY_DRIVE_SEC_SIZE * sizeof(uint8_t), sizeof(uint8_t));
 	if (logBuffer)
 	{
-		retStatus = ata_Read_Log_Ext(device, ATA_LOG_DIRECTORY, 0, logBuffer, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0);
+		retStatus = ata_Read_Log_Directory_Cached(device, true, logBuffer, LEGACY_DRIVE_SEC_SIZE);
 		if (retStatus == SUCCESS)
 		{
 			uint16_t log = 0;
@@ -1696,6 +1740,20 @@ int print_Supported_SCSI_Error_History_Buffer_IDs(tDevice *device, uint64_t flag
     return ret;
 }
 
+//analyze mode decodes the log when there is a decoder for it. Otherwise, and in raw mode, the log is printed as hex
+static void print_Generic_Log(eLogDecodeType logType, uint8_t logAddress, uint8_t *logBuf, uint32_t logSize, eLogPullMode mode)
+{
+    if (mode == PULL_LOG_ANALYZE_MODE)
+    {
+        if (NOT_SUPPORTED != print_Decoded_Log(logType, logAddress, logBuf, logSize))
+        {
+            return;
+        }
+        printf("No decoder for this log. Showing the raw data.\n");
+    }
+    print_Data_Buffer(logBuf, logSize, true);
+}
+
 int pull_Generic_Log(tDevice *device, uint32_t logNum, uint32_t subpage, eLogPullMode mode, const char * const filePath, uint32_t transferSizeBytes)
 {
 	int retStatus = NOT_SUPPORTED;
@@ -1723,9 +1781,11 @@ int pull_Generic_Log(tDevice *device, uint32_t logNum, uint32_t subpage, eLogPul
 		switch (mode)
 		{
 		case PULL_LOG_BIN_FILE_MODE:
-			retStatus = get_ATA_Log(device, logNum, logFileName, "bin", true, false, false, NULL, 0, filePath, transferSizeBytes);
+		case PULL_LOG_COMPRESSED_BIN_FILE_MODE:
+			retStatus = pull_ATA_Log(device, logNum, logFileName, "bin", mode == PULL_LOG_COMPRESSED_BIN_FILE_MODE, true, false, false, NULL, 0, filePath, transferSizeBytes);
 			break;
 		case PULL_LOG_RAW_MODE:
+		case PULL_LOG_ANALYZE_MODE:
 			if (SUCCESS == get_ATA_Log_Size(device, logNum, &logSize, true, false))
 			{
 				genericLogBuf = (uint8_t*)calloc(logSize * sizeof(uint8_t), sizeof(uint8_t));
@@ -1734,7 +1794,7 @@ int pull_Generic_Log(tDevice *device, uint32_t logNum, uint32_t subpage, eLogPul
 					retStatus = get_ATA_Log(device, logNum, NULL, NULL, true, false, true, genericLogBuf, logSize, NULL, transferSizeBytes);
 					if (SUCCESS == retStatus)
 					{
-						print_Data_Buffer(genericLogBuf, logSize, true);
+						print_Generic_Log(LOG_DECODE_ATA_LOG, (uint8_t)logNum, genericLogBuf, logSize, mode);
 					}
 				}
 				else
@@ -1751,9 +1811,11 @@ int pull_Generic_Log(tDevice *device, uint32_t logNum, uint32_t subpage, eLogPul
         switch (mode)
         {
         case PULL_LOG_BIN_FILE_MODE:
-            retStatus = get_SCSI_Log(device,logNum, subpage, logFileName, "bin", false, NULL, 0, filePath);
+        case PULL_LOG_COMPRESSED_BIN_FILE_MODE:
+            retStatus = pull_SCSI_Log(device, logNum, subpage, logFileName, "bin", mode == PULL_LOG_COMPRESSED_BIN_FILE_MODE, false, NULL, 0, filePath);
             break;
         case PULL_LOG_RAW_MODE:
+        case PULL_LOG_ANALYZE_MODE:
             if (SUCCESS == get_SCSI_Log_Size(device, logNum, subpage, &logSize))
             {
                 genericLogBuf = (uint8_t*)calloc(logSize * sizeof(uint8_t), sizeof(uint8_t));
@@ -1762,7 +1824,7 @@ int pull_Generic_Log(tDevice *device, uint32_t logNum, uint32_t subpage, eLogPul
 					retStatus = get_SCSI_Log(device, logNum, subpage, NULL, NULL, true, genericLogBuf, logSize, NULL);
 					if (SUCCESS == retStatus)
 					{
-						print_Data_Buffer(genericLogBuf, logSize, true);
+						print_Generic_Log(LOG_DECODE_SCSI_LOG_PAGE, (uint8_t)logNum, genericLogBuf, logSize, mode);
 					}
 				}
 				else
@@ -1798,7 +1860,8 @@ int pull_Generic_Error_History(tDevice *device, uint8_t bufferID, eLogPullMode m
     switch (mode)
     {
     case PULL_LOG_BIN_FILE_MODE:
-        retStatus = get_SCSI_Error_History(device, bufferID, logFileName, false, rb16, "bin", false, NULL, 0, filePath, transferSizeBytes, NULL);
+    case PULL_LOG_COMPRESSED_BIN_FILE_MODE:
+        retStatus = pull_SCSI_Error_History(device, bufferID, logFileName, false, rb16, "bin", mode == PULL_LOG_COMPRESSED_BIN_FILE_MODE, false, NULL, 0, filePath, transferSizeBytes, NULL);
         break;
     case PULL_LOG_RAW_MODE:
         if (SUCCESS == get_SCSI_Error_History_Size(device, bufferID, &logSize, false, rb16))
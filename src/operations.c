@@ -17,6 +17,7 @@
 #include "ata_helper_func.h"
 #include "scsi_helper_func.h"
 #include "nvme_helper_func.h"
+#include "device_page_cache.h"
 #if !defined(DISABLE_NVME_PASSTHROUGH)
 #include "math.h"
 #endif
@@ -153,6 +154,7 @@ int ata_Set_Read_Look_Ahead(tDevice *device, bool readLookAheadEnableDisable)
     {
         ret = ata_Set_Features(device, SF_DISABLE_READ_LOOK_AHEAD_FEATURE, 0, 0, 0, 0);
     }
+    invalidate_Device_Page_Cache(device);//the enabled bit is in the identify data
     return ret;
 }
 
@@ -235,6 +237,7 @@ int ata_Set_Write_Cache(tDevice *device, bool writeCacheEnableDisable)
     {
         ret = ata_Set_Features(device, SF_DISABLE_VOLITILE_WRITE_CACHE, 0, 0, 0, 0);
     }
+    invalidate_Device_Page_Cache(device);//the enabled bit is in the identify data
     return ret;
 }
 
@@ -688,6 +691,7 @@ int enable_Disable_PUIS_Feature(tDevice *device, bool enable)
             {
                 ret = ata_Set_Features(device, SF_DISABLE_PUIS_FEATURE, 0, 0, 0, 0);
             }
+            invalidate_Device_Page_Cache(device);//the enabled bit is in the identify data
         }
     }
     return ret;
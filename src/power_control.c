@@ -15,6 +15,7 @@
 #include "operations_Common.h"
 #include "power_control.h"
 #include "logs.h"
+#include "device_page_cache.h"
 
 //There is no specific way to enable or disable this on SCSI, so this simulates the bahaviour according to what we see with ATA
 int scsi_Enable_Disable_EPC_Feature(tDevice *device, eEPCFeatureSet lba_field)
@@ -68,6 +69,7 @@ int enable_Disable_EPC_Feature(tDevice *device, eEPCFeatureSet lba_field)
     if (device->drive_info.drive_type == ATA_DRIVE)
     {
         ret = ata_Set_Features(device, SF_EXTENDED_POWER_CONDITIONS, 0, lba_field, 0,0);
+        invalidate_Device_Page_Cache(device);//the enabled bit is in the identify data
     }
     else if (device->drive_info.drive_type == SCSI_DRIVE)
     {
@@ -466,7 +468,7 @@ int scsi_Set_Device_Power_Mode(tDevice *device, bool restoreDefaults, bool enabl
         perror("calloc failure!");
         return MEMORY_FAILURE;
     }
-    if (SUCCESS == scsi_Inquiry(device, scsiDataBuffer, VPD_POWER_CONDITION_LEN, POWER_CONDITION, true, false))
+    if (SUCCESS == scsi_Inquiry_Cached(device, scsiDataBuffer, VPD_POWER_CONDITION_LEN, POWER_CONDITION, true))
     {
         if (scsiDataBuffer[1] != POWER_CONDITION)//make sure we got the correct page...if we did, we will proceed to do what we can with the other passed in options
         {
@@ -893,7 +895,7 @@ int get_Power_Consumption_Identifiers(tDevice *device, ptrPowerConsumptionIdenti
             {
                 return MEMORY_FAILURE;
             }
-            if (SUCCESS == scsi_Inquiry(device, powerConsumptionPage, powerConsumptionLength, POWER_CONSUMPTION, true, false))
+            if (SUCCESS == scsi_Inquiry_Cached(device, powerConsumptionPage, powerConsumptionLength, POWER_CONSUMPTION, true))
             {
                 ret = SUCCESS;
                 //now get all the power consumption descriptors into the struct
@@ -1223,6 +1225,7 @@ int enable_Disable_APM_Feature(tDevice *device, bool enable)
                     ret = NOT_SUPPORTED;
                 }
             }
+            invalidate_Device_Page_Cache(device);//the enabled bit and APM level are in the identify data
         }
     }
     return ret;
@@ -1244,6 +1247,7 @@ int set_APM_Level(tDevice *device, uint8_t apmLevel)
         {
             //subcommand 05 with the apmLevel in the count field
             ret = ata_Set_Features(device, SF_ENABLE_APM_FEATURE, apmLevel, 0, 0, 0);
+            invalidate_Device_Page_Cache(device);//the APM level is in the identify data
         }
     }
     return ret;
@@ -1659,6 +1663,7 @@ int sata_Set_Device_Initiated_Interface_Power_State_Transitions(tDevice *device,
                 ret = ata_Set_Features(device, SF_DISABLE_SATA_FEATURE, 0x03, 0, 0, 0);
             }
             //Issue an identify to update the identify data...
+            invalidate_Device_Page_Cache(device);
             if (device->drive_info.drive_type == ATA_DRIVE)
             {
                 ata_Identify(device, (uint8_t*)&device->drive_info.IdentifyData.ata.Word000, LEGACY_DRIVE_SEC_SIZE);
@@ -1726,6 +1731,7 @@ int sata_Set_Device_Automatic_Partioan_To_Slumber_Transtisions(tDevice *device,
                     ret = ata_Set_Features(device, SF_DISABLE_SATA_FEATURE, 0x07, 0, 0, 0);
                 }
                 //Issue an identify to update the identify data...
+                invalidate_Device_Page_Cache(device);
                 if (device->drive_info.drive_type == ATA_DRIVE)
                 {
                     ata_Identify(device, (uint8_t*)&device->drive_info.IdentifyData.ata.Word000, LEGACY_DRIVE_SEC_SIZE);
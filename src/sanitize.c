@@ -14,6 +14,7 @@
 
 #include "operations_Common.h"
 #include "sanitize.h"
+#include "device_page_cache.h"
 
 int get_Sanitize_Progress(tDevice *device, double *percentComplete, bool *sanitizeInProgress)
 {
@@ -360,6 +361,8 @@ int run_Sanitize_Operation(tDevice *device, eSanitizeOperations sanitizeOperatio
         }
     }
 
+    //everything below changes what the drive reports in identify/inquiry data (including the freeze locks)
+    invalidate_Device_Page_Cache(device);
     //start the sanitize operation requested
     switch (sanitizeOperation)
     {
@@ -19,6 +19,7 @@
 #include "dst.h"
 #include "sanitize.h"
 #include "format_unit.h"
+#include "device_page_cache.h"
 
 int seagate_ata_SCT_SATA_phy_speed(tDevice *device, bool useGPL, bool useDMA, uint8_t speedGen)
 {
@@ -291,6 +292,10 @@ int enable_Low_Current_Spin_Up(tDevice *device)
                 ret = SUCCESS;
             }
         }
+        if (ret == SUCCESS)
+        {
+            invalidate_Device_Page_Cache(device);//the low current spin up bit is in the identify data
+        }
     }
     return ret;
 }
@@ -317,6 +322,10 @@ int disable_Low_Current_Spin_Up(tDevice *device)
                 ret = SUCCESS;
             }
         }
+        if (ret == SUCCESS)
+        {
+            invalidate_Device_Page_Cache(device);//the low current spin up bit is in the identify data
+        }
     }
     return ret;
 }
@@ -631,6 +640,10 @@ int seagate_Set_Power_Balance(tDevice *device, bool enable)
         {
             ret = ata_Set_Features(device, 0x5C, 0, 2, 0, 0);
         }
+        if (ret == SUCCESS)
+        {
+            invalidate_Device_Page_Cache(device);//the power balance enabled bit is in the identify data
+        }
     }
     return ret;
 }
\ No newline at end of file
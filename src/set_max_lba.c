@@ -15,6 +15,7 @@
 #include "operations_Common.h"
 #include "set_max_lba.h"
 #include "scsi_helper_func.h"
+#include "device_page_cache.h"
 
 int ata_Get_Native_Max_LBA(tDevice *device, uint64_t *nativeMaxLBA)
 {
@@ -209,5 +210,9 @@ int set_Max_LBA(tDevice *device, uint64_t newMaxLBA, bool reset)
         }
         ret = NOT_SUPPORTED;
     }
+    if (ret != NOT_SUPPORTED)
+    {
+        invalidate_Device_Page_Cache(device);
+    }
     return ret;
 }
\ No newline at end of file
@@ -15,6 +15,7 @@
 #include "set_sector_size.h"
 #include "format_unit.h"
 #include "logs.h"
+#include "device_page_cache.h"
 
 bool is_Set_Sector_Configuration_Supported(tDevice *device)
 {
@@ -316,6 +317,7 @@ int set_Sector_Configuration(tDevice *device, uint32_t sectorSize)
             }
             ret = run_Format_Unit(device, formatUnitParameters, false);
         }
+        invalidate_Device_Page_Cache(device);
     }
     return ret;
 }
@@ -14,6 +14,7 @@
 
 #include "operations_Common.h"
 #include "smart.h"
+#include "device_page_cache.h"
 
 int get_SMART_Attributes(tDevice *device, smartLogData * smartAttrs)
 {
@@ -79,571 +80,275 @@ int get_SMART_Attributes(tDevice *device, smartLogData * smartAttrs)
     return ret;
 }
 
-void get_Attribute_Name(tDevice *device, uint8_t attributeNumber, char **attributeName)
+//Attribute names by vendor family. Indexed by [eATAAttributeNameTable][attribute number].
+//Sometimes there's overlap between families and sometimes there isn't, so each family gets its own row so the attributes can be named according to the respective specs for each drive.
+typedef enum _eATAAttributeNameTable
 {
-    eSeagateFamily isSeagateDrive = is_Seagate_Family(device);
-    /*
-    I broke the attribute name finder apart because sometimes there's overlap and sometimes there isn't.
-    Also, this will let me name the attributes according to the respective specs for each drive.
-    */
-    memset(*attributeName, 0, MAX_ATTRIBUTE_NAME_LENGTH);
-    switch (isSeagateDrive)
+    ATA_ATTRIBUTE_NAMES_SEAGATE,
+    ATA_ATTRIBUTE_NAMES_SEAGATE_VENDOR_D_E,
+    ATA_ATTRIBUTE_NAMES_SAMSUNG,
+    ATA_ATTRIBUTE_NAMES_MAXTOR,
+    ATA_ATTRIBUTE_NAMES_SEAGATE_VENDOR_B,
+    ATA_ATTRIBUTE_NAMES_SEAGATE_VENDOR_C,
+    ATA_ATTRIBUTE_NAMES_TABLE_COUNT
+}eATAAttributeNameTable;
+
+static const char * const ataAttributeNames[ATA_ATTRIBUTE_NAMES_TABLE_COUNT][256] = {
+    [ATA_ATTRIBUTE_NAMES_SEAGATE] = {//Seagate HDD
+        [1] = "Read Error Rate",
+        [3] = "Spin Up Time",
+        [4] = "Start/Stop Count",
+        [5] = "Retired Sectors Count",
+        [7] = "Seek Error Rate",
+        [9] = "Power On Hours",
+        [10] = "Spin Retry Count",
+        [12] = "Drive Power Cycle Count",
+        [174] = "Unexpected Power Loss Count",
+        [183] = "PHY Counter Events",
+        [184] = "IOEDC Count",
+        [187] = "Reported Un-correctable",
+        [188] = "Command Timeout",
+        [189] = "High Fly Writes",
+        [190] = "Airflow Temperature",
+        [191] = "Shock Sensor Counter",
+        [192] = "Emergency Retract Count",
+        [193] = "Load-Unload Count",
+        [194] = "Temperature",
+        [195] = "ECC On The Fly Count",
+        [197] = "Pending-Sparing Count",
+        [199] = "Ultra DMA CRC Error",
+        [200] = "Pressure Measurement Limit",
+        [230] = "Life Curve Status",
+        [231] = "SSD Life Left",
+        [235] = "SSD Power Less Mgmt Life Left",//SSD Power Loss Mgmt Life Left
+        [240] = "Head Flight Hours",
+        [241] = "Lifetime Writes From Host",
+        [242] = "Lifetime Reads From Host",
+        [254] = "Free Fall Event",
+    },
+    [ATA_ATTRIBUTE_NAMES_SEAGATE_VENDOR_D_E] = {//SEAGATE_VENDOR_D and SEAGATE_VENDOR_E
+        [1] = "Read Error Rate",
+        [5] = "Retired Sectors Count",
+        [9] = "Power On Hours",
+        [12] = "Drive Power Cycle Count",
+        [171] = "Program Fail Count",
+        [172] = "Erase Fail Count",
+        [181] = "Program Fail Count",
+        [182] = "Erase Fail Count",
+        [194] = "Temperature",
+        [201] = "Soft Error Rate",
+        [204] = "Soft ECC Correction Rate",
+        [231] = "SSD Life Left",
+        [234] = "Lifetime Writes To Flash in GiB",//Lifetime Write to Flash
+        [241] = "Lifetime Writes From Host in GiB",
+        [242] = "Lifetime Reads From Host in GiB",
+        [250] = "Lifetime NAND Read Retries",
+    },
+    [ATA_ATTRIBUTE_NAMES_SAMSUNG] = {//Samsung
+        [1] = "Read Error Rate",
+        [2] = "Throughput Performance",
+        [3] = "Spin Up Time",
+        [4] = "Start/Stop Count",
+        [5] = "Retired Sectors Count",
+        [7] = "Seek Error Rate",
+        [8] = "Seek Time Performance",
+        [9] = "Power On Hours",
+        [10] = "Spin Retry Count",
+        [11] = "Calibration Retry Count",
+        [12] = "Drive Power Cycle Count",
+        [184] = "End To End Detection",
+        [187] = "Reported Un-correctable",
+        [188] = "Command Timeout",
+        [190] = "Airflow Temperature",
+        [191] = "Shock Sensor Counter",
+        [192] = "Emergency Retract Count",
+        [193] = "Load-Unload Count",
+        [194] = "Temperature",
+        [195] = "ECC On The Fly Count",
+        [196] = "Re-allocate Sector Event",
+        [197] = "Pending Sector Count",//Pending-Sparing Count
+        [198] = "Offline Uncorrectable Sectors",//offlince uncorrectable sectors
+        [199] = "Ultra DMA CRC Error",
+        [200] = "Write Error Rate",
+        [201] = "Soft Error Rate",
+        [223] = "Load Retry Count",
+        [225] = "Load Cycle Count",
+    },
+    [ATA_ATTRIBUTE_NAMES_MAXTOR] = {//Maxtor. names are from here: https://www.smartmontools.org/wiki/AttributesMaxtor
+        [1] = "Raw Read Error Rate",
+        [2] = "Throughput Performance",
+        [3] = "Spin Up Time",
+        [4] = "Start/Stop Count",
+        [5] = "Reallocated Sector Count",
+        [6] = "Start/Stop Count",
+        [7] = "Seek Error Rate",
+        [8] = "Seek Time Performance",
+        [9] = "Power-On Hours",
+        [10] = "Spin-Up Retry Count",
+        [11] = "Calibration Retry Count",
+        [12] = "Power Cycle Count",
+        [13] = "Soft Read Error Rate",
+        [192] = "Power-Off Retract Cycle Count",
+        [193] = "Load/Unload Cycle Count",
+        [194] = "HDA Temperature",
+        [195] = "Hardware ECC Recovered",
+        [196] = "Re-allocate Event Count",//Reallocated Event Count
+        [197] = "Current Pending Sector Count",
+        [198] = "Off-line Uncorrectable Count",//Offline Scan Uncorrectable Count
+        [199] = "Ultra DMA CRC Error Rate",
+        [200] = "Write Error Rate",
+        [201] = "Soft Read Error Rate",
+        [202] = "Data Address Mark Errors",//Data Addres Mark Errors
+        [203] = "Run Out Cancel",
+        [204] = "Soft ECC Correction",
+        [205] = "Thermal Asperity Rate",
+        [206] = "Flying Height",
+        [207] = "Spin High Current",
+        [208] = "Spin Buzz",
+        [209] = "Offline Seek Performance",
+        [220] = "Disk Shift",
+        [221] = "G-Sense Error Rate",
+        [222] = "Loaded Hours",
+        [223] = "Load/Unload Retry Count",
+        [224] = "Load Friction",
+        [225] = "Load/Unload Cycle Count",
+        [226] = "Load-In Time",
+        [227] = "Torgque Amplification Count",//Torque Amplification Count
+        [228] = "Power-Off Retract Cycle",
+        [230] = "GMR Head Amplitude",
+        [231] = "Temperature",
+        [240] = "Head Flying Hours",
+        [250] = "Read Error Retry Rate",
+    },
+    [ATA_ATTRIBUTE_NAMES_SEAGATE_VENDOR_B] = {//SEAGATE_VENDOR_B
+        [1] = "Raw Read Error Rate",
+        [5] = "Retired Block Count",
+        [9] = "Power On Hours",
+        [12] = "Drive Power Cycle Count",
+        [100] = "Total Erase Count",
+        [168] = "Min Power Cycle Count",
+        [169] = "Max Power Cycle Count",//Max power cycle count (seagate-vendor-b-c)
+        [171] = "Program Fail Count",
+        [172] = "Erase Fail Count",
+        [174] = "Unexpected Power Loss Count",
+        [175] = "Maximum Program Fail Count",
+        [176] = "Maximum Erase Fail Count",
+        [177] = "Wear Leveling Count",
+        [178] = "Used Reserve Block Count (Chip)",//Used Reserved Block Count for The Worst Die
+        [179] = "Used Reserve Block Count (Total)",//Used Reserved Block Count for SSD
+        [180] = "Unused Reserved Block Count (Total)",//reported IOEDC Error In Interval (Seagate/Samsung), End to End Error Detection Rate
+        [181] = "Program Fail Count",
+        [182] = "Erase Fail Count",
+        [183] = "SATA Downshift Count",//PHY Counter Events (Seagate), SATA Downshift Count (Seagate-vendor-b-c)
+        [184] = "End To End Error Detection Count",//IOEDC Count (Seagate), End to End Error Detection Count (Seagate-vendor-b-c)
+        [187] = "Reported Un-correctable",
+        [188] = "Command Timeout",
+        [190] = "SATA Error Counters",//Airflow Temperature (Seagate), SATA Error Counters (Seagate-vendor-b-c)
+        [194] = "Temperature",
+        [195] = "ECC On The Fly Count",//ECC On the Fly Count (Seagate)
+        [196] = "Re-allocate Sector Event",
+        [197] = "Current Pending Sector Count",//Pending-Sparing Count
+        [198] = "Off-line Uncorrectable Sectors",//offlince uncorrectable sectors
+        [199] = "Ultra DMA CRC Error",
+        [201] = "Uncorrectable Read Error Rate",//Uncorrectable Read Error Rate (Seagate-vendor-b-c)
+        [204] = "Soft ECC Correction Rate",
+        [212] = "Phy Error Count",
+        [231] = "SSD Life Left",
+        [234] = "NAND GiB Written",
+        [241] = "Lifetime Writes From Host in GiB",
+        [242] = "Lifetime Reads From Host in GiB",
+        [245] = "SSD Life Left %",
+        [250] = "Lifetime NAND Read Retries",
+    },
+    [ATA_ATTRIBUTE_NAMES_SEAGATE_VENDOR_C] = {//SEAGATE_VENDOR_C
+        [1] = "Raw Read Error Rate",
+        [5] = "Retired Block Count",
+        [9] = "Power On Hours",
+        [12] = "Drive Power Cycle Count",
+        [100] = "Total Erase Count",
+        [168] = "Min Power Cycle Count",
+        [169] = "Max Power Cycle Count",//Max power cycle count (seagate-vendor-b-c)
+        [171] = "Program Fail Count",
+        [172] = "Erase Fail Count",
+        [174] = "Unexpected Power Loss Count",
+        [175] = "Maximum Program Fail Count",
+        [176] = "Maximum Erase Fail Count",
+        [177] = "Endurance Used",//Wear Leveling Count
+        [178] = "Used Reserve Block Count (Chip)",//Used Reserved Block Count for The Worst Die
+        [179] = "Used Reserve Block Count (Total)",//Used Reserved Block Count for SSD
+        [180] = "End To End Error Detection Rate",//reported IOEDC Error In Interval (Seagate/Samsung), End to End Error Detection Rate
+        [181] = "Program Fail Count",
+        [182] = "Erase Fail Count",
+        [183] = "SATA Downshift Count",//PHY Counter Events (Seagate), SATA Downshift Count (Seagate-vendor-b-c)
+        [184] = "End To End Error Detection Count",//IOEDC Count (Seagate), End to End Error Detection Count (Seagate-vendor-b-c)
+        [187] = "Reported Un-correctable",
+        [188] = "Command Timeout",
+        [190] = "SATA Error Counters",//Airflow Temperature (Seagate), SATA Error Counters (Seagate-vendor-b-c)
+        [194] = "Temperature",
+        [195] = "ECC On The Fly Count",//ECC On the Fly Count (Seagate)
+        [196] = "Re-allocate Sector Event",
+        [197] = "Current Pending Sector Count",//Pending-Sparing Count
+        [198] = "Off-line Uncorrectable Sectors",//offlince uncorrectable sectors
+        [199] = "Ultra DMA CRC Error",
+        [201] = "Uncorrectable Read Error Rate",//Uncorrectable Read Error Rate (Seagate-vendor-b-c)
+        [204] = "Soft ECC Correction Rate",
+        [212] = "Phy Error Count",
+        [231] = "SSD Life Left",
+        [234] = "Vendor Specific",
+        [241] = "Total LBAs Written",//Lifetime Writes from Host
+        [242] = "Total LBAs Read",//Lifetime Reads from Host
+        [245] = "SSD Life Left %",
+        [250] = "Read Error Retry Rate",//Lifetime NAND Read Retries
+    }
+};
+
+const char* get_ATA_SMART_Attribute_Name(eSeagateFamily family, uint8_t attributeNumber)
+{
+    eATAAttributeNameTable table = ATA_ATTRIBUTE_NAMES_TABLE_COUNT;
+    switch (family)
     {
     case SEAGATE:
-        switch (attributeNumber)
-        {
-        case 1://read error rate
-            sprintf(*attributeName, "Read Error Rate");
-            break;
-        case 3://spin up time
-            sprintf(*attributeName, "Spin Up Time");
-            break;
-        case 4://start stop count
-            sprintf(*attributeName, "Start/Stop Count");
-            break;
-        case 5://retired sectors count
-            sprintf(*attributeName, "Retired Sectors Count");
-            break;
-        case 7://Seek Error Rate
-            sprintf(*attributeName, "Seek Error Rate");
-            break;
-        case 9: //Power on Hours
-            sprintf(*attributeName, "Power On Hours");
-            break;
-        case 10: //Spin Retry Count
-            sprintf(*attributeName, "Spin Retry Count");
-            break;
-        case 12: //Drive Power Cycle Count
-            sprintf(*attributeName, "Drive Power Cycle Count");
-            break;
-        case 174: //Unexpected Power Loss Count
-            sprintf(*attributeName, "Unexpected Power Loss Count");
-            break;
-        case 183://PHY Counter Events
-            sprintf(*attributeName, "PHY Counter Events");
-            break;
-        case 184://IOEDC Count
-            sprintf(*attributeName, "IOEDC Count");
-            break;
-        case 187: //Reported Un-correctable
-            sprintf(*attributeName, "Reported Un-correctable");
-            break;
-        case 188: //Command Timeout
-            sprintf(*attributeName, "Command Timeout");
-            break;
-        case 189: //High Fly Writes
-            sprintf(*attributeName, "High Fly Writes");
-            break;
-        case 190: //Airflow Temperature
-            sprintf(*attributeName, "Airflow Temperature");
-            break;
-        case 191: //Shock Sensor Counter
-            sprintf(*attributeName, "Shock Sensor Counter");
-            break;
-        case 192: //Emergency Retract Count
-            sprintf(*attributeName, "Emergency Retract Count");
-            break;
-        case 193: //Load-Unload Count
-            sprintf(*attributeName, "Load-Unload Count");
-            break;
-        case 194: //Temperature
-            sprintf(*attributeName, "Temperature");
-            break;
-        case 195: //ECC On the Fly Count
-            sprintf(*attributeName, "ECC On The Fly Count");
-            break;
-        case 197: //Pending-Sparing Count
-            sprintf(*attributeName, "Pending-Sparing Count");
-            break;
-        case 199: //Ultra DMA CRC Error
-            sprintf(*attributeName, "Ultra DMA CRC Error");
-            break;
-        case 200: //Pressure Measurement Limit
-            sprintf(*attributeName, "Pressure Measurement Limit");
-            break;
-        case 230: //Life Curve Status
-            sprintf(*attributeName, "Life Curve Status");
-            break;
-        case 231: //SSD Life Left
-            sprintf(*attributeName, "SSD Life Left");
-            break;
-        case 235: //SSD Power Loss Mgmt Life Left
-            sprintf(*attributeName, "SSD Power Less Mgmt Life Left");
-            break;
-        case 240: //Head flight Hours
-            sprintf(*attributeName, "Head Flight Hours");
-            break;
-        case 241: //Lifetime Writes from Host
-            sprintf(*attributeName, "Lifetime Writes From Host");
-            break;
-        case 242: //Lifetime Reads from Host
-            sprintf(*attributeName, "Lifetime Reads From Host");
-            break;
-        case 254: //Free Fall Event
-            sprintf(*attributeName, "Free Fall Event");
-            break;
-        default:
-            break;
-        }
+        table = ATA_ATTRIBUTE_NAMES_SEAGATE;
         break;
     case SEAGATE_VENDOR_D://with Seagate for now. Might move sometime
     case SEAGATE_VENDOR_E://with Seagate for now. Might move sometime
-        switch (attributeNumber)
-        {
-        case 1://read error rate
-            sprintf(*attributeName, "Read Error Rate");
-            break;
-        case 5://retired sectors count
-            sprintf(*attributeName, "Retired Sectors Count");
-            break;
-        case 9: //Power on Hours
-            sprintf(*attributeName, "Power On Hours");
-            break;
-        case 12: //Drive Power Cycle Count
-            sprintf(*attributeName, "Drive Power Cycle Count");
-            break;
-        case 171: //Program Fail Count
-            sprintf(*attributeName, "Program Fail Count");
-            break;
-        case 172: //Erase Fail Count
-            sprintf(*attributeName, "Erase Fail Count");
-            break;
-        case 181: //Program Fail Count
-            sprintf(*attributeName, "Program Fail Count");
-            break;
-        case 182: //Erase Fail Count
-            sprintf(*attributeName, "Erase Fail Count");
-            break;
-        case 194: //Temperature
-            sprintf(*attributeName, "Temperature");
-            break;
-        case 201: //Soft Error Rate
-            sprintf(*attributeName, "Soft Error Rate");
-            break;
-        case 204: //Soft ECC Correction Rate
-            sprintf(*attributeName, "Soft ECC Correction Rate");
-            break;
-        case 231: //SSD Life Left
-            sprintf(*attributeName, "SSD Life Left");
-            break;
-        case 234: //Lifetime Write to Flash
-            sprintf(*attributeName, "Lifetime Writes To Flash in GiB");
-            break;
-        case 241: //Lifetime Writes from Host
-            sprintf(*attributeName, "Lifetime Writes From Host in GiB");
-            break;
-        case 242: //Lifetime Reads from Host
-            sprintf(*attributeName, "Lifetime Reads From Host in GiB");
-            break;
-        case 250: //Lifetime NAND Read Retries
-            sprintf(*attributeName, "Lifetime NAND Read Retries");
-            break;
-        default:
-            break;
-        }
+        table = ATA_ATTRIBUTE_NAMES_SEAGATE_VENDOR_D_E;
         break;
     case SAMSUNG:
-        switch (attributeNumber)
-        {
-        case 1://read error rate
-            sprintf(*attributeName, "Read Error Rate");
-            break;
-        case 2: //Throughput Performance
-            sprintf(*attributeName, "Throughput Performance");
-            break;
-        case 3://spin up time
-            sprintf(*attributeName, "Spin Up Time");
-            break;
-        case 4://start stop count
-            sprintf(*attributeName, "Start/Stop Count");
-            break;
-        case 5://retired sectors count
-            sprintf(*attributeName, "Retired Sectors Count");
-            break;
-        case 7://Seek Error Rate
-            sprintf(*attributeName, "Seek Error Rate");
-            break;
-        case 8://seek time performance.
-            sprintf(*attributeName, "Seek Time Performance");
-            break;
-        case 9: //Power on Hours
-            sprintf(*attributeName, "Power On Hours");
-            break;
-        case 10: //Spin Retry Count
-            sprintf(*attributeName, "Spin Retry Count");
-            break;
-        case 11: //calibration retry count
-            sprintf(*attributeName, "Calibration Retry Count");
-            break;
-        case 12: //Drive Power Cycle Count
-            sprintf(*attributeName, "Drive Power Cycle Count");
-            break;
-        case 184://End to End detection
-            sprintf(*attributeName, "End To End Detection");
-            break;
-        case 187: //Reported Un-correctable
-            sprintf(*attributeName, "Reported Un-correctable");
-            break;
-        case 188: //Command Timeout
-            sprintf(*attributeName, "Command Timeout");
-            break;
-        case 190: //Airflow Temperature
-            sprintf(*attributeName, "Airflow Temperature");
-            break;
-        case 191: //Shock Sensor Counter
-            sprintf(*attributeName, "Shock Sensor Counter");
-            break;
-        case 192: //Emergency Retract Count
-            sprintf(*attributeName, "Emergency Retract Count");
-            break;
-        case 193: //Load-Unload Count
-            sprintf(*attributeName, "Load-Unload Count");
-            break;
-        case 194: //Temperature
-            sprintf(*attributeName, "Temperature");
-            break;
-        case 195: //ECC On the Fly Count
-            sprintf(*attributeName, "ECC On The Fly Count");
-            break;
-        case 196: //Re-allocate Sector Event
-            sprintf(*attributeName, "Re-allocate Sector Event");
-            break;
-        case 197: //Pending-Sparing Count
-            sprintf(*attributeName, "Pending Sector Count");
-            break;
-        case 198://offlince uncorrectable sectors
-            sprintf(*attributeName, "Offline Uncorrectable Sectors");
-            break;
-        case 199: //Ultra DMA CRC Error
-            sprintf(*attributeName, "Ultra DMA CRC Error");
-            break;
-        case 200: //Write Error Rate
-            sprintf(*attributeName, "Write Error Rate");
-            break;
-        case 201: //Soft Error Rate
-            sprintf(*attributeName, "Soft Error Rate");
-            break;
-        case 223: //Load Retry Count
-            sprintf(*attributeName, "Load Retry Count");
-            break;
-        case 225: //Load Cycle Count
-            sprintf(*attributeName, "Load Cycle Count");
-            break;
-        default:
-            break;
-        }
+        table = ATA_ATTRIBUTE_NAMES_SAMSUNG;
         break;
-    case MAXTOR: //names are from here: https://www.smartmontools.org/wiki/AttributesMaxtor
-        switch (attributeNumber)
-        {
-        case 1: //raw read error rate
-            sprintf(*attributeName, "Raw Read Error Rate");
-            break;
-        case 2: //throughput performance
-            sprintf(*attributeName, "Throughput Performance");
-            break;
-        case 3: //spin-up time
-            sprintf(*attributeName, "Spin Up Time");
-            break;
-        case 4: //start/stop count
-            sprintf(*attributeName, "Start/Stop Count");
-            break;
-        case 5: //Reallocated Sector Count
-            sprintf(*attributeName, "Reallocated Sector Count");
-            break;
-        case 6: //start/stop count
-            sprintf(*attributeName, "Start/Stop Count");
-            break;
-        case 7: //seek error Rate
-            sprintf(*attributeName, "Seek Error Rate");
-            break;
-        case 8: //seek time performance
-            sprintf(*attributeName, "Seek Time Performance");
-            break;
-        case 9: //power on hours
-            sprintf(*attributeName, "Power-On Hours");
-            break;
-        case 10: //spin-up retry count
-            sprintf(*attributeName, "Spin-Up Retry Count");
-            break;
-        case 11: //calibration retry count
-            sprintf(*attributeName, "Calibration Retry Count");
-            break;
-        case 12: //power cycle count
-            sprintf(*attributeName, "Power Cycle Count");
-            break;
-        case 13: //soft read error rate
-            sprintf(*attributeName, "Soft Read Error Rate");
-            break;
-        case 192: //power-off retract cycle count
-            sprintf(*attributeName, "Power-Off Retract Cycle Count");
-            break;
-        case 193: //Load/Unload Cycle Count
-            sprintf(*attributeName, "Load/Unload Cycle Count");
-            break;
-        case 194: //HDA Temperature
-            sprintf(*attributeName, "HDA Temperature");
-            break;
-        case 195: //Hardware ECC Recovered
-            sprintf(*attributeName, "Hardware ECC Recovered");
-            break;
-        case 196: //Reallocated Event Count
-            sprintf(*attributeName, "Re-allocate Event Count");
-            break;
-        case 197: //Current Pending Sector Count
-            sprintf(*attributeName, "Current Pending Sector Count");
-            break;
-        case 198: //Offline Scan Uncorrectable Count
-            sprintf(*attributeName, "Off-line Uncorrectable Count");
-            break;
-        case 199: //UltraDMA CRC Error Rate
-            sprintf(*attributeName, "Ultra DMA CRC Error Rate");
-            break;
-        case 200: //Write Error Rate
-            sprintf(*attributeName, "Write Error Rate");
-            break;
-        case 201: //Soft Read Error Rate
-            sprintf(*attributeName, "Soft Read Error Rate");
-            break;
-        case 202: //Data Addres Mark Errors
-            sprintf(*attributeName, "Data Address Mark Errors");
-            break;
-        case 203: //run out cancel
-            sprintf(*attributeName, "Run Out Cancel");
-            break;
-        case 204: //Soft ECC Correction
-            sprintf(*attributeName, "Soft ECC Correction");
-            break;
-        case 205: //Thermal Asperity Rate
-            sprintf(*attributeName, "Thermal Asperity Rate");
-            break;
-        case 206: //Flying Height
-            sprintf(*attributeName, "Flying Height");
-            break;
-        case 207: //Spin High Current
-            sprintf(*attributeName, "Spin High Current");
-            break;
-        case 208: //Spin Buzz
-            sprintf(*attributeName, "Spin Buzz");
-            break;
-        case 209: //Offline Seek Performance
-            sprintf(*attributeName, "Offline Seek Performance");
-            break;
-        case 220: //Disk Shift
-            sprintf(*attributeName, "Disk Shift");
-            break;
-        case 221: //G-Sense Error Rate
-            sprintf(*attributeName, "G-Sense Error Rate");
-            break;
-        case 222: //Loaded Hours
-            sprintf(*attributeName, "Loaded Hours");
-            break;
-        case 223: //Load/Unload Retry Count
-            sprintf(*attributeName, "Load/Unload Retry Count");
-            break;
-        case 224: //Load Friction
-            sprintf(*attributeName, "Load Friction");
-            break;
-        case 225: //Load/Unload Cycle Count
-            sprintf(*attributeName, "Load/Unload Cycle Count");
-            break;
-        case 226: //Load-in Time
-            sprintf(*attributeName, "Load-In Time");
-            break;
-        case 227: //Torque Amplification Count
-            sprintf(*attributeName, "Torgque Amplification Count");
-            break;
-        case 228: //Power-Off Retract Cycle
-            sprintf(*attributeName, "Power-Off Retract Cycle");
-            break;
-        case 230: //GMR Head Amplitude
-            sprintf(*attributeName, "GMR Head Amplitude");
-            break;
-        case 231: //Temperature
-            sprintf(*attributeName, "Temperature");
-            break;
-        case 240: //Head Flying Hours
-            sprintf(*attributeName, "Head Flying Hours");
-            break;
-        case 250: //Read Error Retry Rate
-            sprintf(*attributeName, "Read Error Retry Rate");
-            break;
-        default:
-            break;
-        }
+    case MAXTOR:
+        table = ATA_ATTRIBUTE_NAMES_MAXTOR;
         break;
     case SEAGATE_VENDOR_B:
+        table = ATA_ATTRIBUTE_NAMES_SEAGATE_VENDOR_B;
+        break;
     case SEAGATE_VENDOR_C:
-        switch (attributeNumber)
-        {
-        case 1://read error rate
-            sprintf(*attributeName, "Raw Read Error Rate");
-            break;
-        case 5://retired block count
-            sprintf(*attributeName, "Retired Block Count");
-            break;
-        case 9: //Power on Hours
-            sprintf(*attributeName, "Power On Hours");
-            break;
-        case 12: //Drive Power Cycle Count
-            sprintf(*attributeName, "Drive Power Cycle Count");
-            break;
-        case 100: //Total Erase Count
-            sprintf(*attributeName, "Total Erase Count");
-            break;
-        case 168: //Min Power Cycle Count
-            sprintf(*attributeName, "Min Power Cycle Count");
-            break;
-        case 169: //Max power cycle count (seagate-vendor-b-c)
-            sprintf(*attributeName, "Max Power Cycle Count");
-            break;
-        case 171: //Program Fail Count
-            sprintf(*attributeName, "Program Fail Count");
-            break;
-        case 172: //Erase Fail Count
-            sprintf(*attributeName, "Erase Fail Count");
-            break;
-        case 174: //Unexpected Power Loss Count
-            sprintf(*attributeName, "Unexpected Power Loss Count");
-            break;
-        case 175: //Maximum Program Fail Count
-            sprintf(*attributeName, "Maximum Program Fail Count");
-            break;
-        case 176: //Maximum Erase Fail Count
-            sprintf(*attributeName, "Maximum Erase Fail Count");
-            break;
-        case 177: //Wear Leveling Count
-            if (isSeagateDrive == SEAGATE_VENDOR_B)
-            {
-                sprintf(*attributeName, "Wear Leveling Count");
-            }
-            else if (isSeagateDrive == SEAGATE_VENDOR_C)
-            {
-                sprintf(*attributeName, "Endurance Used");
-            }
-            break;
-        case 178: //Used Reserved Block Count for The Worst Die
-            sprintf(*attributeName, "Used Reserve Block Count (Chip)");
-            break;
-        case 179: //Used Reserved Block Count for SSD
-            sprintf(*attributeName, "Used Reserve Block Count (Total)");
-            break;
-        case 180: //reported IOEDC Error In Interval (Seagate/Samsung), End to End Error Detection Rate
-            if (isSeagateDrive == SEAGATE_VENDOR_C)
-            {
-                sprintf(*attributeName, "End To End Error Detection Rate");
-            }
-            else if (isSeagateDrive == SEAGATE_VENDOR_B)
-            {
-                sprintf(*attributeName, "Unused Reserved Block Count (Total)");
-            }
-            break;
-        case 181: //Program Fail Count
-            sprintf(*attributeName, "Program Fail Count");
-            break;
-        case 182: //Erase Fail Count
-            sprintf(*attributeName, "Erase Fail Count");
-            break;
-        case 183://PHY Counter Events (Seagate), SATA Downshift Count (Seagate-vendor-b-c)
-            sprintf(*attributeName, "SATA Downshift Count");
-            break;
-        case 184://IOEDC Count (Seagate), End to End Error Detection Count (Seagate-vendor-b-c)
-            sprintf(*attributeName, "End To End Error Detection Count");
-            break;
-        case 187: //Reported Un-correctable
-            sprintf(*attributeName, "Reported Un-correctable");
-            break;
-        case 188: //Command Timeout
-            sprintf(*attributeName, "Command Timeout");
-            break;
-        case 190: //Airflow Temperature (Seagate), SATA Error Counters (Seagate-vendor-b-c)
-            sprintf(*attributeName, "SATA Error Counters");
-            break;
-        case 194: //Temperature
-            sprintf(*attributeName, "Temperature");
-            break;
-        case 195: //ECC On the Fly Count (Seagate)
-            sprintf(*attributeName, "ECC On The Fly Count");
-            break;
-        case 196: //Re-allocate Sector Event
-            sprintf(*attributeName, "Re-allocate Sector Event");
-            break;
-        case 197: //Pending-Sparing Count
-            sprintf(*attributeName, "Current Pending Sector Count");
-            break;
-        case 198://offlince uncorrectable sectors
-            sprintf(*attributeName, "Off-line Uncorrectable Sectors");
-            break;
-        case 199: //Ultra DMA CRC Error
-            sprintf(*attributeName, "Ultra DMA CRC Error");
-            break;
-        case 201: //Uncorrectable Read Error Rate (Seagate-vendor-b-c)
-            sprintf(*attributeName, "Uncorrectable Read Error Rate");
-            break;
-        case 204: //Soft ECC Correction Rate
-            sprintf(*attributeName, "Soft ECC Correction Rate");
-            break;
-        case 212: //Phy Error Count
-            sprintf(*attributeName, "Phy Error Count");
-            break;
-        case 231: //SSD Life Left
-            sprintf(*attributeName, "SSD Life Left");
-            break;
-        case 234: //
-            if (isSeagateDrive == SEAGATE_VENDOR_B)
-            {
-                sprintf(*attributeName, "NAND GiB Written");
-            }
-            else if (isSeagateDrive == SEAGATE_VENDOR_C)
-            {
-                sprintf(*attributeName, "Vendor Specific");
-            }
-            break;
-        case 241: //Lifetime Writes from Host
-            if (isSeagateDrive == SEAGATE_VENDOR_B)
-            {
-                sprintf(*attributeName, "Lifetime Writes From Host in GiB");
-            }
-            else if (isSeagateDrive == SEAGATE_VENDOR_C)
-            {
-                sprintf(*attributeName, "Total LBAs Written");
-            }
-            break;
-        case 242: //Lifetime Reads from Host
-            if (isSeagateDrive == SEAGATE_VENDOR_B)
-            {
-                sprintf(*attributeName, "Lifetime Reads From Host in GiB");
-            }
-            else if (isSeagateDrive == SEAGATE_VENDOR_C)
-            {
-                sprintf(*attributeName, "Total LBAs Read");
-            }
-            break;
-        case 245: //SSD Life Left (%)
-            sprintf(*attributeName, "SSD Life Left %%");
-            break;
-        case 250: //Lifetime NAND Read Retries
-            if (isSeagateDrive == SEAGATE_VENDOR_B)
-            {
-                sprintf(*attributeName, "Lifetime NAND Read Retries");
-            }
-            else if (isSeagateDrive == SEAGATE_VENDOR_C)
-            {
-                sprintf(*attributeName, "Read Error Retry Rate");
-            }
-            break;
-        default:
-            break;
-        }
+        table = ATA_ATTRIBUTE_NAMES_SEAGATE_VENDOR_C;
         break;
     default:
-        break;
+        return NULL;
+    }
+    return ataAttributeNames[table][attributeNumber];
+}
+
+void get_Attribute_Name(tDevice *device, uint8_t attributeNumber, char **attributeName)
+{
+    const char *name = get_ATA_SMART_Attribute_Name(is_Seagate_Family(device), attributeNumber);
+    memset(*attributeName, 0, MAX_ATTRIBUTE_NAME_LENGTH);
+    if (name)
+    {
+        strncpy(*attributeName, name, MAX_ATTRIBUTE_NAME_LENGTH - 1);
     }
 }
 
-static void print_ATA_SMART_Attribute_Raw(ataSMARTValue *currentAttribute, char *attributeName)
+static void print_ATA_SMART_Attribute_Raw(ataSMARTValue *currentAttribute, const char *attributeName)
 {
     uint8_t rawIter = 0;
+    if (!attributeName)
+    {
+        attributeName = "";
+    }
     if (currentAttribute->data.attributeNumber != 0)
     {
         if (currentAttribute->isWarrantied)
@@ -668,51 +373,34 @@ static void print_ATA_SMART_Attribute_Raw(ataSMARTValue *currentAttribute, char
         }
         printf("h\n");
     }
-    //clear out the attribute name before looping again so we don't show dulicates
-    sprintf(attributeName, "                             ");
     return;
 }
 
 static void print_Raw_ATA_Attributes(tDevice *device, smartLogData *smartData)
 {
-    //making the attribute name seperate so that if we add is_Seagate() logic in we can turn on and off printing the name
-    char *attributeName = (char *)calloc(MAX_ATTRIBUTE_NAME_LENGTH, sizeof(char));
-    if (attributeName == NULL)
-    {
-        perror("Calloc Failure!\n");
-        return;
-    }
+    //look up the family once. The names come straight out of the table, so nothing needs to be formatted per attribute
+    eSeagateFamily family = is_Seagate_Family(device);
     printf("   # Attribute Name:                     Status: Nominal: Worst: Thresh: Raw (hex):\n");
     for (uint8_t iter = 0; iter < 255; ++iter)
     {
         if (smartData->attributes.ataSMARTAttr.attributes[iter].valid)
         {
-            get_Attribute_Name(device, iter, &attributeName);
-            print_ATA_SMART_Attribute_Raw(&smartData->attributes.ataSMARTAttr.attributes[iter], attributeName);
+            print_ATA_SMART_Attribute_Raw(&smartData->attributes.ataSMARTAttr.attributes[iter], get_ATA_SMART_Attribute_Name(family, iter));
         }
     }
-    safe_Free(attributeName);
 }
 
 static void print_Analyzed_ATA_Attributes(tDevice *device, smartLogData *smartData)
 {
-    //making the attribute name seperate so that if we add is_Seagate() logic in we can turn on and off printing the name
-    char *attributeName = (char *)calloc(MAX_ATTRIBUTE_NAME_LENGTH, sizeof(char));
-    if (attributeName == NULL)
-    {
-        perror("Calloc Failure!\n");
-        return;
-    }
-
+    eSeagateFamily family = is_Seagate_Family(device);
     for (uint8_t iter = 0; iter < 255; ++iter)
     {
         if (smartData->attributes.ataSMARTAttr.attributes[iter].valid)
         {
-            get_Attribute_Name(device, iter, &attributeName);
-
+            const char *attributeName = get_ATA_SMART_Attribute_Name(family, iter);
             if (smartData->attributes.ataSMARTAttr.attributes[iter].valid)
             {
-                if (strlen(attributeName))
+                if (attributeName)
                 {
                     printf("%u - %s\n", iter, attributeName);
                 }
@@ -771,7 +459,6 @@ static void print_Analyzed_ATA_Attributes(tDevice *device, smartLogData *smartDa
             }
         }
     }
-    safe_Free(attributeName);
 }
 
 int print_SMART_Attributes(tDevice *device, eSMARTAttrOutMode outputMode)
@@ -841,15 +528,273 @@ int print_SMART_Attributes(tDevice *device, eSMARTAttrOutMode outputMode)
     return ret;
 }
 
-int ata_SMART_Check(tDevice *device, ptrSmartTripInfo tripInfo)
+void fill_SMART_Attribute_Snapshot_From_Data(uint8_t *smartData, uint8_t *thresholdData, ptrSmartAttributeSnapshot snapshot)
+{
+    snapshot->attributeCount = 0;
+    for (uint16_t smartIter = ATA_SMART_BEGIN_ATTRIBUTES; smartIter < ATA_SMART_END_ATTRIBUTES && snapshot->attributeCount < SMART_SNAPSHOT_MAX_ATTRIBUTES; smartIter += ATA_SMART_ATTRIBUTE_SIZE)
+    {
+        ataSMARTAttribute *currentAttribute = (ataSMARTAttribute *)&smartData[smartIter];
+        if (currentAttribute->attributeNumber > 0 && currentAttribute->attributeNumber < 255)
+        {
+            ptrSmartAttributeSample sample = &snapshot->attributes[snapshot->attributeCount];
+            sample->attributeNumber = currentAttribute->attributeNumber;
+            sample->nominal = currentAttribute->nominal;
+            sample->worstEver = currentAttribute->worstEver;
+            sample->thresholdValue = 0;
+            sample->rawValue = M_BytesTo8ByteValue(0, currentAttribute->rawData[6], currentAttribute->rawData[5], currentAttribute->rawData[4], currentAttribute->rawData[3], currentAttribute->rawData[2], currentAttribute->rawData[1], currentAttribute->rawData[0]);
+            ++(snapshot->attributeCount);
+        }
+    }
+    snapshot->thresholdsValid = false;
+    if (thresholdData)
+    {
+        for (uint16_t smartIter = ATA_SMART_BEGIN_ATTRIBUTES; smartIter < ATA_SMART_END_ATTRIBUTES; smartIter += ATA_SMART_ATTRIBUTE_SIZE)
+        {
+            ataSMARTThreshold *currentThreshold = (ataSMARTThreshold*)&thresholdData[smartIter];
+            if (currentThreshold->attributeNumber > 0 && currentThreshold->attributeNumber < 255)
+            {
+                for (uint8_t attrIter = 0; attrIter < snapshot->attributeCount; ++attrIter)
+                {
+                    if (snapshot->attributes[attrIter].attributeNumber == currentThreshold->attributeNumber)
+                    {
+                        snapshot->attributes[attrIter].thresholdValue = currentThreshold->thresholdValue;
+                        break;
+                    }
+                }
+            }
+        }
+        snapshot->thresholdsValid = true;
+    }
+}
+
+int get_SMART_Attribute_Snapshot(tDevice *device, ptrSmartAttributeSnapshot previous, ptrSmartAttributeSnapshot snapshot)
+{
+    int ret = NOT_SUPPORTED;
+    if (!snapshot)
+    {
+        return BAD_PARAMETER;
+    }
+    memset(snapshot, 0, sizeof(smartAttributeSnapshot));
+    if (device->drive_info.drive_type == ATA_DRIVE && is_SMART_Enabled(device))
+    {
+        uint8_t smartData[LEGACY_DRIVE_SEC_SIZE] = { 0 };
+        snapshot->timestamp = (uint64_t)time(NULL);
+        ret = ata_SMART_Read_Data(device, smartData, LEGACY_DRIVE_SEC_SIZE);
+        if (ret == SUCCESS)
+        {
+            if (previous && previous->thresholdsValid)
+            {
+                fill_SMART_Attribute_Snapshot_From_Data(smartData, NULL, snapshot);
+                //thresholds don't change between polls, so save a command and carry them forward
+                for (uint8_t attrIter = 0; attrIter < snapshot->attributeCount; ++attrIter)
+                {
+                    for (uint8_t prevIter = 0; prevIter < previous->attributeCount; ++prevIter)
+                    {
+                        if (previous->attributes[prevIter].attributeNumber == snapshot->attributes[attrIter].attributeNumber)
+                        {
+                            snapshot->attributes[attrIter].thresholdValue = previous->attributes[prevIter].thresholdValue;
+                            break;
+                        }
+                    }
+                }
+                snapshot->thresholdsValid = true;
+            }
+            else
+            {
+                uint8_t thresholdData[LEGACY_DRIVE_SEC_SIZE] = { 0 };
+                if (SUCCESS == ata_SMART_Read_Thresholds(device, thresholdData, LEGACY_DRIVE_SEC_SIZE))
+                {
+                    fill_SMART_Attribute_Snapshot_From_Data(smartData, thresholdData, snapshot);
+                }
+                else
+                {
+                    fill_SMART_Attribute_Snapshot_From_Data(smartData, NULL, snapshot);
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+int allocate_SMART_Snapshot_History(ptrSmartSnapshotHistory history, const char *serialNumber, uint32_t capacity)
+{
+    if (!history || capacity == 0)
+    {
+        return BAD_PARAMETER;
+    }
+    memset(history, 0, sizeof(smartSnapshotHistory));
+    history->snapshots = (ptrSmartAttributeSnapshot)calloc(capacity, sizeof(smartAttributeSnapshot));
+    if (!history->snapshots)
+    {
+        return MEMORY_FAILURE;
+    }
+    history->capacity = capacity;
+    if (serialNumber)
+    {
+        strncpy(history->serialNumber, serialNumber, SERIAL_NUM_LEN);
+    }
+    return SUCCESS;
+}
+
+void free_SMART_Snapshot_History(ptrSmartSnapshotHistory history)
+{
+    if (history)
+    {
+        safe_Free(history->snapshots);
+        history->capacity = 0;
+        history->count = 0;
+        history->newest = 0;
+    }
+}
+
+int add_SMART_Snapshot_To_History(ptrSmartSnapshotHistory history, ptrSmartAttributeSnapshot snapshot)
+{
+    if (!history || !history->snapshots || !snapshot)
+    {
+        return BAD_PARAMETER;
+    }
+    if (history->count > 0)
+    {
+        history->newest = (history->newest + 1) % history->capacity;
+    }
+    memcpy(&history->snapshots[history->newest], snapshot, sizeof(smartAttributeSnapshot));
+    if (history->count < history->capacity)
+    {
+        ++(history->count);
+    }
+    return SUCCESS;
+}
+
+ptrSmartAttributeSnapshot get_Newest_SMART_Snapshot(ptrSmartSnapshotHistory history)
+{
+    if (!history || !history->snapshots || history->count == 0)
+    {
+        return NULL;
+    }
+    return &history->snapshots[history->newest];
+}
+
+static ptrSmartAttributeSample find_SMART_Snapshot_Attribute(ptrSmartAttributeSnapshot snapshot, uint8_t attributeNumber)
+{
+    for (uint8_t attrIter = 0; attrIter < snapshot->attributeCount; ++attrIter)
+    {
+        if (snapshot->attributes[attrIter].attributeNumber == attributeNumber)
+        {
+            return &snapshot->attributes[attrIter];
+        }
+    }
+    return NULL;
+}
+
+int get_SMART_Attribute_Delta(ptrSmartSnapshotHistory history, uint8_t attributeNumber, ptrSmartAttributeDelta delta)
+{
+    ptrSmartAttributeSnapshot oldestSnapshot = NULL, newestSnapshot = NULL;
+    ptrSmartAttributeSample oldest = NULL, newest = NULL;
+    if (!history || !history->snapshots || !delta)
+    {
+        return BAD_PARAMETER;
+    }
+    memset(delta, 0, sizeof(smartAttributeDelta));
+    delta->attributeNumber = attributeNumber;
+    //walk from the oldest snapshot forward and from the newest backward to find the widest window containing this attribute
+    for (uint32_t countIter = 0; countIter < history->count && !oldest; ++countIter)
+    {
+        oldestSnapshot = &history->snapshots[(history->newest + history->capacity - (history->count - 1) + countIter) % history->capacity];
+        oldest = find_SMART_Snapshot_Attribute(oldestSnapshot, attributeNumber);
+    }
+    for (uint32_t countIter = 0; countIter < history->count && !newest; ++countIter)
+    {
+        newestSnapshot = &history->snapshots[(history->newest + history->capacity - countIter) % history->capacity];
+        newest = find_SMART_Snapshot_Attribute(newestSnapshot, attributeNumber);
+    }
+    if (!oldest || !newest || oldestSnapshot == newestSnapshot || newestSnapshot->timestamp <= oldestSnapshot->timestamp)
+    {
+        return NOT_SUPPORTED;
+    }
+    delta->elapsedSeconds = newestSnapshot->timestamp - oldestSnapshot->timestamp;
+    delta->rawDelta = (int64_t)(newest->rawValue - oldest->rawValue);
+    delta->nominalDelta = (int16_t)newest->nominal - (int16_t)oldest->nominal;
+    delta->rawPerDay = (double)delta->rawDelta * 86400.0 / (double)delta->elapsedSeconds;
+    delta->nominalPerDay = (double)delta->nominalDelta * 86400.0 / (double)delta->elapsedSeconds;
+    delta->currentNominal = newest->nominal;
+    delta->thresholdValue = newest->thresholdValue;
+    //0 is always passing. FEh and FFh are above the largest nominal value (FDh) so they are always failing. None of these can be trended toward
+    if (newestSnapshot->thresholdsValid && newest->thresholdValue > 0 && newest->thresholdValue < 0xFE)
+    {
+        delta->thresholdValid = true;
+        if (newest->nominal <= newest->thresholdValue)
+        {
+            delta->trendingToThreshold = true;
+            delta->daysToThreshold = 0;
+        }
+        else if (delta->nominalPerDay < 0)
+        {
+            delta->trendingToThreshold = true;
+            delta->daysToThreshold = (double)(newest->nominal - newest->thresholdValue) / -delta->nominalPerDay;
+        }
+    }
+    return SUCCESS;
+}
+
+int find_SMART_Attributes_Trending_To_Threshold(ptrSmartSnapshotHistory histories, uint32_t numberOfHistories, uint32_t warningDays, ptrSmartTrendAlert alerts, uint32_t maxAlerts, uint32_t *alertCount)
+{
+    if (!histories || !alertCount || (!alerts && maxAlerts > 0))
+    {
+        return BAD_PARAMETER;
+    }
+    *alertCount = 0;
+    for (uint32_t historyIter = 0; historyIter < numberOfHistories; ++historyIter)
+    {
+        ptrSmartAttributeSnapshot newestSnapshot = get_Newest_SMART_Snapshot(&histories[historyIter]);
+        if (!newestSnapshot || histories[historyIter].count < 2 || !newestSnapshot->thresholdsValid)
+        {
+            continue;
+        }
+        for (uint8_t attrIter = 0; attrIter < newestSnapshot->attributeCount; ++attrIter)
+        {
+            smartAttributeDelta delta;
+            if (SUCCESS == get_SMART_Attribute_Delta(&histories[historyIter], newestSnapshot->attributes[attrIter].attributeNumber, &delta)
+                && delta.trendingToThreshold && delta.daysToThreshold <= (double)warningDays)
+            {
+                if (*alertCount < maxAlerts)
+                {
+                    alerts[*alertCount].historyIndex = historyIter;
+                    memcpy(&alerts[*alertCount].delta, &delta, sizeof(smartAttributeDelta));
+                }
+                ++(*alertCount);
+            }
+        }
+    }
+    return SUCCESS;
+}
+
+void print_SMART_Trend_Alerts(ptrSmartSnapshotHistory histories, ptrSmartTrendAlert alerts, uint32_t maxAlerts, uint32_t alertCount)
+{
+    if (!histories || !alerts)
+    {
+        return;
+    }
+    printf("Serial Number          Attr  Nominal  Thresh  Nominal/day  Raw/day       Days to Threshold\n");
+    for (uint32_t alertIter = 0; alertIter < M_Min(alertCount, maxAlerts); ++alertIter)
+    {
+        ptrSmartAttributeDelta delta = &alerts[alertIter].delta;
+        printf("%-20s   %3" PRIu8 "   %3" PRIu8 "      %3" PRIu8 "     %10.3f   %12.3f  ", histories[alerts[alertIter].historyIndex].serialNumber, delta->attributeNumber, delta->currentNominal, delta->thresholdValue, delta->nominalPerDay, delta->rawPerDay);
+        if (delta->daysToThreshold == 0)
+        {
+            printf("Threshold reached\n");
+        }
+        else
+        {
+            printf("%0.1f\n", delta->daysToThreshold);
+        }
+    }
+}
+
+int ata_SMART_Status_Check(tDevice *device, ptrSmartTripInfo tripInfo)
 {
     int ret = NOT_SUPPORTED; //command return value
     if (is_SMART_Enabled(device))
     {
-        bool readAttributes = false;
-        bool readThresholds = false;
-        uint8_t smartAttributes[ATA_SMART_READ_DATA_SIZE] = { 0 };
-        uint8_t smartThresholds[ATA_SMART_READ_DATA_SIZE] = { 0 };
         ret = ata_SMART_Return_Status(device);
         if (ret == SUCCESS)
         {
@@ -918,11 +863,20 @@ int ata_SMART_Check(tDevice *device, ptrSmartTripInfo tripInfo)
                 }
                 else
                 {
-                    //Last thing to try is to read the thresholds and attributes and compare them! (which we will do below anyways)
+                    //Last thing to try is to read the thresholds and attributes and compare them! (ata_SMART_Check does this)
                     ret = UNKNOWN;
                 }
             }
         }
+    }
+    return ret;
+}
+
+int ata_SMART_Check(tDevice *device, ptrSmartTripInfo tripInfo)
+{
+    int ret = ata_SMART_Status_Check(device, tripInfo);
+    if (ret != NOT_SUPPORTED)
+    {
         if ((ret == FAILURE && tripInfo) || ret == UNKNOWN)
         {
             smartLogData attributes;
@@ -950,9 +904,8 @@ int ata_SMART_Check(tDevice *device, ptrSmartTripInfo tripInfo)
                                     tripInfo->ataAttribute.attributeNumber = attributes.attributes.ataSMARTAttr.attributes[counter].data.attributeNumber;
                                     tripInfo->ataAttribute.nominalValue = attributes.attributes.ataSMARTAttr.attributes[counter].data.nominal;
                                     tripInfo->ataAttribute.thresholdValue = attributes.attributes.ataSMARTAttr.attributes[counter].thresholdData.thresholdValue;
-                                    char *attributeName = (char *)calloc(MAX_ATTRIBUTE_NAME_LENGTH, sizeof(char));
-                                    get_Attribute_Name(device, tripInfo->ataAttribute.attributeNumber, &attributeName);
-                                    if (strlen(attributeName))
+                                    const char *attributeName = get_ATA_SMART_Attribute_Name(is_Seagate_Family(device), tripInfo->ataAttribute.attributeNumber);
+                                    if (attributeName)
                                     {
                                         //use the name in the error reason
                                         snprintf(tripInfo->reasonString, UINT8_MAX, "%s [%" PRIu8 "] set to test trip!", attributeName, tripInfo->ataAttribute.attributeNumber);
@@ -977,9 +930,8 @@ int ata_SMART_Check(tDevice *device, ptrSmartTripInfo tripInfo)
                                     tripInfo->ataAttribute.attributeNumber = attributes.attributes.ataSMARTAttr.attributes[counter].data.attributeNumber;
                                     tripInfo->ataAttribute.nominalValue = attributes.attributes.ataSMARTAttr.attributes[counter].data.nominal;
                                     tripInfo->ataAttribute.thresholdValue = attributes.attributes.ataSMARTAttr.attributes[counter].thresholdData.thresholdValue;
-                                    char *attributeName = (char *)calloc(MAX_ATTRIBUTE_NAME_LENGTH, sizeof(char));
-                                    get_Attribute_Name(device, tripInfo->ataAttribute.attributeNumber, &attributeName);
-                                    if (strlen(attributeName))
+                                    const char *attributeName = get_ATA_SMART_Attribute_Name(is_Seagate_Family(device), tripInfo->ataAttribute.attributeNumber);
+                                    if (attributeName)
                                     {
                                         //use the name in the error reason
                                         snprintf(tripInfo->reasonString, UINT8_MAX, "%s [%" PRIu8 "] tripped! Nominal Value %" PRIu8 " below Threshold %" PRIu8 "", attributeName, tripInfo->ataAttribute.attributeNumber, tripInfo->ataAttribute.nominalValue, tripInfo->ataAttribute.thresholdValue);
@@ -1382,6 +1334,54 @@ int scsi_SMART_Check(tDevice *device, ptrSmartTripInfo tripInfo)
     return ret;
 }
 
+void set_NVMe_SMART_Trip_Info(uint8_t criticalWarning, ptrSmartTripInfo tripInfo)
+{
+    tripInfo->additionalInformationType = SMART_TRIP_INFO_TYPE_NVME;
+    tripInfo->informationIsValid = true;
+    if (criticalWarning & BIT0)
+    {
+        tripInfo->nvmeCriticalWarning.spareSpaceBelowThreshold = true;
+        sprintf(tripInfo->reasonString, "Available Spare Space has fallen below the threshold\0");
+        tripInfo->reasonStringLength = (uint8_t)strlen(tripInfo->reasonString);
+    }
+    if (criticalWarning & BIT1)
+    {
+        tripInfo->nvmeCriticalWarning.temperatureExceedsThreshold = true;
+        sprintf(tripInfo->reasonString, "Temperature is above an over termperature threshold or below an under temperature threshold\0");
+        tripInfo->reasonStringLength = (uint8_t)strlen(tripInfo->reasonString);
+    }
+    if (criticalWarning & BIT2)
+    {
+        tripInfo->nvmeCriticalWarning.nvmSubsystemDegraded = true;
+        sprintf(tripInfo->reasonString, "NVM subsystem reliability has been degraded due to significant media related errors or an internal error that degrades reliability\0");
+        tripInfo->reasonStringLength = (uint8_t)strlen(tripInfo->reasonString);
+    }
+    if (criticalWarning & BIT3)
+    {
+        tripInfo->nvmeCriticalWarning.mediaReadOnly = true;
+        sprintf(tripInfo->reasonString, "Media has been placed in read only mode\0");
+        tripInfo->reasonStringLength = (uint8_t)strlen(tripInfo->reasonString);
+    }
+    if (criticalWarning & BIT4)
+    {
+        tripInfo->nvmeCriticalWarning.volatileMemoryBackupFailed = true;
+        sprintf(tripInfo->reasonString, "Volatile Memory backup device has failed\0");
+        tripInfo->reasonStringLength = (uint8_t)strlen(tripInfo->reasonString);
+    }
+    if (criticalWarning & BIT5)
+    {
+        tripInfo->nvmeCriticalWarning.reservedBit5 = true;
+    }
+    if (criticalWarning & BIT6)
+    {
+        tripInfo->nvmeCriticalWarning.reservedBit6 = true;
+    }
+    if (criticalWarning & BIT7)
+    {
+        tripInfo->nvmeCriticalWarning.reservedBit7 = true;
+    }
+}
+
 #if !defined (DISABLE_NVME_PASSTHROUGH)
 int nvme_SMART_Check(tDevice *device, ptrSmartTripInfo tripInfo)
 {
@@ -1407,50 +1407,7 @@ int nvme_SMART_Check(tDevice *device, ptrSmartTripInfo tripInfo)
         }
         if (tripInfo && ret == FAILURE)
         {
-            tripInfo->additionalInformationType = SMART_TRIP_INFO_TYPE_NVME;
-            tripInfo->informationIsValid = true;
-            if (smartLogPage[0] & BIT0)
-            {
-                tripInfo->nvmeCriticalWarning.spareSpaceBelowThreshold = true;
-                sprintf(tripInfo->reasonString, "Available Spare Space has fallen below the threshold\0");
-                tripInfo->reasonStringLength = (uint8_t)strlen(tripInfo->reasonString);
-            }
-            if (smartLogPage[0] & BIT1)
-            {
-                tripInfo->nvmeCriticalWarning.temperatureExceedsThreshold = true;
-                sprintf(tripInfo->reasonString, "Temperature is above an over termperature threshold or below an under temperature threshold\0");
-                tripInfo->reasonStringLength = (uint8_t)strlen(tripInfo->reasonString);
-            }
-            if (smartLogPage[0] & BIT2)
-            {
-                tripInfo->nvmeCriticalWarning.nvmSubsystemDegraded = true;
-                sprintf(tripInfo->reasonString, "NVM subsystem reliability has been degraded due to significant media related errors or an internal error that degrades reliability\0");
-                tripInfo->reasonStringLength = (uint8_t)strlen(tripInfo->reasonString);
-            }
-            if (smartLogPage[0] & BIT3)
-            {
-                tripInfo->nvmeCriticalWarning.mediaReadOnly = true;
-                sprintf(tripInfo->reasonString, "Media has been placed in read only mode\0");
-                tripInfo->reasonStringLength = (uint8_t)strlen(tripInfo->reasonString);
-            }
-            if (smartLogPage[0] & BIT4)
-            {
-                tripInfo->nvmeCriticalWarning.volatileMemoryBackupFailed = true;
-                sprintf(tripInfo->reasonString, "Volatile Memory backup device has failed\0");
-                tripInfo->reasonStringLength = (uint8_t)strlen(tripInfo->reasonString);
-            }
-            if (smartLogPage[0] & BIT5)
-            {
-                tripInfo->nvmeCriticalWarning.reservedBit5 = true;
-            }
-            if (smartLogPage[0] & BIT6)
-            {
-                tripInfo->nvmeCriticalWarning.reservedBit6 = true;
-            }
-            if (smartLogPage[0] & BIT7)
-            {
-                tripInfo->nvmeCriticalWarning.reservedBit7 = true;
-            }
+            set_NVMe_SMART_Trip_Info(smartLogPage[0], tripInfo);
         }
     }
 
@@ -1926,6 +1883,7 @@ int enable_Disable_SMART_Feature(tDevice *device, bool enable)
             {
                 ret = ata_SMART_Disable_Operations(device);
             }
+            invalidate_Device_Page_Cache(device);//the enabled bit is in the identify data
         }
     }
     else if (device->drive_info.drive_type == SCSI_DRIVE)
@@ -2202,6 +2160,24 @@ int enable_Disable_SMART_Auto_Offline(tDevice *device, bool enable)
     return ret;
 }
 
+void fill_SMART_Info_From_Data(uint8_t *smartData, ptrSmartFeatureInfo smartInfo)
+{
+    smartInfo->smartVersion = M_BytesTo2ByteValue(smartData[1], smartData[0]);
+    //attributes?
+    smartInfo->offlineDataCollectionStatus = smartData[362];
+    smartInfo->selfTestExecutionStatus = smartData[363];
+    smartInfo->timeToCompleteOfflineDataCollection = M_BytesTo2ByteValue(smartData[365], smartData[364]);
+    //reserved/vendor specific
+    smartInfo->offlineDataCollectionCapability = smartData[367];
+    smartInfo->smartCapability = M_BytesTo2ByteValue(smartData[369], smartData[368]);
+    smartInfo->errorLoggingCapability = smartData[370];
+    smartInfo->vendorSpecific = smartData[371];
+    smartInfo->shortSelfTestPollingTime = smartData[372];
+    smartInfo->extendedSelfTestPollingTime = smartData[373];
+    smartInfo->conveyenceSelfTestPollingTime = smartData[374];
+    smartInfo->longExtendedSelfTestPollingTime = M_BytesTo2ByteValue(smartData[376], smartData[375]);
+}
+
 int get_SMART_Info(tDevice *device, ptrSmartFeatureInfo smartInfo)
 {
     int ret = NOT_SUPPORTED;
@@ -2219,20 +2195,7 @@ int get_SMART_Info(tDevice *device, ptrSmartFeatureInfo smartInfo)
             ret = ata_SMART_Read_Data(device, smartData, LEGACY_DRIVE_SEC_SIZE);
             if (SUCCESS == ret)
             {
-                smartInfo->smartVersion = M_BytesTo2ByteValue(smartData[1], smartData[0]);
-                //attributes?
-                smartInfo->offlineDataCollectionStatus = smartData[362];
-                smartInfo->selfTestExecutionStatus = smartData[363];
-                smartInfo->timeToCompleteOfflineDataCollection = M_BytesTo2ByteValue(smartData[365], smartData[364]);
-                //reserved/vendor specific
-                smartInfo->offlineDataCollectionCapability = smartData[367];
-                smartInfo->smartCapability = M_BytesTo2ByteValue(smartData[369], smartData[368]);
-                smartInfo->errorLoggingCapability = smartData[370];
-                smartInfo->vendorSpecific = smartData[371];
-                smartInfo->shortSelfTestPollingTime = smartData[372];
-                smartInfo->extendedSelfTestPollingTime = smartData[373];
-                smartInfo->conveyenceSelfTestPollingTime = smartData[374];
-                smartInfo->longExtendedSelfTestPollingTime = M_BytesTo2ByteValue(smartData[376], smartData[375]);
+                fill_SMART_Info_From_Data(smartData, smartInfo);
             }
         }
     }
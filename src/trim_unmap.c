@@ -12,6 +12,7 @@
 // \file trim_unmap.c
 
 #include "trim_unmap.h"
+#include "device_page_cache.h"
 
 bool is_Trim_Or_Unmap_Supported(tDevice *device, uint32_t *maxTrimOrUnmapBlockDescriptors, uint32_t *maxLBACount)
 {
@@ -50,7 +51,7 @@ bool is_Trim_Or_Unmap_Supported(tDevice *device, uint32_t *maxTrimOrUnmapBlockDe
                         perror("calloc failure!");
                         return supported;
                     }
-                    if (SUCCESS == scsi_Inquiry(device, blockLimits, VPD_BLOCK_LIMITS_LEN, BLOCK_LIMITS, true, false))
+                    if (SUCCESS == scsi_Inquiry_Cached(device, blockLimits, VPD_BLOCK_LIMITS_LEN, BLOCK_LIMITS, true))
                     {
                         *maxTrimOrUnmapBlockDescriptors = M_BytesTo4ByteValue(blockLimits[24], blockLimits[25], blockLimits[26], blockLimits[27]);
                         *maxLBACount = M_BytesTo4ByteValue(blockLimits[20], blockLimits[21], blockLimits[22], blockLimits[23]);
@@ -71,7 +72,7 @@ bool is_Trim_Or_Unmap_Supported(tDevice *device, uint32_t *maxTrimOrUnmapBlockDe
             perror("calloc failure!");
             return false;
         }
-        if (SUCCESS == scsi_Inquiry(device, lbpPage, VPD_LOGICAL_BLOCK_PROVISIONING_LEN, LOGICAL_BLOCK_PROVISIONING, true, false))
+        if (SUCCESS == scsi_Inquiry_Cached(device, lbpPage, VPD_LOGICAL_BLOCK_PROVISIONING_LEN, LOGICAL_BLOCK_PROVISIONING, true))
         {
             if ((lbpPage[5] & BIT7) > 0)
             {
@@ -87,7 +88,7 @@ bool is_Trim_Or_Unmap_Supported(tDevice *device, uint32_t *maxTrimOrUnmapBlockDe
                 perror("calloc failure!");
                 return supported;
             }
-            if (SUCCESS == scsi_Inquiry(device, blockLimits, VPD_BLOCK_LIMITS_LEN, BLOCK_LIMITS, true, false))
+            if (SUCCESS == scsi_Inquiry_Cached(device, blockLimits, VPD_BLOCK_LIMITS_LEN, BLOCK_LIMITS, true))
             {
                 *maxTrimOrUnmapBlockDescriptors = M_BytesTo4ByteValue(blockLimits[24], blockLimits[25], blockLimits[26], blockLimits[27]);
                 *maxLBACount = M_BytesTo4ByteValue(blockLimits[20], blockLimits[21], blockLimits[22], blockLimits[23]);
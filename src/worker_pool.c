@@ -0,0 +1,190 @@
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2012 - 2017 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file worker_pool.c
+// \brief This file defines the locks, threads and worker pool shared by the operations in this library that do work on more than one thread.
+
+#include "operations_Common.h"
+#include "worker_pool.h"
+
+void init_Worker_Lock(workerLock *lock)
+{
+#if defined (_WIN32)
+    InitializeSRWLock(lock);
+#else
+    pthread_mutex_init(lock, NULL);
+#endif
+}
+
+void destroy_Worker_Lock(workerLock *lock)
+{
+#if defined (_WIN32)
+    //nothing to free for a slim reader/writer lock
+    (void)lock;
+#else
+    pthread_mutex_destroy(lock);
+#endif
+}
+
+void acquire_Worker_Lock(workerLock *lock)
+{
+#if defined (_WIN32)
+    AcquireSRWLockExclusive(lock);
+#else
+    pthread_mutex_lock(lock);
+#endif
+}
+
+void release_Worker_Lock(workerLock *lock)
+{
+#if defined (_WIN32)
+    ReleaseSRWLockExclusive(lock);
+#else
+    pthread_mutex_unlock(lock);
+#endif
+}
+
+void init_Worker_Condition(workerCondition *condition)
+{
+#if defined (_WIN32)
+    InitializeConditionVariable(condition);
+#else
+    pthread_cond_init(condition, NULL);
+#endif
+}
+
+void destroy_Worker_Condition(workerCondition *condition)
+{
+#if defined (_WIN32)
+    (void)condition;
+#else
+    pthread_cond_destroy(condition);
+#endif
+}
+
+void wait_Worker_Condition(workerCondition *condition, workerLock *lock)
+{
+#if defined (_WIN32)
+    SleepConditionVariableSRW(condition, lock, INFINITE, 0);
+#else
+    pthread_cond_wait(condition, lock);
+#endif
+}
+
+void signal_Worker_Condition(workerCondition *condition)
+{
+#if defined (_WIN32)
+    WakeConditionVariable(condition);
+#else
+    pthread_cond_signal(condition);
+#endif
+}
+
+#if defined (_WIN32)
+static DWORD WINAPI worker_Thread_Start(LPVOID thread)
+{
+    ((workerThread*)thread)->function(((workerThread*)thread)->parameter);
+    return 0;
+}
+#else
+static void* worker_Thread_Start(void *thread)
+{
+    ((workerThread*)thread)->function(((workerThread*)thread)->parameter);
+    return NULL;
+}
+#endif
+
+bool start_Worker_Thread(workerThread *thread, workerThreadFunction function, void *parameter)
+{
+    if (!thread || !function)
+    {
+        return false;
+    }
+    thread->function = function;
+    thread->parameter = parameter;
+#if defined (_WIN32)
+    thread->handle = CreateThread(NULL, 0, worker_Thread_Start, thread, 0, NULL);
+    return thread->handle != NULL;
+#else
+    return 0 == pthread_create(&thread->handle, NULL, worker_Thread_Start, thread);
+#endif
+}
+
+void join_Worker_Thread(workerThread *thread)
+{
+#if defined (_WIN32)
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+    thread->handle = NULL;
+#else
+    pthread_join(thread->handle, NULL);
+#endif
+}
+
+bool get_Next_Worker_Pool_Item(ptrWorkerPool pool, uint32_t *item)
+{
+    bool gotItem = false;
+    acquire_Worker_Lock(&pool->nextItemLock);
+    if (pool->nextItem < pool->endItem)
+    {
+        *item = pool->nextItem;
+        pool->nextItem++;
+        gotItem = true;
+    }
+    release_Worker_Lock(&pool->nextItemLock);
+    return gotItem;
+}
+
+static void worker_Pool_Thread(void *pool)
+{
+    ((ptrWorkerPool)pool)->function((ptrWorkerPool)pool, ((ptrWorkerPool)pool)->poolData);
+}
+
+void run_Worker_Pool(uint32_t firstItem, uint32_t endItem, uint32_t maxWorkers, workerPoolFunction function, void *poolData)
+{
+    workerPool pool;
+    workerThread *workers = NULL;
+    uint32_t workersStarted = 0;
+    if (!function || firstItem >= endItem)
+    {
+        return;
+    }
+    memset(&pool, 0, sizeof(workerPool));
+    init_Worker_Lock(&pool.nextItemLock);
+    pool.nextItem = firstItem;
+    pool.endItem = endItem;
+    pool.function = function;
+    pool.poolData = poolData;
+    maxWorkers = M_Min(maxWorkers, endItem - firstItem);
+    if (maxWorkers > 0)
+    {
+        workers = (workerThread*)calloc(maxWorkers, sizeof(workerThread));
+    }
+    for (; workers && workersStarted < maxWorkers; ++workersStarted)
+    {
+        if (!start_Worker_Thread(&workers[workersStarted], worker_Pool_Thread, &pool))
+        {
+            break;
+        }
+    }
+    if (workersStarted == 0)
+    {
+        //could not start any threads. Do the work on this thread instead.
+        function(&pool, poolData);
+    }
+    //any workers that did start will finish every item between them
+    for (uint32_t workerIter = 0; workerIter < workersStarted; ++workerIter)
+    {
+        join_Worker_Thread(&workers[workerIter]);
+    }
+    safe_Free(workers);
+    destroy_Worker_Lock(&pool.nextItemLock);
+}
@@ -13,6 +13,7 @@
 // \brief This file defines the functions related to the writesame command on a drive
 
 #include "writesame.h"
+#include "device_page_cache.h"
 
 bool is_Write_Same_Supported(tDevice *device, uint64_t startingLBA, uint64_t requesedNumberOfLogicalBlocks, uint64_t *maxNumberOfLogicalBlocksPerCommand)
 {
@@ -50,7 +51,7 @@ bool is_Write_Same_Supported(tDevice *device, uint64_t startingLBA, uint64_t req
             perror("Error allocating memory to check block limits VPD page");
             return false;
         }
-        if (SUCCESS == scsi_Inquiry(device, blockLimits, VPD_BLOCK_LIMITS_LEN, BLOCK_LIMITS, true, false) && maxNumberOfLogicalBlocksPerCommand)
+        if (SUCCESS == scsi_Inquiry_Cached(device, blockLimits, VPD_BLOCK_LIMITS_LEN, BLOCK_LIMITS, true) && maxNumberOfLogicalBlocksPerCommand)
         {
             *maxNumberOfLogicalBlocksPerCommand = M_BytesTo8ByteValue(blockLimits[36], blockLimits[37], blockLimits[38], blockLimits[39], blockLimits[40], blockLimits[41], blockLimits[42], blockLimits[43]);
             if (*maxNumberOfLogicalBlocksPerCommand > requesedNumberOfLogicalBlocks && (device->drive_info.deviceMaxLba - startingLBA) >= requesedNumberOfLogicalBlocks)